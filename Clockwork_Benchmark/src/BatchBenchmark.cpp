@@ -0,0 +1,84 @@
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "Benchmark.h"
+#include "src\Maths\Batch.h"
+#include "src\Maths\Quat.h"
+
+namespace benchmark {
+
+	using namespace clockwork;
+
+	/*compares the batch kernels from Batch.h with loops over the single point versions for 4096 points | the times are per batch of all points
+	the loops over single points already use the simd Mat4f*Vec3f, so the speedup is only from the batching*/
+	void batchBenchmark() noexcept
+	{
+		const unsigned int count = 4096;
+		const unsigned int rounds = 2000;
+		std::vector<float> values = randomFloats(count * 6, -100.0f, 100.0f);
+		std::vector<maths::Vec3f> positions(count);
+		std::vector<maths::Vec3f> sizes(count);
+		std::vector<float> x(count), y(count), z(count);
+		for ( unsigned int i = 0; i < count; ++i )
+		{
+			positions[i] = maths::Vec3f(values[i * 6], values[i * 6 + 1], values[i * 6 + 2]);
+			sizes[i] = maths::Vec3f(maths::abs(values[i * 6 + 3]) * 0.1f, maths::abs(values[i * 6 + 4]) * 0.1f, maths::abs(values[i * 6 + 5]) * 0.1f);
+			x[i] = positions[i].x;
+			y[i] = positions[i].y;
+			z[i] = positions[i].z;
+		}
+		const maths::Mat4f matrix = maths::Quatf::eulerD(maths::Vec3f(30, 45, 60)).toMatrix(maths::Vec3f(1.5f, 0.5f, 2.0f), maths::Vec3f(10, 20, 30));
+		const maths::Vec3f camera(5, 10, 15);
+		std::vector<maths::Vec3f> results(count);
+		std::vector<maths::Vec3f> maxResults(count);
+		std::vector<float> outX(count), outY(count), outZ(count), distances(count);
+
+		double single = measure("transform points single", 1, rounds, [&](unsigned int) { for ( unsigned int i = 0; i < count; ++i ) results[i] = matrix * positions[i]; });
+		double batch = measure("transformPoints", 1, rounds, [&](unsigned int) { maths::transformPoints(matrix, positions.data(), results.data(), count); });
+		printSpeedup(single, batch);
+		batch = measure("transformPoints x/y/z arrays", 1, rounds, [&](unsigned int) { maths::transformPoints(matrix, x.data(), y.data(), z.data(), outX.data(), outY.data(), outZ.data(), count); });
+		printSpeedup(single, batch);
+		sink = sink + results[count / 2].x + outX[count / 2];
+
+		single = measure("aabb 8 corners single", 1, rounds, [&](unsigned int)
+		{
+			for ( unsigned int i = 0; i < count; ++i )
+			{
+				maths::Vec3f min = matrix * positions[i];
+				maths::Vec3f max = min;
+				for ( unsigned int corner = 1; corner < 8; ++corner )
+				{
+					maths::Vec3f point = matrix * maths::Vec3f(corner & 1 ? positions[i].x + sizes[i].x : positions[i].x, corner & 2 ? positions[i].y + sizes[i].y : positions[i].y, corner & 4 ? positions[i].z + sizes[i].z : positions[i].z);
+					min = maths::Vec3f(maths::min(min.x, point.x), maths::min(min.y, point.y), maths::min(min.z, point.z));
+					max = maths::Vec3f(maths::max(max.x, point.x), maths::max(max.y, point.y), maths::max(max.z, point.z));
+				}
+				results[i] = min;
+				maxResults[i] = max;
+			}
+		});
+		batch = measure("transformAabb single", 1, rounds, [&](unsigned int) { for ( unsigned int i = 0; i < count; ++i ) maths::transformAabb(matrix, positions[i], positions[i] + sizes[i], results[i], maxResults[i]); });
+		printSpeedup(single, batch);
+		for ( unsigned int i = 0; i < count; ++i )
+			sizes[i] += positions[i];//the maximums for the batch version
+		batch = measure("transformAabbs", 1, rounds, [&](unsigned int) { maths::transformAabbs(matrix, positions.data(), sizes.data(), results.data(), maxResults.data(), count); });
+		printSpeedup(single, batch);
+		sink = sink + results[count / 2].x + maxResults[count / 2].x;
+
+		single = measure("distance single", 1, rounds, [&](unsigned int) { for ( unsigned int i = 0; i < count; ++i ) distances[i] = positions[i].distance(camera); });
+		batch = measure("distancesSquared", 1, rounds, [&](unsigned int) { maths::distancesSquared(camera, positions.data(), distances.data(), count); });
+		printSpeedup(single, batch);
+		batch = measure("distancesSquared x/y/z arrays", 1, rounds, [&](unsigned int) { maths::distancesSquared(camera, x.data(), y.data(), z.data(), distances.data(), count); });
+		printSpeedup(single, batch);
+		sink = sink + distances[count / 2];
+	}
+
+}
@@ -0,0 +1,75 @@
+#pragma once
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+/*small helpers for the benchmarks | every benchmark prints the nanoseconds per call of each variant, so they can be compared in one run
+one value of the results is added to a volatile sink after each benchmark, so the compiler can not remove the loops*/
+namespace benchmark {
+
+	extern volatile float sink;
+
+	/*calls function(i) for i = 0 to count-1 in a loop repeated rounds times and prints the time per call | returns the nanoseconds per call
+	the loop is measured 5 times and the fastest time is used, so interruptions of the os do not count | the first loop is not measured, so the caches are warm
+	the function should store its results in memory, which is read after the benchmark, otherwise the compiler can remove the calls
+	if one call handles more elements(for example a whole array), the time is divided by elementsPerCall, so it can be compared with the single versions*/
+	template<typename Function> double measure(const char* name, unsigned int count, unsigned int rounds, Function function, unsigned int elementsPerCall = 1) noexcept
+	{
+		for ( unsigned int i = 0; i < count; ++i )
+			function(i);
+		double nanoseconds = 0;
+		for ( unsigned int repeat = 0; repeat < 5; ++repeat )
+		{
+			auto start = std::chrono::high_resolution_clock::now();
+			for ( unsigned int round = 0; round < rounds; ++round )
+			{
+				for ( unsigned int i = 0; i < count; ++i )
+					function(i);
+			}
+			auto end = std::chrono::high_resolution_clock::now();
+			double time = std::chrono::duration<double, std::nano>(end - start).count() / ( static_cast<double>( count ) * rounds * elementsPerCall );
+			if ( repeat == 0 || time < nanoseconds )
+				nanoseconds = time;
+		}
+		std::cout << "  " << std::left << std::setw(40) << name << std::right << std::fixed << std::setprecision(2) << std::setw(10) << nanoseconds << " ns" << std::endl;
+		return nanoseconds;
+	}
+
+	//prints how many times faster the optimised variant is than the reference
+	inline void printSpeedup(double reference, double optimised) noexcept
+	{
+		std::cout << "  " << std::left << std::setw(40) << "speedup" << std::right << std::fixed << std::setprecision(2) << std::setw(10) << reference / optimised << " x" << std::endl;
+	}
+
+	//uniform random floats between min and max with a fixed seed, so every run uses the same data
+	inline std::vector<float> randomFloats(unsigned int count, float min, float max) noexcept
+	{
+		std::mt19937 generator(1337);
+		std::uniform_real_distribution<float> distribution(min, max);
+		std::vector<float> values(count);
+		for ( auto& value : values )
+			value = distribution(generator);
+		return values;
+	}
+
+	void matrixBenchmark() noexcept;
+	void batchBenchmark() noexcept;
+	void trigonometryBenchmark() noexcept;
+	void vectorBenchmark() noexcept;
+	void entityBenchmark() noexcept;
+
+}
@@ -0,0 +1,100 @@
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "Benchmark.h"
+#include <memory>
+#include <thread>
+#include "src\Logics\Entities\EntityStorage.h"
+
+namespace benchmark {
+
+	using namespace clockwork;
+
+	namespace {
+
+		/*the gameobject/tick listener layout for the comparison: every entity is its own heap object with a virtual base and is ticked with one virtual call through a pointer list like the chunks do*/
+		struct ReferenceObject
+		{
+			maths::Vec3f size;
+			maths::Quatf rotation;
+			maths::Vec3f position;
+			maths::Mat4f modelMatrix;
+			virtual ~ReferenceObject() noexcept
+			{}
+		};
+
+		struct ReferenceTickListener
+			: public virtual ReferenceObject
+		{
+			maths::Vec3f velocity;
+			virtual void fastTick(float time) noexcept = 0;
+		};
+
+		struct ReferenceBlock
+			: public ReferenceTickListener
+		{
+			void fastTick(float time) noexcept override
+			{
+				position += velocity * time;
+				modelMatrix = rotation.toMatrix(size, position);
+			}
+		};
+
+	}
+
+	/*ticks 25000 moving blocks: position += velocity * time and the modelmatrix is composed again | the times are per block
+	compares the virtual fastTick() of heap objects in a pointer list with the movement system of the entitystorage on one thread and on all threads of the storage*/
+	void entityBenchmark() noexcept
+	{
+		const unsigned int count = 25000;
+		const unsigned int rounds = 100;
+		const float time = 0.016f;
+		std::vector<float> values = randomFloats(count * 6, -10.0f, 10.0f);
+		std::vector<std::unique_ptr<ReferenceBlock>> objects;
+		std::vector<ReferenceTickListener*> tickList;
+		logics::EntityStorage singleStorage;
+		logics::EntityStorage parallelStorage(std::thread::hardware_concurrency() > 1 ? std::thread::hardware_concurrency() - 1 : 1);
+		const unsigned int components = logics::EntityStorage::transformComponent | logics::EntityStorage::velocityComponent;
+		for ( unsigned int i = 0; i < count; ++i )
+		{
+			maths::Vec3f position(values[i * 6], values[i * 6 + 1], values[i * 6 + 2]);
+			maths::Vec3f velocity(values[i * 6 + 3], values[i * 6 + 4], values[i * 6 + 5]);
+			objects.push_back(std::unique_ptr<ReferenceBlock>(new ReferenceBlock()));
+			objects.back()->size = maths::Vec3f(1, 1, 1);
+			objects.back()->position = position;
+			objects.back()->velocity = velocity;
+			tickList.push_back(objects.back().get());
+			logics::Entity single = singleStorage.create(components, maths::Vec3f(1, 1, 1), maths::Quatf(), position);
+			singleStorage.setVelocity(single, velocity);
+			logics::Entity parallel = parallelStorage.create(components, maths::Vec3f(1, 1, 1), maths::Quatf(), position);
+			parallelStorage.setVelocity(parallel, velocity);
+		}
+
+		double reference = measure("virtual fastTick per gameobject", 1, rounds, [&](unsigned int)
+		{
+			for ( auto listener : tickList )
+				listener->fastTick(time);
+		}, count);
+		double single = measure("entitystorage fastTick 1 thread", 1, rounds, [&](unsigned int)
+		{
+			singleStorage.fastTick(time);
+		}, count);
+		printSpeedup(reference, single);
+		double parallel = measure("entitystorage fastTick all threads", 1, rounds, [&](unsigned int)
+		{
+			parallelStorage.fastTick(time);
+		}, count);
+		printSpeedup(reference, parallel);
+		sink = sink + objects[count / 2]->position.x + singleStorage.getTables().front().positions[count / 2].x + parallelStorage.getTables().front().positions[count / 2].x;
+	}
+
+}
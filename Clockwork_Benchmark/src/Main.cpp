@@ -0,0 +1,64 @@
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "Benchmark.h"
+#include "src\Maths\Simd.h"
+#include <string>
+
+/*the benchmark compares the optimised maths kernels of the engine with the generic versions they replaced
+usage: Clockwork_Benchmark [name = all]
+build it in release, because the debug build does not inline anything | the simd level depends on the /arch option of the build(see Simd.h)*/
+
+namespace benchmark {
+
+	volatile float sink = 0;
+
+}
+
+struct BenchmarkEntry
+{
+	const char* name;
+	void(*function)() noexcept;
+};
+
+int main(int argc, char** argv)
+{
+	const BenchmarkEntry benchmarks[] {
+		{ "matrix", &benchmark::matrixBenchmark },
+		{ "batch", &benchmark::batchBenchmark },
+		{ "sincos", &benchmark::trigonometryBenchmark },
+		{ "vector", &benchmark::vectorBenchmark },
+		{ "entities", &benchmark::entityBenchmark }
+	};
+	std::string selected = argc > 1 ? argv[1] : "all";
+	std::cout << "CLOCKWORK_SIMD " << CLOCKWORK_SIMD << std::endl;
+
+	bool found = false;
+	for ( const auto& entry : benchmarks )
+	{
+		if ( selected == "all" || selected == entry.name )
+		{
+			std::cout << entry.name << ":" << std::endl;
+			entry.function();
+			found = true;
+		}
+	}
+	if ( !found )
+	{
+		std::cout << "usage: Clockwork_Benchmark [name = all]" << std::endl << "benchmarks:";
+		for ( const auto& entry : benchmarks )
+			std::cout << " " << entry.name;
+		std::cout << std::endl;
+		return 1;
+	}
+	return 0;
+}
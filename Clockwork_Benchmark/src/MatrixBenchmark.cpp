@@ -0,0 +1,77 @@
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "Benchmark.h"
+#include "src\Maths\Mat4x4.h"
+#include "src\Maths\Quat.h"
+
+namespace benchmark {
+
+	using namespace clockwork;
+
+	/*compares the Mat4f kernels from Mat4x4Simd.h with the generic template versions on 4096 random matrices, which fit into the l2 cache
+	the affine matrices are modelmatrices(rotation, scaling and translation) like the ones of the gameobjects*/
+	void matrixBenchmark() noexcept
+	{
+		const unsigned int count = 4096;
+		const unsigned int rounds = 50;
+		std::vector<float> values = randomFloats(count * 16 + count * 4, -10.0f, 10.0f);
+		std::vector<maths::Mat4f> matrices(count);
+		std::vector<maths::Mat4f> affine(count);
+		std::vector<maths::Vec4f> vectors(count);
+		std::vector<maths::Vec3f> positions(count);
+		for ( unsigned int i = 0; i < count; ++i )
+		{
+			for ( unsigned int j = 0; j < 16; ++j )
+				matrices[i].data[j] = values[i * 16 + j];
+			const float* v = &values[count * 16 + i * 4];
+			vectors[i] = maths::Vec4f(v[0], v[1], v[2], v[3]);
+			positions[i] = maths::Vec3f(v[0], v[1], v[2]);
+			affine[i] = maths::Quatf::eulerD(maths::Vec3f(v[0] * 18, v[1] * 18, v[2] * 18)).toMatrix(maths::Vec3f(1.5f, 0.5f, 2.0f), positions[i]);
+		}
+		std::vector<maths::Mat4f> results(count);
+		std::vector<maths::Vec4f> vectorResults(count);
+		std::vector<maths::Vec3f> positionResults(count);
+
+		double generic = measure("Mat4f * Mat4f generic", count, rounds, [&](unsigned int i) { results[i] = maths::Mat4f::genericProduct(matrices[i], matrices[count - 1 - i]); });
+		double simd = measure("Mat4f * Mat4f", count, rounds, [&](unsigned int i) { results[i] = matrices[i] * matrices[count - 1 - i]; });
+		printSpeedup(generic, simd);
+		sink = sink + results[count / 2].x1;
+
+		generic = measure("Mat4f * Vec4f generic", count, rounds, [&](unsigned int i) { vectorResults[i] = maths::Mat4f::genericTransform(matrices[i], vectors[i]); });
+		simd = measure("Mat4f * Vec4f", count, rounds, [&](unsigned int i) { vectorResults[i] = matrices[i] * vectors[i]; });
+		printSpeedup(generic, simd);
+		sink = sink + vectorResults[count / 2].x;
+
+		generic = measure("Mat4f * Vec3f generic", count, rounds, [&](unsigned int i) { positionResults[i] = maths::Mat4f::genericTransform(matrices[i], positions[i]); });
+		simd = measure("Mat4f * Vec3f", count, rounds, [&](unsigned int i) { positionResults[i] = matrices[i] * positions[i]; });
+		printSpeedup(generic, simd);
+		sink = sink + positionResults[count / 2].x;
+
+		generic = measure("transpose generic", count, rounds, [&](unsigned int i) { results[i] = matrices[i].genericTranspose(); });
+		simd = measure("transpose", count, rounds, [&](unsigned int i) { results[i] = matrices[i].transpose(); });
+		printSpeedup(generic, simd);
+		sink = sink + results[count / 2].x1;
+
+		generic = measure("inverse generic", count, rounds, [&](unsigned int i) { results[i] = matrices[i].genericInverse(); });
+		simd = measure("inverse", count, rounds, [&](unsigned int i) { results[i] = matrices[i].inverse(); });
+		printSpeedup(generic, simd);
+		sink = sink + results[count / 2].x1;
+
+		generic = measure("affine inverse generic inverse", count, rounds, [&](unsigned int i) { results[i] = affine[i].genericInverse(); });
+		measure("affine inverse generic", count, rounds, [&](unsigned int i) { results[i] = affine[i].genericAffineInverse(); });
+		simd = measure("affine inverse", count, rounds, [&](unsigned int i) { results[i] = affine[i].affineInverse(); });
+		printSpeedup(generic, simd);
+		sink = sink + results[count / 2].x1;
+	}
+
+}
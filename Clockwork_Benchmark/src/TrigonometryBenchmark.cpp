@@ -0,0 +1,57 @@
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include <cmath>
+#include "Benchmark.h"
+#include "src\Maths\MathFunctions.h"
+
+namespace benchmark {
+
+	using namespace clockwork;
+
+	/*compares sincos() from Trigonometry.h with std::sin/std::cos and the old lookup tables of whole degrees for 4096 random angles from -2pi to 2pi
+	the table version needs whole degrees, so its angles are rounded before, like the rotations did before*/
+	void trigonometryBenchmark() noexcept
+	{
+		const unsigned int count = 4096;
+		const unsigned int rounds = 50;
+		std::vector<float> angles = randomFloats(count, -6.3f, 6.3f);
+		std::vector<double> doubleAngles(angles.begin(), angles.end());
+		std::vector<unsigned int> degrees(count);
+		std::vector<double> sintable(360), costable(360);
+		for ( unsigned int i = 0; i < 360; ++i )
+		{
+			sintable[i] = std::sin(maths::toRadians<double>(i));
+			costable[i] = std::cos(maths::toRadians<double>(i));
+		}
+		for ( unsigned int i = 0; i < count; ++i )
+			degrees[i] = static_cast<unsigned int>( maths::toDegrees(angles[i]) + 360.5f );
+		std::vector<float> sin(count), cos(count);
+		std::vector<double> doubleSin(count), doubleCos(count);
+
+		double reference = measure("float std::sin + std::cos", count, rounds, [&](unsigned int i) { sin[i] = std::sin(angles[i]); cos[i] = std::cos(angles[i]); });
+		measure("float lookup table", count, rounds, [&](unsigned int i) { sin[i] = static_cast<float>( sintable[degrees[i] % 360] ); cos[i] = static_cast<float>( costable[degrees[i] % 360] ); });
+		double optimised = measure("float sincos", count, rounds, [&](unsigned int i) { maths::sincos(angles[i], sin[i], cos[i]); });
+		printSpeedup(reference, optimised);
+		optimised = measure("float sincos array", 1, rounds, [&](unsigned int) { maths::sincos(angles.data(), sin.data(), cos.data(), count); }, count);
+		printSpeedup(reference, optimised);
+		sink = sink + sin[count / 2] + cos[count / 2];
+
+		reference = measure("double std::sin + std::cos", count, rounds, [&](unsigned int i) { doubleSin[i] = std::sin(doubleAngles[i]); doubleCos[i] = std::cos(doubleAngles[i]); });
+		optimised = measure("double sincos", count, rounds, [&](unsigned int i) { maths::sincos(doubleAngles[i], doubleSin[i], doubleCos[i]); });
+		printSpeedup(reference, optimised);
+		optimised = measure("double sincos array", 1, rounds, [&](unsigned int) { maths::sincos(doubleAngles.data(), doubleSin.data(), doubleCos.data(), count); }, count);
+		printSpeedup(reference, optimised);
+		sink = sink + static_cast<float>( doubleSin[count / 2] + doubleCos[count / 2] );
+	}
+
+}
@@ -0,0 +1,118 @@
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "Benchmark.h"
+#include "src\Maths\Vec3.h"
+
+namespace benchmark {
+
+	using namespace clockwork;
+
+	namespace {
+
+		/*the old Vec3 operators for the comparison: user provided copy/move constructors and rvalue references returned from the operators
+		the result of a chain like a + b * t - c is one of the temporaries, which is moved into the target at the end*/
+		struct ReferenceVec3
+		{
+			float x, y, z;
+			ReferenceVec3() noexcept
+				: x(0), y(0), z(0)
+			{}
+			ReferenceVec3(float x, float y, float z) noexcept
+				: x(x), y(y), z(z)
+			{}
+			ReferenceVec3(const ReferenceVec3& other) noexcept
+				: x(other.x), y(other.y), z(other.z)
+			{}
+			ReferenceVec3(ReferenceVec3&& other) noexcept
+				: x(std::move(other.x)), y(std::move(other.y)), z(std::move(other.z))
+			{}
+			ReferenceVec3& operator=(const ReferenceVec3& other) noexcept
+			{
+				x = other.x;
+				y = other.y;
+				z = other.z;
+				return *this;
+			}
+			ReferenceVec3& operator=(ReferenceVec3&& other) noexcept
+			{
+				x = std::move(other.x);
+				y = std::move(other.y);
+				z = std::move(other.z);
+				return *this;
+			}
+			friend ReferenceVec3 operator*(const ReferenceVec3& vec, float val) noexcept
+			{
+				return ReferenceVec3(vec.x * val, vec.y * val, vec.z * val);
+			}
+			friend ReferenceVec3&& operator+(const ReferenceVec3& v1, ReferenceVec3&& v2) noexcept
+			{
+				v2.x += v1.x;
+				v2.y += v1.y;
+				v2.z += v1.z;
+				return std::move(v2);
+			}
+			friend ReferenceVec3&& operator-(ReferenceVec3&& v1, ReferenceVec3&& v2) noexcept
+			{
+				v1.x -= v2.x;
+				v1.y -= v2.y;
+				v1.z -= v2.z;
+				return std::move(v1);
+			}
+		};
+
+	}
+
+	/*the physics integration loop of moving entities for 25000 bodies: velocity = velocity + gravity * time - velocity * drag; position = position + velocity * time;
+	compares the old rvalue reference operators with the value operators of Vec3 | the times are per body
+	the value version keeps every temporary in registers and loads and stores each body once | the old version can only do that if the compiler sees through the moves of the temporaries
+	compare the disassembly of both loops in the release build to see the loads and stores of the temporaries*/
+	void vectorBenchmark() noexcept
+	{
+		const unsigned int count = 25000;
+		const unsigned int rounds = 200;
+		const float time = 0.016f;
+		const float drag = 0.1f * time;
+		std::vector<float> values = randomFloats(count * 6, -10.0f, 10.0f);
+		std::vector<ReferenceVec3> referencePositions(count), referenceVelocities(count);
+		std::vector<maths::Vec3f> positions(count), velocities(count);
+		for ( unsigned int i = 0; i < count; ++i )
+		{
+			referencePositions[i] = ReferenceVec3(values[i * 6], values[i * 6 + 1], values[i * 6 + 2]);
+			referenceVelocities[i] = ReferenceVec3(values[i * 6 + 3], values[i * 6 + 4], values[i * 6 + 5]);
+			positions[i] = maths::Vec3f(values[i * 6], values[i * 6 + 1], values[i * 6 + 2]);
+			velocities[i] = maths::Vec3f(values[i * 6 + 3], values[i * 6 + 4], values[i * 6 + 5]);
+		}
+		const ReferenceVec3 referenceGravity(0, -9.81f, 0);
+		const maths::Vec3f gravity(0, -9.81f, 0);
+
+		double reference = measure("integrate rvalue reference operators", 1, rounds, [&](unsigned int)
+		{
+			for ( unsigned int i = 0; i < count; ++i )
+			{
+				referenceVelocities[i] = referenceVelocities[i] + referenceGravity * time - referenceVelocities[i] * drag;
+				referencePositions[i] = referencePositions[i] + referenceVelocities[i] * time;
+			}
+		}, count);
+		double optimised = measure("integrate Vec3f value operators", 1, rounds, [&](unsigned int)
+		{
+			for ( unsigned int i = 0; i < count; ++i )
+			{
+				velocities[i] = velocities[i] + gravity * time - velocities[i] * drag;
+				positions[i] = positions[i] + velocities[i] * time;
+			}
+		}, count);
+		printSpeedup(reference, optimised);
+		sink = sink + referencePositions[count / 2].x + positions[count / 2].x;
+	}
+
+}
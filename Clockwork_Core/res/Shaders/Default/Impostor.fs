@@ -0,0 +1,10 @@
+#version 330 core
+
+in vec4 colour;
+
+out vec4 outColour;//output final colour 
+
+void main()
+{
+    outColour = colour;
+}
\ No newline at end of file
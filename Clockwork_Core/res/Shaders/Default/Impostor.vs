@@ -0,0 +1,15 @@
+#version 330 core
+
+layout (location = 0) in vec3 vertexPos;//3d position in world space | the impostors are built in world space, so there is no model matrix
+layout (location = 1) in vec4 vertexColour;//colour of the voxel face with the shading already applied
+
+out vec4 colour;
+
+uniform mat4 u_view;//view matrix is the world relative to the camera
+uniform mat4 u_projection;//projection matrix for the viewport
+
+void main()
+{
+    gl_Position = u_projection * u_view * vec4(vertexPos, 1.0);
+    colour = vertexColour;
+}
\ No newline at end of file
@@ -4,17 +4,30 @@ layout (location = 0) in vec3 vertexPos;//3d position at first pos
 layout (location = 1) in vec2 vertexTexCoord;//text coordinates at second pos of the vertexarray as input
 layout (location = 2) in vec3 vertexNormal;//for lighting
 layout (location = 3) in int textureId;//textureId for the texturearray to select the texture
-layout (location = 4) in mat4 instanceMatrix;//model matrix with scaling/translation/rotation | position of the model in the world, etc with scaling 
+layout (location = 4) in mat4 instanceMatrix;//model matrix with scaling/translation/rotation | position of the model in the world, etc with scaling | with compact instances the first 3 columns are the translation, the rotation quaternion and the scale instead(see CubeManager::setCompactInstances())
 
 out vec2 fragTexCoord;//output the texcoordinates to the fragmentshader
 flat out int fragTexId;//textureid passed to the fragmentshader | flat is specifier for int, because otherwise it will crash
 
 uniform mat4 u_view;//view matrix is the world relative to the camera
 uniform mat4 u_projection;//projection matrix for the viewport
+uniform bool u_compactInstances;//if the instance data has the compact layout
+
+//rebuilds the model matrix out of the compact instance data
+mat4 compactMatrix(vec3 position, vec4 rotation, vec3 scale)
+{
+    vec4 q = normalize(rotation);
+    mat3 rotationMatrix = mat3(
+        1.0 - 2.0 * (q.y * q.y + q.z * q.z), 2.0 * (q.x * q.y + q.w * q.z), 2.0 * (q.x * q.z - q.w * q.y),
+        2.0 * (q.x * q.y - q.w * q.z), 1.0 - 2.0 * (q.x * q.x + q.z * q.z), 2.0 * (q.y * q.z + q.w * q.x),
+        2.0 * (q.x * q.z + q.w * q.y), 2.0 * (q.y * q.z - q.w * q.x), 1.0 - 2.0 * (q.x * q.x + q.y * q.y));
+    return mat4(vec4(rotationMatrix[0] * scale.x, 0.0), vec4(rotationMatrix[1] * scale.y, 0.0), vec4(rotationMatrix[2] * scale.z, 0.0), vec4(position, 1.0));
+}
 
 void main()
 {
-    gl_Position = u_projection * u_view * instanceMatrix * vec4(vertexPos, 1.0);//calculate opengl position with the model, modelmatrix and then the projection matrix
+    mat4 modelMatrix = u_compactInstances ? compactMatrix(instanceMatrix[0].xyz, instanceMatrix[1], instanceMatrix[2].xyz) : instanceMatrix;
+    gl_Position = u_projection * u_view * modelMatrix * vec4(vertexPos, 1.0);//calculate opengl position with the model, modelmatrix and then the projection matrix
     fragTexCoord = vertexTexCoord;
 	fragTexId = textureId;
 }
\ No newline at end of file
@@ -23,29 +23,42 @@
 #include "src\Graphics\Textures\Texture2D.h"
 #include "src\Graphics\Textures\TextureArray2D.h"
 #include "src\Graphics\Textures\SpriteSheet.h"
+#include "src\Graphics\Textures\TextureUploader.h"
+#include "src\Graphics\Textures\TextureCache.h"
+#include "src\Graphics\Renderer\ShaderCache.h"
+#include "src\Graphics\Renderables\Mesh.h"
+#include "src\Utils\AssetLoader.h"
+#include "src\Utils\PackFile.h"
+#include "src\Graphics\ContextThread.h"
 #include "src\Logics\States\Game\TestGame.h"
 #include "src\Maths\MathFunctions.h"
 #include <thread>
 
 #define HIGH_FPS 1
 #define LOGFPS 1
+#define CONTEXT_THREAD 1//creates the global contextthread with a hidden shared opengl context, so the textureuploader and the chunkimpostors fill their textures and buffers in the background | if the shared context can not be created, the textures are streamed through the pixelbuffers of the textureuploader again
 
 namespace clockwork {
 
 	Engine::Engine(const char* title) noexcept
-		:m_running(true), m_currentState(nullptr), m_passedTime { 0 }
+		:m_running(true), m_currentState(nullptr), m_defaultLoading(nullptr), m_passedTime { 0 }
 	{
 #if CLOCKWORK_DEBUG
 		std::cout << "Clockwork-Engine Debug Mode" << std::endl;
 #else
 		std::cout << "Clockwork-Engine Release Mode" << std::endl;
 #endif
-		clockwork::maths::initMaths();
+		utils::resourcePack = new utils::PackFile("res.cwpk");//if there is no packfile, all resources are read from the loose files in res/
 		graphics::Window::init();//hier ggf noch andere libs initialisieren, oder im window initialisieren | modelloader, fonts, etc
 		m_window = new graphics::Window(title,800,800,1,false,0);//spter size von static configmanager nehmen genau wie welcher screen benutzt wird ob fullscreen und vsync etc, sonst von screen ablesen | wird spter alles hier dem window von configmanager bergeben | standard ist hier alles 0 in configmanager, wie bei window | beim ersten starten wird das window mit default sachen fullscreen mit size des primren monitors erstellt und config saved einmal, wenn game gestartet ist
 		graphics::initBuffers(10);///spter nach testen wieder zu 100000 bytes machen, genau wie cube mit mehr bytes reservieren | jede funktion, die mit grafik objekten arbeitet MUSS VOM RENDERING THREAD AUFGERUFEN WERDEN, also bei allen buffer sachen, etc hinzuschreiben, dass sie nur vom renderthread mit opengl context aufgerufen werden knnen, wie bei initbuffers
 		graphics::initTextures();
+		graphics::shaderCache = new graphics::ShaderCache("shaders.cache");//the program binaries of the last start, so the shaders dont have to be compiled again
 		graphics::openglParams();
+		utils::assetLoader = new utils::AssetLoader();
+#if CONTEXT_THREAD
+		graphics::contextThread = new graphics::ContextThread(*m_window);
+#endif
 
 		//immer muss zuerst window erstellt werden und dann loading und dann states und dann kann in start alles verwendet werden
 		//m_defaultLoading = new logics::Loading();//hier loadingstate und alle anderen state objekte erstellen, die game spezifischen initialisierungen finden dann in start statt, aber hier schonmal die objekte erstellen, damit auf sie zugegriffen werden kann | in den states die verschiedenen gameobjekt listen, etc ggf mit nullptr initialisieren und erst von loading mit start initialisieren lassen, z.b. chunksystem
@@ -54,9 +67,22 @@ namespace clockwork {
 
 	Engine::~Engine() noexcept
 	{
+		delete m_defaultLoading;
+		delete utils::assetLoader;
+		delete graphics::contextThread;
+		delete graphics::textureUploader;
+#if CLOCKWORK_DEBUG
+		graphics::textureCache->printStatistics();
+		graphics::shaderCache->printStatistics();
+		graphics::Mesh::printStatistics();
+#endif
+		delete graphics::textureCache;
+		delete graphics::shaderCache;
+		graphics::shaderCache = nullptr;
 		delete m_window;
-		clockwork::maths::destroyMaths();
 		graphics::Window::destroy();
+		delete utils::resourcePack;
+		utils::resourcePack = nullptr;
 	}
 
 	void Engine::start() noexcept
@@ -65,9 +91,8 @@ namespace clockwork {
 		using namespace utils;
 		using namespace logics;
 
-		m_currentState = new TestGame();
-		m_currentState->State::enter();//hier als erstes state::enter aufrufen | auch bei leave machen, etc | fr alles bei state, oder auch ausgangsmethode machen, die weitergeleitet wird
-		m_currentState->enter();
+		m_defaultLoading = new Loading();
+		setState(m_defaultLoading, new TestGame());//the loading state calls state::enter and load of the new state and switches to it after all assets are loaded
 
 		m_window->setVsync(0);//disable vsync and performancemode for most fps 
 #if HIGH_FPS
@@ -104,6 +129,10 @@ namespace clockwork {
 
 			fastTick();///hier physics sachen adden, wie movement, etc, aber noch zweite funktion ai, oder so und davon nur jede sekunde sachen zu den threadworkern adden und nicht jeden tick | das dann ggf im timer >= 1 if machen und dann mehrere update funktionen in objekten haben, einmal pro tick, einmal pro sekunde | ggf auch fr network benutzen
 
+			utils::assetLoader->update();//executes the gpu uploads of the assets that were loaded in the background
+			if ( graphics::contextThread )
+				graphics::contextThread->update();//calls the finished callbacks of the objects that were created with the shared context
+			graphics::textureUploader->update();//streams the waiting images into their textures within the framebudget before rendering
 			render();
 			m_window->updateWindow();
 			m_window->updateInput();
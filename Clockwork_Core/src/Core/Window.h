@@ -47,7 +47,7 @@ namespace clockwork {
 			@param[vsync] the number of screen updates to wait for when swapping back(render) and front(display) buffers | 0 = no vsync, 1 = vsync 
 			@param[fullscreen] maximized window true/false bool
 			@param[monitorNumber] the monitor to display the window on | 0 = primary monitor 
-			@param[shared] a window to share the opengl context(same textures, etc) | NULL = no shared window */
+			@param[shared] a window to share the opengl context(same textures, etc) | NULL = no shared window | the ContextThread uses a hidden shared window to create objects in the background */
 			Window(const char *title, int width = 0, int height = 0, unsigned short vsync=0, bool fullscreen=true, int monitorNumber = 0, GLFWwindow* shared = nullptr) noexcept;
 			
 			/*destroys the glfw3 window | does not call the onClose callback | must be called from the main thread */
@@ -150,6 +150,20 @@ namespace clockwork {
 				glDrawElementsInstanced(GL_TRIANGLES, indicesCount, OpenglType<type>::gltype, reinterpret_cast<void*>( position * sizeof(type)), instanceCount);
 			}
 
+			/*draws a part of the indices like drawParts(), but the basevertex is added to each index before the vertex is read from the vertexbuffer
+			so all submeshes of a mesh can share one vertexbuffer and one indexbuffer and the indices of each submesh can start at 0, which lets them fit into unsigned shorts
+			@param[baseVertex] the position of the first vertex of the submesh in the vertexbuffer*/
+			void drawPartsBaseVertex(unsigned int position, unsigned int indicesCount, int baseVertex) const noexcept
+			{
+				glDrawElementsBaseVertex(GL_TRIANGLES, indicesCount, OpenglType<type>::gltype, reinterpret_cast<void*>( position * sizeof(type) ), baseVertex);
+			}
+
+			/*draws a part of the indices like drawInstancedParts(), but the basevertex is added to each index like in drawPartsBaseVertex()*/
+			void drawInstancedPartsBaseVertex(unsigned int position, unsigned int indicesCount, int baseVertex, unsigned int instanceCount) const noexcept
+			{
+				glDrawElementsInstancedBaseVertex(GL_TRIANGLES, indicesCount, OpenglType<type>::gltype, reinterpret_cast<void*>( position * sizeof(type) ), instanceCount, baseVertex);
+			}
+
 			/*binds this opengl element array buffer to the opengl state machine, so opengl can work with it(by using buffercalls on GL_ELEMENT_ARRAY_BUFFER)
 			only one buffer of the same type(here indexbuffer/element_array_buffer) can be bound at a time, but buffers of other types can be bound at the same time | vertexarray, vertexbuffer and indexbuffer are independant(can be bound at the same time)*/
 			void bind() const noexcept
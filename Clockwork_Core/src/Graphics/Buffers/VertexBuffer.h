@@ -178,7 +178,7 @@ namespace clockwork {
 #endif
 				glEnableVertexAttribArray(VaoPos);//enables the vertexarray at the position
 
-				if( OpenglType<type>::gltype == OpenglType<float>::gltype || OpenglType<type>::gltype == OpenglType<double>::gltype )
+				if( normalized || OpenglType<type>::gltype == OpenglType<float>::gltype || OpenglType<type>::gltype == OpenglType<double>::gltype || OpenglType<type>::gltype == OpenglType<HalfFloat>::gltype )//normalized integers are converted to floats
 					glVertexAttribPointer(VaoPos, dim, OpenglType<type>::gltype, normalized, stride, reinterpret_cast<void*>( vaoOffset ));//1. position of the vertexbuffer in the vertexarray, 2. dimension of the vertices(vec2-vec4), 3. type of the vertices, 4. normalized, 4. size of one vertex, 5. offset from the beginning of the vertexbuffer to this position
 				else
 					glVertexAttribIPointer(VaoPos, dim, OpenglType<type>::gltype, stride, reinterpret_cast<void*>( vaoOffset ));
@@ -220,8 +220,8 @@ namespace clockwork {
 					std::cout << "Error VertexBuffer::connectToVao(): VertexArray was not bound" << std::endl;
 #endif
 				glEnableVertexAttribArray(pos);//enables the vertexarray at the position
-				if ( OpenglType<type>::gltype == OpenglType<float>::gltype || OpenglType<type>::gltype == OpenglType<double>::gltype )
-				glVertexAttribPointer(pos, dim, OpenglType<type>::gltype, normalized, stride, reinterpret_cast<void*>( offset ));//1. position of the vertexbuffer in the vertexarray, 2. dimension of the vertices(vec2-vec4), 3. type of the vertices, 4. normalized, 4. size of one vertex, 5. offset from the beginning of the vertexbuffer to this position
+				if ( normalized || OpenglType<type>::gltype == OpenglType<float>::gltype || OpenglType<type>::gltype == OpenglType<double>::gltype || OpenglType<type>::gltype == OpenglType<HalfFloat>::gltype )//normalized integers are converted to floats
+					glVertexAttribPointer(pos, dim, OpenglType<type>::gltype, normalized, stride, reinterpret_cast<void*>( offset ));//1. position of the vertexbuffer in the vertexarray, 2. dimension of the vertices(vec2-vec4), 3. type of the vertices, 4. normalized, 4. size of one vertex, 5. offset from the beginning of the vertexbuffer to this position
 				else
 					glVertexAttribIPointer(pos, dim, OpenglType<type>::gltype, stride, reinterpret_cast<void*>( offset ));
 				glVertexAttribDivisor(pos, instancing);
@@ -0,0 +1,165 @@
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "glad\glad.h"
+#include "glfw\glfw3.h"
+#include "ContextThread.h"
+#include "src\Core\Window.h"
+#include <iostream>
+#include <vector>
+
+namespace clockwork {
+	namespace graphics {
+
+		ContextThread* contextThread = nullptr;
+
+		ContextThread::ContextThread(const Window& window) noexcept
+			: m_context(nullptr), m_pendingCount(0), m_running(true)
+		{
+			glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);//the context needs a window, but it is never shown
+			m_context = glfwCreateWindow(1, 1, "Clockwork ContextThread", nullptr, window.getWindow());
+			glfwWindowHint(GLFW_VISIBLE, GLFW_TRUE);
+			if ( !m_context )
+			{
+#if CLOCKWORK_DEBUG
+				std::cout << "Error ContextThread::ContextThread(): The shared opengl context could not be created, the tasks will be executed on the render thread" << std::endl;
+#endif
+				return;
+			}
+			m_thread = std::thread(&ContextThread::running, this);
+		}
+
+		ContextThread::~ContextThread() noexcept
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_lock);
+				m_running = false;
+			}
+			m_condition.notify_all();
+			if ( m_thread.joinable() )
+				m_thread.join();
+			for ( auto& fence : m_fences )
+				glDeleteSync(fence.fence);
+			if ( m_context )
+				glfwDestroyWindow(m_context);
+		}
+
+		void ContextThread::running() noexcept
+		{
+			glfwMakeContextCurrent(m_context);//the glad function pointers of the main context are used, because both contexts have the same pixelformat
+			std::unique_lock<std::mutex> lock(m_lock);
+			while ( true )
+			{
+				m_condition.wait(lock, [this]() {return !m_running || !m_tasks.empty();});
+				if ( m_tasks.empty() )
+					break;
+				Task task = std::move(m_tasks.front());
+				m_tasks.pop_front();
+				lock.unlock();
+				task.task();
+				GLsync fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+				glFlush();//the commands of the task have to be sent to the gpu, otherwise the fence would never be signaled for the render thread
+				lock.lock();
+				m_fences.push_back(Fence {fence, std::move(task.finished)});
+			}
+			lock.unlock();
+			glfwMakeContextCurrent(nullptr);
+		}
+
+		void ContextThread::addTask(std::function<void()>&& task, std::function<void()>&& finished) noexcept
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_lock);
+				m_tasks.push_back(Task {std::move(task), std::move(finished)});
+				++m_pendingCount;
+			}
+			m_condition.notify_one();
+		}
+
+		void ContextThread::addFillTask(std::function<void()>&& task, std::function<void()>&& finished) noexcept
+		{
+			GLsync ready = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+			glFlush();//the fence has to reach the gpu, otherwise the context thread would wait forever
+			addTask([ready, task = std::move(task)]() {
+				glWaitSync(ready, 0, GL_TIMEOUT_IGNORED);//the gpu of the context thread waits, not the cpu
+				glDeleteSync(ready);
+				task();
+			}, std::move(finished));
+		}
+
+		void ContextThread::update() noexcept
+		{
+			if ( !m_context )//without a shared context the tasks are executed on the render thread
+			{
+				std::deque<Task> tasks;
+				{
+					std::lock_guard<std::mutex> lock(m_lock);
+					tasks.swap(m_tasks);
+				}
+				for ( auto& task : tasks )
+				{
+					task.task();
+					std::lock_guard<std::mutex> lock(m_lock);
+					m_fences.push_back(Fence {nullptr, std::move(task.finished)});
+				}
+			}
+			std::vector<std::function<void()>> finished;
+			{
+				std::lock_guard<std::mutex> lock(m_lock);
+				while ( !m_fences.empty() )
+				{
+					Fence& fence = m_fences.front();
+					if ( fence.fence )
+					{
+						GLenum status = glClientWaitSync(fence.fence, 0, 0);
+						if ( status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED )
+							break;
+						glDeleteSync(fence.fence);
+					}
+					if ( fence.finished )
+						finished.push_back(std::move(fence.finished));
+					m_fences.pop_front();
+					--m_pendingCount;
+				}
+			}
+			for ( auto& callback : finished )//the callbacks are called without the lock, so they can add new tasks
+				callback();
+		}
+
+		void ContextThread::finish() noexcept
+		{
+			while ( getPendingCount() != 0 )
+			{
+				update();
+				std::unique_lock<std::mutex> lock(m_lock);
+				if ( !m_fences.empty() && m_fences.front().fence )
+				{
+					GLsync fence = m_fences.front().fence;
+					lock.unlock();
+					glClientWaitSync(fence, 0, 1000000);
+				}
+				else
+				{
+					lock.unlock();
+					std::this_thread::yield();//waits for the context thread
+				}
+			}
+		}
+
+		const unsigned int ContextThread::getPendingCount() noexcept
+		{
+			std::lock_guard<std::mutex> lock(m_lock);
+			return m_pendingCount;
+		}
+
+	}
+}
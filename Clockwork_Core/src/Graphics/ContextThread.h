@@ -0,0 +1,112 @@
+#pragma once
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "glad\glad.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <deque>
+
+struct GLFWwindow;
+
+namespace clockwork {
+	namespace graphics {
+
+		class Window;
+
+		/*a background thread with its own hidden opengl context, which shares its objects(buffers, textures, shaders and fences) with the context of the main window
+		so big assets can create their buffers and textures on this thread and the render loop is never blocked by the driver copying the data
+		each task is executed on the context thread and then a fence is inserted, so the finished callback of the task is called on the render thread(in update()) only after the gpu has finished the commands of the task
+		CAREFUL: vertexarrays and framebuffers are not shared between contexts, so create them on the render thread | growing a TextureArray2D on this thread needs opengl 4.3(glCopyImageSubData), because the copy framebuffers belong to the render thread
+		the static copybuffers of the buffer classes are shared with the render thread, so dont use the copy methods of the buffers in tasks | an object that was changed on the context thread has to be bound again on the render thread to see the changes
+		the hidden window works without a visible window, so it also works with headless software opengl(mesa)*/
+		class ContextThread
+		{
+
+		private:
+			/*a task for the context thread and the callback for the render thread*/
+			struct Task
+			{
+				std::function<void()> task;
+				std::function<void()> finished;
+			};
+
+			/*a finished task with the fence that signals when the gpu has executed its commands*/
+			struct Fence
+			{
+				GLsync fence;
+				std::function<void()> finished;
+			};
+
+		private:
+			GLFWwindow* m_context;
+			std::thread m_thread;
+			std::mutex m_lock;
+			std::condition_variable m_condition;
+			std::deque<Task> m_tasks;
+			std::deque<Fence> m_fences;
+			unsigned int m_pendingCount;
+			bool m_running;
+
+		public:
+			/*creates the hidden window with an opengl context that is shared with the window and starts the context thread | must be called from the main thread like the window constructor
+			@param[window] the window whose opengl context will be shared*/
+			explicit ContextThread(const Window& window) noexcept;
+
+			/*executes the remaining tasks, stops the context thread and destroys the hidden window | must be called from the main thread with the context of the window current
+			the finished callbacks that were not called by update() are lost*/
+			~ContextThread() noexcept;
+
+			ContextThread(const ContextThread& other) = delete;
+
+			ContextThread(ContextThread&& other) = delete;
+
+			ContextThread& operator=(const ContextThread& other) = delete;
+
+			ContextThread& operator=(ContextThread&& other) = delete;
+
+		private:
+			/*the loop of the context thread | makes the hidden context current and executes the tasks in the order they were added*/
+			void running() noexcept;
+
+		public:
+			/*adds a task that will be executed with the shared opengl context on the context thread | can be called from any thread
+			@param[task] creates/fills the opengl objects by their ids | dont construct buffer objects here, because the vertexbuffers share the static vertexarray positions with the render thread
+			@param[finished] is called on the render thread after the gpu has executed the commands of the task, so the objects of the task can be used for rendering | can be empty*/
+			void addTask(std::function<void()>&& task, std::function<void()>&& finished = nullptr) noexcept;
+
+			/*adds a task like addTask(), but the task waits on the gpu for the commands that the render thread has sent before, so it can fill the opengl objects whose storage was just created on the render thread(glTexSubImage, glBufferSubData) | must be called from the render thread*/
+			void addFillTask(std::function<void()>&& task, std::function<void()>&& finished = nullptr) noexcept;
+
+			/*calls the finished callbacks of the tasks whose fences are signaled | must be called once per frame from the render thread(the engine does this before rendering) | never blocks*/
+			void update() noexcept;
+
+			/*waits until all tasks are executed and calls their finished callbacks | must be called from the render thread | blocks the render thread, so use it only in loading screens*/
+			void finish() noexcept;
+
+		public:
+			/*returns the number of tasks that were added and whose finished callbacks were not called yet | can be called from any thread*/
+			const unsigned int getPendingCount() noexcept;
+
+			/*returns false if the hidden window with the shared context could not be created | then all tasks are executed on the render thread in update()*/
+			const bool isValid() const noexcept {return m_context != nullptr;}
+
+		};
+
+		/*the global contextthread that is created by the engine, if the engine uses a shared context for loading(CONTEXT_THREAD in Engine.cpp) | nullptr otherwise
+		the textureuploader and the chunkimpostors fill their textures and buffers on it, if it is valid*/
+		extern ContextThread* contextThread;
+
+	}
+}
@@ -15,6 +15,8 @@
 #include "Buffers\CopyBuffer.h"
 #include "Buffers\InternalCopyBuffer.h"
 #include "src\Graphics\Textures\TextureArray2D.h"
+#include "src\Graphics\Textures\TextureUploader.h"
+#include "src\Graphics\Textures\TextureCache.h"
 
 namespace clockwork {
 	namespace graphics {
@@ -44,6 +46,8 @@ namespace clockwork {
 		{
 			TextureArray2D::m_readBuffer = new FrameBuffer(GL_READ_FRAMEBUFFER);
 			TextureArray2D::m_drawBuffer = new FrameBuffer(GL_DRAW_FRAMEBUFFER);
+			textureUploader = new TextureUploader();
+			textureCache = new TextureCache();
 		}
 
 	}
@@ -62,6 +62,17 @@ namespace clockwork {
 			static const int gltype = 0x1405;
 		};
 
+		/*the bits of a 16 bit floating point value, which can only be used as vertex attribute and not for calculations | connectToVao<HalfFloat>() converts them to floats for the shader*/
+		struct HalfFloat
+		{
+			unsigned short bits;
+		};
+		template<>
+		struct OpenglType<HalfFloat>
+		{
+			static const int gltype = 0x140B;
+		};
+
 		/*must be called from the render thread with an active opengl context( Window::init() has to be called first and then atleast one window object has to be created before calling this method)
 		has to be called before using any buffer and it will initialize the internal copy buffers | will be called from the engine constructor
 		@param[size] the reserved size in bytes for the private copy buffers of the buffer classes*/
@@ -99,7 +110,8 @@ namespace clockwork {
 		@param[blendFunc] the kind of function used to calculate the colour | default is GL_FUNC_ADD = 32774 | GL_FUNC_SUBSTRACT = 32778 | GL_FUNC_REVERSE_SUBSTRACT = 32779*/
 		void openglParams(int cullFace = 1029, int windingOrder = 2304, int depthCompare = 515, int blendSourceFactor = 770, int blendDestinationFactor= 771, int blendFunc = 32774) noexcept;
 
-		/*kommentieren | erstellt immoment nur framebuffers in texturearray2d | auch in texturearray2d bei friend deklaration kommentieren*/
+		/*kommentieren | erstellt immoment nur framebuffers in texturearray2d | auch in texturearray2d bei friend deklaration kommentieren
+		also creates the global textureUploader with its ring of pixelbuffers and its copy thread, which is updated by the engine before each frame, and the global textureCache that shares the textures between the renderers*/
 		void initTextures();
 
 	}
@@ -11,35 +11,38 @@
 * You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
 *************************************************************************/
 #include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include "InstancedCube.h"
 #include "NormalCube.h"
 #include "CubeManager.h"
 #include "src\Graphics\Renderer\Renderer.h"
 #include "src\Logics\Entities\GameObject.h"
+#include "src\Maths\Batch.h"
+#include "src\Utils\CookedMesh.h"
 
 namespace clockwork {
 	namespace graphics {
 
 		struct TransparentCubeCompare
 		{
-			CubeManager* m_manager;
-			TransparentCubeCompare(CubeManager* manager)
-				:m_manager(manager)
+			const float* m_distances;//the squared camera distances at the positions of the cubes in the transparent list
+			TransparentCubeCompare(const float* distances)
+				:m_distances(distances)
 			{}
 			inline bool operator()(NormalCube* ptr1, NormalCube* ptr2)
 			{
-				return ptr1->m_gameObject->getPosition().distance(( *m_manager->m_renderer->m_currentCamera )->getPosition()) > ptr2->m_gameObject->getPosition().distance(( *m_manager->m_renderer->m_currentCamera )->getPosition());
+				return m_distances[ptr1->m_pos] > m_distances[ptr2->m_pos];
 			}
 		};
 
 		CubeManager::CubeManager() noexcept
-			:  m_renderer(nullptr)
+			: m_instanceCount(0), m_reserved(0), m_compactInstances(false), m_renderer(nullptr)
 		{}
 
 		CubeManager::CubeManager(unsigned int reserved, Renderer* renderer) noexcept
-			: m_textureArray(10), m_renderer(renderer)
+			: m_textureRegistry(10), m_instanceCount(0), m_reserved(reserved), m_compactInstances(false), m_renderer(renderer)
 		{
-			m_instanceArray.bind();
 			m_vertexBuffer = VertexBuffer(//you could also create a local nameless array of vertices, where vertex is a struct with vec2 of float for position and vec2 of float for colour
 				floatarr//floats
 				{//positions          texture coords	 vertex normals
@@ -75,7 +78,7 @@ namespace clockwork {
 					-1.0f, 1.0f, 1.0f,	    0.0f, 1.0f,     -1.0f, 0.0f, 0.0f
 				}, 8 * 4 * 6 * sizeof(float)
 				);
-			m_modelBuffer = VertexBuffer(nullptr, reserved * ( sizeof(int) + sizeof(maths::Mat4f) ), GL_STREAM_DRAW);
+			m_batchBuffer = VertexBuffer(nullptr, reserved * sizeof(maths::Mat4f), GL_STREAM_DRAW);
 			m_indexBuffer = IndexBuffer<unsigned char>(uchararr {//unsigned chars
 				0,1,2,		2,1,3,//back
 				4,5,6,		6,5,7,//top
@@ -85,45 +88,50 @@ namespace clockwork {
 				20,21,22,	22,21,23//left
 				}, 36//6 indices
 				);
+			m_normalArray.bind();
 			m_vertexBuffer.bind();
+			m_indexBuffer.bind();
 			m_vertexBuffer.connectToVao<float>(3, false, 8 * sizeof(float));//3d position
 			m_vertexBuffer.connectToVao<float>(2, false, 8 * sizeof(float));//2d texture coords
 			m_vertexBuffer.connectToVao<float>(3, false, 8 * sizeof(float));//3d vertex normal
 			VertexBuffer::vaoOffset = 0;
-			m_modelBuffer.bind();
-			m_modelBuffer.connectToVao<int>(1, false, ( sizeof(int) + sizeof(maths::Mat4f) ), 1);
-			m_modelBuffer.connectToVao<float>(4, false, ( sizeof(int) + sizeof(maths::Mat4f) ), 1);//4 vec4s modelmatrices
-			m_modelBuffer.connectToVao<float>(4, false, ( sizeof(int) + sizeof(maths::Mat4f) ), 1);
-			m_modelBuffer.connectToVao<float>(4, false, ( sizeof(int) + sizeof(maths::Mat4f) ), 1);
-			m_modelBuffer.connectToVao<float>(4, false, ( sizeof(int) + sizeof(maths::Mat4f) ), 1);
-			VertexBuffer::vaoOffset = 0;
 			VertexBuffer::VaoPos = 0;
-			m_normalArray.bind();
+			m_batchArray.bind();
 			m_vertexBuffer.bind();
 			m_indexBuffer.bind();
 			m_vertexBuffer.connectToVao<float>(3, false, 8 * sizeof(float));//3d position
 			m_vertexBuffer.connectToVao<float>(2, false, 8 * sizeof(float));//2d texture coords
 			m_vertexBuffer.connectToVao<float>(3, false, 8 * sizeof(float));//3d vertex normal
-			m_normalArray.unbind();
-			m_copyBuffer = CopyBuffer(nullptr, reserved * ( sizeof(int) + sizeof(maths::Mat4f) ), GL_STREAM_DRAW);
-			m_instanceCubes.reserve(reserved);
+			VertexBuffer::vaoOffset = 0;
+			m_batchBuffer.bind();
+			m_batchBuffer.connectToVao<float>(4, false, sizeof(maths::Mat4f), 1);//4 vec4s modelmatrices | the offset is moved to the start of each texture batch before drawing it
+			m_batchBuffer.connectToVao<float>(4, false, sizeof(maths::Mat4f), 1);
+			m_batchBuffer.connectToVao<float>(4, false, sizeof(maths::Mat4f), 1);
+			m_batchBuffer.connectToVao<float>(4, false, sizeof(maths::Mat4f), 1);
+			VertexBuffer::vaoOffset = 0;
+			VertexBuffer::VaoPos = 0;
+			m_batchArray.unbind();
+			m_instanceBuckets.reserve(4);
 			m_normalCubes.reserve(reserved);
 			m_transparentCubes.reserve(reserved);
 			m_transparentTextures.reserve(10);
 			m_normalTextures.reserve(10);
+			m_normalBatches.reserve(10);
+			m_batchMatrices.reserve(reserved);
 		}
 
 		CubeManager::~CubeManager() noexcept
 		{}
 
 		CubeManager::CubeManager(CubeManager&& other) noexcept
-			: m_instanceArray(std::move(other.m_instanceArray)), m_normalArray(std::move(other.m_normalArray)), m_indexBuffer(std::move(other.m_indexBuffer)), m_vertexBuffer(std::move(other.m_vertexBuffer)), m_modelBuffer(std::move(other.m_modelBuffer)),
-			m_copyBuffer(std::move(other.m_copyBuffer)), m_textureArray(std::move(other.m_textureArray)), m_normalTextures(std::move(other.m_normalTextures)), m_transparentTextures(std::move(other.m_transparentTextures)), m_instanceCubes(std::move(other.m_instanceCubes)),
-			m_normalCubes(std::move(other.m_normalCubes)), m_transparentCubes(std::move(other.m_transparentCubes)), m_renderer(other.m_renderer)
+			: m_normalArray(std::move(other.m_normalArray)), m_batchArray(std::move(other.m_batchArray)), m_indexBuffer(std::move(other.m_indexBuffer)), m_vertexBuffer(std::move(other.m_vertexBuffer)),
+			m_batchBuffer(std::move(other.m_batchBuffer)), m_textureRegistry(std::move(other.m_textureRegistry)), m_normalTextures(std::move(other.m_normalTextures)), m_transparentTextures(std::move(other.m_transparentTextures)), m_normalIds(std::move(other.m_normalIds)), m_transparentIds(std::move(other.m_transparentIds)), m_instanceBuckets(std::move(other.m_instanceBuckets)),
+			m_normalCubes(std::move(other.m_normalCubes)), m_transparentCubes(std::move(other.m_transparentCubes)), m_normalBatches(std::move(other.m_normalBatches)), m_batchMatrices(std::move(other.m_batchMatrices)), m_instanceCount(other.m_instanceCount), m_reserved(other.m_reserved), m_compactInstances(other.m_compactInstances), m_renderer(other.m_renderer)
 		{
-			for ( auto& cube : m_instanceCubes )
+			for ( auto& bucket : m_instanceBuckets )
 			{
-				cube->m_manager = this;
+				for ( auto& cube : bucket.m_cubes )
+					cube->m_manager = this;
 			}
 			for ( auto& cube : m_normalCubes )
 			{
@@ -133,27 +141,35 @@ namespace clockwork {
 			{
 				cube->m_manager = this;
 			}
+			other.m_instanceCount = 0;
 			other.m_renderer = nullptr;
 		}
 
 		CubeManager& CubeManager::operator=(CubeManager&& other) noexcept
 		{
-			m_instanceArray = std::move(other.m_instanceArray);//muss bei allen die pointer verschieben(auch bei den neuen) | also aus allen listen, etc 
-			m_normalArray = std::move(other.m_normalArray);
+			m_normalArray = std::move(other.m_normalArray);//muss bei allen die pointer verschieben(auch bei den neuen) | also aus allen listen, etc 
+			m_batchArray = std::move(other.m_batchArray);
 			m_vertexBuffer = std::move(other.m_vertexBuffer);
-			m_modelBuffer = std::move(other.m_modelBuffer);
-			m_copyBuffer = std::move(other.m_copyBuffer);
+			m_batchBuffer = std::move(other.m_batchBuffer);
 			m_indexBuffer = std::move(other.m_indexBuffer);
-			m_textureArray = std::move(other.m_textureArray);
+			m_textureRegistry = std::move(other.m_textureRegistry);
 			m_normalTextures = std::move(other.m_normalTextures);
 			m_transparentTextures = std::move(other.m_transparentTextures);
-			m_instanceCubes = std::move(other.m_instanceCubes);
+			m_normalIds = std::move(other.m_normalIds);
+			m_transparentIds = std::move(other.m_transparentIds);
+			m_instanceBuckets = std::move(other.m_instanceBuckets);
 			m_normalCubes = std::move(other.m_normalCubes);
 			m_transparentCubes = std::move(other.m_transparentCubes);
+			m_normalBatches = std::move(other.m_normalBatches);
+			m_batchMatrices = std::move(other.m_batchMatrices);
+			m_instanceCount = other.m_instanceCount;
+			m_reserved = other.m_reserved;
+			m_compactInstances = other.m_compactInstances;
 			m_renderer = other.m_renderer;
-			for ( auto& cube : m_instanceCubes )
+			for ( auto& bucket : m_instanceBuckets )
 			{
-				cube->m_manager = this;
+				for ( auto& cube : bucket.m_cubes )
+					cube->m_manager = this;
 			}
 			for ( auto& cube : m_normalCubes )
 			{
@@ -163,106 +179,327 @@ namespace clockwork {
 			{
 				cube->m_manager = this;
 			}
+			other.m_instanceCount = 0;
 			other.m_renderer = nullptr;
 			return *this;
 		}
 
-		int CubeManager::getNormalTextureId(const utils::Image& image) noexcept
+		int CubeManager::findTextureId(const std::unordered_map<unsigned int, int>& textureIds, const std::string& imagePath) noexcept
 		{
-#if CLOCKWORK_DEBUG
-			if ( image.getData() == nullptr )
-				std::cout << "Error CubeManager::getNormalTextureId(): Image has no data" << std::endl;
-#endif
-			for ( unsigned int i = 0; i < m_normalTextures.size(); ++i )
+			auto textureId = textureIds.find(utils::internPath(imagePath));
+			return textureId == textureIds.end() ? -1 : textureId->second;
+		}
+
+		int CubeManager::addTexture(TextureHandle&& texture, const std::string& imagePath, bool transparent) noexcept
+		{
+			if ( transparent )
 			{
-				if ( m_normalTextures.at(i).getImage().getFilepath() == image.getFilepath() )
-					return i;
+				m_transparentTextures.push_back(std::move(texture));
+				return m_transparentIds[utils::internPath(imagePath)] = m_transparentTextures.size() - 1;
 			}
-			m_normalTextures.push_back(Texture2D(image));
-			return m_normalTextures.size() - 1;
+			m_normalTextures.push_back(std::move(texture));
+			return m_normalIds[utils::internPath(imagePath)] = m_normalTextures.size() - 1;
+		}
+
+		int CubeManager::getNormalTextureId(const utils::Image& image) noexcept
+		{
+			int textureId = findTextureId(m_normalIds, image.getFilepath());
+			if ( textureId != -1 )
+				return textureId;
+			return addTexture(textureCache->get(image), image.getFilepath(), false);
 		}
 
 		int CubeManager::getNormalTextureId(const std::string& imagePath) noexcept
 		{
-			for ( unsigned int i = 0; i < m_normalTextures.size(); ++i )
+			int textureId = findTextureId(m_normalIds, imagePath);
+			if ( textureId != -1 )
+				return textureId;
+			return addTexture(textureCache->get(imagePath), imagePath, false);
+		}
+
+		int CubeManager::getTransparentTextureId(const utils::Image& image) noexcept
+		{
+			int textureId = findTextureId(m_transparentIds, image.getFilepath());
+			if ( textureId != -1 )
+				return textureId;
+			return addTexture(textureCache->get(image), image.getFilepath(), true);
+		}
+
+		int CubeManager::getTransparentTextureId(const std::string& imagePath) noexcept
+		{
+			int textureId = findTextureId(m_transparentIds, imagePath);
+			if ( textureId != -1 )
+				return textureId;
+			return addTexture(textureCache->get(imagePath), imagePath, true);
+		}
+
+		CubeManager::InstanceBucket& CubeManager::getInstanceBucket(int bucket) noexcept
+		{
+			while ( m_instanceBuckets.size() <= bucket )
 			{
-				if ( m_normalTextures.at(i).getImage().getFilepath() == imagePath )
-					return i;
+				m_instanceBuckets.push_back(InstanceBucket());
+				InstanceBucket& newBucket = m_instanceBuckets.back();
+				newBucket.m_modelBuffer = VertexBuffer(nullptr, m_reserved * getInstanceSize(), GL_STREAM_DRAW);
+				newBucket.m_copyBuffer = CopyBuffer(nullptr, m_reserved * getInstanceSize(), GL_STREAM_DRAW);
+				newBucket.m_cubes.reserve(m_reserved);
+				connectInstanceBucket(newBucket);
 			}
-			utils::Image image(imagePath);
-			image.load();
-#if CLOCKWORK_DEBUG
-			if ( image.getData() == nullptr )
-				std::cout << "Error CubeManager::getNormalTextureId(): Image has no data" << std::endl;
-#endif
-			m_normalTextures.push_back(Texture2D(image));
-			return m_normalTextures.size() - 1;
+			return m_instanceBuckets.at(bucket);
 		}
 
-		int CubeManager::getTransparentTextureId(const utils::Image& image) noexcept
+		void CubeManager::connectInstanceBucket(InstanceBucket& bucket) noexcept
 		{
-#if CLOCKWORK_DEBUG
-			if ( image.getData() == nullptr )
-				std::cout << "Error CubeManager::getNormalTextureId(): Image has no data" << std::endl;
-#endif
-			for ( unsigned int i = 0; i < m_transparentTextures.size(); ++i )
+			bucket.m_array.bind();
+			m_vertexBuffer.bind();
+			m_indexBuffer.bind();
+			m_vertexBuffer.connectToVao<float>(3, false, 8 * sizeof(float));//3d position
+			m_vertexBuffer.connectToVao<float>(2, false, 8 * sizeof(float));//2d texture coords
+			m_vertexBuffer.connectToVao<float>(3, false, 8 * sizeof(float));//3d vertex normal
+			VertexBuffer::vaoOffset = 0;
+			bucket.m_modelBuffer.bind();
+			if ( m_compactInstances )//the attributes are in the first 3 columns of the instancematrix in the shader
 			{
-				if ( m_transparentTextures.at(i).getImage().getFilepath() == image.getFilepath() )
-					return i;
+				bucket.m_modelBuffer.connectToVao<unsigned short>(1, false, 3, offsetof(CompactInstance, layer), sizeof(CompactInstance), 1);//layer of the texture in the texturearray2d of the bucket
+				bucket.m_modelBuffer.connectToVao<float>(3, false, 4, offsetof(CompactInstance, position), sizeof(CompactInstance), 1);//translation
+				bucket.m_modelBuffer.connectToVao<short>(4, true, 5, offsetof(CompactInstance, rotation), sizeof(CompactInstance), 1);//rotation quaternion
+				bucket.m_modelBuffer.connectToVao<HalfFloat>(3, false, 6, offsetof(CompactInstance, scale), sizeof(CompactInstance), 1);//scale
 			}
-			m_transparentTextures.push_back(Texture2D(image));
-			return m_transparentTextures.size() - 1;
+			else
+			{
+				bucket.m_modelBuffer.connectToVao<int>(1, false, ( sizeof(int) + sizeof(maths::Mat4f) ), 1);//layer of the texture in the texturearray2d of the bucket
+				bucket.m_modelBuffer.connectToVao<float>(4, false, ( sizeof(int) + sizeof(maths::Mat4f) ), 1);//4 vec4s modelmatrices
+				bucket.m_modelBuffer.connectToVao<float>(4, false, ( sizeof(int) + sizeof(maths::Mat4f) ), 1);
+				bucket.m_modelBuffer.connectToVao<float>(4, false, ( sizeof(int) + sizeof(maths::Mat4f) ), 1);
+				bucket.m_modelBuffer.connectToVao<float>(4, false, ( sizeof(int) + sizeof(maths::Mat4f) ), 1);
+			}
+			VertexBuffer::vaoOffset = 0;
+			VertexBuffer::VaoPos = 0;
+			bucket.m_array.unbind();
 		}
 
-		int CubeManager::getTransparentTextureId(const std::string& imagePath) noexcept
+		void CubeManager::setCompactInstances(bool compact) noexcept
 		{
-			for ( unsigned int i = 0; i < m_transparentTextures.size(); ++i )
+			if ( compact == m_compactInstances )
+				return;
+			m_compactInstances = compact;
+			for ( auto& bucket : m_instanceBuckets )
 			{
-				if ( m_transparentTextures.at(i).getImage().getFilepath() == imagePath )
-					return i;
+				InstanceBucket oldBucket(std::move(bucket));//deletes the old buffers and vertexarray at the end of the scope
+				unsigned int capacity = maths::max(m_reserved, static_cast<unsigned int>( oldBucket.m_cubes.size() ) * 2);
+				bucket.m_array = VertexArray();
+				bucket.m_modelBuffer = VertexBuffer(nullptr, capacity * getInstanceSize(), GL_STREAM_DRAW);
+				bucket.m_copyBuffer = CopyBuffer(nullptr, capacity * getInstanceSize(), GL_STREAM_DRAW);
+				bucket.m_cubes = std::move(oldBucket.m_cubes);
+				connectInstanceBucket(bucket);
+				for ( auto cube : bucket.m_cubes )
+					cube->m_changed = true;
 			}
-			utils::Image image(imagePath);
-			image.load();
-#if CLOCKWORK_DEBUG
-			if ( image.getData() == nullptr )
-				std::cout << "Error CubeManager::getNormalTextureId(): Image has no data" << std::endl;
-#endif
-			m_transparentTextures.push_back(Texture2D(image));
-			return m_transparentTextures.size() - 1;
+			if ( m_renderer && m_renderer->instancedShader )
+			{
+				m_renderer->instancedShader->enable();
+				m_renderer->instancedShader->setUniform("u_compactInstances", compact ? 1 : 0);
+			}
+		}
+
+		CompactInstance CompactInstance::pack(const maths::Mat4f& modelMatrix, int layer) noexcept
+		{
+			static_assert( sizeof(CompactInstance) == 28, "the compact instances have to be 28 bytes like the stride of the modelbuffers" );
+			CompactInstance instance;
+			instance.position[0] = modelMatrix.x4;
+			instance.position[1] = modelMatrix.y4;
+			instance.position[2] = modelMatrix.z4;
+			instance.layer = static_cast<unsigned short>( layer );
+
+			//the columns of the upper 3x3 matrix are the rotated axes multiplied with the scale
+			float axes[3][3] = {
+				{ modelMatrix.x1, modelMatrix.y1, modelMatrix.z1 },
+				{ modelMatrix.x2, modelMatrix.y2, modelMatrix.z2 },
+				{ modelMatrix.x3, modelMatrix.y3, modelMatrix.z3 }
+			};
+			float scale[3];
+			for ( int i = 0; i < 3; ++i )
+			{
+				scale[i] = std::sqrt(axes[i][0] * axes[i][0] + axes[i][1] * axes[i][1] + axes[i][2] * axes[i][2]);
+				float inverse = scale[i] > 0.0f ? 1.0f / scale[i] : 0.0f;
+				for ( int j = 0; j < 3; ++j )
+					axes[i][j] *= inverse;
+			}
+			float determinant = axes[0][0] * ( axes[1][1] * axes[2][2] - axes[2][1] * axes[1][2] ) - axes[1][0] * ( axes[0][1] * axes[2][2] - axes[2][1] * axes[0][2] ) + axes[2][0] * ( axes[0][1] * axes[1][2] - axes[1][1] * axes[0][2] );
+			if ( determinant < 0.0f )//a quaternion can not mirror, so the mirroring is moved into the scale
+			{
+				scale[0] = -scale[0];
+				for ( int j = 0; j < 3; ++j )
+					axes[0][j] = -axes[0][j];
+			}
+
+			//the quaternion of the rotationmatrix(axes[column][row]) is calculated from its biggest component to stay precise
+			float quaternion[4];
+			float trace = axes[0][0] + axes[1][1] + axes[2][2];
+			if ( trace > 0.0f )
+			{
+				float s = std::sqrt(trace + 1.0f) * 2.0f;
+				quaternion[0] = ( axes[1][2] - axes[2][1] ) / s;
+				quaternion[1] = ( axes[2][0] - axes[0][2] ) / s;
+				quaternion[2] = ( axes[0][1] - axes[1][0] ) / s;
+				quaternion[3] = 0.25f * s;
+			}
+			else if ( axes[0][0] > axes[1][1] && axes[0][0] > axes[2][2] )
+			{
+				float s = std::sqrt(1.0f + axes[0][0] - axes[1][1] - axes[2][2]) * 2.0f;
+				quaternion[0] = 0.25f * s;
+				quaternion[1] = ( axes[1][0] + axes[0][1] ) / s;
+				quaternion[2] = ( axes[2][0] + axes[0][2] ) / s;
+				quaternion[3] = ( axes[1][2] - axes[2][1] ) / s;
+			}
+			else if ( axes[1][1] > axes[2][2] )
+			{
+				float s = std::sqrt(1.0f + axes[1][1] - axes[0][0] - axes[2][2]) * 2.0f;
+				quaternion[0] = ( axes[1][0] + axes[0][1] ) / s;
+				quaternion[1] = 0.25f * s;
+				quaternion[2] = ( axes[2][1] + axes[1][2] ) / s;
+				quaternion[3] = ( axes[2][0] - axes[0][2] ) / s;
+			}
+			else
+			{
+				float s = std::sqrt(1.0f + axes[2][2] - axes[0][0] - axes[1][1]) * 2.0f;
+				quaternion[0] = ( axes[2][0] + axes[0][2] ) / s;
+				quaternion[1] = ( axes[2][1] + axes[1][2] ) / s;
+				quaternion[2] = 0.25f * s;
+				quaternion[3] = ( axes[0][1] - axes[1][0] ) / s;
+			}
+			for ( int i = 0; i < 4; ++i )
+			{
+				float value = maths::max(-1.0f, maths::min(quaternion[i], 1.0f));
+				instance.rotation[i] = static_cast<short>( value * 32767.0f + ( value < 0.0f ? -0.5f : 0.5f ) );
+			}
+			for ( int i = 0; i < 3; ++i )
+				instance.scale[i].bits = utils::toHalfFloat(scale[i]);
+			return instance;
 		}
 
 		void CubeManager::renderInstancedCubes() noexcept
 		{
-			m_textureArray.bind();
-			m_copyBuffer.bind();
-			m_modelBuffer.bind();
-			for ( auto cube : m_instanceCubes )
+			for ( unsigned int i = 0; i < m_instanceBuckets.size(); ++i )
 			{
-				cube->updateBufferData();
+				InstanceBucket& bucket = m_instanceBuckets.at(i);
+				if ( bucket.m_cubes.size() != 0 )
+				{
+					m_textureRegistry.getBucket(i).bind();
+					bucket.m_copyBuffer.bind();
+					bucket.m_modelBuffer.bind();
+					for ( auto cube : bucket.m_cubes )
+					{
+						cube->updateBufferData();
+					}
+					bucket.m_modelBuffer.copy(bucket.m_copyBuffer);
+					bucket.m_array.bind();
+					m_indexBuffer.drawInstanced(bucket.m_cubes.size());
+				}
 			}
-			m_modelBuffer.copy(m_copyBuffer);
-			m_instanceArray.bind();
-			m_indexBuffer.drawInstanced(m_instanceCubes.size());
 		}
 
 		void CubeManager::renderNormalCubes() noexcept
 		{
+			if ( m_normalBatches.size() < m_normalTextures.size() )
+				m_normalBatches.resize(m_normalTextures.size());
 			m_normalArray.bind();
 			for ( auto cube : m_normalCubes )
 			{
 				if ( cube->m_visible )
 				{
-					m_normalTextures.at(cube->m_textureId).bind();
-					cube->render();
-					m_indexBuffer.draw();
+					if ( cube->m_batched )
+						m_normalBatches.at(cube->m_textureId).push_back(cube);
+					else
+					{
+						m_normalTextures.at(cube->m_textureId)->bind();
+						cube->render();
+						m_indexBuffer.draw();
+					}
 				}
 			}
 		}
 
+		void CubeManager::renderBatchedNormalCubes() noexcept
+		{
+			m_batchMatrices.clear();
+			for ( auto& batch : m_normalBatches )
+			{
+				for ( auto cube : batch )
+					m_batchMatrices.push_back(cube->m_gameObject->getModelMatrix());
+			}
+			if ( m_batchMatrices.size() == 0 )
+				return;
+			m_batchBuffer.bind();
+			unsigned int size = m_batchMatrices.size() * sizeof(maths::Mat4f);
+			if ( size > m_batchBuffer.getSize() )
+				m_batchBuffer.reset(size * 2);
+			else
+				m_batchBuffer.reset(m_batchBuffer.getSize());//orphans the old data, so the driver doesnt have to wait for the drawcalls of the last frame
+			m_batchBuffer.setData(m_batchMatrices.data(), size);
+			m_batchArray.bind();
+			unsigned int start = 0;
+			for ( unsigned int i = 0; i < m_normalBatches.size(); ++i )
+			{
+				std::vector<NormalCube*>& batch = m_normalBatches.at(i);
+				if ( batch.size() != 0 )
+				{
+					VertexBuffer::VaoPos = 3;//the modelmatrix attributes of the batch shader start at location 3
+					VertexBuffer::vaoOffset = start * sizeof(maths::Mat4f);
+					m_batchBuffer.connectToVao<float>(4, false, sizeof(maths::Mat4f), 1);
+					m_batchBuffer.connectToVao<float>(4, false, sizeof(maths::Mat4f), 1);
+					m_batchBuffer.connectToVao<float>(4, false, sizeof(maths::Mat4f), 1);
+					m_batchBuffer.connectToVao<float>(4, false, sizeof(maths::Mat4f), 1);
+					m_normalTextures.at(i)->bind();
+					m_indexBuffer.drawInstanced(batch.size());
+					start += batch.size();
+					batch.clear();
+				}
+			}
+			VertexBuffer::vaoOffset = 0;
+			VertexBuffer::VaoPos = 0;
+		}
+
+		void CubeManager::renderBatch(int textureId, const maths::Mat4f* modelMatrices, unsigned int count) noexcept
+		{
+			if ( textureId < 0 || static_cast<unsigned int>( textureId ) >= m_normalTextures.size() )
+			{
+#if CLOCKWORK_DEBUG
+				std::cout << "Error CubeManager::renderBatch(): TextureId is not in the texture list of the cubemanager" << std::endl;
+#endif
+				return;
+			}
+			if ( count == 0 )
+				return;
+			m_batchBuffer.bind();
+			unsigned int size = count * sizeof(maths::Mat4f);
+			if ( size > m_batchBuffer.getSize() )
+				m_batchBuffer.reset(size * 2);
+			else
+				m_batchBuffer.reset(m_batchBuffer.getSize());//orphans the data of the batches that were drawn before
+			m_batchBuffer.setData(modelMatrices, size);
+			m_batchArray.bind();
+			VertexBuffer::VaoPos = 3;
+			VertexBuffer::vaoOffset = 0;
+			m_batchBuffer.connectToVao<float>(4, false, sizeof(maths::Mat4f), 1);//the offset of the last batch is still stored in the vertexarray
+			m_batchBuffer.connectToVao<float>(4, false, sizeof(maths::Mat4f), 1);
+			m_batchBuffer.connectToVao<float>(4, false, sizeof(maths::Mat4f), 1);
+			m_batchBuffer.connectToVao<float>(4, false, sizeof(maths::Mat4f), 1);
+			m_normalTextures.at(textureId)->bind();
+			m_indexBuffer.drawInstanced(count);
+			VertexBuffer::vaoOffset = 0;
+			VertexBuffer::VaoPos = 0;
+		}
+
 		void CubeManager::renderTransparentCubes() noexcept
 		{
 			m_normalArray.bind();
-			std::sort(m_transparentCubes.begin(), m_transparentCubes.end(), TransparentCubeCompare { this });
+			const unsigned int count = m_transparentCubes.size();
+			m_sortPositions.resize(count);
+			m_sortDistances.resize(count);
+			for ( unsigned int i = 0; i < count; ++i )//m_pos is the position in the transparent list, so the compare can find the distance of a cube while sorting
+				m_sortPositions[i] = m_transparentCubes[i]->m_gameObject->getPosition();
+			maths::distancesSquared(( *m_renderer->m_currentCamera )->getPosition(), m_sortPositions.data(), m_sortDistances.data(), count);
+			std::sort(m_transparentCubes.begin(), m_transparentCubes.end(), TransparentCubeCompare { m_sortDistances.data() });
 			for ( unsigned int i = 0; i < m_transparentCubes.size(); ++i )
 			{
 				NormalCube* cube = m_transparentCubes.at(i);
@@ -270,7 +507,7 @@ namespace clockwork {
 					cube->m_pos = i;
 				if ( cube->m_visible )
 				{
-					m_transparentTextures.at(cube->m_textureId).bind();
+					m_transparentTextures.at(cube->m_textureId)->bind();
 					cube->render();
 
 					maths::Vec3f distToCamera = ( *m_renderer->m_currentCamera )->getPosition() - cube->m_gameObject->getPosition();
@@ -390,19 +627,23 @@ namespace clockwork {
 			}
 		}
 
-		void CubeManager::removeInstancedCubesAt(int pos) noexcept
+		void CubeManager::removeInstancedCubesAt(int bucket, int pos) noexcept
 		{
-			m_instanceCubes.back()->m_pos = pos;
-			m_instanceCubes.back()->m_changed = true;
-			m_instanceCubes.at(pos)->m_pos = -1;
-			m_instanceCubes.at(pos) = m_instanceCubes.back();
-			m_instanceCubes.erase(m_instanceCubes.end() - 1);
+			std::vector<InstancedCube*>& cubes = m_instanceBuckets.at(bucket).m_cubes;
+			cubes.back()->m_pos = pos;
+			cubes.back()->m_changed = true;
+			cubes.at(pos)->m_pos = -1;
+			cubes.at(pos) = cubes.back();
+			cubes.erase(cubes.end() - 1);
+			--m_instanceCount;
 		}
 
-		void CubeManager::removeLastInstancedCube() noexcept
+		void CubeManager::removeLastInstancedCube(int bucket) noexcept
 		{
-			m_instanceCubes.back()->m_pos = -1;
-			m_instanceCubes.erase(m_instanceCubes.end() - 1);
+			std::vector<InstancedCube*>& cubes = m_instanceBuckets.at(bucket).m_cubes;
+			cubes.back()->m_pos = -1;
+			cubes.erase(cubes.end() - 1);
+			--m_instanceCount;
 		}
 
 		void CubeManager::removeNormalCubesAt(int pos) noexcept
@@ -431,80 +672,68 @@ namespace clockwork {
 
 		void CubeManager::addInstancedTexture(const utils::Image& image) noexcept
 		{
-			m_textureArray.addTexture(image);
+			m_textureRegistry.addTexture(image);
 		}
 
 		void CubeManager::addInstancedTexture(const std::string& imagePath) noexcept
 		{
-			m_textureArray.addTexture(imagePath);
+			m_textureRegistry.addTexture(imagePath);
 		}
 
-		void CubeManager::addNormalTexture(const utils::Image& image) noexcept
+		void CubeManager::addInstancedTextures(const std::vector<std::string>& imagePaths) noexcept
 		{
-#if CLOCKWORK_DEBUG
-			if ( image.getData() == nullptr )
-				std::cout << "Error CubeManager::addNormalTexture(): Image has no data" << std::endl;
-#endif
-#if CLOCKWORK_DEBUG
-			if ( image.hasAlpha() )
+			m_textureRegistry.addTextures(imagePaths);
+		}
+
+		void CubeManager::addInstancedTextures(std::vector<utils::Image>&& images, TextureUploader& uploader) noexcept
+		{
+			m_textureRegistry.addTextures(std::move(images), uploader);
+		}
+
+		void CubeManager::addNormalTextures(std::vector<utils::Image>&& images, TextureUploader& uploader) noexcept
+		{
+			for ( auto& image : images )
 			{
-				for ( unsigned int i = 0; i < m_transparentTextures.size(); ++i )
+#if CLOCKWORK_DEBUG
+				if ( containsNormalTexture(image.getFilepath()) || containsTransparentTexture(image.getFilepath()) )
 				{
-					if ( m_transparentTextures.at(i).getImage().getFilepath() == image.getFilepath() )
-					{
-						std::cout << "Error TextureArray2D::addTexture(): an image with the same imagepath already is in the texture list" << std::endl;
-						return;
-					}
+					std::cout << "Error CubeManager::addNormalTextures(): an image with the same imagepath already is in the texture list" << std::endl;
+					continue;
 				}
+#endif
+				std::string imagePath = image.getFilepath();
+				bool transparent = image.hasAlpha();
+				addTexture(textureCache->get(std::move(image), uploader), imagePath, transparent);
 			}
-			else
+			images.clear();
+		}
+
+		void CubeManager::addNormalTexture(const utils::Image& image) noexcept
+		{
+#if CLOCKWORK_DEBUG
+			if ( !image.hasData() )
+				std::cout << "Error CubeManager::addNormalTexture(): Image has no data" << std::endl;
+			if ( containsNormalTexture(image) || containsTransparentTexture(image) )
 			{
-				for ( unsigned int i = 0; i < m_normalTextures.size(); ++i )
-				{
-					if ( m_normalTextures.at(i).getImage().getFilepath() == image.getFilepath() )
-					{
-						std::cout << "Error TextureArray2D::addTexture(): an image with the same imagepath already is in the texture list" << std::endl;
-						return;
-					}
-				}
+				std::cout << "Error CubeManager::addNormalTexture(): an image with the same imagepath already is in the texture list" << std::endl;
+				return;
 			}
 #endif 
-			if(image.hasAlpha() )
-				m_transparentTextures.push_back(Texture2D(image));
-			else
-				m_normalTextures.push_back(Texture2D(image));
+			addTexture(textureCache->get(image), image.getFilepath(), image.hasAlpha());
 		}
 
 		void CubeManager::addNormalTexture(const std::string& imagePath) noexcept
 		{
 #if CLOCKWORK_DEBUG
-			for ( unsigned int i = 0; i < m_normalTextures.size(); ++i )
+			if ( containsNormalTexture(imagePath) || containsTransparentTexture(imagePath) )
 			{
-				if ( m_normalTextures.at(i).getImage().getFilepath() == imagePath )
-				{
-					std::cout << "Error TextureArray2D::addTexture(): an image with the same imagepath already is in the texture list" << std::endl;
-					return;
-				}
-			}
-			for ( unsigned int i = 0; i < m_transparentTextures.size(); ++i )
-			{
-				if ( m_transparentTextures.at(i).getImage().getFilepath() == imagePath )
-				{
-					std::cout << "Error TextureArray2D::addTexture(): an image with the same imagepath already is in the texture list" << std::endl;
-					return;
-				}
+				std::cout << "Error CubeManager::addNormalTexture(): an image with the same imagepath already is in the texture list" << std::endl;
+				return;
 			}
 #endif 
-			utils::Image image(imagePath);
-			image.load();
-#if CLOCKWORK_DEBUG
-			if ( image.getData() == nullptr )
-				std::cout << "Error CubeManager::addNormalTexture(): Image has no data" << std::endl;
-#endif
-			if ( image.hasAlpha() )
-				m_transparentTextures.push_back(Texture2D(image));
-			else
-				m_normalTextures.push_back(Texture2D(image));
+			TextureHandle texture = textureCache->get(imagePath);
+			bool transparent = texture->getImage().hasAlpha();
+			addTexture(std::move(texture), imagePath, transparent);
 		}
 
 		void CubeManager::addTextureBoth(const utils::Image& image) noexcept
@@ -521,31 +750,35 @@ namespace clockwork {
 
 		void CubeManager::removeInstancedTexture(int textureId) noexcept
 		{
-			m_copyBuffer.bind();
-			m_textureArray.removeTexture(textureId);
-			for ( unsigned int i = 0; i < m_instanceCubes.size(); ++i )
+			int removedBucket = m_textureRegistry.getSlot(textureId).bucket;
+			m_textureRegistry.removeTexture(textureId);
+			for ( unsigned int i = 0; i < m_instanceBuckets.size(); ++i )
 			{
-				if ( m_instanceCubes.at(i)->m_textureId == textureId )
-				{
-					m_instanceCubes.at(i)->m_textureId = 0;
-					m_instanceCubes.at(i)->m_changed = true;
-				}
-				else if ( m_instanceCubes.at(i)->m_textureId > textureId )
+				std::vector<InstancedCube*> cubes = m_instanceBuckets.at(i).m_cubes;//copy, because the cubes can change their bucket
+				for ( auto cube : cubes )
 				{
-					--m_instanceCubes.at(i)->m_textureId;
-					m_instanceCubes.at(i)->m_changed = true;
+					if ( cube->m_textureId == textureId )
+						cube->m_textureId = 0;
+					else if ( cube->m_textureId > textureId )
+						--cube->m_textureId;
+					if ( i == removedBucket )
+						cube->m_changed = true;//the layers after the removed texture were moved down
+					if ( m_textureRegistry.getTextureCount() != 0 )
+						cube->updateBucket();
 				}
 			}
 		}
 
 		void CubeManager::removeInstancedTexture(const utils::Image& image) noexcept
 		{
-			removeInstancedTexture(m_textureArray.getTextureId(image));
+			if ( m_textureRegistry.contains(image) )
+				removeInstancedTexture(m_textureRegistry.getTextureId(image));
 		}
 
 		void CubeManager::removeInstancedTexture(const std::string& imagePath) noexcept
 		{
-			removeInstancedTexture(m_textureArray.getTextureId(imagePath));
+			if ( m_textureRegistry.contains(imagePath) )
+				removeInstancedTexture(m_textureRegistry.getTextureId(imagePath));
 		}
 
 		void CubeManager::removeNormalTexture(int textureId, bool transparent) noexcept
@@ -557,6 +790,7 @@ namespace clockwork {
 					std::cout << "Error CubeManager::removeNormalTexture(): TextureId is not in the texture list" << std::endl;
 #endif
 				m_transparentTextures.erase(m_transparentTextures.begin() + textureId);
+				removeTextureId(m_transparentIds, textureId);
 				for ( unsigned int i = 0; i < m_transparentCubes.size(); ++i )
 				{
 					if ( m_transparentCubes.at(i)->m_textureId == textureId )
@@ -576,13 +810,14 @@ namespace clockwork {
 					std::cout << "Error CubeManager::removeNormalTexture(): TextureId is not in the texture list" << std::endl;
 #endif
 				m_normalTextures.erase(m_normalTextures.begin() + textureId);
+				removeTextureId(m_normalIds, textureId);
 				for ( unsigned int i = 0; i < m_normalCubes.size(); ++i )
 				{
 					if ( m_normalCubes.at(i)->m_textureId == textureId )
 					{
 						m_normalCubes.at(i)->m_textureId = 0;
 					}
-					else if ( m_instanceCubes.at(i)->m_textureId > textureId )
+					else if ( m_normalCubes.at(i)->m_textureId > textureId )
 					{
 						--m_normalCubes.at(i)->m_textureId;
 					}
@@ -590,94 +825,64 @@ namespace clockwork {
 			}
 		}
 
-		void CubeManager::removeNormalTexture(const utils::Image& image) noexcept
+		void CubeManager::removeTextureId(std::unordered_map<unsigned int, int>& textureIds, int textureId) noexcept
 		{
-			for ( unsigned int i = 0; i < m_normalTextures.size(); ++i )
-			{
-				if ( m_normalTextures.at(i).getImage().getFilepath() == image.getFilepath() )
-				{
-					removeNormalTexture(i, false);
-					break;
-				}
-			}
-			for ( unsigned int i = 0; i < m_transparentTextures.size(); ++i )
+			for ( auto entry = textureIds.begin(); entry != textureIds.end(); )
 			{
-				if ( m_transparentTextures.at(i).getImage().getFilepath() == image.getFilepath() )
+				if ( entry->second == textureId )
 				{
-					removeNormalTexture(i, true);
-					break;
+					entry = textureIds.erase(entry);
+					continue;
 				}
+				if ( entry->second > textureId )
+					--entry->second;
+				++entry;
 			}
 		}
 
+		void CubeManager::removeNormalTexture(const utils::Image& image) noexcept
+		{
+			removeNormalTexture(image.getFilepath());
+		}
+
 		void CubeManager::removeNormalTexture(const std::string& imagePath) noexcept
 		{
-			for ( unsigned int i = 0; i < m_normalTextures.size(); ++i )
-			{
-				if ( m_normalTextures.at(i).getImage().getFilepath() == imagePath )
-				{
-					removeNormalTexture(i, false);
-					break;
-				}
-			}
-			for ( unsigned int i = 0; i < m_transparentTextures.size(); ++i )
-			{
-				if ( m_transparentTextures.at(i).getImage().getFilepath() == imagePath )
-				{
-					removeNormalTexture(i, true);
-					break;
-				}
-			}
+			int textureId = findTextureId(m_normalIds, imagePath);
+			if ( textureId != -1 )
+				removeNormalTexture(textureId, false);
+			textureId = findTextureId(m_transparentIds, imagePath);
+			if ( textureId != -1 )
+				removeNormalTexture(textureId, true);
 		}
 
 		bool CubeManager::containsInstancedTexture(const utils::Image& image) noexcept
 		{
-			return m_textureArray.contains(image);
+			return m_textureRegistry.contains(image);
 		}
 
 		bool CubeManager::containsInstancedTexture(const std::string& imagePath) noexcept
 		{
-			return m_textureArray.contains(imagePath);
+			return m_textureRegistry.contains(imagePath);
 		}
 
 		bool CubeManager::containsNormalTexture(const utils::Image& image) noexcept
 		{
-			for ( unsigned int i = 0; i < m_normalTextures.size(); ++i )
-			{
-				if ( m_normalTextures.at(i).getImage().getFilepath() == image.getFilepath() )
-					return true;
-			}
-			return false;
+			return findTextureId(m_normalIds, image.getFilepath()) != -1;
 		}
 
 		bool CubeManager::containsNormalTexture(const std::string& imagePath) noexcept
 		{
-			for ( unsigned int i = 0; i < m_normalTextures.size(); ++i )
-			{
-				if ( m_normalTextures.at(i).getImage().getFilepath() == imagePath )
-					return true;
-			}
-			return false;
+			return findTextureId(m_normalIds, imagePath) != -1;
 		}
 
 		bool CubeManager::containsTransparentTexture(const utils::Image& image) noexcept
 		{
-			for ( unsigned int i = 0; i < m_transparentTextures.size(); ++i )
-			{
-				if ( m_transparentTextures.at(i).getImage().getFilepath() == image.getFilepath() )
-					return true;
-			}
-			return false;
+			return findTextureId(m_transparentIds, image.getFilepath()) != -1;
 		}
 
 		bool CubeManager::containsTransparentTexture(const std::string& imagePath) noexcept
 		{
-			for ( unsigned int i = 0; i < m_transparentTextures.size(); ++i )
-			{
-				if ( m_transparentTextures.at(i).getImage().getFilepath() == imagePath )
-					return true;
-			}
-			return false;
+			return findTextureId(m_transparentIds, imagePath) != -1;
 		}
 
 		const Renderer* const CubeManager::getRenderer() const noexcept
@@ -12,6 +12,7 @@
 * You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
 *************************************************************************/
 #include <vector>
+#include <unordered_map>
 #include "src\Maths\Mat4x4.h"
 #include "src\Graphics\Buffers\VertexBuffer.h"
 #include "src\Graphics\Buffers\CopyBuffer.h"
@@ -20,7 +21,8 @@
 #include "src\Graphics\Buffers\VertexArray.h"
 #include "src\Utils\Image.h"
 #include "src\Graphics\Textures\TextureArray2D.h"
-#include "src\Graphics\Textures\Texture2D.h"
+#include "src\Graphics\Textures\TextureRegistry.h"
+#include "src\Graphics\Textures\TextureCache.h"
 
 namespace clockwork {
 	namespace graphics {
@@ -29,8 +31,22 @@ namespace clockwork {
 		class NormalCube;
 		class Renderer;
 
-		/*
-		CAREFUL: the size of each image has to be the same as the size of the other images and the pixelkind has to be the same too(rgb/rgba = same transparancy level), so CAREFUL WITH TRANSPARENCY TEXUTRES | dont use them for instanced cubes */
+		/*the compact per instance data of an instancedcube(28 bytes instead of the 68 bytes of the textureid and the modelmatrix) for cubes that are only scaled, rotated and translated | see CubeManager::setCompactInstances()
+		position: the translation of the modelmatrix | rotation: the rotation quaternion(x, y, z, w) as normalized shorts | scale: the scale along the rotated axes as half floats | layer: the layer of the texture in the texturearray2d of the bucket
+		the vertex shader rebuilds the modelmatrix out of them, so a modelmatrix with shearing can not be stored*/
+		struct CompactInstance
+		{
+			float position[3];
+			short rotation[4];
+			HalfFloat scale[3];
+			unsigned short layer;
+
+			/*splits the modelmatrix into translation, rotation and scale | a mirroring modelmatrix is stored with a negative x scale*/
+			static CompactInstance pack(const maths::Mat4f& modelMatrix, int layer) noexcept;
+		};
+
+		/*the instanced textures are stored in a textureregistry, where each bucket(texturearray2d) only has images of the same size and pixelkind(rgb/rgba)
+		so instanced cubes can use textures with diffrent sizes, but there will be one instanced drawcall per bucket | CAREFUL WITH TRANSPARENCY TEXUTRES | dont use them for instanced cubes, because instanced cubes are not sorted */
 		class CubeManager
 		{
 
@@ -42,19 +58,37 @@ namespace clockwork {
 			using floatarr = float[8 * 4 * 6];
 			using uchararr = unsigned  char[36];
 
+			/*the instancedcubes with a texture in the same bucket of the textureregistry | each bucket has its own vertexarray and modelbuffer with the layer of the texture in the texturearray2d of the bucket and the modelmatrix per instance
+			so all instancedcubes of one bucket are drawn with one instanced drawcall*/
+			struct InstanceBucket
+			{
+				VertexArray m_array;
+				VertexBuffer m_modelBuffer;
+				CopyBuffer m_copyBuffer;
+				std::vector<InstancedCube*> m_cubes;
+			};
+
 		private:
-			VertexArray m_instanceArray;
 			VertexArray m_normalArray;
+			VertexArray m_batchArray;
 			VertexBuffer m_vertexBuffer;
-			VertexBuffer m_modelBuffer;
-			CopyBuffer m_copyBuffer;
+			VertexBuffer m_batchBuffer;
 			IndexBuffer<unsigned char> m_indexBuffer;
-			TextureArray2D m_textureArray;
-			std::vector<Texture2D> m_normalTextures;
-			std::vector<Texture2D> m_transparentTextures;
-			std::vector<InstancedCube*> m_instanceCubes;
+			TextureRegistry m_textureRegistry;
+			std::vector<TextureHandle> m_normalTextures;//shared with the other renderers by the global texturecache
+			std::vector<TextureHandle> m_transparentTextures;
+			std::unordered_map<unsigned int, int> m_normalIds;//the textureids of the interned imagepaths(utils::internPath) in m_normalTextures
+			std::unordered_map<unsigned int, int> m_transparentIds;
+			std::vector<InstanceBucket> m_instanceBuckets;
 			std::vector<NormalCube*> m_normalCubes;
 			std::vector<NormalCube*> m_transparentCubes;
+			std::vector<std::vector<NormalCube*>> m_normalBatches;
+			std::vector<maths::Mat4f> m_batchMatrices;
+			std::vector<maths::Vec3f> m_sortPositions;//the positions and squared camera distances of the transparent cubes for sorting them | only reused memory, so they are not moved
+			std::vector<float> m_sortDistances;
+			unsigned int m_instanceCount;
+			unsigned int m_reserved;
+			bool m_compactInstances;
 			Renderer* m_renderer;
 
 		public:
@@ -74,24 +108,51 @@ namespace clockwork {
 			CubeManager& operator=(CubeManager&& other) noexcept;
 
 		private:
+			/*returns the textureid of the imagepath in the hash map, or -1*/
+			static int findTextureId(const std::unordered_map<unsigned int, int>& textureIds, const std::string& imagePath) noexcept;
+
+			/*removes the textureid from the hash map and moves the textureids after it down*/
+			static void removeTextureId(std::unordered_map<unsigned int, int>& textureIds, int textureId) noexcept;
+
+			/*adds the shared texture to the normal texture list, or the transparent texture list and returns its textureid*/
+			int addTexture(TextureHandle&& texture, const std::string& imagePath, bool transparent) noexcept;
+
 			int getNormalTextureId(const utils::Image& image) noexcept;
 			int getNormalTextureId(const std::string& imagePath) noexcept;
 			int getTransparentTextureId(const utils::Image& image) noexcept;
 			int getTransparentTextureId(const std::string& imagePath) noexcept;
 
+			/*returns the instancebucket for the bucket of the textureregistry and creates the missing instancebuckets with their vertexarrays and modelbuffers*/
+			InstanceBucket& getInstanceBucket(int bucket) noexcept;
+
+			/*creates the vertexarray of the instancebucket with the vertexbuffer of the cube and the modelbuffer of the bucket in the current instance layout*/
+			void connectInstanceBucket(InstanceBucket& bucket) noexcept;
+
 		public:
 
+			/*draws the instancedcubes of each bucket of the textureregistry with one instanced drawcall per bucket | the instanced shader has to be enabled first*/
 			void renderInstancedCubes() noexcept;
 
+			/*renders the visible normalcubes that are not batched(normalcube::setBatched(false)) one by one with their own render() call and the normal shader
+			and sorts all other visible normalcubes into one batch per textureid, which will then be drawn by renderBatchedNormalCubes()
+			the normal shader has to be enabled first*/
 			void renderNormalCubes() noexcept;
 
+			/*draws the texture batches of normalcubes that were collected in renderNormalCubes() with one instanced drawcall per texture | the modelmatrices of all batches are uploaded at once into the batchbuffer
+			has to be called after renderNormalCubes() in the same frame and the batch shader has to be enabled first*/
+			void renderBatchedNormalCubes() noexcept;
+
+			/*draws count cubes with the normal texture of the textureid and the modelmatrices in one instanced drawcall like renderBatchedNormalCubes() | used for the render tables of the entitystorage(see Renderer::renderEntities())
+			the modelmatrices are uploaded into the batchbuffer, so this has to be called after renderBatchedNormalCubes() in the same frame and the batch shader has to be enabled first*/
+			void renderBatch(int textureId, const maths::Mat4f* modelMatrices, unsigned int count) noexcept;
+
 			void renderTransparentCubes() noexcept;
 
 			/*dont use the object at the position in the cubemanager, because it will change places with the last object in the list and the last object will then be removed */
-			void removeInstancedCubesAt(int pos) noexcept;///neu besser kommentieren		| kommentieren, funktioniert nicht, wenn man 3. letztes mehrmals hintereinander entfernt, da es die sachen mischt und nicht aufrckt, also das letzte objekt kommt zur position des gelschten objekts | ist richtig so, nur dazu schreiben | vorher binden | objekt danach nicht mehr benutzen
+			void removeInstancedCubesAt(int bucket, int pos) noexcept;///neu besser kommentieren		| kommentieren, funktioniert nicht, wenn man 3. letztes mehrmals hintereinander entfernt, da es die sachen mischt und nicht aufrckt, also das letzte objekt kommt zur position des gelschten objekts | ist richtig so, nur dazu schreiben | vorher binden | objekt danach nicht mehr benutzen
 			
 			//entfernt bei transparent immer das nchste
-			void removeLastInstancedCube() noexcept;
+			void removeLastInstancedCube(int bucket) noexcept;
 
 			void removeNormalCubesAt(int pos) noexcept;
 
@@ -101,17 +162,29 @@ namespace clockwork {
 
 			void removeLastTransparentCube() noexcept;
 
-			/*adds an image/texture(that is not in the texturearray) to the texturearray2d of the cubemanager | dont add an image that already is in the texturearray, because then 2 identical images/textures would be in the texturearray2d
-			CAREFUL: the size of the new image has to be the same as the size of the other images and the pixelkind has to be the same too(rgb/rgba = same transparancy level), so you have to use the transparentinstancedcube and transparentinstancedcubemanager for transparency textures
+			/*adds an image/texture(that is not in the textureregistry) to the bucket of the textureregistry with the same size and pixelkind | dont add an image that already is in the textureregistry, because then 2 identical images/textures would be in the textureregistry
+			a new bucket(and one more drawcall for the instancedcubes) will be created if there is no bucket with the same size and pixelkind
 			@param[image] the texture/image that will be used for this model*/
 			void addInstancedTexture(const utils::Image& image) noexcept;
 
-			/*adds an image/texture(that is not in the texturearray) to the texturearray2d of the cubemanager | dont add an image that already is in the texturearray, because then 2 identical images/textures would be in the texturearray2d
-			CAREFUL: the size of the new image has to be the same as the size of the other images and the pixelkind has to be the same too(rgb/rgba = same transparancy level), so you have to use the transparentinstancedcube and transparentinstancedcubemanager for transparency textures
+			/*adds an image/texture(that is not in the textureregistry) to the bucket of the textureregistry with the same size and pixelkind | dont add an image that already is in the textureregistry, because then 2 identical images/textures would be in the textureregistry
+			a new bucket(and one more drawcall for the instancedcubes) will be created if there is no bucket with the same size and pixelkind
 			@param[imagePath] the path of a texture/image that will be used for this model*/
 			///KEINE TRANSPARENTEN TEXTUREN 
 			void addInstancedTexture(const std::string& imagePath) noexcept;
 
+			/*loads all images and adds them at once to the textureregistry | each bucket of the registry will only resize its texturearray2d and generate its mipmaps once, so this is faster than calling addInstancedTexture for each image
+			the textureids will be in the same order as the imagepaths*/
+			void addInstancedTextures(const std::vector<std::string>& imagePaths) noexcept;
+
+			/*adds the decoded images at once to the textureregistry like addInstancedTextures, but the imagedata is streamed into the buckets by the textureuploader over the next frames
+			the textureids will be in the same order as the images and can be used right away | CAREFUL: dont add, or remove instanced textures while the uploads are pending*/
+			void addInstancedTextures(std::vector<utils::Image>&& images, TextureUploader& uploader) noexcept;
+
+			/*adds the decoded images to the normal texture list, or the transparent texture list(depending on their alpha channel) in the same order as the images
+			the imagedata is streamed into the textures by the textureuploader over the next frames, so the textureids can be used right away, but the textures stay empty until the uploads are finished*/
+			void addNormalTextures(std::vector<utils::Image>&& images, TextureUploader& uploader) noexcept;
+
 			//kann transparent sein, oder nicht | seperate texturelisten | textureid ist auch seperat fr normal/transparent und natrlich auch fr instanced
 			void addNormalTexture(const utils::Image& image) noexcept;
 
@@ -145,15 +218,27 @@ namespace clockwork {
 			
 			bool containsTransparentTexture(const std::string& imagePath) noexcept;
 
+			/*switches the instancedcubes between the full layout(textureid and modelmatrix per instance) and the compact layout(see compactinstance), which needs less than half of the memory and upload bandwidth
+			the modelbuffers of the existing buckets are created again and the instancedcubes are uploaded again in the next frame | the instanced shader has to decode the compact layout if the uniform u_compactInstances is set(like the default Instancing.vs)
+			the default is the full layout*/
+			void setCompactInstances(bool compact) noexcept;
+
 			const Renderer* const getRenderer() const noexcept;
 
-			inline const unsigned int getInstanceCount() const noexcept {return m_instanceCubes.size();}
+			/*returns the size of the data per instancedcube in the modelbuffers in bytes*/
+			inline const unsigned int getInstanceSize() const noexcept {return m_compactInstances ? sizeof(CompactInstance) : sizeof(int) + sizeof(maths::Mat4f);}
+
+			inline const bool hasCompactInstances() const noexcept {return m_compactInstances;}
+
+			inline const unsigned int getInstanceCount() const noexcept {return m_instanceCount;}
 
 			inline const unsigned int getNormalCount() const noexcept {return m_normalCubes.size();}
 
 			inline const unsigned int getTransparentCount() const noexcept {return m_transparentCubes.size();}
 
-			inline const unsigned int getInstancedTextureCount() const noexcept {return m_textureArray.getTextureCount();}
+			inline const unsigned int getInstancedTextureCount() const noexcept {return m_textureRegistry.getTextureCount();}
+
+			inline const unsigned int getInstancedBucketCount() const noexcept {return m_textureRegistry.getBucketCount();}
 
 			inline const unsigned int getNormalTextureCount() const noexcept {return m_normalTextures.size();}
 
@@ -19,22 +19,22 @@ namespace clockwork {
 	namespace graphics {
 
 		InstancedCube::InstancedCube(int textureId, logics::GameObject* gameObject, Renderer* renderer) noexcept
-			: Renderable(textureId, gameObject), m_changed(true), m_pos(-1), m_manager(&renderer->cubeManager)
+			: Renderable(textureId, gameObject), m_changed(true), m_pos(-1), m_bucket(-1), m_manager(&renderer->cubeManager)
 		{
 #if CLOCKWORK_DEBUG
-			if ( m_manager->m_textureArray.getTextureCount() <= textureId )
-				std::cout << "Error InstancedCube::InstancedCube(): TextureId is not in the texturearray2d of the cubemanager" << std::endl;
+			if ( m_manager->m_textureRegistry.getTextureCount() <= textureId )
+				std::cout << "Error InstancedCube::InstancedCube(): TextureId is not in the textureregistry of the cubemanager" << std::endl;
 #endif
 		}
 
 		InstancedCube::InstancedCube(const std::string& imagePath, logics::GameObject* gameObject, Renderer* renderer) noexcept
-			: Renderable(renderer->cubeManager.m_textureArray.getTextureId(imagePath), gameObject), m_changed(true), m_pos(-1), m_manager(&renderer->cubeManager)
+			: Renderable(renderer->cubeManager.m_textureRegistry.getTextureId(imagePath), gameObject), m_changed(true), m_pos(-1), m_bucket(-1), m_manager(&renderer->cubeManager)
 		{
 
 		}
 
 		InstancedCube::InstancedCube(const utils::Image& image, logics::GameObject* gameObject, Renderer* renderer) noexcept
-			: Renderable(renderer->cubeManager.m_textureArray.getTextureId(image), gameObject), m_changed(true), m_pos(-1), m_manager(&renderer->cubeManager)
+			: Renderable(renderer->cubeManager.m_textureRegistry.getTextureId(image), gameObject), m_changed(true), m_pos(-1), m_bucket(-1), m_manager(&renderer->cubeManager)
 		{
 
 		}
@@ -45,12 +45,13 @@ namespace clockwork {
 		}
 
 		InstancedCube::InstancedCube(InstancedCube&& other) noexcept
-			: Renderable(std::move(other)), m_changed(true), m_pos(other.m_pos), m_manager(other.m_manager)
+			: Renderable(std::move(other)), m_changed(true), m_pos(other.m_pos), m_bucket(other.m_bucket), m_manager(other.m_manager)
 		{ 
 			other.m_pos = -1;
+			other.m_bucket = -1;
 			other.m_manager = nullptr;
 			if ( m_pos != -1 )
-				m_manager->m_instanceCubes.at(m_pos) = this;
+				m_manager->m_instanceBuckets.at(m_bucket).m_cubes.at(m_pos) = this;
 		}
 
 		InstancedCube& InstancedCube::operator=(InstancedCube&& other) noexcept
@@ -58,12 +59,14 @@ namespace clockwork {
 			this->remove();
 			m_changed = true;
 			m_pos = other.m_pos;
+			m_bucket = other.m_bucket;
 			m_manager = other.m_manager;
 			Renderable::operator=(std::move(other));
 			other.m_pos = -1;
+			other.m_bucket = -1;
 			other.m_manager = nullptr;
 			if ( m_pos != -1 )
-				m_manager->m_instanceCubes.at(m_pos) = this;
+				m_manager->m_instanceBuckets.at(m_bucket).m_cubes.at(m_pos) = this;
 			return *this;
 		}
 
@@ -71,8 +74,18 @@ namespace clockwork {
 		{
 			if ( m_changed )
 			{
-				m_manager->m_copyBuffer.setData(&m_textureId, sizeof(int), m_pos * ( sizeof(int) + sizeof(maths::Mat4f) ));
-				m_manager->m_copyBuffer.setData(m_gameObject->getModelMatrixMemoryLocation(), +sizeof(maths::Mat4f), m_pos * ( sizeof(int) + sizeof(maths::Mat4f) ) + sizeof(int));
+				CopyBuffer& copyBuffer = m_manager->m_instanceBuckets.at(m_bucket).m_copyBuffer;
+				int layer = m_manager->m_textureRegistry.getSlot(m_textureId).layer;
+				if ( m_manager->m_compactInstances )
+				{
+					CompactInstance instance = CompactInstance::pack(m_gameObject->getModelMatrix(), layer);
+					copyBuffer.setData(&instance, sizeof(CompactInstance), m_pos * sizeof(CompactInstance));
+				}
+				else
+				{
+					copyBuffer.setData(&layer, sizeof(int), m_pos * ( sizeof(int) + sizeof(maths::Mat4f) ));
+					copyBuffer.setData(m_gameObject->getModelMatrixMemoryLocation(), +sizeof(maths::Mat4f), m_pos * ( sizeof(int) + sizeof(maths::Mat4f) ) + sizeof(int));
+				}
 				m_changed = false;
 			}
 		}
@@ -85,11 +98,14 @@ namespace clockwork {
 #endif
 			if ( m_pos != -1 )
 			{
-				m_manager->m_instanceCubes.back()->m_pos = m_pos;
-				m_manager->m_instanceCubes.back()->m_changed = true;
-				m_manager->m_instanceCubes.at(m_pos) = m_manager->m_instanceCubes.back();
+				std::vector<InstancedCube*>& cubes = m_manager->m_instanceBuckets.at(m_bucket).m_cubes;
+				cubes.back()->m_pos = m_pos;
+				cubes.back()->m_changed = true;
+				cubes.at(m_pos) = cubes.back();
 				m_pos = -1;
-				m_manager->m_instanceCubes.erase(m_manager->m_instanceCubes.end() - 1);
+				m_bucket = -1;
+				cubes.erase(cubes.end() - 1);
+				--m_manager->m_instanceCount;
 			}
 		}
 
@@ -101,43 +117,57 @@ namespace clockwork {
 #endif
 			if ( m_pos == -1 )
 			{
-				unsigned int instanceCount = m_manager->m_instanceCubes.size();
+				m_bucket = m_manager->m_textureRegistry.getSlot(m_textureId).bucket;
+				CubeManager::InstanceBucket& bucket = m_manager->getInstanceBucket(m_bucket);
+				unsigned int instanceCount = bucket.m_cubes.size();
 				m_pos = instanceCount;
-				m_manager->m_instanceCubes.push_back(this);
+				bucket.m_cubes.push_back(this);
+				++m_manager->m_instanceCount;
 				m_changed = true;
-				if ( instanceCount * ( sizeof(int) + sizeof(maths::Mat4f) ) + ( sizeof(int) + sizeof(maths::Mat4f) ) >= m_manager->m_copyBuffer.getSize() )
+				if ( instanceCount * m_manager->getInstanceSize() + m_manager->getInstanceSize() >= bucket.m_copyBuffer.getSize() )
 				{
-					m_manager->m_copyBuffer.bind();
-					m_manager->m_copyBuffer.setSize(instanceCount * ( sizeof(int) + sizeof(maths::Mat4f) ) * 2);
+					bucket.m_copyBuffer.bind();
+					bucket.m_copyBuffer.setSize(( instanceCount + 1 ) * m_manager->getInstanceSize() * 2);
 				}
 			}
 		}
 
+		void InstancedCube::updateBucket() noexcept
+		{
+			if ( m_pos != -1 && m_manager->m_textureRegistry.getSlot(m_textureId).bucket != m_bucket )
+			{
+				remove();
+				add();
+			}
+			else
+				m_changed = true;
+		}
+
 		void InstancedCube::setTexture(int textureId) noexcept
 		{
 #if CLOCKWORK_DEBUG
-			if ( m_manager->m_textureArray.getTextureCount()<=textureId)
-				std::cout << "Error InstancedCube::setTexture(): TextureId is not in the texturearray2d of the cubemanager" << std::endl;
+			if ( m_manager->m_textureRegistry.getTextureCount()<=textureId)
+				std::cout << "Error InstancedCube::setTexture(): TextureId is not in the textureregistry of the cubemanager" << std::endl;
 #endif
 			m_textureId = textureId;
-			m_changed = true;
+			updateBucket();
 		}
 
 		void InstancedCube::setTexture(const utils::Image& image) noexcept
 		{
-			m_textureId = m_manager->m_textureArray.getTextureId(image);
-			m_changed = true;
+			m_textureId = m_manager->m_textureRegistry.getTextureId(image);
+			updateBucket();
 		}
 
 		void InstancedCube::setTexture(const std::string& imagePath) noexcept
 		{
-			m_textureId = m_manager->m_textureArray.getTextureId(imagePath);
-			m_changed = true;
+			m_textureId = m_manager->m_textureRegistry.getTextureId(imagePath);
+			updateBucket();
 		}
 
 		const utils::Image& InstancedCube::getTextureImage() noexcept
 		{
-			return m_manager->m_textureArray.getTexture(m_textureId);
+			return m_manager->m_textureRegistry.getTexture(m_textureId);
 		}
 
 		void InstancedCube::changeRenderer(Renderer* renderer) noexcept
@@ -147,13 +177,14 @@ namespace clockwork {
 			{
 				remove();
 				m_manager = &renderer->cubeManager;
+				m_textureId = m_manager->m_textureRegistry.getTextureId(image);//the textureid has to be set before adding it, because the bucket depends on the texture
 				add();
 			}
 			else
 			{
 				m_manager = &renderer->cubeManager;
+				m_textureId = m_manager->m_textureRegistry.getTextureId(image);
 			}
-			m_textureId = m_manager->m_textureArray.getTextureId(image);
 		}
 
 		const Renderer* const InstancedCube::getRenderer() const noexcept
@@ -27,7 +27,7 @@ namespace clockwork {
 		where the modelmatrix is used to display the instance with its transformation in the world and the textureid is used to display the correct texture
 		the instancedcube will have a pointer to a renderer, where a cubemanager will render all instancedcubes that are added to the cubemanager
 		the cubemanager can also add a texture to prepare for instancedcubes(textures are also automaticly added when adding instancedcubes), or remove an instancedcube from the render list
-		every texture/image has to be the same size(same resolution and same pixelkind(rgb/rgba), so you have to use the transparentinstancedcube and transparentinstancedcubemanager for transparency textures*/
+		the textures are stored in the textureregistry of the cubemanager and textures with diffrent sizes are sorted into diffrent buckets | the instancedcube is stored in the instance list of the bucket of its texture and all instancedcubes of one bucket are drawn with one drawcall*/
 		///NEUE KOMMENTARE | KANN NICHT TRANSPARENT SEIN
 		class InstancedCube
 			: public Renderable
@@ -37,15 +37,16 @@ namespace clockwork {
 			friend class CubeManager;
 			friend class Renderer;
 			int m_pos;
+			int m_bucket;
 			bool m_changed;
 			CubeManager* m_manager;
 
 		public:
 
 			/*creates an instancedcube that is not added to the cubemanager and will not be rendered | so you have to call add after the constructor to render it 
-			dont use this constructor, if the count of textures/images in the texturearray2d of the cubemanager is equal or less than the textureID, because it will give an error
-			@param[textureId] the id of the texture in the texturearray2d of the cubemanager that will be used for this model
-			every texture/image has to be the same size(same resolution and same pixelkind(rgb/rgba), so you have to use the transparentinstancedcube and transparentinstancedcubemanager for transparency textures
+			dont use this constructor, if the count of textures/images in the textureregistry of the cubemanager is equal or less than the textureID, because it will give an error
+			@param[textureId] the id of the texture in the textureregistry of the cubemanager that will be used for this model
+			textures with diffrent sizes/pixelkinds(rgb/rgba) are stored in diffrent buckets and each bucket costs one drawcall | dont use transparency textures, because instancedcubes are not sorted
 			@param[size] the scale of the size of the model
 			@param[rotation] the rotation of the model around each axis in degrees
 			@param[position] the position of the model
@@ -55,8 +56,8 @@ namespace clockwork {
 
 			/*creates an instancedcube that is not added to the cubemanager and will not be rendered | so you have to call add after the constructor to render it 
 			@param[imagePath] the path of a texture/image that will be used for this model
-			the textureId will be equal to the position of the image in the texturearray2d of the cubemanager and if the image is not already in the texturearray2d, it will be added to it
-			every texture/image has to be the same size(same resolution and same pixelkind(rgb/rgba), so you have to use the transparentinstancedcube and transparentinstancedcubemanager for transparency textures
+			the textureId will be equal to the position of the image in the textureregistry of the cubemanager and if the image is not already in the textureregistry, it will be added to it
+			textures with diffrent sizes/pixelkinds(rgb/rgba) are stored in diffrent buckets and each bucket costs one drawcall | dont use transparency textures, because instancedcubes are not sorted
 			@param[size] the scale of the size of the model
 			@param[rotation] the rotation of the model around each axis in degrees
 			@param[position] the position of the model
@@ -66,8 +67,8 @@ namespace clockwork {
 
 			/*creates an instancedcube that is not added to the cubemanager and will not be rendered | so you have to call add after the constructor to render it 
 			@param[image] the texture/image that will be used for this model
-			the textureId will be equal to the position of the image in the texturearray2d of the cubemanager and if the image is not already in the texturearray2d, it will be added to it
-			every texture/image has to be the same size(same resolution and same pixelkind(rgb/rgba), so you have to use the transparentinstancedcube and transparentinstancedcubemanager for transparency textures
+			the textureId will be equal to the position of the image in the textureregistry of the cubemanager and if the image is not already in the textureregistry, it will be added to it
+			textures with diffrent sizes/pixelkinds(rgb/rgba) are stored in diffrent buckets and each bucket costs one drawcall | dont use transparency textures, because instancedcubes are not sorted
 			@param[size] the scale of the size of the model
 			@param[rotation] the rotation of the model around each axis in degrees
 			@param[position] the position of the model
@@ -88,6 +89,10 @@ namespace clockwork {
 			/*moves the data, removes the old this object from the cubemanager and changes the pointer in the list of the cubemanager from the other object to this object*/
 			InstancedCube& operator=(InstancedCube&& other) noexcept;
 
+		private:
+			/*moves the instancedcube to the instance list of the bucket of its current texture, if its added and the bucket of the texture changed | otherwise the buffer data will just be updated*/
+			void updateBucket() noexcept;
+
 		public:
 
 			//wird nur von transparentmanager aufgerufen, auch ggf private |  copybuffer muss vorher gebindet werden und es wird ja eh automatisch gemacht vor dem rendern
@@ -108,24 +113,24 @@ namespace clockwork {
 
 
 			/*changes the texture of this instancedcube and automaticly updates the buffer(gpu side) in the cubemanager
-			dont use this method, if the count of textures/images in the texturearray2d of the cubemanager is equal or less than the textureID, because it will give an error
-			@param[textureId] the id of the texture in the texturearray2d of the cubemanager that will be used for this model
-			every texture/image has to be the same size(same resolution and same pixelkind(rgb/rgba), so you have to use the transparentinstancedcube and transparentinstancedcubemanager for transparency textures*/
+			dont use this method, if the count of textures/images in the textureregistry of the cubemanager is equal or less than the textureID, because it will give an error
+			@param[textureId] the id of the texture in the textureregistry of the cubemanager that will be used for this model
+			textures with diffrent sizes/pixelkinds(rgb/rgba) are stored in diffrent buckets and each bucket costs one drawcall | dont use transparency textures, because instancedcubes are not sorted*/
 			void setTexture(int textureId) noexcept;
 
 			/*changes the texture of this instancedcube and automaticly updates the buffer(gpu side) in the cubemanager
 			@param[image] the texture/image that will be used for this model
-			the textureId will be equal to the position of the image in the texturearray2d of the cubemanager and if the image is not already in the texturearray2d, it will be added to it
-			every texture/image has to be the same size(same resolution and same pixelkind(rgb/rgba), so you have to use the transparentinstancedcube and transparentinstancedcubemanager for transparency textures*/
+			the textureId will be equal to the position of the image in the textureregistry of the cubemanager and if the image is not already in the textureregistry, it will be added to it
+			textures with diffrent sizes/pixelkinds(rgb/rgba) are stored in diffrent buckets and each bucket costs one drawcall | dont use transparency textures, because instancedcubes are not sorted*/
 			void setTexture(const utils::Image& image) noexcept;
 
 			/*changes the texture of this instancedcube and automaticly updates the buffer(gpu side) in the cubemanager
 			@param[imagePath] the path of a texture/image that will be used for this model
-			the textureId will be equal to the position of the image in the texturearray2d of the cubemanager and if the image is not already in the texturearray2d, it will be added to it
-			every texture/image has to be the same size(same resolution and same pixelkind(rgb/rgba), so you have to use the transparentinstancedcube and transparentinstancedcubemanager for transparency textures*/
+			the textureId will be equal to the position of the image in the textureregistry of the cubemanager and if the image is not already in the textureregistry, it will be added to it
+			textures with diffrent sizes/pixelkinds(rgb/rgba) are stored in diffrent buckets and each bucket costs one drawcall | dont use transparency textures, because instancedcubes are not sorted*/
 			void setTexture(const std::string& imagePath) noexcept;
 
-			/*returns the image of the texture in the texturearray at the textureid with size, imagepath, etc | CAREFUL: the image has no imagedata, because it has been cleared*/
+			/*returns the image of the texture in the textureregistry at the textureid with size, imagepath, etc | CAREFUL: the image has no imagedata, because it has been cleared*/
 			const utils::Image& getTextureImage() noexcept;
 
 			void changeRenderer(Renderer* renderer) noexcept;///changerenderer auch in normalcube machen
@@ -134,6 +139,8 @@ namespace clockwork {
 
 		public:
 			inline const bool isAdded() const noexcept {return m_pos!=-1;}
+			/*returns the bucket of the textureregistry where the instancedcube is drawn | -1 if its not added*/
+			inline const int getBucket() const noexcept {return m_bucket;}
 			inline const bool hasChanged() const noexcept {return m_changed;}//wahrscheinlich wird es nicht gebraucht
 			inline void setChanged(bool changed) noexcept{m_changed=changed;}
 
@@ -19,7 +19,7 @@ namespace clockwork {
 	namespace graphics {
 
 		NormalCube::NormalCube(int textureId, bool transparent, logics::GameObject* gameObject, Renderer* renderer) noexcept
-			: Renderable(textureId, gameObject), m_visible(true), m_transparent(transparent), m_pos(-1), m_manager(&renderer->cubeManager)
+			: Renderable(textureId, gameObject), m_visible(true), m_transparent(transparent), m_batched(true), m_pos(-1), m_manager(&renderer->cubeManager)
 		{
 #if CLOCKWORK_DEBUG
 			if ( m_transparent )
@@ -36,7 +36,7 @@ namespace clockwork {
 		}
 
 		NormalCube::NormalCube(const std::string& imagePath, logics::GameObject* gameObject, Renderer* renderer) noexcept
-			: Renderable(0, gameObject), m_visible(true), m_pos(-1), m_manager(&renderer->cubeManager)
+			: Renderable(0, gameObject), m_visible(true), m_batched(true), m_pos(-1), m_manager(&renderer->cubeManager)
 		{
 			if ( m_manager->containsNormalTexture(imagePath) )
 			{
@@ -66,7 +66,7 @@ namespace clockwork {
 		}
 
 		NormalCube::NormalCube(const utils::Image& image, logics::GameObject* gameObject, Renderer* renderer) noexcept
-			: Renderable(0, gameObject), m_visible(true), m_pos(-1), m_manager(&renderer->cubeManager)
+			: Renderable(0, gameObject), m_visible(true), m_batched(true), m_pos(-1), m_manager(&renderer->cubeManager)
 		{
 			if ( image.hasAlpha() )
 			{
@@ -86,7 +86,7 @@ namespace clockwork {
 		}
 
 		NormalCube::NormalCube(NormalCube&& other) noexcept
-			: Renderable(std::move(other)), m_visible(other.m_visible), m_transparent(other.m_transparent), m_pos(other.m_pos), m_manager(other.m_manager)
+			: Renderable(std::move(other)), m_visible(other.m_visible), m_transparent(other.m_transparent), m_batched(other.m_batched), m_pos(other.m_pos), m_manager(other.m_manager)
 		{
 			other.m_pos = -1;
 			other.m_manager = nullptr;
@@ -104,6 +104,7 @@ namespace clockwork {
 			this->remove();
 			m_visible = other.m_visible;
 			m_transparent = other.m_transparent;
+			m_batched = other.m_batched;
 			m_pos = other.m_pos;
 			m_manager = other.m_manager;
 			Renderable::operator=(std::move(other));
@@ -278,12 +279,17 @@ namespace clockwork {
 			m_visible = visible;
 		}
 
+		void NormalCube::setBatched(bool batched) noexcept
+		{
+			m_batched = batched;
+		}
+
 		const utils::Image& NormalCube::getTextureImage() noexcept
 		{
 			if(m_transparent )
-				return m_manager->m_transparentTextures.at(m_textureId).getImage();
+				return m_manager->m_transparentTextures.at(m_textureId)->getImage();
 			else
-				return m_manager->m_normalTextures.at(m_textureId).getImage();
+				return m_manager->m_normalTextures.at(m_textureId)->getImage();
 
 		}
 
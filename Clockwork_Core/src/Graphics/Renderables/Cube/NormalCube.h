@@ -34,6 +34,7 @@ namespace clockwork {
 			int m_pos;
 			bool m_visible;
 			bool m_transparent;
+			bool m_batched;
 			CubeManager* m_manager;
 
 		public:
@@ -74,6 +75,10 @@ namespace clockwork {
 			//hier gibt setvisible schon guten performance boost
 			void setVisible(bool visible) noexcept;
 
+			/*batched normalcubes(the default) are drawn together with all other normalcubes of the same texture in one instanced drawcall and their render() method will not be called
+			set this to false if the cube needs its own uniforms(overridden render() method), then it will be drawn alone with the normal shader | transparent cubes are always drawn alone, because they have to be sorted*/
+			void setBatched(bool batched) noexcept;
+
 			/*returns the image of the texture in the texture list at the textureid with size, imagepath, etc | CAREFUL: the image has no imagedata, because it has been cleared*/
 			const utils::Image& getTextureImage() noexcept;
 
@@ -85,6 +90,7 @@ namespace clockwork {
 			inline const bool isAdded() const noexcept {return m_pos!=-1;}
 			inline const bool isVisible() const noexcept { return m_visible;}
 			inline const bool isTransparent() const noexcept {return m_transparent;}
+			inline const bool isBatched() const noexcept {return m_batched;}
 
 		};
 
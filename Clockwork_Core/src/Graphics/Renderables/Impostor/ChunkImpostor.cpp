@@ -0,0 +1,251 @@
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include <memory>
+#include "src\Logics\States\State.h"
+#include "src\Graphics\Renderer\Renderer.h"
+#include "src\Graphics\ContextThread.h"
+#include "src\Maths\MathFunctions.h"
+#include "ChunkImpostor.h"
+#include "ImpostorManager.h"
+
+namespace clockwork {
+	namespace graphics {
+
+		constexpr float ChunkImpostor::minCoverage;
+		constexpr unsigned int ChunkImpostor::maxResolution;
+
+		namespace {
+
+			/*the brightness of the faces that point towards -x, +x, -y, +y, -z, +z | the impostors have no normals, so the faces are shaded like a light from above*/
+			constexpr float faceShades[6] = { 0.8f, 0.8f, 0.5f, 1.0f, 0.7f, 0.7f };
+
+			/*the corners of a face on the 2 other axes | the faces towards the positive direction need the reverse order to be front facing*/
+			constexpr int faceCorners[2][4][2] = {
+				{ { 0, 0 }, { 0, 1 }, { 1, 1 }, { 1, 0 } },
+				{ { 0, 0 }, { 1, 0 }, { 1, 1 }, { 0, 1 } }
+			};
+
+		}
+
+		ChunkImpostor::Buffers::Buffers(const ImpostorGeometry& geometry, bool fill) noexcept
+			: m_vertexBuffer(fill ? geometry.vertices.data() : nullptr, geometry.vertices.size() * sizeof(ImpostorVertex)), m_indexBuffer(fill ? geometry.indices.data() : nullptr, geometry.indices.size()), m_filled(fill)
+		{
+			m_vertexBuffer.connectToVao<float>(3, false, sizeof(ImpostorVertex));//3d world position
+			m_vertexBuffer.connectToVao<unsigned char>(4, true, sizeof(ImpostorVertex));//shaded rgba colour
+			VertexBuffer::VaoPos = 0;
+			VertexBuffer::vaoOffset = 0;
+			m_array.unbind();
+		}
+
+		void ChunkImpostor::Buffers::fill(const ImpostorGeometry& geometry) noexcept
+		{
+			glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer.getId());
+			glBufferSubData(GL_ARRAY_BUFFER, 0, geometry.vertices.size() * sizeof(ImpostorVertex), geometry.vertices.data());
+			glBindBuffer(GL_ARRAY_BUFFER, m_indexBuffer.getId());//the indices are copied through the arraybuffer binding, because the elementarraybuffer binding belongs to the bound vertexarray
+			glBufferSubData(GL_ARRAY_BUFFER, 0, geometry.indices.size() * sizeof(unsigned int), geometry.indices.data());
+			glBindBuffer(GL_ARRAY_BUFFER, 0);
+		}
+
+		ChunkImpostor::ChunkImpostor(logics::State* state) noexcept
+			: m_buffers(nullptr), m_uploading(nullptr), m_triangleCount(0), m_pos(-1), m_manager(&state->getDefaultRenderer().m_impostorManager)
+		{}
+
+		ChunkImpostor::~ChunkImpostor() noexcept
+		{
+			remove();
+		}
+
+		void ChunkImpostor::build(ImpostorGeometry& geometry, const std::vector<ImpostorBox>& boxes, const maths::Vec3f& min, const maths::Vec3f& max, unsigned int resolution) noexcept
+		{
+			geometry.vertices.clear();
+			geometry.indices.clear();
+#if CLOCKWORK_DEBUG
+			if ( resolution == 0 || resolution > maxResolution )
+				std::cout << "Error ChunkImpostor::build(): the resolution has to be from 1 to " << maxResolution << std::endl;
+#endif
+			const int count = static_cast<int>( maths::max(1u, maths::min(resolution, maxResolution)) );
+			const float boundsMin[3] { min.x, min.y, min.z };
+			const float cellSize[3] { ( max.x - min.x ) / count, ( max.y - min.y ) / count, ( max.z - min.z ) / count };
+			if ( cellSize[0] <= 0.0f || cellSize[1] <= 0.0f || cellSize[2] <= 0.0f )
+				return;
+
+			//each box adds the part of each voxel that it covers to the coverage and its colour weighted by that part to the colour sum of the voxel
+			std::vector<float> coverage(count * count * count, 0.0f);
+			std::vector<float> colours(count * count * count * 3, 0.0f);
+			for ( unsigned int i = 0; i < boxes.size(); ++i )
+			{
+				const ImpostorBox& box = boxes[i];
+				const float boxMin[3] { box.min.x, box.min.y, box.min.z };
+				const float boxMax[3] { box.max.x, box.max.y, box.max.z };
+				int first[3], last[3];
+				bool inside = true;
+				for ( int axis = 0; axis < 3; ++axis )
+				{
+					const float lower = ( boxMin[axis] - boundsMin[axis] ) / cellSize[axis];
+					const float upper = ( boxMax[axis] - boundsMin[axis] ) / cellSize[axis];
+					if ( upper <= 0.0f || lower >= count )
+						inside = false;
+					first[axis] = maths::max(0, maths::min(static_cast<int>( maths::floor(lower) ), count - 1));
+					last[axis] = maths::max(0, maths::min(static_cast<int>( maths::ceil(upper) ) - 1, count - 1));
+				}
+				if ( !inside )
+					continue;
+
+				int cell[3];
+				for ( cell[0] = first[0]; cell[0] <= last[0]; ++cell[0] )
+				{
+					for ( cell[1] = first[1]; cell[1] <= last[1]; ++cell[1] )
+					{
+						for ( cell[2] = first[2]; cell[2] <= last[2]; ++cell[2] )
+						{
+							float overlap = 1.0f;
+							for ( int axis = 0; axis < 3; ++axis )
+							{
+								const float cellMin = boundsMin[axis] + cell[axis] * cellSize[axis];
+								overlap *= maths::max(0.0f, maths::min(boxMax[axis], cellMin + cellSize[axis]) - maths::max(boxMin[axis], cellMin)) / cellSize[axis];
+							}
+							if ( overlap <= 0.0f )
+								continue;
+							const int index = ( cell[0] * count + cell[1] ) * count + cell[2];
+							coverage[index] += overlap;
+							colours[index * 3] += box.colour.x * overlap;
+							colours[index * 3 + 1] += box.colour.y * overlap;
+							colours[index * 3 + 2] += box.colour.z * overlap;
+						}
+					}
+				}
+			}
+
+			//a face of a filled voxel is only needed if the neighbour voxel in its direction is empty, or outside of the bounds
+			int cell[3];
+			for ( cell[0] = 0; cell[0] < count; ++cell[0] )
+			{
+				for ( cell[1] = 0; cell[1] < count; ++cell[1] )
+				{
+					for ( cell[2] = 0; cell[2] < count; ++cell[2] )
+					{
+						const int index = ( cell[0] * count + cell[1] ) * count + cell[2];
+						if ( coverage[index] < minCoverage )
+							continue;
+						for ( int face = 0; face < 6; ++face )
+						{
+							const int axis = face / 2;
+							const int positive = face % 2;
+							int neighbour[3] { cell[0], cell[1], cell[2] };
+							neighbour[axis] += positive ? 1 : -1;
+							if ( neighbour[axis] >= 0 && neighbour[axis] < count && coverage[( neighbour[0] * count + neighbour[1] ) * count + neighbour[2]] >= minCoverage )
+								continue;
+
+							unsigned char colour[4] { 0, 0, 0, 255 };
+							for ( int channel = 0; channel < 3; ++channel )
+								colour[channel] = static_cast<unsigned char>( maths::max(0.0f, maths::min(colours[index * 3 + channel] / coverage[index] * faceShades[face], 1.0f)) * 255.0f + 0.5f );
+
+							const int u = ( axis + 1 ) % 3;
+							const int v = ( axis + 2 ) % 3;
+							const unsigned int base = geometry.vertices.size();
+							for ( int corner = 0; corner < 4; ++corner )
+							{
+								ImpostorVertex vertex;
+								vertex.position[axis] = boundsMin[axis] + ( cell[axis] + positive ) * cellSize[axis];
+								vertex.position[u] = boundsMin[u] + ( cell[u] + faceCorners[positive][corner][0] ) * cellSize[u];
+								vertex.position[v] = boundsMin[v] + ( cell[v] + faceCorners[positive][corner][1] ) * cellSize[v];
+								vertex.colour[0] = colour[0];
+								vertex.colour[1] = colour[1];
+								vertex.colour[2] = colour[2];
+								vertex.colour[3] = colour[3];
+								geometry.vertices.push_back(vertex);
+							}
+							geometry.indices.insert(geometry.indices.end(), { base, base + 1, base + 2, base, base + 2, base + 3 });
+						}
+					}
+				}
+			}
+		}
+
+		void ChunkImpostor::rebuild(std::vector<ImpostorBox>&& boxes, const maths::Vec3f& min, const maths::Vec3f& max, unsigned int resolution) noexcept
+		{
+			std::shared_ptr<std::vector<ImpostorBox>> sharedBoxes = std::make_shared<std::vector<ImpostorBox>>(std::move(boxes));//the task is copied into the threadpool, so the boxes are shared instead of copied
+			m_pending = utils::assetLoader->load<ImpostorGeometry>([sharedBoxes, min, max, resolution](ImpostorGeometry& geometry) {
+				build(geometry, *sharedBoxes, min, max, resolution);
+				return true;
+			});
+		}
+
+		void ChunkImpostor::render() noexcept
+		{
+			if ( m_pending.isFinished() )
+			{
+				if ( m_pending.isReady() )
+				{
+					const ImpostorGeometry& geometry = m_pending.get();
+					m_uploading = nullptr;//an older upload is discarded like an older build
+					if ( geometry.indices.empty() )
+					{
+						m_buffers = nullptr;
+						m_triangleCount = 0;
+					}
+					else if ( contextThread && contextThread->isValid() )
+					{
+						m_uploading = std::make_shared<Buffers>(geometry, false);
+						Buffers* buffers = m_uploading.get();//the finished callback keeps the buffers alive until after the task, so the vertexarray is deleted on the render thread
+						utils::AssetHandle<ImpostorGeometry> pending = m_pending;
+						std::shared_ptr<Buffers> uploading = m_uploading;
+						contextThread->addFillTask([buffers, pending]() {
+							buffers->fill(pending.get());
+						}, [uploading]() {
+							uploading->m_filled = true;
+						});
+					}
+					else
+					{
+						m_buffers = std::make_shared<Buffers>(geometry);
+						m_triangleCount = geometry.indices.size() / 3;
+					}
+				}
+				m_pending = utils::AssetHandle<ImpostorGeometry>();
+			}
+			if ( m_uploading && m_uploading->m_filled )
+			{
+				m_buffers = std::move(m_uploading);
+				m_uploading = nullptr;
+				m_triangleCount = m_buffers->m_indexBuffer.getCount() / 3;
+			}
+			if ( m_buffers )
+			{
+				m_buffers->m_array.bind();
+				m_buffers->m_indexBuffer.draw();
+			}
+		}
+
+		void ChunkImpostor::add() noexcept
+		{
+			if ( m_pos == -1 )
+			{
+				m_pos = m_manager->m_impostors.size();
+				m_manager->m_impostors.push_back(this);
+			}
+		}
+
+		void ChunkImpostor::remove() noexcept
+		{
+			if ( m_pos != -1 )
+			{
+				m_manager->m_impostors.back()->m_pos = m_pos;
+				m_manager->m_impostors.at(m_pos) = m_manager->m_impostors.back();
+				m_pos = -1;
+				m_manager->m_impostors.erase(m_manager->m_impostors.end() - 1);
+			}
+		}
+
+	}
+}
@@ -0,0 +1,128 @@
+#pragma once
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include <vector>
+#include <memory>
+#include "src\Maths\Vec3.h"
+#include "src\Maths\Vec4.h"
+#include "src\Graphics\Buffers\VertexBuffer.h"
+#include "src\Graphics\Buffers\IndexBuffer.h"
+#include "src\Graphics\Buffers\VertexArray.h"
+#include "src\Utils\AssetLoader.h"
+
+namespace clockwork {
+	namespace logics {
+		class State;
+	}
+	namespace graphics {
+
+		class ImpostorManager;
+
+		/*the world space box and the colour of one object in a chunk | the impostor is built from a copy of these boxes, so the worker thread never reads the gameobjects while they change*/
+		struct ImpostorBox
+		{
+			maths::Vec3f min;
+			maths::Vec3f max;
+			maths::Vec4f colour;
+		};
+
+		/*one vertex of an impostor(16 bytes) | the position is in world space, so the impostors need no modelmatrix and the colour is already shaded per face*/
+		struct ImpostorVertex
+		{
+			float position[3];
+			unsigned char colour[4];
+		};
+
+		/*the vertices and indices of an impostor that are built on a worker thread and uploaded on the render thread*/
+		struct ImpostorGeometry
+		{
+			std::vector<ImpostorVertex> vertices;
+			std::vector<unsigned int> indices;
+		};
+
+		/*a coarse replacement mesh for all objects of a chunk that is outside of the renderdistance, but inside of the impostordistance of the chunksystem
+		the bounds of the chunk are split into a grid of resolution^3 voxels and each voxel that is covered enough by the boxes of the objects is filled with their average colour | only the outer faces of the filled voxels are drawn
+		so a whole chunk is drawn with one drawcall of a few hundred triangles at most, which allows a much larger view distance than rendering the objects themselves
+		the impostor is rebuilt in the background by the global assetloader and keeps drawing its old geometry until the new one is uploaded
+		with a valid global contextthread the buffers are created empty on the render thread and the geometry is copied into them on the context thread, so only the vertexarray is set up on the render thread */
+		class ChunkImpostor
+		{
+
+		private:
+			friend class ImpostorManager;
+
+			/*the opengl buffers of the uploaded geometry | they are created again for each new geometry, because the buffers delete their ids only in the destructor*/
+			struct Buffers
+			{
+				VertexArray m_array;
+				VertexBuffer m_vertexBuffer;
+				IndexBuffer<unsigned int> m_indexBuffer;
+				bool m_filled;
+
+				/*creates the buffers with the size of the geometry and connects them to the vertexarray | the geometry is only copied into the buffers if fill is true, otherwise fill() has to be called*/
+				Buffers(const ImpostorGeometry& geometry, bool fill = true) noexcept;
+
+				/*copies the geometry into the buffers with glBufferSubData | only uses the opengl ids, so it can be called on the contextthread*/
+				void fill(const ImpostorGeometry& geometry) noexcept;
+			};
+
+		public:
+			/*a voxel is filled if the boxes cover at least this part of its volume*/
+			static constexpr float minCoverage = 0.25f;
+			static constexpr unsigned int maxResolution = 32;
+
+		private:
+			std::shared_ptr<Buffers> m_buffers;
+			std::shared_ptr<Buffers> m_uploading;//the buffers that are filled on the contextthread and replace m_buffers when they are finished
+			utils::AssetHandle<ImpostorGeometry> m_pending;
+			unsigned int m_triangleCount;
+			int m_pos;
+			ImpostorManager* m_manager;
+
+		public:
+			ChunkImpostor(logics::State* state) noexcept;
+
+			~ChunkImpostor() noexcept;
+
+			ChunkImpostor(const ChunkImpostor& other) = delete;
+
+			ChunkImpostor& operator=(const ChunkImpostor& other) = delete;
+
+		public:
+			/*builds the voxel mesh of the boxes inside of the bounds | can be called from any thread, because it does not use opengl
+			@param[resolution] the count of voxels along each axis of the bounds | from 1 to maxResolution*/
+			static void build(ImpostorGeometry& geometry, const std::vector<ImpostorBox>& boxes, const maths::Vec3f& min, const maths::Vec3f& max, unsigned int resolution) noexcept;
+
+			/*builds the impostor again from the boxes on a worker thread of the global assetloader | the old geometry is drawn until the new geometry is uploaded in the next render() call after the build is finished
+			if the impostor is rebuilt again before the last build is finished, the last build is discarded*/
+			void rebuild(std::vector<ImpostorBox>&& boxes, const maths::Vec3f& min, const maths::Vec3f& max, unsigned int resolution) noexcept;
+
+			/*uploads the geometry of a finished build(or starts its upload on the contextthread) and draws the impostor | the impostor shader has to be enabled first*/
+			void render() noexcept;
+
+			/*it is checked internally if the impostor is already added/removed*/
+			void add() noexcept;
+
+			void remove() noexcept;
+
+		public:
+			inline const bool isAdded() const noexcept {return m_pos != -1;}
+			/*returns true while a build is running, or waits for its upload*/
+			inline const bool isBuilding() const noexcept {return m_pending.isValid() || m_uploading != nullptr;}
+			inline const bool hasGeometry() const noexcept {return m_buffers != nullptr;}
+			inline const unsigned int getTriangleCount() const noexcept {return m_triangleCount;}
+
+		};
+
+	}
+}
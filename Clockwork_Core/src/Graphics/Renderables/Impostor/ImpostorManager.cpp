@@ -10,14 +10,28 @@
 * arising from the use of this software.
 * You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
 *************************************************************************/
-#include "MathFunctions.h"
-
+#include "ImpostorManager.h"
+#include "ChunkImpostor.h"
 
 namespace clockwork {
-	namespace maths {
-		double* sintable;
-		double* costable;
-		double* tantable;
+	namespace graphics {
+
+		ImpostorManager::ImpostorManager() noexcept
+		{}
+
+		void ImpostorManager::render() noexcept
+		{
+			for ( unsigned int i = 0; i < m_impostors.size(); ++i )
+				m_impostors[i]->render();
+		}
+
+		const unsigned int ImpostorManager::getTriangleCount() const noexcept
+		{
+			unsigned int count = 0;
+			for ( unsigned int i = 0; i < m_impostors.size(); ++i )
+				count += m_impostors[i]->getTriangleCount();
+			return count;
+		}
 
 	}
-}
\ No newline at end of file
+}
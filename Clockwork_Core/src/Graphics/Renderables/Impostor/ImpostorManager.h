@@ -0,0 +1,48 @@
+#pragma once
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include <vector>
+
+namespace clockwork {
+	namespace graphics {
+
+		class ChunkImpostor;
+		class Renderer;
+
+		/*the list of the chunkimpostors of a renderer that are drawn with the impostor shader after the opaque objects | only the defaultrenderer of a state is used by the chunks*/
+		class ImpostorManager
+		{
+
+		private:
+			friend class Renderer;
+			friend class ChunkImpostor;
+
+		private:
+			std::vector<ChunkImpostor*> m_impostors;
+
+		public:
+			ImpostorManager() noexcept;
+
+		public:
+			/*uploads the finished builds and draws all added impostors | the impostor shader has to be enabled first*/
+			void render() noexcept;
+
+			/*returns the count of triangles of all added impostors*/
+			const unsigned int getTriangleCount() const noexcept;
+
+			inline const unsigned int getSize() const noexcept {return m_impostors.size();}
+
+		};
+
+	}
+}
@@ -0,0 +1,179 @@
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "Mesh.h"
+#include <cstddef>
+
+namespace clockwork {
+	namespace graphics {
+
+		namespace {
+
+			/*the meshes of Mesh::get() | only weak references, so it can outlive the opengl context*/
+			utils::AssetCache<Mesh>& getMeshCache() noexcept
+			{
+				static utils::AssetCache<Mesh> meshCache("Mesh");
+				return meshCache;
+			}
+
+		}
+
+		Mesh::Mesh() noexcept
+			: m_bounds { { 0, 0, 0 }, { 0, 0, 0 } }, m_vertexTransform(maths::Mat4f::identity()), m_indexSize(2), m_halfFloatUVs(false), m_vertexCount(0), m_indexCount(0)
+		{
+			m_array.unbind();
+		}
+
+		Mesh::Mesh(const utils::CookedMesh& mesh) noexcept
+			: m_vertexBuffer(mesh.getVertexData(), mesh.getVertexCount() * sizeof(utils::PackedVertex)), m_bounds(mesh.getBounds()),
+			m_vertexTransform(maths::Mat4f::scaleTrans(m_bounds.max[0] - m_bounds.min[0], m_bounds.max[1] - m_bounds.min[1], m_bounds.max[2] - m_bounds.min[2], m_bounds.min[0], m_bounds.min[1], m_bounds.min[2])), m_indexSize(mesh.getIndexSize()), m_halfFloatUVs(mesh.hasHalfFloatUVs()),
+			m_vertexCount(mesh.getVertexCount()), m_indexCount(mesh.getIndexCount()), m_filepath(mesh.getFilepath())
+		{
+#if CLOCKWORK_DEBUG
+			if ( !mesh.hasData() )
+				std::cout << "Error Mesh::Mesh(): the cooked mesh has no data " << mesh.getFilepath() << std::endl;
+#endif
+			m_array.bind();
+			if ( m_indexSize == 2 )
+				m_shortIndices = IndexBuffer<unsigned short>(reinterpret_cast<const unsigned short*>( mesh.getIndexData() ), m_indexCount);
+			else
+				m_intIndices = IndexBuffer<unsigned int>(reinterpret_cast<const unsigned int*>( mesh.getIndexData() ), m_indexCount);
+			connectBuffers();
+			VertexBuffer::VaoPos = 0;
+			m_array.unbind();
+
+			m_parts.reserve(mesh.getSubmeshCount());
+			for ( unsigned int i = 0; i < mesh.getSubmeshCount(); ++i )
+			{
+				utils::Submesh submesh = mesh.getSubmesh(i);
+				m_parts.push_back(Part { std::vector<utils::SubmeshLod>(), static_cast<int>( submesh.baseVertex ), submesh.bounds, mesh.getMaterial(i) });
+				for ( unsigned int lod = 0; lod < mesh.getLodCount(); ++lod )
+					m_parts.back().lods.push_back(mesh.getSubmeshLod(i, lod));
+			}
+			for ( unsigned int lod = 0; lod < mesh.getLodCount(); ++lod )
+				m_lodErrors.push_back(mesh.getLodError(lod));
+		}
+
+		Mesh::Mesh(Mesh&& other) noexcept
+			: m_array(std::move(other.m_array)), m_vertexBuffer(std::move(other.m_vertexBuffer)), m_shortIndices(std::move(other.m_shortIndices)), m_intIndices(std::move(other.m_intIndices)), m_parts(std::move(other.m_parts)), m_lodErrors(std::move(other.m_lodErrors)),
+			m_bounds(other.m_bounds), m_vertexTransform(other.m_vertexTransform), m_indexSize(other.m_indexSize), m_halfFloatUVs(other.m_halfFloatUVs), m_vertexCount(other.m_vertexCount), m_indexCount(other.m_indexCount), m_filepath(std::move(other.m_filepath))
+		{
+			other.m_vertexCount = 0;
+			other.m_indexCount = 0;
+		}
+
+		Mesh& Mesh::operator=(Mesh&& other) noexcept
+		{
+			m_array = std::move(other.m_array);
+			m_vertexBuffer = std::move(other.m_vertexBuffer);
+			m_shortIndices = std::move(other.m_shortIndices);
+			m_intIndices = std::move(other.m_intIndices);
+			m_parts = std::move(other.m_parts);
+			m_lodErrors = std::move(other.m_lodErrors);
+			m_bounds = other.m_bounds;
+			m_vertexTransform = other.m_vertexTransform;
+			m_indexSize = other.m_indexSize;
+			m_halfFloatUVs = other.m_halfFloatUVs;
+			m_vertexCount = other.m_vertexCount;
+			m_indexCount = other.m_indexCount;
+			m_filepath = std::move(other.m_filepath);
+			other.m_vertexCount = 0;
+			other.m_indexCount = 0;
+			return *this;
+		}
+
+		MeshHandle Mesh::get(const std::string& meshPath) noexcept
+		{
+			utils::AssetCache<Mesh>& meshCache = getMeshCache();
+			unsigned int pathId = utils::internPath(meshPath);
+			MeshHandle mesh = meshCache.find(pathId);
+			if ( mesh )
+				return mesh;
+			utils::CookedMesh cooked(meshPath);
+			cooked.load();
+			Mesh uploaded(cooked);
+			unsigned long long bytes = uploaded.getSize();
+			return meshCache.insert(pathId, 0, bytes, std::move(uploaded));
+		}
+
+		const utils::AssetStatistics& Mesh::getStatistics() noexcept
+		{
+			return getMeshCache().getStatistics();
+		}
+
+		void Mesh::printStatistics() noexcept
+		{
+			getMeshCache().printStatistics();
+		}
+
+		void Mesh::bind() noexcept
+		{
+			m_array.bind();
+		}
+
+		void Mesh::connectBuffers() noexcept
+		{
+			m_vertexBuffer.bind();
+			if ( m_indexSize == 2 )
+				m_shortIndices.bind();
+			else
+				m_intIndices.bind();
+			m_vertexBuffer.connectToVao<unsigned short>(3, true, sizeof(utils::PackedVertex));//3d position from 0 to 1 inside of the bounds
+			VertexBuffer::vaoOffset = offsetof(utils::PackedVertex, uv);
+			if ( m_halfFloatUVs )
+				m_vertexBuffer.connectToVao<HalfFloat>(2, false, sizeof(utils::PackedVertex));//2d texture coords
+			else
+				m_vertexBuffer.connectToVao<unsigned short>(2, true, sizeof(utils::PackedVertex));
+			m_vertexBuffer.connectToVao<unsigned short>(2, true, sizeof(utils::PackedVertex));//octahedral vertex normal
+			VertexBuffer::vaoOffset = 0;
+		}
+
+		void Mesh::draw(unsigned int lod) const noexcept
+		{
+			for ( unsigned int i = 0; i < m_parts.size(); ++i )
+				drawSubmesh(i, lod);
+		}
+
+		void Mesh::drawSubmesh(unsigned int submesh, unsigned int lod) const noexcept
+		{
+			const Part& part = m_parts.at(submesh);
+			const utils::SubmeshLod& range = part.lods.at(lod < part.lods.size() ? lod : part.lods.size() - 1);
+			if ( m_indexSize == 2 )
+				m_shortIndices.drawPartsBaseVertex(range.firstIndex, range.indexCount, part.baseVertex);
+			else
+				m_intIndices.drawPartsBaseVertex(range.firstIndex, range.indexCount, part.baseVertex);
+		}
+
+		void Mesh::drawSubmeshInstanced(unsigned int submesh, unsigned int instanceCount, unsigned int lod) const noexcept
+		{
+			const Part& part = m_parts.at(submesh);
+			const utils::SubmeshLod& range = part.lods.at(lod < part.lods.size() ? lod : part.lods.size() - 1);
+			if ( m_indexSize == 2 )
+				m_shortIndices.drawInstancedPartsBaseVertex(range.firstIndex, range.indexCount, part.baseVertex, instanceCount);
+			else
+				m_intIndices.drawInstancedPartsBaseVertex(range.firstIndex, range.indexCount, part.baseVertex, instanceCount);
+		}
+
+		unsigned int Mesh::selectLod(unsigned int currentLod, float pixelsPerUnit, float threshold, float hysteresis) const noexcept
+		{
+			if ( m_lodErrors.empty() )
+				return 0;
+			unsigned int lod = currentLod < m_lodErrors.size() ? currentLod : m_lodErrors.size() - 1;
+			while ( lod + 1 < m_lodErrors.size() && m_lodErrors.at(lod + 1) * pixelsPerUnit < threshold * ( 1.0f - hysteresis ) )
+				++lod;
+			while ( lod > 0 && m_lodErrors.at(lod) * pixelsPerUnit > threshold * ( 1.0f + hysteresis ) )
+				--lod;
+			return lod;
+		}
+
+	}
+}
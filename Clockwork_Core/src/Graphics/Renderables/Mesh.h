@@ -1 +1,144 @@
 #pragma once
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include <memory>
+#include <string>
+#include <vector>
+#include "src\Utils\CookedMesh.h"
+#include "src\Utils\AssetCache.h"
+#include "src\Maths\Mat4x4.h"
+#include "src\Graphics\Buffers\VertexArray.h"
+#include "src\Graphics\Buffers\VertexBuffer.h"
+#include "src\Graphics\Buffers\IndexBuffer.h"
+
+namespace clockwork {
+	namespace graphics {
+
+		class Mesh;
+
+		/*a shared mesh from Mesh::get() | the mesh is deleted when the last handle is released*/
+		using MeshHandle = std::shared_ptr<Mesh>;
+
+		/*the gpu buffers of a cooked mesh(see utils::CookedMesh) | all submeshes share one vertexarray with one vertexbuffer of quantised vertices(utils::PackedVertex) and one indexbuffer with 16 or 32 bit indices
+		the vertexarray has the same locations as the vertexarrays of the cubes(position at 0, texture coords at 1 and vertex normal at 2), so the normal shaders can draw meshes
+		but the positions are from 0 to 1 inside of the bounds, so the modelmatrix has to be multiplied with getVertexTransform() | the normals are octahedral encoded as vec2 in the x and y of the vertex normal
+		the meshes are loaded only from cooked .cwms files, so there is no model parsing at runtime | use the meshcooker to cook model files with assimp
+		the simplified levels of detail of the cooked mesh are stored in the same indexbuffer, so a level is only another index range of each submesh and can be chosen per drawcall(see selectLod())*/
+		class Mesh
+		{
+
+		private:
+			/*the indices of one submesh for each level of detail and its material*/
+			struct Part
+			{
+				std::vector<utils::SubmeshLod> lods;
+				int baseVertex;
+				utils::MeshBounds bounds;
+				std::string material;
+			};
+
+		private:
+			VertexArray m_array;
+			VertexBuffer m_vertexBuffer;
+			IndexBuffer<unsigned short> m_shortIndices;
+			IndexBuffer<unsigned int> m_intIndices;
+			std::vector<Part> m_parts;
+			std::vector<float> m_lodErrors;
+			utils::MeshBounds m_bounds;
+			maths::Mat4f m_vertexTransform;
+			unsigned int m_indexSize;
+			bool m_halfFloatUVs;
+			unsigned int m_vertexCount;
+			unsigned int m_indexCount;
+			std::string m_filepath;
+
+		public:
+			/*creates an empty mesh without submeshes*/
+			Mesh() noexcept;
+
+			/*uploads the vertices and indices of the cooked mesh into the buffers | the cooked mesh needs data, so load() has to be called first*/
+			explicit Mesh(const utils::CookedMesh& mesh) noexcept;
+
+			Mesh(const Mesh& other) = delete;
+
+			Mesh(Mesh&& other) noexcept;
+
+			Mesh& operator=(const Mesh& other) = delete;
+
+			Mesh& operator=(Mesh&& other) noexcept;
+
+		public:
+			/*returns the shared mesh of the cooked .cwms file | the mesh is only loaded and uploaded once while a handle to it is alive, so all models with the same meshpath use the same buffers
+			must only be called on the render thread*/
+			static MeshHandle get(const std::string& meshPath) noexcept;
+
+			/*returns the statistics of the shared meshes of get()*/
+			static const utils::AssetStatistics& getStatistics() noexcept;
+
+			/*prints the statistics of the shared meshes into the console*/
+			static void printStatistics() noexcept;
+
+		public:
+			/*binds the vertexarray of the mesh, which also binds its indexbuffer*/
+			void bind() noexcept;
+
+			/*binds the vertexbuffer and the indexbuffer of the mesh and connects the vertex attributes to the currently bound vertexarray at position 0 to 2
+			after this call VertexBuffer::VaoPos is 3, so more attributes(like the modelmatrices of instances) can be connected to the vertexarray | used by the meshmanager to draw the mesh instanced*/
+			void connectBuffers() noexcept;
+
+			/*draws all submeshes at the level of detail | the vertexarray has to be bound first*/
+			void draw(unsigned int lod = 0) const noexcept;
+
+			/*draws one submesh at the level of detail | the vertexarray has to be bound first*/
+			void drawSubmesh(unsigned int submesh, unsigned int lod = 0) const noexcept;
+
+			/*draws one submesh at the level of detail for each instance | the vertexarray has to be bound first*/
+			void drawSubmeshInstanced(unsigned int submesh, unsigned int instanceCount, unsigned int lod = 0) const noexcept;
+
+			/*returns the coarsest level of detail whose error is smaller than threshold pixels on the screen
+			@param[currentLod] the level of detail of the last frame | the level only changes if its error is hysteresis(for example 0.25 = 25%) above, or below the threshold, so an object near the threshold does not switch its level every frame
+			@param[pixelsPerUnit] the size of one unit in model space on the screen in pixels(see MeshManager::getPixelsPerUnit())*/
+			unsigned int selectLod(unsigned int currentLod, float pixelsPerUnit, float threshold, float hysteresis) const noexcept;
+
+		public:
+			/*returns the material of the submesh | it is the path of the diffuse texture relative to the engine.exe, or empty*/
+			const std::string& getMaterial(unsigned int submesh) const noexcept {return m_parts.at(submesh).material;}
+
+			const utils::MeshBounds& getSubmeshBounds(unsigned int submesh) const noexcept {return m_parts.at(submesh).bounds;}
+
+			const unsigned int getSubmeshCount() const noexcept {return m_parts.size();}
+
+			/*returns the count of the levels of detail including level 0(the full detail)*/
+			const unsigned int getLodCount() const noexcept {return m_lodErrors.size();}
+
+			/*returns the error of the level of detail in model space | the biggest distance of the simplified surface from the full detail surface*/
+			const float getLodError(unsigned int lod) const noexcept {return m_lodErrors.at(lod);}
+
+			const utils::MeshBounds& getBounds() const noexcept {return m_bounds;}
+
+			/*returns the scaling and translation from the quantised positions(0 to 1) to the bounds of the mesh | draw the mesh with modelmatrix * vertextransform*/
+			const maths::Mat4f& getVertexTransform() const noexcept {return m_vertexTransform;}
+
+			const unsigned int getVertexCount() const noexcept {return m_vertexCount;}
+
+			const unsigned int getIndexCount() const noexcept {return m_indexCount;}
+
+			/*returns the gpu memory of the vertices and indices in bytes*/
+			const unsigned int getSize() const noexcept {return m_vertexCount * sizeof(utils::PackedVertex) + m_indexCount * m_indexSize;}
+
+			const std::string& getFilepath() const noexcept {return m_filepath;}
+
+		};
+
+	}
+}
@@ -0,0 +1,311 @@
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include <algorithm>
+#include <cmath>
+#include "MeshManager.h"
+#include "Model.h"
+#include "src\Graphics\Renderer\Renderer.h"
+#include "src\Logics\Entities\GameObject.h"
+#include "src\Maths\Batch.h"
+
+namespace clockwork {
+	namespace graphics {
+
+		struct TransparentModelCompare
+		{
+			const float* m_distances;//the squared camera distances at the positions of the models in the transparent list
+			TransparentModelCompare(const float* distances)
+				:m_distances(distances)
+			{}
+			inline bool operator()(Model* ptr1, Model* ptr2)
+			{
+				return m_distances[ptr1->m_pos] > m_distances[ptr2->m_pos];
+			}
+		};
+
+		MeshManager::MeshManager() noexcept
+			: m_batchedCount(0), m_reserved(0), m_lodScale(1.0f), m_orthographic(false), m_lodThreshold(1.0f), m_lodHysteresis(0.25f), m_renderer(nullptr)
+		{}
+
+		MeshManager::MeshManager(unsigned int reserved, Renderer* renderer) noexcept
+			: m_batchBuffer(nullptr, reserved * sizeof(maths::Mat4f), GL_STREAM_DRAW), m_batchedCount(0), m_reserved(reserved), m_lodScale(1.0f), m_orthographic(false), m_lodThreshold(1.0f), m_lodHysteresis(0.25f),
+			m_renderer(renderer)
+		{
+			m_buckets.reserve(4);
+			m_normalModels.reserve(reserved);
+			m_transparentModels.reserve(reserved);
+			m_batchMatrices.reserve(reserved);
+		}
+
+		MeshManager::~MeshManager() noexcept
+		{}
+
+		MeshManager::MeshManager(MeshManager&& other) noexcept
+			: m_batchBuffer(std::move(other.m_batchBuffer)), m_buckets(std::move(other.m_buckets)), m_bucketIds(std::move(other.m_bucketIds)), m_normalModels(std::move(other.m_normalModels)), m_transparentModels(std::move(other.m_transparentModels)),
+			m_batchMatrices(std::move(other.m_batchMatrices)), m_batchedCount(other.m_batchedCount), m_reserved(other.m_reserved), m_lodScale(other.m_lodScale), m_orthographic(other.m_orthographic), m_lodThreshold(other.m_lodThreshold),
+			m_lodHysteresis(other.m_lodHysteresis), m_renderer(other.m_renderer)
+		{
+			for ( auto& bucket : m_buckets )
+			{
+				for ( auto model : bucket.m_models )
+					model->m_manager = this;
+			}
+			for ( auto model : m_normalModels )
+				model->m_manager = this;
+			for ( auto model : m_transparentModels )
+				model->m_manager = this;
+			other.m_batchedCount = 0;
+			other.m_renderer = nullptr;
+		}
+
+		MeshManager& MeshManager::operator=(MeshManager&& other) noexcept
+		{
+			m_batchBuffer = std::move(other.m_batchBuffer);
+			m_buckets = std::move(other.m_buckets);
+			m_bucketIds = std::move(other.m_bucketIds);
+			m_normalModels = std::move(other.m_normalModels);
+			m_transparentModels = std::move(other.m_transparentModels);
+			m_batchMatrices = std::move(other.m_batchMatrices);
+			m_batchedCount = other.m_batchedCount;
+			m_reserved = other.m_reserved;
+			m_lodScale = other.m_lodScale;
+			m_orthographic = other.m_orthographic;
+			m_lodThreshold = other.m_lodThreshold;
+			m_lodHysteresis = other.m_lodHysteresis;
+			m_renderer = other.m_renderer;
+			for ( auto& bucket : m_buckets )
+			{
+				for ( auto model : bucket.m_models )
+					model->m_manager = this;
+			}
+			for ( auto model : m_normalModels )
+				model->m_manager = this;
+			for ( auto model : m_transparentModels )
+				model->m_manager = this;
+			other.m_batchedCount = 0;
+			other.m_renderer = nullptr;
+			return *this;
+		}
+
+		int MeshManager::getBucket(const MeshHandle& mesh) noexcept
+		{
+			auto bucketId = m_bucketIds.find(mesh.get());
+			if ( bucketId != m_bucketIds.end() )
+				return bucketId->second;
+			m_buckets.push_back(MeshBucket());
+			MeshBucket& bucket = m_buckets.back();
+			bucket.m_mesh = mesh;
+			bucket.m_visibleCount = 0;
+			bucket.m_models.reserve(m_reserved);
+			bucket.m_array.bind();
+			bucket.m_mesh->connectBuffers();
+			m_batchBuffer.bind();
+			m_batchBuffer.connectToVao<float>(4, false, sizeof(maths::Mat4f), 1);//4 vec4s modelmatrices | the offset is moved to the start of the bucket in the batchbuffer before drawing it
+			m_batchBuffer.connectToVao<float>(4, false, sizeof(maths::Mat4f), 1);
+			m_batchBuffer.connectToVao<float>(4, false, sizeof(maths::Mat4f), 1);
+			m_batchBuffer.connectToVao<float>(4, false, sizeof(maths::Mat4f), 1);
+			VertexBuffer::vaoOffset = 0;
+			VertexBuffer::VaoPos = 0;
+			bucket.m_array.unbind();
+			return m_bucketIds[mesh.get()] = m_buckets.size() - 1;
+		}
+
+		void MeshManager::removeBucket(int bucket) noexcept
+		{
+			m_bucketIds.erase(m_buckets.at(bucket).m_mesh.get());
+			if ( bucket != m_buckets.size() - 1 )
+			{
+				m_buckets.at(bucket) = std::move(m_buckets.back());
+				for ( auto model : m_buckets.at(bucket).m_models )
+					model->m_bucket = bucket;
+				m_bucketIds[m_buckets.at(bucket).m_mesh.get()] = bucket;
+			}
+			m_buckets.pop_back();
+		}
+
+		std::vector<Model*>& MeshManager::getList(const Model* model) noexcept
+		{
+			if ( model->m_bucket != -1 )
+				return m_buckets.at(model->m_bucket).m_models;
+			if ( model->m_transparent )
+				return m_transparentModels;
+			return m_normalModels;
+		}
+
+		void MeshManager::addModel(Model* model) noexcept
+		{
+			if ( !model->m_transparent && model->m_batched )
+			{
+				model->m_bucket = getBucket(model->m_mesh);
+				++m_batchedCount;
+			}
+			std::vector<Model*>& list = getList(model);
+			model->m_pos = list.size();
+			list.push_back(model);
+		}
+
+		void MeshManager::removeModel(Model* model) noexcept
+		{
+			std::vector<Model*>& list = getList(model);
+			list.back()->m_pos = model->m_pos;
+			list.at(model->m_pos) = list.back();
+			list.pop_back();
+			model->m_pos = -1;
+			if ( model->m_bucket != -1 )
+			{
+				--m_batchedCount;
+				if ( list.empty() )
+					removeBucket(model->m_bucket);
+				model->m_bucket = -1;
+			}
+		}
+
+		unsigned int MeshManager::updateLod(Model* model, const maths::Vec3f& cameraPosition) noexcept
+		{
+			model->m_lod = model->m_mesh->selectLod(model->m_lod, getPixelsPerUnit(*model, cameraPosition), m_lodThreshold, m_lodHysteresis);
+			return model->m_lod;
+		}
+
+		void MeshManager::renderNormalModels() noexcept
+		{
+			Shader* shader = m_renderer->normalShader;
+			const maths::Vec3f& cameraPosition = ( *m_renderer->m_currentCamera )->getPosition();
+			for ( auto model : m_normalModels )
+			{
+				if ( model->m_visible )
+				{
+					updateLod(model, cameraPosition);
+					model->render(shader);
+				}
+			}
+		}
+
+		void MeshManager::renderBatchedModels() noexcept
+		{
+			m_batchMatrices.clear();
+			const maths::Vec3f& cameraPosition = ( *m_renderer->m_currentCamera )->getPosition();
+			for ( auto& bucket : m_buckets )
+			{
+				unsigned int start = m_batchMatrices.size();
+				const maths::Mat4f& vertexTransform = bucket.m_mesh->getVertexTransform();//the positions of the mesh are quantised inside of its bounds
+				bucket.m_lodCounts.assign(std::max(bucket.m_mesh->getLodCount(), 1u), 0);
+				for ( auto model : bucket.m_models )
+				{
+					if ( model->m_visible )
+						++bucket.m_lodCounts.at(updateLod(model, cameraPosition));
+				}
+				for ( unsigned int lod = 0; lod < bucket.m_lodCounts.size(); ++lod )//the modelmatrices of each level of detail are one range in the batchbuffer
+				{
+					if ( bucket.m_lodCounts.at(lod) == 0 )
+						continue;
+					for ( auto model : bucket.m_models )
+					{
+						if ( model->m_visible && model->m_lod == lod )
+							m_batchMatrices.push_back(model->m_gameObject->getModelMatrix() * vertexTransform);
+					}
+				}
+				bucket.m_visibleCount = m_batchMatrices.size() - start;
+			}
+			if ( m_batchMatrices.size() == 0 )
+				return;
+			m_batchBuffer.bind();
+			unsigned int size = m_batchMatrices.size() * sizeof(maths::Mat4f);
+			if ( size > m_batchBuffer.getSize() )
+				m_batchBuffer.reset(size * 2);
+			else
+				m_batchBuffer.reset(m_batchBuffer.getSize());//orphans the old data, so the driver doesnt have to wait for the drawcalls of the last frame
+			m_batchBuffer.setData(m_batchMatrices.data(), size);
+			unsigned int start = 0;
+			for ( auto& bucket : m_buckets )
+			{
+				if ( bucket.m_visibleCount != 0 )
+				{
+					bucket.m_array.bind();
+					const std::vector<TextureHandle>& textures = bucket.m_models.front()->m_textures;//all models of a bucket have the textures of the materials of the same mesh
+					for ( unsigned int lod = 0; lod < bucket.m_lodCounts.size(); ++lod )
+					{
+						unsigned int count = bucket.m_lodCounts.at(lod);
+						if ( count == 0 )
+							continue;
+						VertexBuffer::VaoPos = 3;//the modelmatrix attributes of the batch shader start at location 3
+						VertexBuffer::vaoOffset = start * sizeof(maths::Mat4f);
+						m_batchBuffer.connectToVao<float>(4, false, sizeof(maths::Mat4f), 1);
+						m_batchBuffer.connectToVao<float>(4, false, sizeof(maths::Mat4f), 1);
+						m_batchBuffer.connectToVao<float>(4, false, sizeof(maths::Mat4f), 1);
+						m_batchBuffer.connectToVao<float>(4, false, sizeof(maths::Mat4f), 1);
+						for ( unsigned int i = 0; i < bucket.m_mesh->getSubmeshCount(); ++i )
+						{
+							if ( textures.at(i) )
+								textures.at(i)->bind();
+							bucket.m_mesh->drawSubmeshInstanced(i, count, lod);
+						}
+						start += count;
+					}
+				}
+			}
+			VertexBuffer::vaoOffset = 0;
+			VertexBuffer::VaoPos = 0;
+		}
+
+		void MeshManager::renderTransparentModels() noexcept
+		{
+			const maths::Vec3f& cameraPosition = ( *m_renderer->m_currentCamera )->getPosition();
+			const unsigned int count = m_transparentModels.size();
+			m_sortPositions.resize(count);
+			m_sortDistances.resize(count);
+			for ( unsigned int i = 0; i < count; ++i )//m_pos is the position in the transparent list, so the compare can find the distance of a model while sorting
+				m_sortPositions[i] = m_transparentModels[i]->m_gameObject->getPosition();
+			maths::distancesSquared(cameraPosition, m_sortPositions.data(), m_sortDistances.data(), count);
+			std::sort(m_transparentModels.begin(), m_transparentModels.end(), TransparentModelCompare { m_sortDistances.data() });
+			Shader* shader = m_renderer->normalShader;
+			for ( unsigned int i = 0; i < m_transparentModels.size(); ++i )
+			{
+				Model* model = m_transparentModels.at(i);
+				model->m_pos = i;
+				if ( model->m_visible )
+				{
+					updateLod(model, cameraPosition);
+					model->render(shader);
+				}
+			}
+		}
+
+		void MeshManager::setProjection(const maths::Mat4f& projection, unsigned int viewportHeight) noexcept
+		{
+			m_orthographic = projection.w4 != 0.0f;//a perspective projection moves the negative z into w, so w4 is 0
+			m_lodScale = std::abs(projection.y2) * viewportHeight * 0.5f;
+		}
+
+		void MeshManager::setLodThreshold(float pixels, float hysteresis) noexcept
+		{
+#if CLOCKWORK_DEBUG
+			if ( pixels <= 0.0f || hysteresis < 0.0f || hysteresis >= 1.0f )
+				std::cout << "Error MeshManager::setLodThreshold(): the threshold has to be bigger than 0 and the hysteresis has to be from 0 to 1" << std::endl;
+#endif
+			m_lodThreshold = pixels;
+			m_lodHysteresis = hysteresis;
+		}
+
+		float MeshManager::getPixelsPerUnit(const Model& model, const maths::Vec3f& cameraPosition) const noexcept
+		{
+			const float minDistance = 0.001f;
+			const maths::Vec3f& size = model.m_gameObject->getSize();
+			float scale = std::max(std::abs(size.x), std::max(std::abs(size.y), std::abs(size.z)));
+			if ( m_orthographic )
+				return scale * m_lodScale;
+			float distance = model.m_gameObject->getPosition().distance(cameraPosition);
+			return scale * m_lodScale / ( distance > minDistance ? distance : minDistance );
+		}
+
+	}
+}
@@ -0,0 +1,141 @@
+#pragma once
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include <vector>
+#include <unordered_map>
+#include "src\Maths\Mat4x4.h"
+#include "src\Graphics\Buffers\VertexBuffer.h"
+#include "src\Graphics\Buffers\VertexArray.h"
+#include "src\Graphics\Renderables\Mesh.h"
+
+namespace clockwork {
+	namespace graphics {
+
+		class Model;
+		class Renderer;
+
+		/*the meshmanager of a renderer draws the models like the cubemanager draws the cubes, but for any mesh instead of the hardcoded cube buffers
+		batched models(the default) are sorted into one meshbucket per mesh and all visible models of a bucket are drawn with one instanced drawcall per submesh, so thousands of models with the same mesh only need a few drawcalls
+		models that are not batched(Model::setBatched(false)) are drawn one by one with their own render() call and the normal shader | models with transparent textures are always drawn one by one and sorted back to front
+		each frame the level of detail of every visible model is chosen from the projected error of the levels of its mesh(Mesh::selectLod()), so far away models are drawn with less triangles
+		the batched models of a bucket are grouped by their level of detail, so a bucket needs one instanced drawcall per submesh for each level that is used*/
+		class MeshManager
+		{
+
+		private:
+			friend class Model;
+			friend class Renderer;
+
+			/*the batched models of one mesh | the vertexarray of a bucket connects the buffers of the mesh and the modelmatrices of the shared batchbuffer at position 3 to 6
+			the bucket holds a handle to the mesh, so the buffers in its vertexarray stay valid until the last model of the mesh is removed*/
+			struct MeshBucket
+			{
+				VertexArray m_array;
+				MeshHandle m_mesh;
+				std::vector<Model*> m_models;
+				std::vector<unsigned int> m_lodCounts;//the visible models at each level of detail
+				unsigned int m_visibleCount;
+			};
+
+		private:
+			VertexBuffer m_batchBuffer;
+			std::vector<MeshBucket> m_buckets;
+			std::unordered_map<const Mesh*, int> m_bucketIds;//the bucket of each mesh in m_buckets
+			std::vector<Model*> m_normalModels;
+			std::vector<Model*> m_transparentModels;
+			std::vector<maths::Mat4f> m_batchMatrices;
+			std::vector<maths::Vec3f> m_sortPositions;//the positions and squared camera distances of the transparent models for sorting them | only reused memory, so they are not moved
+			std::vector<float> m_sortDistances;
+			unsigned int m_batchedCount;
+			unsigned int m_reserved;
+			float m_lodScale;//the pixels on the screen of one unit at the distance 1 from the camera
+			bool m_orthographic;//the size on the screen does not depend on the distance
+			float m_lodThreshold;
+			float m_lodHysteresis;
+			Renderer* m_renderer;
+
+		public:
+
+			MeshManager() noexcept;
+
+			MeshManager(unsigned int reserved, Renderer* renderer) noexcept;
+
+			~MeshManager() noexcept;
+
+			MeshManager(const MeshManager& other) = delete;
+
+			MeshManager(MeshManager&& other) noexcept;
+
+			MeshManager& operator=(const MeshManager& other) = delete;
+
+			MeshManager& operator=(MeshManager&& other) noexcept;
+
+		private:
+			/*returns the bucket of the mesh and creates the bucket with its vertexarray if the mesh has no bucket yet*/
+			int getBucket(const MeshHandle& mesh) noexcept;
+
+			/*removes the empty bucket and moves the last bucket to its position*/
+			void removeBucket(int bucket) noexcept;
+
+			/*returns the list of the added model | the models of its bucket, the normal models, or the transparent models*/
+			std::vector<Model*>& getList(const Model* model) noexcept;
+
+			/*adds the model to its bucket, the normal models, or the transparent models depending on its mesh and flags*/
+			void addModel(Model* model) noexcept;
+
+			/*removes the model from its list like NormalCube::remove() | the last model of the list is moved to the position of the model and an empty bucket is removed*/
+			void removeModel(Model* model) noexcept;
+
+			/*chooses the level of detail of the model from its size on the screen and returns it*/
+			unsigned int updateLod(Model* model, const maths::Vec3f& cameraPosition) noexcept;
+
+		public:
+			/*renders the visible models that are not batched one by one with their own render() call | the normal shader has to be enabled first*/
+			void renderNormalModels() noexcept;
+
+			/*uploads the modelmatrices of the visible batched models of all buckets at once into the batchbuffer and draws each bucket with one instanced drawcall per submesh | the batch shader has to be enabled first
+			the render() methods of batched models are not called, so set a model to not batched if it needs its own uniforms*/
+			void renderBatchedModels() noexcept;
+
+			/*sorts the transparent models back to front and renders the visible ones with their own render() call | the normal shader has to be enabled first*/
+			void renderTransparentModels() noexcept;
+
+			/*updates the size of the projected errors of the levels of detail | called by Renderer::updateProjection() with the projection matrix and the height of the viewport in pixels*/
+			void setProjection(const maths::Mat4f& projection, unsigned int viewportHeight) noexcept;
+
+			/*sets the biggest error of a level of detail in pixels on the screen(the default is 1 pixel) | a bigger threshold draws models with less triangles closer to the camera
+			@param[hysteresis] the level of a model only changes if its projected error is this much(for example 0.25 = 25%) above, or below the threshold, so models near the threshold dont switch between 2 levels every frame*/
+			void setLodThreshold(float pixels, float hysteresis = 0.25f) noexcept;
+
+			/*returns the size of one unit in model space of the model on the screen in pixels | it is the biggest size(scaling) of the gameobject times the pixels per unit of the projection divided by the distance to the camera*/
+			float getPixelsPerUnit(const Model& model, const maths::Vec3f& cameraPosition) const noexcept;
+
+			const Renderer* const getRenderer() const noexcept {return m_renderer;}
+
+			inline const unsigned int getBatchedCount() const noexcept {return m_batchedCount;}
+
+			inline const unsigned int getNormalCount() const noexcept {return m_normalModels.size();}
+
+			inline const unsigned int getTransparentCount() const noexcept {return m_transparentModels.size();}
+
+			/*returns the count of diffrent meshes of the batched models | each of them needs one instanced drawcall per submesh*/
+			inline const unsigned int getBucketCount() const noexcept {return m_buckets.size();}
+
+			inline const float getLodThreshold() const noexcept {return m_lodThreshold;}
+
+			inline const float getLodHysteresis() const noexcept {return m_lodHysteresis;}
+
+		};
+
+	}
+}
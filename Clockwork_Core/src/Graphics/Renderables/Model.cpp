@@ -0,0 +1,148 @@
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "Model.h"
+#include "src\Graphics\Renderer\Renderer.h"
+#include "src\Logics\Entities\GameObject.h"
+
+namespace clockwork {
+	namespace graphics {
+
+		Model::Model(const std::string& meshPath, logics::GameObject* gameObject, Renderer* renderer) noexcept
+			: Renderable(0, gameObject), m_pos(-1), m_bucket(-1), m_lod(0), m_visible(true), m_transparent(false), m_batched(true), m_manager(&renderer->meshManager)
+		{
+			setMesh(meshPath);
+		}
+
+		Model::~Model() noexcept
+		{
+			this->remove();
+		}
+
+		Model::Model(Model&& other) noexcept
+			: Renderable(std::move(other)), m_mesh(std::move(other.m_mesh)), m_textures(std::move(other.m_textures)), m_pos(other.m_pos), m_bucket(other.m_bucket), m_lod(other.m_lod), m_visible(other.m_visible), m_transparent(other.m_transparent),
+			m_batched(other.m_batched), m_manager(other.m_manager)
+		{
+			other.m_pos = -1;
+			other.m_bucket = -1;
+			if ( m_pos != -1 )
+				m_manager->getList(this).at(m_pos) = this;
+		}
+
+		Model& Model::operator=(Model&& other) noexcept
+		{
+			this->remove();
+			Renderable::operator=(std::move(other));
+			m_mesh = std::move(other.m_mesh);
+			m_textures = std::move(other.m_textures);
+			m_pos = other.m_pos;
+			m_bucket = other.m_bucket;
+			m_lod = other.m_lod;
+			m_visible = other.m_visible;
+			m_transparent = other.m_transparent;
+			m_batched = other.m_batched;
+			m_manager = other.m_manager;
+			other.m_pos = -1;
+			other.m_bucket = -1;
+			if ( m_pos != -1 )
+				m_manager->getList(this).at(m_pos) = this;
+			return *this;
+		}
+
+		void Model::render(Shader* shader) noexcept
+		{
+			shader->setUniform("u_model", m_gameObject->getModelMatrix() * m_mesh->getVertexTransform());//the positions of the mesh are quantised inside of its bounds
+			m_mesh->bind();
+			for ( unsigned int i = 0; i < m_mesh->getSubmeshCount(); ++i )
+			{
+				if ( m_textures.at(i) )
+					m_textures.at(i)->bind();
+				m_mesh->drawSubmesh(i, m_lod);
+			}
+		}
+
+		void Model::add() noexcept
+		{
+#if CLOCKWORK_DEBUG == 2
+			if ( m_pos != -1 )
+				std::cout << "Info Model::add(): Model was already added" << std::endl;
+#endif
+			if ( m_pos == -1 )
+				m_manager->addModel(this);
+		}
+
+		void Model::remove() noexcept
+		{
+#if CLOCKWORK_DEBUG == 2
+			if ( m_pos == -1 )
+				std::cout << "Info Model::remove(): Model was already removed" << std::endl;
+#endif
+			if ( m_pos != -1 )
+				m_manager->removeModel(this);
+		}
+
+		void Model::setVisible(bool visible) noexcept
+		{
+			m_visible = visible;
+		}
+
+		void Model::setMesh(const std::string& meshPath) noexcept
+		{
+			bool added = m_pos != -1;
+			if ( added )
+				remove();
+			m_mesh = Mesh::get(meshPath);
+			m_lod = 0;
+			m_textures.clear();
+			m_transparent = false;
+			for ( unsigned int i = 0; i < m_mesh->getSubmeshCount(); ++i )
+			{
+				const std::string& material = m_mesh->getMaterial(i);
+				m_textures.push_back(material.empty() ? nullptr : textureCache->get(material));
+				if ( m_textures.back() && m_textures.back()->getImage().hasAlpha() )
+					m_transparent = true;
+			}
+			if ( added )
+				add();
+		}
+
+		void Model::setBatched(bool batched) noexcept
+		{
+			if ( batched != m_batched && m_pos != -1 )
+			{
+				remove();
+				m_batched = batched;
+				add();
+			}
+			else
+				m_batched = batched;
+		}
+
+		void Model::changeRenderer(Renderer* renderer) noexcept
+		{
+			if ( m_pos != -1 )
+			{
+				remove();
+				m_manager = &renderer->meshManager;
+				add();
+			}
+			else
+				m_manager = &renderer->meshManager;
+		}
+
+		const Renderer* const Model::getRenderer() const noexcept
+		{
+			return m_manager->m_renderer;
+		}
+
+	}
+}
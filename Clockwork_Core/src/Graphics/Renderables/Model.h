@@ -1,4 +1,96 @@
 #pragma once
-//model mit mehreren meshes
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "src\Graphics\Renderables\Renderable.h"
+#include "src\Graphics\Renderables\Mesh.h"
+#include "src\Graphics\Textures\TextureCache.h"
 
-//AUCH COPY/MOVE KONSTRUKTOR/OPERATOR auch in mesh und image und file 
\ No newline at end of file
+namespace clockwork {
+	namespace logics {
+		class GameObject;
+	}
+	namespace graphics {
+
+		class Renderer;
+		class MeshManager;
+		class Shader;
+
+		/*a gameobject that is drawn with a shared mesh and the textures of the materials of its submeshes | the mesh and the textures are shared with all other models through Mesh::get() and the global texturecache
+		the models are drawn by the meshmanager of their renderer | batched models with the same mesh are drawn together with one instanced drawcall per submesh, the other models need one drawcall per submesh*/
+		class Model
+			: public Renderable
+		{
+
+		protected:
+			friend class MeshManager;
+			friend struct TransparentModelCompare;
+			MeshHandle m_mesh;
+			std::vector<TextureHandle> m_textures;//the texture of each submesh, or an empty handle if the submesh has no material
+			int m_pos;
+			int m_bucket;//the meshbucket in the meshmanager of a batched model, or -1
+			unsigned int m_lod;//the level of detail of the mesh that is drawn | chosen by the meshmanager each frame
+			bool m_visible;
+			bool m_transparent;
+			bool m_batched;
+			MeshManager* m_manager;
+
+		public:
+			/*creates a model with the cooked mesh(.cwms) at the meshpath and loads the textures of its materials | the model is not added to the meshmanager of the renderer, so call add() to draw it*/
+			Model(const std::string& meshPath, logics::GameObject* gameObject, Renderer* renderer) noexcept;
+
+			virtual ~Model() noexcept;
+
+			Model(const Model& other) = delete;
+
+			Model(Model&& other) noexcept;
+
+			Model& operator=(const Model& other) = delete;
+
+			Model& operator=(Model&& other) noexcept;
+
+		public:
+			/*sets the modelmatrix of the gameobject and draws each submesh with its texture at the level of detail of the model | the shader has to be enabled first | can be overridden to set more uniforms, but it is not called for batched models*/
+			virtual void render(Shader* shader) noexcept;
+
+			/*adds the model to the meshmanager of the renderer, so it is drawn each frame | it is checked internally if the model was already added*/
+			void add() noexcept;
+
+			/*removes the model from the meshmanager of the renderer | it is checked internally if the model was already removed*/
+			void remove() noexcept;
+
+			void setVisible(bool visible) noexcept;
+
+			/*changes the mesh and loads the textures of its materials | the model is transparent if one of the textures has an alpha channel*/
+			void setMesh(const std::string& meshPath) noexcept;
+
+			/*batched models(the default) are drawn together with all other models of the same mesh and their render() method will not be called
+			set this to false if the model needs its own uniforms(overridden render() method) | transparent models are always drawn alone, because they have to be sorted*/
+			void setBatched(bool batched) noexcept;
+
+			void changeRenderer(Renderer* renderer) noexcept;
+
+			const Renderer* const getRenderer() const noexcept;
+
+		public:
+			inline const Mesh& getMesh() const noexcept {return *m_mesh;}
+			inline const bool isAdded() const noexcept {return m_pos != -1;}
+			inline const bool isVisible() const noexcept {return m_visible;}
+			inline const bool isTransparent() const noexcept {return m_transparent;}
+			inline const bool isBatched() const noexcept {return m_batched;}
+			/*returns the level of detail of the mesh that was chosen by the meshmanager in the last frame*/
+			inline const unsigned int getLod() const noexcept {return m_lod;}
+
+		};
+
+	}
+}
@@ -17,9 +17,12 @@
 #include "src\Graphics\Renderables\Cube\NormalCube.h"
 #include "src\Graphics\Renderables\Cube\CubeManager.h"
 #include "src\Graphics\Renderables\Border\BorderManager.h"
+#include "src\Graphics\Renderables\Impostor\ImpostorManager.h"
+#include "src\Graphics\Renderables\MeshManager.h"
 
 
 #include "src\Graphics\Renderables\BadTerrainTest.h"
+#include "src\Logics\Entities\EntityStorage.h"
 
 
 namespace clockwork {
@@ -30,10 +33,12 @@ namespace clockwork {
 
 		private:
 			friend class NormalCube;
+			friend class MeshManager;
 			friend class CubeManager;
 			friend class BorderManager;
 			friend class CubeBorder;
 			friend class SphereBorder;
+			friend class ChunkImpostor;
 			friend struct TransparentCubeCompare;
 
 		private:
@@ -41,13 +46,17 @@ namespace clockwork {
 			maths::Mat4f* m_currentProjection;
 			bool m_deleteShader;
 			Shader* m_borderShader;
+			Shader* m_batchShader;
+			Shader* m_impostorShader;
 			BorderManager m_borderManager;
+			ImpostorManager m_impostorManager;
 
 		public:
 			Shader * instancedShader;
 			Shader* normalShader;
 
 			CubeManager cubeManager;
+			MeshManager meshManager;
 
 
 
@@ -56,13 +65,14 @@ namespace clockwork {
 		public:
 
 			Renderer() noexcept
-				: instancedShader(nullptr), normalShader(nullptr), m_currentCamera(nullptr), m_currentProjection(nullptr), cubeManager(), m_borderManager(this), m_deleteShader(false)
+				: instancedShader(nullptr), normalShader(nullptr), m_currentCamera(nullptr), m_currentProjection(nullptr), cubeManager(), meshManager(), m_borderManager(this), m_impostorManager(), m_deleteShader(false), m_borderShader(nullptr), m_batchShader(nullptr), m_impostorShader(nullptr)
 			{}
 
 			//pointer to dynamic, or class owned shader, pointer to dynamic, or class owned pointer to camera, pointer to dynnamic, or class owned projection matrix
 			//bool deleteshader this renderer deletes the shader with its destruktor call when its set to true | so if you have a shared shader in multiple renderers and you manage it/delete it in your game, then pass false as the boolean(just shader pointer passed as parameter, not new shader objekt created with new)
 			Renderer(Shader* instanceShader, Shader* normalShader, logics::Camera** camera, maths::Mat4f* projection, unsigned int reserved = 10, bool deleteShader = true) noexcept
-				: instancedShader(instanceShader), normalShader(normalShader), m_currentCamera(camera), m_currentProjection(projection), cubeManager(reserved, this), m_borderManager(this), m_deleteShader(deleteShader), m_borderShader(new Shader("res/Shaders/Default/Border.vs", "res/Shaders/Default/Border.fs"))
+				: instancedShader(instanceShader), normalShader(normalShader), m_currentCamera(camera), m_currentProjection(projection), cubeManager(reserved, this), meshManager(reserved, this), m_borderManager(this), m_deleteShader(deleteShader), m_borderShader(new Shader("res/Shaders/Default/Border.vs", "res/Shaders/Default/Border.fs")),
+				m_batchShader(new Shader("res/Shaders/Default/NormalBatch.vs", "res/Shaders/Default/Normal.fs")), m_impostorShader(new Shader("res/Shaders/Default/Impostor.vs", "res/Shaders/Default/Impostor.fs"))
 			{
 				prepare();
 			}
@@ -75,19 +85,24 @@ namespace clockwork {
 					delete normalShader;
 				}
 				delete m_borderShader;
+				delete m_batchShader;
+				delete m_impostorShader;
 			}
 
 			Renderer(const Renderer& other) = delete;
 
 			Renderer(Renderer&& other) noexcept
-				: instancedShader(other.instancedShader), normalShader(other.normalShader), m_currentCamera(other.m_currentCamera), m_currentProjection(other.m_currentProjection), m_deleteShader(other.m_deleteShader), m_borderShader(other.m_borderShader), cubeManager(std::move(other.cubeManager)),
-				m_borderManager(std::move(other.m_borderManager))
+				: instancedShader(other.instancedShader), normalShader(other.normalShader), m_currentCamera(other.m_currentCamera), m_currentProjection(other.m_currentProjection), m_deleteShader(other.m_deleteShader), m_borderShader(other.m_borderShader), m_batchShader(other.m_batchShader), m_impostorShader(other.m_impostorShader), cubeManager(std::move(other.cubeManager)),
+				meshManager(std::move(other.meshManager)), m_borderManager(std::move(other.m_borderManager)), m_impostorManager(std::move(other.m_impostorManager))
 			{
+				meshManager.m_renderer = this;
 				other.instancedShader = nullptr;
 				other.normalShader = nullptr;
 				other.m_currentCamera = nullptr;
 				other.m_currentProjection = nullptr;
 				other.m_borderShader = nullptr;
+				other.m_batchShader = nullptr;
+				other.m_impostorShader = nullptr;
 				other.m_deleteShader = false;
 			}
 
@@ -101,13 +116,20 @@ namespace clockwork {
 				m_currentProjection = other.m_currentProjection;
 				m_deleteShader = other.m_deleteShader;
 				m_borderShader = other.m_borderShader;
+				m_batchShader = other.m_batchShader;
+				m_impostorShader = other.m_impostorShader;
 				cubeManager = std::move(cubeManager);
 				m_borderManager = std::move(other.m_borderManager);
+				m_impostorManager = std::move(other.m_impostorManager);
+				meshManager = std::move(other.meshManager);
+				meshManager.m_renderer = this;
 				other.instancedShader = nullptr;
 				other.normalShader = nullptr;
 				other.m_currentCamera = nullptr;
 				other.m_currentProjection = nullptr;
 				other.m_borderShader = nullptr;
+				other.m_batchShader = nullptr;
+				other.m_impostorShader = nullptr;
 				other.m_deleteShader = false;
 				return *this;
 			}
@@ -121,6 +143,9 @@ namespace clockwork {
 
 				normalShader->enable();
 				normalShader->setUniform("u_texture1", 0);
+
+				m_batchShader->enable();
+				m_batchShader->setUniform("u_texture1", 0);
 			}
 
 			void render() noexcept///render methode muss wahrscheinlich doch nicht virtual vererbt werden, da im state direkt auf objekte/direkte pointer auf objekte von renderern zugegriffen wird | somit wrde normale vererbung reichen | der zugriff auf manager ist ja public und diese sind auch automatisch in erbenden klassen vorhanden
@@ -131,7 +156,7 @@ namespace clockwork {
 				instancedShader->enable();
 				(*m_currentCamera)->update(instancedShader);//so hnlich dann hier die verschiedenen modelle vorbereiten, dann texturen und dann positionen, etc schicken
 
-				if ( cubeManager.m_instanceCubes.size() != 0 )
+				if ( cubeManager.m_instanceCount != 0 )
 					cubeManager.renderInstancedCubes();
 
 
@@ -141,6 +166,25 @@ namespace clockwork {
 				if ( cubeManager.m_normalCubes.size() != 0 )
 					cubeManager.renderNormalCubes();
 				terrain.render(normalShader);
+				if ( meshManager.m_normalModels.size() != 0 )
+					meshManager.renderNormalModels();
+
+				if ( cubeManager.m_normalCubes.size() != 0 || meshManager.m_batchedCount != 0 )
+				{
+					m_batchShader->enable();
+					( *m_currentCamera )->update(m_batchShader);
+					if ( cubeManager.m_normalCubes.size() != 0 )
+						cubeManager.renderBatchedNormalCubes();
+					if ( meshManager.m_batchedCount != 0 )
+						meshManager.renderBatchedModels();
+				}
+
+				if ( m_impostorManager.getSize() != 0 )//the far chunks outside of the renderdistance
+				{
+					m_impostorShader->enable();
+					( *m_currentCamera )->update(m_impostorShader);
+					m_impostorManager.render();
+				}
 
 				if ( m_borderManager.getSize() != 0 )
 				{
@@ -150,6 +194,20 @@ namespace clockwork {
 				}
 			}
 
+			/*draws the tables of the entitystorage with the render component as cubes with one instanced drawcall per table | the modelmatrices are uploaded straight from the tables
+			has to be called after render() in the same frame, because the entities use the batchbuffer of the cubemanager after the batched normalcubes*/
+			void renderEntities(const logics::EntityStorage& entities) noexcept
+			{
+				glEnable(GL_CULL_FACE);
+				m_batchShader->enable();
+				( *m_currentCamera )->update(m_batchShader);
+				for ( const auto& table : entities.getTables() )
+				{
+					if ( ( table.components & logics::EntityStorage::renderComponent ) && table.getSize() != 0 )
+						cubeManager.renderBatch(table.textureId, table.modelMatrices.data(), table.getSize());
+				}
+			}
+
 			void renderTransparent() noexcept
 			{
 				//ggf culling deaktivieren fr transparent sachen 
@@ -158,6 +216,8 @@ namespace clockwork {
 
 				if ( cubeManager.m_transparentCubes.size() != 0 )
 				cubeManager.renderTransparentCubes();
+				if ( meshManager.m_transparentModels.size() != 0 )
+					meshManager.renderTransparentModels();
 			}
 
 			void updateProjection() noexcept
@@ -166,9 +226,15 @@ namespace clockwork {
 				instancedShader->setUniform("u_projection", *m_currentProjection);
 				m_borderShader->enable();
 				m_borderShader->setUniform("u_projection", *m_currentProjection);
+				m_batchShader->enable();
+				m_batchShader->setUniform("u_projection", *m_currentProjection);
+				m_impostorShader->enable();
+				m_impostorShader->setUniform("u_projection", *m_currentProjection);
 				normalShader->enable();
 				normalShader->setUniform("u_projection", *m_currentProjection);
-
+				GLint viewport[4];
+				glGetIntegerv(GL_VIEWPORT, viewport);
+				meshManager.setProjection(*m_currentProjection, viewport[3]);//the levels of detail of the models are chosen by their size on the screen
 			}
 
 		};
@@ -14,8 +14,10 @@
 #include "glad\glad.h"
 #include <unordered_map>
 #include <string>
+#include <chrono>
 #include "src\Utils\Helper.h"
 #include "src\Utils\File.h"
+#include "src\Graphics\Renderer\ShaderCache.h"
 #include "src\Maths\Vec2.h"
 #include "src\Maths\Vec3.h"
 #include "src\Maths\Vec4.h"
@@ -90,7 +92,8 @@ namespace clockwork {
 		public:
 			/*loads a vertex and a fragmentshader into a shader program both specified by the file path relative to the engine.exe
 			vertex shader is called for each vertex(for example triangle 3 times), specifies how the vertex arrives at the screen and passes the data(for example position) to the fragment shader 
-			fragment shader is called for each pixel between the vertices and specifies the colour/lightning of the pixels*/
+			fragment shader is called for each pixel between the vertices and specifies the colour/lightning of the pixels
+			if the global shadercache has a program binary for the sources and the driver, the binary is loaded instead of compiling the sources and otherwise the binary of the compiled program is added to the shadercache*/
 			void loadShader(const std::string& vertexShaderPath, const std::string& fragmentShaderPath) noexcept
 			{
 				m_vertexPath = vertexShaderPath;
@@ -98,18 +101,34 @@ namespace clockwork {
 				if ( m_id == 0 )
 					m_id = glCreateProgram();//one shader program for both fragment and vertex shader
 				m_uniformLocationCache.clear();
-
-				GLuint vs = glCreateShader(GL_VERTEX_SHADER);//vertex shader unique opengl state id 
-				GLuint fs = glCreateShader(GL_FRAGMENT_SHADER);//here fragmentshader
+				auto start = std::chrono::steady_clock::now();
 
 				utils::File tempVsSource { vertexShaderPath };//has to be created as a temp string, because otherwise as a rvalue object the data would have been deleted after the function call and the chars cant be saved in the source when compiling the shaders(temp rvalue objects are deleted after function call when passed as parameters)
 				utils::File tempFsSource { fragmentShaderPath };//has to be alive when the shader is being compiled
 
-				const char* vsSource = tempVsSource.read().getData().c_str();//returntyp std::string of utils::readfile has to be converted to cstring for opengl to use it | has to be saved as temp copy, because the opengl function cant take in reference to rvalue objects and std::string.c_str() creates an rvalue char pointer
-				const char* fsSource = tempFsSource.read().getData().c_str();
+				const char* vsSource = tempVsSource.read().getChars();//the data can point directly into the resource packfile, so it is not null terminated | has to be saved as temp copy, because the opengl function needs the memoryadress of the pointer
+				const char* fsSource = tempFsSource.read().getChars();
+				GLint vsLength = tempVsSource.getSize();
+				GLint fsLength = tempFsSource.getSize();
+
+				unsigned long long key = 0;
+				if ( shaderCache )
+				{
+					key = shaderCache->getKey(vsSource, vsLength, fsSource, fsLength);
+					if ( shaderCache->load(m_id, key) )
+					{
+						addLoadTime(true, start);
+						return;
+					}
+					if ( shaderCache->isSupported() )//glProgramParameteri is a null pointer without opengl 4.1, or ARB_get_program_binary
+						glProgramParameteri(m_id, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);//the driver has to keep the binary of the linked program for the shadercache
+				}
+
+				GLuint vs = glCreateShader(GL_VERTEX_SHADER);//vertex shader unique opengl state id 
+				GLuint fs = glCreateShader(GL_FRAGMENT_SHADER);//here fragmentshader
 
-				glShaderSource(vs, 1, &vsSource, NULL);//first shader id, second how many strings, third source of the shader(memoryadress of cstring, so pointer to pointer to char), fourth lenght of the string as nullptr so opengl automaticly determines the size to the \0 char of the cstring
-				glShaderSource(fs, 1, &fsSource, NULL);
+				glShaderSource(vs, 1, &vsSource, &vsLength);//first shader id, second how many strings, third source of the shader(memoryadress of cstring, so pointer to pointer to char), fourth lenght of the string, because the source has no \0 char at the end
+				glShaderSource(fs, 1, &fsSource, &fsLength);
 
 				glCompileShader(vs);//compiles the shader
 				glCompileShader(fs);
@@ -146,7 +165,26 @@ namespace clockwork {
 
 				glDeleteShader(vs);//delete the shaders, because they are saved in the program
 				glDeleteShader(fs);
+
+				if ( shaderCache )
+				{
+					shaderCache->store(m_id, key);
+					addLoadTime(false, start);
+				}
+			}
+
+		private:
+			/*adds the time since start to the statistics of the shadercache and prints it in debug mode*/
+			void addLoadTime(bool loaded, std::chrono::steady_clock::time_point start) const noexcept
+			{
+				double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+				shaderCache->addTime(loaded, seconds);
+#if CLOCKWORK_DEBUG
+				std::cout << "Info Shader::loadShader(): " << m_vertexPath << " | " << m_fragmentPath << ( loaded ? " loaded from a program binary in " : " compiled in " ) << seconds * 1000.0 << " ms" << std::endl;
+#endif
 			}
+
+		public:
 			
 			/*deletes the shader program with the id*/
 			void deleteShader() const noexcept
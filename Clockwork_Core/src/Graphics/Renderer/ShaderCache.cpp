@@ -0,0 +1,197 @@
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "ShaderCache.h"
+#include "src\Utils\AssetCache.h"
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+namespace clockwork {
+	namespace graphics {
+
+		ShaderCache* shaderCache = nullptr;
+
+		namespace {
+
+			const char cacheMagic[4] = { 'C', 'W', 'S', 'C' };
+			const unsigned int cacheVersion = 1;
+
+			template<typename type> bool readValue(const std::vector<unsigned char>& data, unsigned long long& position, type& value) noexcept
+			{
+				if ( position + sizeof(type) > data.size() )
+					return false;
+				std::memcpy(&value, data.data() + position, sizeof(type));
+				position += sizeof(type);
+				return true;
+			}
+
+			template<typename type> void writeValue(std::ofstream& file, const type& value) noexcept
+			{
+				file.write(reinterpret_cast<const char*>( &value ), sizeof(type));
+			}
+
+			unsigned long long hashString(const GLubyte* string) noexcept
+			{
+				if ( string == nullptr )
+					return 0;
+				return utils::hashContent(string, std::strlen(reinterpret_cast<const char*>( string )));
+			}
+
+		}
+
+		ShaderCache::ShaderCache(const std::string& filepath) noexcept
+			: m_filepath(filepath), m_driverHash(0), m_supported(false), m_changed(false), m_loadedCount(0), m_compiledCount(0), m_loadTime(0), m_compileTime(0)
+		{
+			GLint formatCount = 0;
+			if ( glGetProgramBinary != nullptr && glProgramBinary != nullptr && glProgramParameteri != nullptr )
+				glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+			m_supported = formatCount > 0;
+			m_driverHash = hashString(glGetString(GL_VENDOR)) * 31 + hashString(glGetString(GL_RENDERER));
+			m_driverHash = m_driverHash * 31 + hashString(glGetString(GL_VERSION));
+			if ( !m_supported )
+			{
+#if CLOCKWORK_DEBUG
+				std::cout << "Info ShaderCache::ShaderCache(): The driver does not support program binaries, so all shaders will be compiled" << std::endl;
+#endif
+				return;
+			}
+			std::ifstream file(filepath, std::ios::binary);
+			if ( !file )
+				return;
+			std::vector<unsigned char> data { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+			unsigned long long position = 4;
+			unsigned int version = 0;
+			unsigned int count = 0;
+			if ( data.size() < 4 || std::memcmp(data.data(), cacheMagic, 4) != 0 || !readValue(data, position, version) || version != cacheVersion || !readValue(data, position, count) )
+			{
+#if CLOCKWORK_DEBUG
+				std::cout << "Error ShaderCache::ShaderCache(): " << filepath << " is not a shadercache of this version" << std::endl;
+#endif
+				return;
+			}
+			for ( unsigned int i = 0; i < count; ++i )
+			{
+				unsigned long long key;
+				Binary binary;
+				unsigned int size;
+				if ( !readValue(data, position, key) || !readValue(data, position, binary.format) || !readValue(data, position, size) || position + size > data.size() )
+				{
+#if CLOCKWORK_DEBUG
+					std::cout << "Error ShaderCache::ShaderCache(): " << filepath << " is truncated" << std::endl;
+#endif
+					break;
+				}
+				binary.data.assign(data.begin() + position, data.begin() + position + size);
+				position += size;
+				m_binaries.emplace(key, std::move(binary));
+			}
+		}
+
+		ShaderCache::~ShaderCache() noexcept
+		{
+			if ( m_changed )
+				save();
+		}
+
+		unsigned long long ShaderCache::getKey(const char* vertexSource, unsigned int vertexSize, const char* fragmentSource, unsigned int fragmentSize) const noexcept
+		{
+			unsigned long long key = utils::hashContent(reinterpret_cast<const unsigned char*>( vertexSource ), vertexSize);
+			key = key * 0x100000001B3ULL ^ utils::hashContent(reinterpret_cast<const unsigned char*>( fragmentSource ), fragmentSize);
+			return key * 0x100000001B3ULL ^ m_driverHash;
+		}
+
+		bool ShaderCache::load(GLuint program, unsigned long long key) noexcept
+		{
+			if ( !m_supported )
+				return false;
+			std::lock_guard<std::mutex> lock(m_lock);
+			auto binary = m_binaries.find(key);
+			if ( binary == m_binaries.end() )
+				return false;
+			glProgramBinary(program, binary->second.format, binary->second.data.data(), binary->second.data.size());
+			GLint linked = GL_FALSE;
+			glGetProgramiv(program, GL_LINK_STATUS, &linked);
+			if ( linked == GL_TRUE )
+				return true;
+#if CLOCKWORK_DEBUG
+			std::cout << "Info ShaderCache::load(): The driver rejected a cached program binary, so the shader will be compiled" << std::endl;
+#endif
+			m_binaries.erase(binary);
+			m_changed = true;
+			return false;
+		}
+
+		void ShaderCache::store(GLuint program, unsigned long long key) noexcept
+		{
+			if ( !m_supported )
+				return;
+			GLint length = 0;
+			glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+			if ( length <= 0 )
+				return;
+			Binary binary;
+			binary.data.resize(length);
+			glGetProgramBinary(program, length, nullptr, &binary.format, binary.data.data());
+			std::lock_guard<std::mutex> lock(m_lock);
+			m_binaries[key] = std::move(binary);
+			m_changed = true;
+		}
+
+		void ShaderCache::addTime(bool loaded, double seconds) noexcept
+		{
+			std::lock_guard<std::mutex> lock(m_lock);
+			if ( loaded )
+			{
+				++m_loadedCount;
+				m_loadTime += seconds;
+			}
+			else
+			{
+				++m_compiledCount;
+				m_compileTime += seconds;
+			}
+		}
+
+		void ShaderCache::save() noexcept
+		{
+			std::lock_guard<std::mutex> lock(m_lock);
+			std::ofstream file(m_filepath, std::ios::binary | std::ios::trunc);
+			if ( !file )
+			{
+#if CLOCKWORK_DEBUG
+				std::cout << "Error ShaderCache::save(): Could not write " << m_filepath << std::endl;
+#endif
+				return;
+			}
+			file.write(cacheMagic, 4);
+			writeValue(file, cacheVersion);
+			writeValue(file, static_cast<unsigned int>( m_binaries.size() ));
+			for ( const auto& binary : m_binaries )
+			{
+				writeValue(file, binary.first);
+				writeValue(file, binary.second.format);
+				writeValue(file, static_cast<unsigned int>( binary.second.data.size() ));
+				file.write(reinterpret_cast<const char*>( binary.second.data.data() ), binary.second.data.size());
+			}
+			m_changed = false;
+		}
+
+		void ShaderCache::printStatistics() noexcept
+		{
+			std::lock_guard<std::mutex> lock(m_lock);
+			std::cout << "Shaders: " << m_loadedCount << " loaded from program binaries in " << m_loadTime * 1000.0 << " ms | " << m_compiledCount << " compiled in " << m_compileTime * 1000.0 << " ms" << std::endl;
+		}
+
+	}
+}
@@ -0,0 +1,90 @@
+#pragma once
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "glad\glad.h"
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+
+namespace clockwork {
+	namespace graphics {
+
+		/*stores the linked shader programs as driver specific program binaries(glGetProgramBinary) in one cachefile, so the next start of the engine can load them with glProgramBinary instead of compiling and linking the sources again
+		the binaries are found by the hash of the vertex and fragment source and the hash of the vendor, renderer and version strings of the driver, so changed sources, or a new driver will just compile the shader again
+		if the driver does not support program binaries, or rejects a binary, the shader is compiled like before | the cachefile is written when the cache is deleted and only if new binaries were added
+		the cache can be used from every thread with an opengl context*/
+		class ShaderCache
+		{
+
+		private:
+			struct Binary
+			{
+				GLenum format;
+				std::vector<unsigned char> data;
+			};
+
+		private:
+			std::unordered_map<unsigned long long, Binary> m_binaries;
+			std::string m_filepath;
+			unsigned long long m_driverHash;
+			bool m_supported;
+			bool m_changed;
+			unsigned int m_loadedCount;
+			unsigned int m_compiledCount;
+			double m_loadTime;
+			double m_compileTime;
+			std::mutex m_lock;
+
+		public:
+			/*reads the program binaries of the cachefile | the opengl context has to be created first, because the driver strings are part of the keys
+			@param[filepath] the path of the cachefile relative to the engine.exe | it is created when new binaries are added*/
+			explicit ShaderCache(const std::string& filepath) noexcept;
+
+			/*writes the cachefile if new binaries were added*/
+			~ShaderCache() noexcept;
+
+			ShaderCache(const ShaderCache& other) = delete;
+
+			ShaderCache& operator=(const ShaderCache& other) = delete;
+
+		public:
+			/*returns the key of the shader program with the sources and the driver*/
+			unsigned long long getKey(const char* vertexSource, unsigned int vertexSize, const char* fragmentSource, unsigned int fragmentSize) const noexcept;
+
+			/*loads the cached binary of the key into the program and returns true if the driver accepted it and the program is linked | returns false if the program has to be compiled
+			a rejected binary is removed from the cache, so the compiled program replaces it*/
+			bool load(GLuint program, unsigned long long key) noexcept;
+
+			/*stores the binary of the linked program for the key | the program must have been linked with GL_PROGRAM_BINARY_RETRIEVABLE_HINT set to GL_TRUE*/
+			void store(GLuint program, unsigned long long key) noexcept;
+
+			/*adds the time in seconds that a shader needed to be loaded from a binary, or to be compiled to the statistics*/
+			void addTime(bool loaded, double seconds) noexcept;
+
+			/*writes all binaries into the cachefile*/
+			void save() noexcept;
+
+			/*prints how many shaders were loaded from binaries and how many were compiled and how long it took into the console*/
+			void printStatistics() noexcept;
+
+		public:
+			const bool isSupported() const noexcept {return m_supported;}
+
+		};
+
+		/*the global shadercache that is created by the engine after the window | shaders are compiled without binaries while it is nullptr*/
+		extern ShaderCache* shaderCache;
+
+	}
+}
@@ -15,16 +15,20 @@
 #include <vector>
 #include "src\Maths\Vec4.h"
 #include "src\Utils\Image.h"
+#include "src\Utils\PixelConversion.h"
 #include "FreeImage\FreeImage.h"
 
 namespace clockwork {
 	namespace graphics {
 
-		/*stores a number of images with the same width/height/pixelsize | mostly different textures for the same model to create a TextureArray*/
+		/*stores a number of images with the same width/height/pixelsize | mostly different textures for the same model to create a TextureArray
+		the images are stored as views(see utils::ImageView) into the source images, so the tiles of a spritesheet image dont allocate a bitmap each | the source images share their data with the images they were created from*/
 		class SpriteSheet///VIELLEICHT NOCHMAL NEU MACHEN, BERARBEITEN
 		{
 		private:
-			std::vector<utils::Image> images;
+			std::vector<utils::Image> sources;//keeps the pixels of the views alive
+			std::vector<utils::ImageView> images;
+			std::vector<std::string> filepaths;
 
 		public:
 
@@ -32,30 +36,35 @@ namespace clockwork {
 			SpriteSheet(unsigned int size=5) noexcept
 			{
 				images.reserve(size);
+				filepaths.reserve(size);
 			}
 
 			/*adds a single image to the spritesheet and reserves size for n more images*/
 			SpriteSheet(const utils::Image& image, unsigned int size = 5) noexcept
 			{
 				images.reserve(size+1);
-				images.push_back(image);
+				addImage(image);
 			}
 
 			/*creates a spritesheet from a spritesheet image where the different images are stored in one big image
 			the images are saved per x-row from the top left(not like opengl coordinate space) to the bottom right | so the top left to top right row first, then the middel left to middel right row, etc
+			the pixels are not copied, each image is only a view of its rectangle in the spritesheet
 			@param[image] the spritesheet
 			@param[imageWidth] the width of a single small image, NOT THE SPRITESHEET
 			@param[imageHeight]the height of a single small image, NOT THE SPRITESHEET*/
 			SpriteSheet(const utils::Image& image, unsigned int imageWidth, unsigned int imageHeight) noexcept
+				: sources(1, image)
 			{
 				unsigned int xCount = image.getWidth() / imageWidth;
 				unsigned int yCount = image.getHeight() / imageHeight;
 				images.reserve(xCount*yCount);
+				filepaths.reserve(xCount*yCount);
 				for ( unsigned int y = 0; y < yCount; ++y )
 				{
 					for ( unsigned int x = 0; x < xCount; ++x )
 					{
-						images.push_back(image.subImage(x*imageWidth, y*imageHeight, imageWidth, imageHeight));
+						images.push_back(sources.front().getView(x*imageWidth, y*imageHeight, imageWidth, imageHeight));
+						filepaths.push_back(image.getFilepath() + std::to_string(filepaths.size()));
 					}
 				}
 
@@ -74,16 +83,33 @@ namespace clockwork {
 			/*returns the pixel size of a single small image*/
 			const unsigned int getImagePixelSize() const noexcept{return images.at(0).getPixelSize();}
 
-			/*returns an image at the given position in the SpriteSheet(0 to size-1)*/
-			const utils::Image& getImage(unsigned int pos) const noexcept{return images.at(pos);}
+			/*returns the view of the image at the given position in the SpriteSheet(0 to size-1) without copying the pixels | the view is valid as long as the spritesheet lives*/
+			const utils::ImageView& getView(unsigned int pos) const noexcept{return images.at(pos);}
+
+			/*returns a copy of the image at the given position in the SpriteSheet(0 to size-1) with its own data | the tiles of a spritesheet image have the filepath of the spritesheet with their position added as a number to the string
+			this allocates a bitmap, so use getView() if the pixels are only read | only images with 24, or 32 bits per pixel can be copied, otherwise an image without data is returned*/
+			utils::Image getImage(unsigned int pos) const noexcept
+			{
+				const utils::ImageView& view = images.at(pos);
+				if ( view.getPixelSize() != 24 && view.getPixelSize() != 32 )
+				{
+#if CLOCKWORK_DEBUG
+					std::cout << "Error SpriteSheet::getImage(): the image is not 24/32 bits per pixel and can not be copied: " << filepaths.at(pos) << std::endl;
+#endif
+					return utils::Image(filepaths.at(pos), view.getWidth(), view.getHeight(), view.getPixelSize());
+				}
+				return utils::convertImage(view, view.getPixelSize(), filepaths.at(pos));
+			}
 
 			/*adds an image to the spritesheet if it has the same width/height and pixelsize as the other images*/
 			void addImage(const utils::Image& image) noexcept
 			{
-				if ( images.size() < 1 )
-					images.push_back(image);
-				else if ( image.getWidth() == images.at(0).getWidth() && image.getHeight() == images.at(0).getHeight() && image.getPixelSize() == images.at(0).getPixelSize() )
-					images.push_back(image);
+				if ( images.size() < 1 || ( image.getWidth() == images.at(0).getWidth() && image.getHeight() == images.at(0).getHeight() && image.getPixelSize() == images.at(0).getPixelSize() ) )
+				{
+					sources.push_back(image);
+					images.push_back(image.getView());
+					filepaths.push_back(image.getFilepath());
+				}
 			}
 
 		};
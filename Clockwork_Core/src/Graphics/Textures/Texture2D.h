@@ -14,6 +14,8 @@
 #include "glad\glad.h"
 #include "FreeImage\FreeImage.h"
 #include "src\Utils\Image.h"
+#include "src\Utils\CookedTexture.h"
+#include "src\Graphics\Textures\TextureUploader.h"
 #include "src\Maths\Vec4.h"
 
 namespace clockwork {
@@ -59,27 +61,61 @@ namespace clockwork {
 				: m_image(image)
 			{
 #if CLOCKWORK_DEBUG
-				if ( image.getData() == nullptr )
+				if ( !image.hasData() )
 					std::cout << "Error Texture2D::Texture2D(): Image has no data" << std::endl;
 #endif
 				glGenTextures(1, &m_id);//generate texture in opengl state machine and save id 
 				glBindTexture(GL_TEXTURE_2D, m_id);//like other objects bind the texture to modify and access it 
-
-				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, textureRepeat);
-				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, textureRepeat);
-				float colour[4] = { borderColour.r,borderColour.g, borderColour.b , borderColour.a };
-				glTexParameterfv(GL_TEXTURE_2D, GL_TEXTURE_BORDER_COLOR, colour);
-				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, textureFilterUpscale);
-				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, textureFilterDownscale);
+				setParameters(textureRepeat, borderColour, textureFilterUpscale, textureFilterDownscale);
 
 				if ( m_image.hasAlpha())//look at pixelsize to guess the colour format for the image
-					glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, m_image.getWidth(), m_image.getHeight(), 0, utils::Image::getColourOrderRGBA(), GL_UNSIGNED_BYTE, static_cast<void*>( m_image.getData() ));//7. input colour format of the image(RGB/RGBA), 8. input datatype of the image, 9. pointer to image data
+					glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, m_image.getWidth(), m_image.getHeight(), 0, utils::Image::getColourOrderRGBA(), GL_UNSIGNED_BYTE, static_cast<const void*>( m_image.getData() ));//7. input colour format of the image(RGB/RGBA), 8. input datatype of the image, 9. pointer to image data
 				else
-					glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, m_image.getWidth(), m_image.getHeight(), 0, utils::Image::getColourOrderRGB(), GL_UNSIGNED_BYTE, static_cast<void*>( m_image.getData() ));//1. texture target(mostly texture_2d, so 1d and 3d are not affected), 2. mipmap lvl to create the texture for(base lvl at 0), 3. output colour format of the image(RGB/RGBA), 4./5. width/height of the image, 6. always 0(legacy opengl)
+					glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, m_image.getWidth(), m_image.getHeight(), 0, utils::Image::getColourOrderRGB(), GL_UNSIGNED_BYTE, static_cast<const void*>( m_image.getData() ));//1. texture target(mostly texture_2d, so 1d and 3d are not affected), 2. mipmap lvl to create the texture for(base lvl at 0), 3. output colour format of the image(RGB/RGBA), 4./5. width/height of the image, 6. always 0(legacy opengl)
 				glGenerateMipmap(GL_TEXTURE_2D);//activate mipmaps for the currently bound texture object | like calling the function from above with diffrent positions for the mipmap as second parameter instead of 0 and changing width/height
 				m_image.clearData();
 			}
 
+			/*creates a texture2D object from a cooked texture and binds it, so another bind() call is unnecessary | the compressed mipmap levels of the cooked texture are uploaded directly, so no mipmaps are generated
+			the cooked texture needs its data(call load() first) | the parameters are the same as the parameters of the image constructor
+			the image of the texture will be an image without data that only describes the cooked texture with its filepath and size*/
+			explicit Texture2D(const utils::CookedTexture& texture, GLint textureRepeat = GL_CLAMP_TO_EDGE, const maths::Vec4<float>& borderColour = maths::Vec4<float>(0, 0, 0, 0), GLint textureFilterUpscale = GL_LINEAR, GLint textureFilterDownscale = GL_NEAREST_MIPMAP_LINEAR) noexcept
+				: m_image(texture.getImage())
+			{
+#if CLOCKWORK_DEBUG
+				if ( !texture.hasData() )
+					std::cout << "Error Texture2D::Texture2D(): CookedTexture has no data" << std::endl;
+#endif
+				glGenTextures(1, &m_id);
+				glBindTexture(GL_TEXTURE_2D, m_id);
+				setParameters(textureRepeat, borderColour, textureFilterUpscale, textureFilterDownscale);
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, texture.getLevelCount() - 1);
+				for ( unsigned int level = 0; level < texture.getLevelCount(); ++level )
+					glCompressedTexImage2D(GL_TEXTURE_2D, level, texture.getInternalFormat(), texture.getLevelWidth(level), texture.getLevelHeight(level), 0, texture.getLevelSize(level), texture.getLevelData(level));
+			}
+
+			/*creates a texture2D object like the image constructor and binds it, but the imagedata is streamed into the texture by the textureuploader over the next frames instead of being copied synchronously on the render thread
+			the storage of the texture is allocated immediately, so the texture can be used right away, but it stays empty until the upload is finished and the mipmaps have been generated
+			CAREFUL: the texture object can be moved, but it should not be deleted while its upload is pending
+			@param[image] the decoded image with data | the image is moved into the uploader and the texture keeps an image without data with its filepath and size
+			@param[uploader] the textureuploader that streams the imagedata, for example the global textureUploader | the other parameters are the same as the parameters of the image constructor*/
+			Texture2D(utils::Image&& image, TextureUploader& uploader, GLint textureRepeat = GL_CLAMP_TO_EDGE, const maths::Vec4<float>& borderColour = maths::Vec4<float>(0, 0, 0, 0), GLint textureFilterUpscale = GL_LINEAR, GLint textureFilterDownscale = GL_NEAREST_MIPMAP_LINEAR) noexcept
+				: m_image(image.getFilepath(), image.getWidth(), image.getHeight(), image.getPixelSize())
+			{
+				glGenTextures(1, &m_id);
+				glBindTexture(GL_TEXTURE_2D, m_id);
+				setParameters(textureRepeat, borderColour, textureFilterUpscale, textureFilterDownscale);
+				if ( m_image.hasAlpha() )
+					glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, m_image.getWidth(), m_image.getHeight(), 0, utils::Image::getColourOrderRGBA(), GL_UNSIGNED_BYTE, nullptr);
+				else
+					glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, m_image.getWidth(), m_image.getHeight(), 0, utils::Image::getColourOrderRGB(), GL_UNSIGNED_BYTE, nullptr);
+				GLuint id = m_id;
+				uploader.upload(std::move(image), GL_TEXTURE_2D, m_id, 0, [id]() {
+					glBindTexture(GL_TEXTURE_2D, id);
+					glGenerateMipmap(GL_TEXTURE_2D);
+				});
+			}
+
 			/*creates an empty texture with no texturedata and no id*/
 			Texture2D()
 				: m_id(0)
@@ -111,6 +147,18 @@ namespace clockwork {
 				return *this;
 			}
 
+		private:
+			/*sets the texture parameters of the bound texture | the parameters are explained at the constructor*/
+			static void setParameters(GLint textureRepeat, const maths::Vec4<float>& borderColour, GLint textureFilterUpscale, GLint textureFilterDownscale) noexcept
+			{
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, textureRepeat);
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, textureRepeat);
+				float colour[4] = { borderColour.r,borderColour.g, borderColour.b , borderColour.a };
+				glTexParameterfv(GL_TEXTURE_2D, GL_TEXTURE_BORDER_COLOR, colour);
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, textureFilterUpscale);
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, textureFilterDownscale);
+			}
+
 		public:
 			/*binds the current texture2d object to the selected texture slot where the default slot is 0 | there can only be one texture bound per texture slot at the same time | so there can be 32 textures be bound at the same time to use for rendering a single model
 			the shader has to be enabled first, but the texture should be bound before binding the model, so the texture can be applied to the model | the texture bind call is just for this texture kind(GL_TEXTURE_2D)
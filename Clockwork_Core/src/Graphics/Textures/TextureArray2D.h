@@ -13,8 +13,12 @@
 *************************************************************************/
 #include "glad\glad.h"
 #include <vector>
+#include <utility>
 #include "src\Maths\Vec4.h"
 #include "src\Utils\Image.h"
+#include "src\Utils\PixelConversion.h"
+#include "src\Utils\CookedTexture.h"
+#include "src\Graphics\Textures\TextureUploader.h"
 #include "FreeImage\FreeImage.h"
 #include "src\Graphics\Textures\SpriteSheet.h"
 #include "src\Maths\MathFunctions.h"
@@ -30,6 +34,7 @@ namespace clockwork {
 		each model can have multiple textures that can be calculated in the shaders, but each texture has to be bound first
 
 		the texturearray2d is used for many small models with instancing | CAREFUL: the size of every image has to be the same as the size of the other images and the pixelkind has to be the same too(rgb/rgba = same transparancy level)
+		the texturearray2d can also store cooked textures(block compressed with precomputed mipmaps) instead of images | then all textures have to be cooked textures with the same blockformat and size
 		there are multiple textures stored in the texturearray at a position from 0 to size-1, where the position of the image also is its imageId/textureid to access it in the fragmentshader
 		in the fragmentshader an image of the texturearray2d is drawn with a given position(imageId/textureid) in the array | the imageId/textureid is used to specify what texture to draw and is stored per model instance/object*/
 		class TextureArray2D
@@ -39,6 +44,9 @@ namespace clockwork {
 			GLuint m_id;
 			std::vector<utils::Image> m_images;
 			unsigned int m_bufferSize;
+			GLint m_compressedFormat;//the opengl internal format of the cooked textures, or 0 for images
+			unsigned int m_blockSize;
+			unsigned int m_levelCount;
 			GLint m_textureRepeat; 
 			maths::Vec4f m_borderColour;
 			GLint m_textureFilterUpscale;
@@ -70,7 +78,7 @@ namespace clockwork {
 			GL_NEAREST_MIPMAP_LINEAR=9986 mixes the two closest mipmaps to the pixel size(linearly interpolates between the two mipmaps) and chooses the nearest pixel like GL_NEAREST
 			GL_LINEAR_MIPMAP_LINEAR=9987 mixes the two closest mipmaps to the pixel size(linearly interpolates between the two mipmaps) and mixes the nearest pixel like GL_LINEAR*/
 			explicit TextureArray2D(unsigned int reserved, GLint textureRepeat = GL_CLAMP_TO_EDGE, const maths::Vec4<float>& borderColour = maths::Vec4<float>(0, 0, 0, 0), GLint textureFilterUpscale = GL_LINEAR, GLint textureFilterDownscale = GL_NEAREST_MIPMAP_LINEAR) noexcept
-				: m_textureRepeat(textureRepeat), m_borderColour(borderColour), m_textureFilterUpscale(textureFilterUpscale), m_textureFilterDownscale(textureFilterDownscale)
+				: m_compressedFormat(0), m_blockSize(0), m_levelCount(0), m_textureRepeat(textureRepeat), m_borderColour(borderColour), m_textureFilterUpscale(textureFilterUpscale), m_textureFilterDownscale(textureFilterDownscale)
 			{
 				glGenTextures(1, &m_id);//generate texture in opengl state machine and save id 
 				glBindTexture(GL_TEXTURE_2D_ARRAY, m_id);//like other objects bind the texture array to modify and access it 
@@ -88,7 +96,7 @@ namespace clockwork {
 
 			/*creates an empty texturearray2d with no data and no id*/
 			TextureArray2D() noexcept
-				: m_id(0), m_bufferSize(0)
+				: m_id(0), m_bufferSize(0), m_compressedFormat(0), m_blockSize(0), m_levelCount(0)
 			{}
 
 			/*deletes the TextureArrayId in the opengl state machine*/
@@ -102,7 +110,7 @@ namespace clockwork {
 
 			/*copies the unique id and resets the id of the moved object*/
 			TextureArray2D(TextureArray2D&& other) noexcept
-				: m_id(other.m_id), m_images(std::move(other.m_images)), m_bufferSize(other.m_bufferSize), m_textureRepeat(other.m_textureRepeat), m_borderColour(other.m_borderColour), m_textureFilterUpscale(other.m_textureFilterUpscale), m_textureFilterDownscale(other.m_textureFilterDownscale)
+				: m_id(other.m_id), m_images(std::move(other.m_images)), m_bufferSize(other.m_bufferSize), m_compressedFormat(other.m_compressedFormat), m_blockSize(other.m_blockSize), m_levelCount(other.m_levelCount), m_textureRepeat(other.m_textureRepeat), m_borderColour(other.m_borderColour), m_textureFilterUpscale(other.m_textureFilterUpscale), m_textureFilterDownscale(other.m_textureFilterDownscale)
 			{
 				other.m_id = 0;
 			}
@@ -118,6 +126,9 @@ namespace clockwork {
 				other.m_id = 0;
 				m_images = std::move(other.m_images);
 				m_bufferSize = other.m_bufferSize;
+				m_compressedFormat = other.m_compressedFormat;
+				m_blockSize = other.m_blockSize;
+				m_levelCount = other.m_levelCount;
 				m_textureRepeat = other.m_textureRepeat;
 				m_borderColour = other.m_borderColour;
 				m_textureFilterUpscale = other.m_textureFilterUpscale;
@@ -126,69 +137,170 @@ namespace clockwork {
 			}
 
 		private:
-			void addImage(const utils::Image& image) noexcept
+			/*copies the first mipmap level of one layer of a texturearray to a layer of another(or the same) texturearray
+			uses glCopyImageSubData when opengl 4.3 is available, so the copy stays on the gpu without framebuffers | otherwise the static read/draw framebuffers are used to blit the layer
+			the read/draw framebuffers have to be bound first when opengl 4.3 is not available*/
+			static void copyLayer(GLuint sourceId, unsigned int sourceLayer, GLuint targetId, unsigned int targetLayer, unsigned int width, unsigned int height) noexcept
 			{
-				if ( image.hasAlpha() )//look at pixelsize to guess the colour format for the image
+				if ( GLAD_GL_VERSION_4_3 )
+					glCopyImageSubData(sourceId, GL_TEXTURE_2D_ARRAY, 0, 0, 0, sourceLayer, targetId, GL_TEXTURE_2D_ARRAY, 0, 0, 0, targetLayer, width, height, 1);
+				else
 				{
-					if ( m_images.empty() )
+					glFramebufferTextureLayer(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, sourceId, 0, sourceLayer);
+					glFramebufferTextureLayer(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, targetId, 0, targetLayer);
+					glBlitFramebuffer(0, 0, width, height, 0, 0, width, height, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+				}
+			}
+
+			/*makes sure that the texturearray has storage for atleast count layers with the size and pixelkind of the image | the texturearray will be bound after this method
+			the first image allocates the storage with the reserved size | if the storage is full, the capacity will be doubled(or set to count if thats larger) and all layers will be copied into the new storage
+			so adding n images one by one only needs log(n) reallocations and the old texture id will be deleted after the copy*/
+			void reserveLayers(const utils::Image& image, unsigned int count) noexcept
+			{
+#if CLOCKWORK_DEBUG
+				if ( !m_images.empty() && m_compressedFormat != 0 )
+					std::cout << "Error TextureArray2D::reserveLayers(): an image can not be added to a texturearray2d with cooked textures" << std::endl;
+#endif
+				GLint internalFormat = image.hasAlpha() ? GL_RGBA : GL_RGB;
+				GLenum format = image.hasAlpha() ? utils::Image::getColourOrderRGBA() : utils::Image::getColourOrderRGB();
+				if ( m_images.empty() )
+				{
+					if ( count > m_bufferSize )
+						m_bufferSize = count;
+					if ( m_bufferSize == 0 )
+						m_bufferSize = 1;
+					glBindTexture(GL_TEXTURE_2D_ARRAY, m_id);
+					if ( m_compressedFormat != 0 )//the texturearray had cooked textures before
 					{
-						glBindTexture(GL_TEXTURE_2D_ARRAY, m_id);
-						glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA, image.getWidth(), image.getHeight(), m_bufferSize, 0, utils::Image::getColourOrderRGBA(), GL_UNSIGNED_BYTE, nullptr);
+						m_compressedFormat = 0;
+						glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, 1000);
 					}
-					else if ( m_images.size() >= m_bufferSize )
-					{
-						++m_bufferSize;
-						m_bufferSize *= 2;
-						TextureArray2D temp { 0,m_textureRepeat,m_borderColour,m_textureFilterUpscale,m_textureFilterDownscale };
-						glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA, image.getWidth(), image.getHeight(), m_bufferSize, 0, utils::Image::getColourOrderRGBA(), GL_UNSIGNED_BYTE, nullptr);
+					glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, internalFormat, image.getWidth(), image.getHeight(), m_bufferSize, 0, format, GL_UNSIGNED_BYTE, nullptr);
+				}
+				else if ( count > m_bufferSize )
+				{
+					m_bufferSize = maths::max(m_bufferSize * 2, count);
+					TextureArray2D temp { 0,m_textureRepeat,m_borderColour,m_textureFilterUpscale,m_textureFilterDownscale };
+					glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, internalFormat, image.getWidth(), image.getHeight(), m_bufferSize, 0, format, GL_UNSIGNED_BYTE, nullptr);
 
+					if ( !GLAD_GL_VERSION_4_3 )
+					{
 						m_readBuffer->bind();
 						m_drawBuffer->bind();
-						for ( unsigned int i = 0; i < m_images.size(); ++i )
-						{
-							glFramebufferTextureLayer(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, m_id, 0, i);
-							glFramebufferTextureLayer(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, temp.m_id, 0, i);
-							glBlitFramebuffer(0, 0, image.getWidth(), image.getHeight(), 0, 0, image.getWidth(), image.getHeight(), GL_COLOR_BUFFER_BIT, GL_NEAREST);
-						}
-						this->m_id = temp.m_id;
-						temp.m_id = 0;
+					}
+					for ( unsigned int i = 0; i < m_images.size(); ++i )
+						copyLayer(m_id, i, temp.m_id, i, image.getWidth(), image.getHeight());
+					if ( !GLAD_GL_VERSION_4_3 )
+					{
 						m_readBuffer->unbind();
 						m_drawBuffer->unbind();
 					}
-					glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, m_images.size(), image.getWidth(), image.getHeight(), 1, utils::Image::getColourOrderRGBA(), GL_UNSIGNED_BYTE, image.getData());
+					std::swap(m_id, temp.m_id);//temp deletes the old storage with its destructor
+					glBindTexture(GL_TEXTURE_2D_ARRAY, m_id);
 				}
 				else
+					glBindTexture(GL_TEXTURE_2D_ARRAY, m_id);
+			}
+
+			/*copies the imagedata into the next free layer of the bound texturearray and stores the image without its data | the storage has to be reserved first*/
+			void uploadImage(const utils::Image& image) noexcept
+			{
+				if ( image.hasAlpha() )//look at pixelsize to guess the colour format for the image
+					glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, m_images.size(), image.getWidth(), image.getHeight(), 1, utils::Image::getColourOrderRGBA(), GL_UNSIGNED_BYTE, image.getData());
+				else
+					glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, m_images.size(), image.getWidth(), image.getHeight(), 1, utils::Image::getColourOrderRGB(), GL_UNSIGNED_BYTE, image.getData());
+				m_images.push_back(image);
+				m_images.back().clearData();
+			}
+
+			void addImage(const utils::Image& image) noexcept
+			{
+				reserveLayers(image, m_images.size() + 1);
+				uploadImage(image);
+				glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+			}
+
+			/*copies all mipmap levels of count layers of a compressed texturearray to the layers of another(or the same) compressed texturearray with the same format and size
+			uses glCopyImageSubData when opengl 4.3 is available | otherwise each level of the source is read back with glGetCompressedTexImage and uploaded into the target, which also works with opengl 3.3
+			the target texturearray will be bound after this method*/
+			void copyCompressedLayers(GLuint sourceId, unsigned int sourceLayer, GLuint targetId, unsigned int targetLayer, unsigned int count) noexcept
+			{
+				unsigned int width = m_images.at(0).getWidth();
+				unsigned int height = m_images.at(0).getHeight();
+				std::vector<unsigned char> data;
+				for ( unsigned int level = 0; level < m_levelCount; ++level )
 				{
-					if ( m_images.empty() )
+					unsigned int levelWidth = maths::max(width >> level, 1u);
+					unsigned int levelHeight = maths::max(height >> level, 1u);
+					if ( GLAD_GL_VERSION_4_3 )
 					{
-						glBindTexture(GL_TEXTURE_2D_ARRAY, m_id);
-						glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGB, image.getWidth(), image.getHeight(), m_bufferSize, 0, utils::Image::getColourOrderRGB(), GL_UNSIGNED_BYTE, nullptr);
+						for ( unsigned int i = 0; i < count; ++i )//one layer per copy, because the regions can overlap when the layers are moved inside the same texturearray
+							glCopyImageSubData(sourceId, GL_TEXTURE_2D_ARRAY, level, 0, 0, sourceLayer + i, targetId, GL_TEXTURE_2D_ARRAY, level, 0, 0, targetLayer + i, levelWidth, levelHeight, 1);
 					}
-					else if ( m_images.size() >= m_bufferSize )
+					else
 					{
-						++m_bufferSize;
-						m_bufferSize *= 2;
-						TextureArray2D temp { 0,m_textureRepeat,m_borderColour,m_textureFilterUpscale,m_textureFilterDownscale };
-						glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGB, image.getWidth(), image.getHeight(), m_bufferSize, 0, utils::Image::getColourOrderRGB(), GL_UNSIGNED_BYTE, nullptr);
-
-						m_readBuffer->bind();
-						m_drawBuffer->bind();
-						for ( unsigned int i = 0; i < m_images.size(); ++i )
-						{
-							glFramebufferTextureLayer(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, m_id, 0, i); 
-							glFramebufferTextureLayer(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, temp.m_id, 0, i);
-							glBlitFramebuffer(0, 0, image.getWidth(), image.getHeight(), 0, 0, image.getWidth(), image.getHeight(), GL_COLOR_BUFFER_BIT, GL_NEAREST);
-						}
-						this->m_id = temp.m_id;
-						temp.m_id = 0;
-						m_readBuffer->unbind();
-						m_drawBuffer->unbind();
+						unsigned int layerSize = ( ( levelWidth + 3 ) / 4 ) * ( ( levelHeight + 3 ) / 4 ) * m_blockSize;
+						GLint size = 0;
+						glBindTexture(GL_TEXTURE_2D_ARRAY, sourceId);
+						glGetTexLevelParameteriv(GL_TEXTURE_2D_ARRAY, level, GL_TEXTURE_COMPRESSED_IMAGE_SIZE, &size);
+						data.resize(size);
+						glGetCompressedTexImage(GL_TEXTURE_2D_ARRAY, level, data.data());
+						glBindTexture(GL_TEXTURE_2D_ARRAY, targetId);
+						glCompressedTexSubImage3D(GL_TEXTURE_2D_ARRAY, level, 0, 0, targetLayer, levelWidth, levelHeight, count, m_compressedFormat, layerSize * count, data.data() + layerSize * sourceLayer);
 					}
-					glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, m_images.size(), image.getWidth(), image.getHeight(), 1, utils::Image::getColourOrderRGB(), GL_UNSIGNED_BYTE, image.getData());
 				}
-				glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
-				m_images.push_back(image);
-				m_images.back().clearData();
+				glBindTexture(GL_TEXTURE_2D_ARRAY, targetId);
+			}
+
+			/*allocates the storage of all mipmap levels for m_buffersize layers of the cooked texture in the bound texturearray | the size of each level is set, so opengl does not need to generate mipmaps*/
+			void allocateCompressedStorage(const utils::CookedTexture& texture) noexcept
+			{
+				glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, m_levelCount - 1);
+				for ( unsigned int level = 0; level < m_levelCount; ++level )
+					glCompressedTexImage3D(GL_TEXTURE_2D_ARRAY, level, m_compressedFormat, texture.getLevelWidth(level), texture.getLevelHeight(level), m_bufferSize, 0, texture.getLevelSize(level) * m_bufferSize, nullptr);
+			}
+
+			/*makes sure that the texturearray has storage for atleast count cooked textures with the format and size of the cooked texture | the texturearray will be bound after this method
+			works like reserveLayers for images, but all mipmap levels are allocated and copied, because the compressed mipmaps can not be generated by opengl*/
+			void reserveCompressedLayers(const utils::CookedTexture& texture, unsigned int count) noexcept
+			{
+#if CLOCKWORK_DEBUG
+				if ( !m_images.empty() && m_compressedFormat != texture.getInternalFormat() )
+					std::cout << "Error TextureArray2D::reserveCompressedLayers(): the cooked texture has not the same format as the other textures in the texturearray" << std::endl;
+				if ( !texture.hasData() )
+					std::cout << "Error TextureArray2D::reserveCompressedLayers(): CookedTexture has no data" << std::endl;
+#endif
+				if ( m_images.empty() )
+				{
+					m_compressedFormat = texture.getInternalFormat();
+					m_blockSize = utils::CookedTexture::getBlockSize(texture.getFormat());
+					m_levelCount = texture.getLevelCount();
+					if ( count > m_bufferSize )
+						m_bufferSize = count;
+					if ( m_bufferSize == 0 )
+						m_bufferSize = 1;
+					glBindTexture(GL_TEXTURE_2D_ARRAY, m_id);
+					allocateCompressedStorage(texture);
+				}
+				else if ( count > m_bufferSize )
+				{
+					m_bufferSize = maths::max(m_bufferSize * 2, count);
+					TextureArray2D temp { 0,m_textureRepeat,m_borderColour,m_textureFilterUpscale,m_textureFilterDownscale };
+					allocateCompressedStorage(texture);
+					copyCompressedLayers(m_id, 0, temp.m_id, 0, m_images.size());
+					std::swap(m_id, temp.m_id);//temp deletes the old storage with its destructor
+					glBindTexture(GL_TEXTURE_2D_ARRAY, m_id);
+				}
+				else
+					glBindTexture(GL_TEXTURE_2D_ARRAY, m_id);
+			}
+
+			/*copies all compressed mipmap levels of the cooked texture into the next free layer of the bound texturearray and stores the image that describes the cooked texture | the storage has to be reserved first*/
+			void uploadCookedTexture(const utils::CookedTexture& texture) noexcept
+			{
+				for ( unsigned int level = 0; level < m_levelCount; ++level )
+					glCompressedTexSubImage3D(GL_TEXTURE_2D_ARRAY, level, 0, 0, m_images.size(), texture.getLevelWidth(level), texture.getLevelHeight(level), 1, m_compressedFormat, texture.getLevelSize(level), texture.getLevelData(level));
+				m_images.push_back(texture.getImage());
 			}
 
 		public:
@@ -222,7 +334,7 @@ namespace clockwork {
 			int getTextureId(const utils::Image& image) noexcept
 			{
 #if CLOCKWORK_DEBUG
-				if ( image.getData() == nullptr )
+				if ( !image.hasData() )
 					std::cout << "Error TextureArray2D::getTextureId(): Image has no data" << std::endl;
 #endif
 #if CLOCKWORK_DEBUG
@@ -250,10 +362,15 @@ namespace clockwork {
 					if ( m_images.at(i).getFilepath() == imagePath )
 						return i;
 				}
+				if ( utils::CookedTexture::isCookedFile(imagePath) )
+				{
+					addTexture(utils::CookedTexture(imagePath).load());
+					return m_images.size() - 1;
+				}
 				utils::Image image(imagePath);
 				image.load();
 #if CLOCKWORK_DEBUG
-				if ( image.getData() == nullptr )
+				if ( !image.hasData() )
 					std::cout << "Error TextureArray2D::getTextureId(): Image has no data" << std::endl;
 #endif
 #if CLOCKWORK_DEBUG
@@ -270,7 +387,7 @@ namespace clockwork {
 			void addTexture(const utils::Image& image) noexcept
 			{
 #if CLOCKWORK_DEBUG
-				if ( image.getData() == nullptr )
+				if ( !image.hasData() )
 					std::cout << "Error TextureArray2D::addTexture(): Image has no data" << std::endl;
 #endif
 #if CLOCKWORK_DEBUG
@@ -305,10 +422,15 @@ namespace clockwork {
 					}
 				}
 #endif 
+				if ( utils::CookedTexture::isCookedFile(imagePath) )
+				{
+					addTexture(utils::CookedTexture(imagePath).load());
+					return;
+				}
 				utils::Image image(imagePath);
 				image.load();
 #if CLOCKWORK_DEBUG
-				if ( image.getData() == nullptr )
+				if ( !image.hasData() )
 					std::cout << "Error TextureArray2D::addTexture(): Image has no data" << std::endl;
 #endif
 #if CLOCKWORK_DEBUG
@@ -318,6 +440,142 @@ namespace clockwork {
 				addImage(image);
 			}
 
+			/*adds many images/textures(that are not in the texturearray) at once to the texturearray2d | the storage will only be resized once for all images and the mipmaps will only be generated once
+			so this should be used instead of calling addTexture for each image when loading many textures | dont add images that already are in the texturearray
+			images with another size or pixelkind than the other images(or the first new image for an empty texturearray) are converted with utils::normaliseImage instead of being rejected
+			the conversion runs on the render thread, so mixed images should better be normalised on worker threads first(see AssetLoader::loadImages with a size)
+			the texturearray will be bound after this method*/
+			void addImages(const std::vector<utils::Image>& images) noexcept
+			{
+				if ( images.empty() )
+					return;
+#if CLOCKWORK_DEBUG
+				for ( unsigned int i = 0; i < images.size(); ++i )
+				{
+					if ( !images.at(i).hasData() )
+						std::cout << "Error TextureArray2D::addImages(): Image has no data" << std::endl;
+					if ( contains(images.at(i).getFilepath()) )
+						std::cout << "Error TextureArray2D::addImages(): an image with the same imagepath already is in the texturearray2d" << std::endl;
+				}
+#endif
+				const utils::Image& layout = m_images.empty() ? images.front() : m_images.at(0);
+				std::vector<utils::Image> fitted;//images that already fit only share their data
+				fitted.reserve(images.size());
+				for ( const auto& image : images )
+					fitted.push_back(utils::normaliseImage(image, layout.getWidth(), layout.getHeight(), layout.getPixelSize()));
+				m_images.reserve(m_images.size() + fitted.size());
+				reserveLayers(fitted.front(), m_images.size() + fitted.size());
+				for ( const auto& image : fitted )
+					uploadImage(image);
+				glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+			}
+
+			/*adds many images/textures(that are not in the texturearray) at once to the texturearray2d like addImages, but the imagedata is streamed into the layers by the textureuploader over the next frames instead of being copied synchronously on the render thread
+			the layers are reserved and the images are stored(without data) immediately, so the textureids can be used right away, but the layers stay empty until the upload is finished | the mipmaps are generated once after the last image has been uploaded
+			CAREFUL: dont add or remove textures of this texturearray while its uploads are pending, because a resized texturearray gets a new opengl id and the pending uploads would still go to the old id
+			images with another size or pixelkind are converted like in addImages(const std::vector<utils::Image>&)
+			@param[images] the decoded images with data | they are moved into the uploader
+			@param[uploader] the textureuploader that streams the imagedata, for example the global textureUploader
+			the texturearray will be bound after this method*/
+			void addImages(std::vector<utils::Image>&& images, TextureUploader& uploader) noexcept
+			{
+				if ( images.empty() )
+					return;
+#if CLOCKWORK_DEBUG
+				for ( unsigned int i = 0; i < images.size(); ++i )
+				{
+					if ( !images.at(i).hasData() )
+						std::cout << "Error TextureArray2D::addImages(): Image has no data" << std::endl;
+					if ( contains(images.at(i).getFilepath()) )
+						std::cout << "Error TextureArray2D::addImages(): an image with the same imagepath already is in the texturearray2d" << std::endl;
+				}
+#endif
+				const utils::Image& layout = m_images.empty() ? images.front() : m_images.at(0);
+				for ( unsigned int i = m_images.empty() ? 1 : 0; i < images.size(); ++i )//the first image sets the size of an empty texturearray
+					images.at(i) = utils::normaliseImage(images.at(i), layout.getWidth(), layout.getHeight(), layout.getPixelSize());
+				m_images.reserve(m_images.size() + images.size());
+				reserveLayers(images.front(), m_images.size() + images.size());
+				GLuint id = m_id;
+				for ( unsigned int i = 0; i < images.size(); ++i )
+				{
+					utils::Image& image = images.at(i);
+					m_images.push_back(utils::Image(image.getFilepath(), image.getWidth(), image.getHeight(), image.getPixelSize()));
+					if ( i + 1 == images.size() )//the uploads are finished in order, so the mipmaps are generated after the last one
+					{
+						uploader.upload(std::move(image), GL_TEXTURE_2D_ARRAY, id, m_images.size() - 1, [id]() {
+							glBindTexture(GL_TEXTURE_2D_ARRAY, id);
+							glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+						});
+					}
+					else
+						uploader.upload(std::move(image), GL_TEXTURE_2D_ARRAY, id, m_images.size() - 1);
+				}
+				images.clear();
+			}
+
+			/*adds a cooked texture(that is not in the texturearray) to the texturearray2d | the compressed mipmap levels are uploaded directly, so no mipmaps are generated
+			the filepath of the cooked texture is used like the imagepath of an image | dont add a cooked texture that already is in the texturearray
+			CAREFUL: all textures of the texturearray have to be cooked textures with the same size and blockformat, so cooked textures and images can not be mixed in one texturearray2d
+			the texturearray will be bound after this method*/
+			void addTexture(const utils::CookedTexture& texture) noexcept
+			{
+#if CLOCKWORK_DEBUG
+				if ( contains(texture.getFilepath()) )
+				{
+					std::cout << "Error TextureArray2D::addTexture(): a texture with the same filepath already is in the texturearray2d" << std::endl;
+					return;
+				}
+#endif 
+				reserveCompressedLayers(texture, m_images.size() + 1);
+				uploadCookedTexture(texture);
+			}
+
+			/*adds many cooked textures(that are not in the texturearray) at once to the texturearray2d | the storage will only be resized once for all cooked textures
+			CAREFUL: all textures of the texturearray have to be cooked textures with the same size and blockformat
+			the texturearray will be bound after this method*/
+			void addImages(const std::vector<utils::CookedTexture>& textures) noexcept
+			{
+				if ( textures.empty() )
+					return;
+#if CLOCKWORK_DEBUG
+				for ( unsigned int i = 0; i < textures.size(); ++i )
+				{
+					if ( textures.at(i).getWidth() != textures.front().getWidth() || textures.at(i).getHeight() != textures.front().getHeight() || textures.at(i).getFormat() != textures.front().getFormat() )
+						std::cout << "Error TextureArray2D::addImages(): the cooked texture has not the same size and format as the other cooked textures" << std::endl;
+					if ( contains(textures.at(i).getFilepath()) )
+						std::cout << "Error TextureArray2D::addImages(): a texture with the same filepath already is in the texturearray2d" << std::endl;
+				}
+#endif
+				m_images.reserve(m_images.size() + textures.size());
+				reserveCompressedLayers(textures.front(), m_images.size() + textures.size());
+				for ( const auto& texture : textures )
+					uploadCookedTexture(texture);
+			}
+
+			/*loads the images(or the cooked textures for .cwtx files) from the imagepaths and adds them at once to the texturearray2d | the storage will only be resized once for all images and the mipmaps will only be generated once
+			CAREFUL: the size of the new images has to be the same as the size of the other images and the pixelkind has to be the same too(rgb/rgba = same transparancy level)
+			the texturearray will be bound after this method*/
+			void addImages(const std::vector<std::string>& imagePaths) noexcept
+			{
+				std::vector<utils::Image> images;
+				std::vector<utils::CookedTexture> textures;
+				for ( const auto& imagePath : imagePaths )
+				{
+					if ( utils::CookedTexture::isCookedFile(imagePath) )
+					{
+						textures.push_back(utils::CookedTexture(imagePath));
+						textures.back().load();
+					}
+					else
+					{
+						images.push_back(utils::Image(imagePath));
+						images.back().load();
+					}
+				}
+				addImages(images);
+				addImages(textures);
+			}
+
 			/*removes a texture/image out of the texturearray at the given position*/
 			void removeTexture(int textureId) noexcept
 			{
@@ -325,24 +583,39 @@ namespace clockwork {
 				if ( m_images.size() <= textureId )
 					std::cout << "Error TextureArray2D::removeTexture(): TextureId is not in the texturearray2d" << std::endl;
 #endif
+				unsigned int width = m_images.at(textureId).getWidth();
+				unsigned int height = m_images.at(textureId).getHeight();
 				m_images.erase(m_images.begin() + textureId);
-				m_readBuffer->bind();
-				m_drawBuffer->bind();
+				if ( m_compressedFormat != 0 )
+				{
+					if ( textureId < m_images.size() )
+						copyCompressedLayers(m_id, textureId + 1, m_id, textureId, m_images.size() - textureId);
+					return;
+				}
+				if ( !GLAD_GL_VERSION_4_3 )
+				{
+					m_readBuffer->bind();
+					m_drawBuffer->bind();
+				}
 				for ( unsigned int i = textureId; i < m_images.size(); ++i )
+					copyLayer(m_id, i + 1, m_id, i, width, height);
+				if ( !GLAD_GL_VERSION_4_3 )
+				{
+					m_readBuffer->unbind();
+					m_drawBuffer->unbind();
+				}
+				if ( textureId < m_images.size() )
 				{
-					glFramebufferTextureLayer(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, m_id, 0, i + 1);
-					glFramebufferTextureLayer(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, m_id, 0, i);
-					glBlitFramebuffer(0, 0, m_images.front().getWidth(), m_images.front().getHeight(), 0, 0, m_images.front().getWidth(), m_images.front().getHeight(), GL_COLOR_BUFFER_BIT, GL_NEAREST);
+					glBindTexture(GL_TEXTURE_2D_ARRAY, m_id);
+					glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
 				}
-				m_readBuffer->unbind();
-				m_drawBuffer->unbind();
 			}
 
 			/*removes a texture/image with the same filepath out of the texturearray*/
 			void removeTexture(const utils::Image& image) noexcept
 			{
 #if CLOCKWORK_DEBUG
-				if ( image.getData() == nullptr )
+				if ( !image.hasData() )
 					std::cout << "Error TextureArray2D::removeTexture(): Image has no data" << std::endl;
 #endif
 				for ( unsigned int i = 0; i < m_images.size(); ++i )
@@ -378,7 +651,7 @@ namespace clockwork {
 			bool contains(const utils::Image& image) const noexcept
 			{
 #if CLOCKWORK_DEBUG
-				if ( image.getData()==nullptr )
+				if ( !image.hasData() )
 					std::cout << "Error TextureArray2D::contains(): Image has no data" << std::endl;
 #endif
 				for ( unsigned int i = 0; i < m_images.size(); ++i )
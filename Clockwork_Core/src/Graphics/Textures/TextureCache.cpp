@@ -0,0 +1,154 @@
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "TextureCache.h"
+#include <cstring>
+
+namespace clockwork {
+	namespace graphics {
+
+		TextureCache* textureCache = nullptr;
+
+		TextureCache::TextureCache() noexcept
+			: m_cache("Texture2D")
+		{}
+
+		TextureHandle TextureCache::get(const utils::Image& image) noexcept
+		{
+			unsigned int pathId = utils::internPath(image.getFilepath());
+			TextureHandle texture = m_cache.find(pathId);
+			if ( texture )
+				return texture;
+			if ( !image.hasData() )
+			{
+				utils::Image loaded(image.getFilepath());
+				loaded.load();
+				return create(pathId, loaded);
+			}
+			return create(pathId, image);
+		}
+
+		TextureHandle TextureCache::get(const std::string& imagePath) noexcept
+		{
+			unsigned int pathId = utils::internPath(imagePath);
+			TextureHandle texture = m_cache.find(pathId);
+			if ( texture )
+				return texture;
+			utils::Image image(imagePath);
+			image.load();
+			return create(pathId, image);
+		}
+
+		TextureHandle TextureCache::get(utils::Image&& image, TextureUploader& uploader) noexcept
+		{
+			unsigned int pathId = utils::internPath(image.getFilepath());
+			TextureHandle texture = m_cache.find(pathId);
+			if ( texture )
+				return texture;
+			unsigned long long contentHash = hashImage(image);
+			texture = findContent(pathId, contentHash, image);
+			if ( texture )
+				return texture;
+			utils::Image pixels(image);//shares the pixels before the image is moved into the uploader
+			return insert(pathId, contentHash, pixels, Texture2D(std::move(image), uploader));
+		}
+
+		TextureHandle TextureCache::create(unsigned int pathId, const utils::Image& image) noexcept
+		{
+			unsigned long long contentHash = hashImage(image);
+			TextureHandle texture = findContent(pathId, contentHash, image);
+			if ( texture )
+				return texture;
+			return insert(pathId, contentHash, image, Texture2D(image));
+		}
+
+		TextureHandle TextureCache::findContent(unsigned int pathId, unsigned long long contentHash, const utils::Image& image) noexcept
+		{
+			if ( contentHash == 0 )//no data to compare, so the texture is only cached by its path
+				return m_cache.findContent(pathId, contentHash, [](const TextureHandle&) {return false;});
+			return m_cache.findContent(pathId, contentHash, [this, contentHash, &image](const TextureHandle& texture) {
+				auto pixels = m_pixels.find(contentHash);
+				return pixels != m_pixels.end() && pixels->second.texture.lock() == texture && isSameImage(pixels->second.image, image);
+			});
+		}
+
+		TextureHandle TextureCache::insert(unsigned int pathId, unsigned long long contentHash, const utils::Image& pixels, Texture2D&& texture) noexcept
+		{
+			unsigned long long bytes = getTextureBytes(pixels);
+			if ( contentHash != 0 )
+			{
+				auto resident = m_pixels.find(contentHash);
+				if ( resident != m_pixels.end() && !resident->second.texture.expired() )
+					contentHash = 0;//the hash collides with a different resident texture, which keeps the content entry
+			}
+			TextureHandle handle = m_cache.insert(pathId, contentHash, bytes, std::move(texture));
+			if ( contentHash != 0 )
+				m_pixels[contentHash] = Pixels { handle, pixels };
+			return handle;
+		}
+
+		void TextureCache::prune() noexcept
+		{
+			m_cache.prune();
+			for ( auto pixels = m_pixels.begin(); pixels != m_pixels.end(); )
+				pixels = pixels->second.texture.expired() ? m_pixels.erase(pixels) : ++pixels;
+		}
+
+		TextureHandle TextureCache::find(const std::string& imagePath) noexcept
+		{
+			return m_cache.find(utils::internPath(imagePath));
+		}
+
+		unsigned long long TextureCache::hashImage(const utils::Image& image) noexcept
+		{
+			if ( !image.hasData() )//a failed load would otherwise only be hashed by its size and share the texture of another failed image
+				return 0;
+			utils::ImageView view = image.getView();
+			unsigned long long hash = ( static_cast<unsigned long long>( view.getWidth() ) << 40 ) ^ ( static_cast<unsigned long long>( view.getHeight() ) << 16 ) ^ view.getBytesPerPixel();
+			if ( view.isPacked() )
+				hash ^= utils::hashContent(view.getData(), static_cast<unsigned long long>( view.getPitch() ) * view.getHeight());
+			else
+			{
+				unsigned int rowSize = view.getWidth() * view.getBytesPerPixel();
+				for ( unsigned int row = 0; row < view.getHeight(); ++row )
+					hash = ( hash * 0x100000001B3ULL ) ^ utils::hashContent(view.getRow(row), rowSize);
+			}
+			return hash == 0 ? 1 : hash;//0 is reserved for images without content
+		}
+
+		bool TextureCache::isSameImage(const utils::Image& first, const utils::Image& second) noexcept
+		{
+			if ( !first.hasData() || !second.hasData() )
+				return false;
+			utils::ImageView firstView = first.getView();
+			utils::ImageView secondView = second.getView();
+			if ( firstView.getWidth() != secondView.getWidth() || firstView.getHeight() != secondView.getHeight() || firstView.getBytesPerPixel() != secondView.getBytesPerPixel() )
+				return false;
+			if ( firstView.getData() == secondView.getData() )//copies that share the same data
+				return true;
+			unsigned int rowSize = firstView.getWidth() * firstView.getBytesPerPixel();
+			for ( unsigned int row = 0; row < firstView.getHeight(); ++row )
+			{
+				if ( std::memcmp(firstView.getRow(row), secondView.getRow(row), rowSize) != 0 )
+					return false;
+			}
+			return true;
+		}
+
+		unsigned long long TextureCache::getTextureBytes(const utils::Image& image) noexcept
+		{
+			unsigned long long bytes = static_cast<unsigned long long>( image.getWidth() ) * image.getHeight() * ( image.getPixelSize() / 8 );
+			return bytes + bytes / 3;//the mipmaps need one third more memory
+		}
+
+	}
+}
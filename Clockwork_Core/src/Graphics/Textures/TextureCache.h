@@ -0,0 +1,94 @@
+#pragma once
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "src\Utils\AssetCache.h"
+#include "src\Graphics\Textures\Texture2D.h"
+
+namespace clockwork {
+	namespace graphics {
+
+		/*a shared texture2d from the texturecache | the texture is deleted when the last handle is released*/
+		using TextureHandle = std::shared_ptr<Texture2D>;
+
+		/*shares the texture2d objects with the default parameters between all renderers and cubemanagers, so each image is only uploaded once to the gpu
+		the textures are found by their interned path first and then by the hash of their pixels, so the same image under another path also uses the same texture
+		must only be used on the render thread*/
+		class TextureCache
+		{
+
+		private:
+			/*the pixels of a texture in the content map of the cache | the image shares the data of the loaded image(copy on write), because the texture itself clears its imagedata after the upload*/
+			struct Pixels
+			{
+				std::weak_ptr<Texture2D> texture;
+				utils::Image image;
+			};
+
+		private:
+			utils::AssetCache<Texture2D> m_cache;
+			std::unordered_map<unsigned long long, Pixels> m_pixels;//the pixels of the textures with a content hash, so a hash hit is compared byte by byte before the texture is shared
+
+		public:
+			TextureCache() noexcept;
+
+			TextureCache(const TextureCache& other) = delete;
+
+			TextureCache& operator=(const TextureCache& other) = delete;
+
+		private:
+			/*returns the texture with the same pixels as the image, or creates the texture for the path*/
+			TextureHandle create(unsigned int pathId, const utils::Image& image) noexcept;
+
+			/*returns the resident texture with the same hash and the same pixels as the image, or an empty handle | images without data are never shared*/
+			TextureHandle findContent(unsigned int pathId, unsigned long long contentHash, const utils::Image& image) noexcept;
+
+			/*stores the texture for the path and keeps the pixels for the content hash | a hash that is already used by another resident texture with different pixels(a collision) is not stored*/
+			TextureHandle insert(unsigned int pathId, unsigned long long contentHash, const utils::Image& pixels, Texture2D&& texture) noexcept;
+
+		public:
+			/*returns the texture of the image and creates it if its path and its pixels are not resident | an image without data is loaded from its filepath if there is no texture for its path*/
+			TextureHandle get(const utils::Image& image) noexcept;
+
+			/*returns the texture of the image at the path without loading the image if the texture is resident*/
+			TextureHandle get(const std::string& imagePath) noexcept;
+
+			/*returns the texture of the decoded image, or creates it and streams the imagedata with the textureuploader over the next frames like the texture2d constructor*/
+			TextureHandle get(utils::Image&& image, TextureUploader& uploader) noexcept;
+
+			/*returns the resident texture of the path, or an empty handle*/
+			TextureHandle find(const std::string& imagePath) noexcept;
+
+			/*removes the entries and the pixels of released textures*/
+			void prune() noexcept;
+
+			/*returns the hash of the pixels and the size of the image | the padding at the end of the rows is not hashed | an image without data returns 0, so it is not found by its content*/
+			static unsigned long long hashImage(const utils::Image& image) noexcept;
+
+			/*returns true if both images have the same size and the same pixels | the padding at the end of the rows is not compared*/
+			static bool isSameImage(const utils::Image& first, const utils::Image& second) noexcept;
+
+			/*returns the estimated gpu memory of the texture of the image with all mipmap levels*/
+			static unsigned long long getTextureBytes(const utils::Image& image) noexcept;
+
+		public:
+			const utils::AssetStatistics& getStatistics() const noexcept {return m_cache.getStatistics();}
+
+			void printStatistics() const noexcept {m_cache.printStatistics();}
+
+		};
+
+		/*the global texturecache that is created by initTextures()*/
+		extern TextureCache* textureCache;
+
+	}
+}
@@ -0,0 +1,425 @@
+#pragma once
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "glad\glad.h"
+#include <vector>
+#include <unordered_map>
+#include <type_traits>
+#include "src\Maths\Vec4.h"
+#include "src\Utils\Image.h"
+#include "src\Utils\CookedTexture.h"
+#include "src\Utils\AssetCache.h"
+#include "src\Graphics\Textures\TextureArray2D.h"
+
+namespace clockwork {
+	namespace graphics {
+
+		/*the position of a texture in the textureregistry | bucket is the id of the texturearray2d in the registry and layer is the position of the image in that texturearray2d(the textureid that is used in the fragmentshader)*/
+		struct TextureSlot
+		{
+			int bucket;
+			int layer;
+		};
+
+		/*a list of texturearray2ds where each texturearray2d(bucket) only stores images with the same width, height and pixelkind(rgb/rgba)
+		so images with diffrent sizes and transparency can be added to the registry and they will be sorted into the matching bucket, or a new bucket will be created for them
+		each image has a textureid in the registry from 0 to size-1 and the textureid is mapped to a textureslot(bucket, layer) | the layer is the position of the image in the texturearray2d of the bucket
+		models with textures in the same bucket can be drawn together with one instanced drawcall, so there is one drawcall per bucket and not one per size/pixelkind mismatch
+		cooked textures(.cwtx files) get their own buckets per size and blockformat, because compressed and uncompressed textures can not be stored in the same texturearray2d*/
+		class TextureRegistry
+		{
+
+		private:
+			/*the width, height and pixelkind of all images in one bucket | compressedformat is the opengl internal format of the cooked textures in the bucket, or 0 for images*/
+			struct BucketFormat
+			{
+				unsigned int width;
+				unsigned int height;
+				bool alpha;
+				int compressedFormat;
+			};
+
+		private:
+			std::vector<TextureArray2D> m_buckets;
+			std::vector<BucketFormat> m_formats;
+			std::vector<TextureSlot> m_slots;
+			std::unordered_map<unsigned int, int> m_textureIds;//the textureids of the interned imagepaths(utils::internPath)
+			unsigned int m_reserved;
+			GLint m_textureRepeat;
+			maths::Vec4f m_borderColour;
+			GLint m_textureFilterUpscale;
+			GLint m_textureFilterDownscale;
+
+		public:
+			/*creates an empty textureregistry without buckets | the buckets will be created when the first image of a new size/pixelkind is added
+			@param[reserved] the reserved count of images for each new texturearray2d bucket
+			the other parameters are the texture parameters for each texturearray2d bucket and are the same as the parameters of the texturearray2d constructor*/
+			explicit TextureRegistry(unsigned int reserved, GLint textureRepeat = GL_CLAMP_TO_EDGE, const maths::Vec4<float>& borderColour = maths::Vec4<float>(0, 0, 0, 0), GLint textureFilterUpscale = GL_LINEAR, GLint textureFilterDownscale = GL_NEAREST_MIPMAP_LINEAR) noexcept
+				: m_reserved(reserved), m_textureRepeat(textureRepeat), m_borderColour(borderColour), m_textureFilterUpscale(textureFilterUpscale), m_textureFilterDownscale(textureFilterDownscale)
+			{
+				m_slots.reserve(reserved);
+			}
+
+			/*creates an empty textureregistry that can not create buckets*/
+			TextureRegistry() noexcept
+				: m_reserved(0), m_textureRepeat(GL_CLAMP_TO_EDGE), m_borderColour(0, 0, 0, 0), m_textureFilterUpscale(GL_LINEAR), m_textureFilterDownscale(GL_NEAREST_MIPMAP_LINEAR)
+			{}
+
+			TextureRegistry(const TextureRegistry&) = delete;
+
+			/*moves the texturearray2d buckets and the textureslots of the other registry*/
+			TextureRegistry(TextureRegistry&& other) noexcept
+				: m_buckets(std::move(other.m_buckets)), m_formats(std::move(other.m_formats)), m_slots(std::move(other.m_slots)), m_textureIds(std::move(other.m_textureIds)), m_reserved(other.m_reserved), m_textureRepeat(other.m_textureRepeat), m_borderColour(other.m_borderColour),
+				m_textureFilterUpscale(other.m_textureFilterUpscale), m_textureFilterDownscale(other.m_textureFilterDownscale)
+			{}
+
+			TextureRegistry& operator=(const TextureRegistry&) = delete;
+
+			/*moves the texturearray2d buckets and the textureslots of the other registry*/
+			TextureRegistry& operator=(TextureRegistry&& other) noexcept
+			{
+				m_buckets = std::move(other.m_buckets);
+				m_formats = std::move(other.m_formats);
+				m_slots = std::move(other.m_slots);
+				m_textureIds = std::move(other.m_textureIds);
+				m_reserved = other.m_reserved;
+				m_textureRepeat = other.m_textureRepeat;
+				m_borderColour = other.m_borderColour;
+				m_textureFilterUpscale = other.m_textureFilterUpscale;
+				m_textureFilterDownscale = other.m_textureFilterDownscale;
+				return *this;
+			}
+
+		private:
+			/*returns the textureid of the image with the same filepath, or -1 if the image is not in the registry*/
+			int findTexture(const std::string& imagePath) const noexcept
+			{
+				auto textureId = m_textureIds.find(utils::internPath(imagePath));
+				return textureId == m_textureIds.end() ? -1 : textureId->second;
+			}
+
+			/*returns the id of the bucket with the format | if there is no matching bucket, a new texturearray2d bucket will be created and bound*/
+			int getBucketId(const BucketFormat& format) noexcept
+			{
+				for ( unsigned int i = 0; i < m_formats.size(); ++i )
+				{
+					if ( m_formats.at(i).width == format.width && m_formats.at(i).height == format.height && m_formats.at(i).alpha == format.alpha && m_formats.at(i).compressedFormat == format.compressedFormat )
+						return i;
+				}
+				m_buckets.push_back(TextureArray2D(m_reserved, m_textureRepeat, m_borderColour, m_textureFilterUpscale, m_textureFilterDownscale));
+				m_formats.push_back(format);
+				return m_buckets.size() - 1;
+			}
+
+			/*adds the image, or the cooked texture to its bucket and maps the next textureid to it*/
+			template<typename texture> void addImage(const texture& image) noexcept
+			{
+				int bucket = getBucketId(image);
+				m_buckets.at(bucket).addTexture(image);
+				m_slots.push_back(TextureSlot { bucket, static_cast<int>( m_buckets.at(bucket).getTextureCount() ) - 1 });
+				m_textureIds[utils::internPath(image.getFilepath())] = m_slots.size() - 1;
+			}
+
+			/*maps the next textureid to the layer that the image, or the cooked texture will have in its bucket and stores it in the list of its bucket, so all textures of a bucket can be added at once with addBuckets()*/
+			template<typename texture> void sortIntoBucket(texture&& image, std::vector<std::vector<typename std::decay<texture>::type>>& bucketTextures) noexcept
+			{
+				unsigned int bucket = getBucketId(image);
+				if ( bucketTextures.size() <= bucket )
+					bucketTextures.resize(bucket + 1);
+				m_slots.push_back(TextureSlot { static_cast<int>( bucket ), static_cast<int>( m_buckets.at(bucket).getTextureCount() + bucketTextures.at(bucket).size() ) });
+				m_textureIds[utils::internPath(image.getFilepath())] = m_slots.size() - 1;
+				bucketTextures.at(bucket).push_back(std::forward<texture>(image));
+			}
+
+			/*adds the sorted textures of each bucket at once to the texturearray2d of the bucket*/
+			template<typename texture> void addBuckets(const std::vector<std::vector<texture>>& bucketTextures) noexcept
+			{
+				for ( unsigned int i = 0; i < bucketTextures.size(); ++i )
+					m_buckets.at(i).addImages(bucketTextures.at(i));
+			}
+
+		public:
+			/*returns the id of the bucket with the same width, height and pixelkind(rgb/rgba) as the image | if there is no matching bucket, a new texturearray2d bucket will be created and bound*/
+			int getBucketId(const utils::Image& image) noexcept
+			{
+				return getBucketId(BucketFormat { image.getWidth(), image.getHeight(), image.hasAlpha(), 0 });
+			}
+
+			/*returns the id of the bucket with the same width, height and blockformat as the cooked texture | if there is no matching bucket, a new texturearray2d bucket will be created and bound*/
+			int getBucketId(const utils::CookedTexture& texture) noexcept
+			{
+				return getBucketId(BucketFormat { texture.getWidth(), texture.getHeight(), texture.hasAlpha(), texture.getInternalFormat() });
+			}
+
+			/*returns the textureid of the image in the registry | if the image is not in the registry, it will be added to the matching bucket
+			the textureid range is from 0 to size-1 and can be mapped to the bucket and layer with getSlot(textureId)*/
+			int getTextureId(const utils::Image& image) noexcept
+			{
+#if CLOCKWORK_DEBUG
+				if ( !image.hasData() )
+					std::cout << "Error TextureRegistry::getTextureId(): Image has no data" << std::endl;
+#endif
+				int textureId = findTexture(image.getFilepath());
+				if ( textureId != -1 )
+					return textureId;
+				addImage(image);
+				return m_slots.size() - 1;
+			}
+
+			/*returns the textureid of an image with the same imagepath in the registry | otherwise the image will be loaded from the imagepath and added to the matching bucket
+			imagepaths of cooked textures(.cwtx) are loaded as cooked textures*/
+			int getTextureId(const std::string& imagePath) noexcept
+			{
+				int textureId = findTexture(imagePath);
+				if ( textureId != -1 )
+					return textureId;
+				if ( utils::CookedTexture::isCookedFile(imagePath) )
+				{
+					addImage(utils::CookedTexture(imagePath).load());
+					return m_slots.size() - 1;
+				}
+				utils::Image image(imagePath);
+				image.load();
+#if CLOCKWORK_DEBUG
+				if ( !image.hasData() )
+					std::cout << "Error TextureRegistry::getTextureId(): Image has no data" << std::endl;
+#endif
+				addImage(image);
+				return m_slots.size() - 1;
+			}
+
+			/*adds an image(that is not in the registry) to the bucket with the same size and pixelkind | the bucket will be created if there is no matching bucket*/
+			void addTexture(const utils::Image& image) noexcept
+			{
+#if CLOCKWORK_DEBUG
+				if ( !image.hasData() )
+					std::cout << "Error TextureRegistry::addTexture(): Image has no data" << std::endl;
+				if ( findTexture(image.getFilepath()) != -1 )
+				{
+					std::cout << "Error TextureRegistry::addTexture(): an image with the same imagepath already is in the textureregistry" << std::endl;
+					return;
+				}
+#endif
+				addImage(image);
+			}
+
+			/*adds a cooked texture(that is not in the registry) to the bucket with the same size and blockformat | the bucket will be created if there is no matching bucket*/
+			void addTexture(const utils::CookedTexture& texture) noexcept
+			{
+#if CLOCKWORK_DEBUG
+				if ( findTexture(texture.getFilepath()) != -1 )
+				{
+					std::cout << "Error TextureRegistry::addTexture(): a texture with the same filepath already is in the textureregistry" << std::endl;
+					return;
+				}
+#endif
+				addImage(texture);
+			}
+
+			/*loads the image(or the cooked texture for .cwtx files) from the imagepath and adds it(if its not in the registry) to the bucket with the same size and pixelkind*/
+			void addTexture(const std::string& imagePath) noexcept
+			{
+#if CLOCKWORK_DEBUG
+				if ( findTexture(imagePath) != -1 )
+				{
+					std::cout << "Error TextureRegistry::addTexture(): an image with the same imagepath already is in the textureregistry" << std::endl;
+					return;
+				}
+#endif
+				if ( utils::CookedTexture::isCookedFile(imagePath) )
+				{
+					addImage(utils::CookedTexture(imagePath).load());
+					return;
+				}
+				utils::Image image(imagePath);
+				image.load();
+#if CLOCKWORK_DEBUG
+				if ( !image.hasData() )
+					std::cout << "Error TextureRegistry::addTexture(): Image has no data" << std::endl;
+#endif
+				addImage(image);
+			}
+
+			/*adds many images(that are not in the registry) at once | the images are sorted into their buckets and each bucket resizes its storage and generates its mipmaps only once
+			the textureids of the images are in the same order as the images in the vector*/
+			void addTextures(const std::vector<utils::Image>& images) noexcept
+			{
+				std::vector<std::vector<utils::Image>> bucketImages;
+				for ( const auto& image : images )
+				{
+#if CLOCKWORK_DEBUG
+					if ( findTexture(image.getFilepath()) != -1 )
+						std::cout << "Error TextureRegistry::addTextures(): an image with the same imagepath already is in the textureregistry" << std::endl;
+#endif
+					sortIntoBucket(image, bucketImages);
+				}
+				addBuckets(bucketImages);
+			}
+
+			/*adds many images(that are not in the registry) at once like addTextures, but the imagedata is streamed into the buckets by the textureuploader over the next frames(look at TextureArray2D::addImages with an uploader)
+			the textureids of the images are in the same order as the images in the vector and can be used right away, but the textures stay empty until the uploads are finished
+			CAREFUL: dont add or remove textures of the registry while its uploads are pending, because a resized bucket gets a new opengl id
+			@param[images] the decoded images with data | they are moved into the uploader*/
+			void addTextures(std::vector<utils::Image>&& images, TextureUploader& uploader) noexcept
+			{
+				std::vector<std::vector<utils::Image>> bucketImages;
+				for ( auto& image : images )
+				{
+#if CLOCKWORK_DEBUG
+					if ( findTexture(image.getFilepath()) != -1 )
+						std::cout << "Error TextureRegistry::addTextures(): an image with the same imagepath already is in the textureregistry" << std::endl;
+#endif
+					sortIntoBucket(std::move(image), bucketImages);
+				}
+				images.clear();
+				for ( unsigned int i = 0; i < bucketImages.size(); ++i )
+					m_buckets.at(i).addImages(std::move(bucketImages.at(i)), uploader);
+			}
+
+			/*adds many cooked textures(that are not in the registry) at once | the cooked textures are sorted into their buckets and each bucket resizes its storage only once
+			the textureids of the cooked textures are in the same order as the cooked textures in the vector*/
+			void addTextures(const std::vector<utils::CookedTexture>& textures) noexcept
+			{
+				std::vector<std::vector<utils::CookedTexture>> bucketTextures;
+				for ( const auto& texture : textures )
+				{
+#if CLOCKWORK_DEBUG
+					if ( findTexture(texture.getFilepath()) != -1 )
+						std::cout << "Error TextureRegistry::addTextures(): a texture with the same filepath already is in the textureregistry" << std::endl;
+#endif
+					sortIntoBucket(texture, bucketTextures);
+				}
+				addBuckets(bucketTextures);
+			}
+
+			/*loads the images(or the cooked textures for .cwtx files) from the imagepaths and adds them at once to the registry | each bucket resizes its storage and generates its mipmaps only once
+			the textureids are in the same order as the imagepaths, even if images and cooked textures are mixed*/
+			void addTextures(const std::vector<std::string>& imagePaths) noexcept
+			{
+				std::vector<std::vector<utils::Image>> bucketImages;
+				std::vector<std::vector<utils::CookedTexture>> bucketTextures;
+				for ( const auto& imagePath : imagePaths )
+				{
+#if CLOCKWORK_DEBUG
+					if ( findTexture(imagePath) != -1 )
+						std::cout << "Error TextureRegistry::addTextures(): an image with the same imagepath already is in the textureregistry" << std::endl;
+#endif
+					if ( utils::CookedTexture::isCookedFile(imagePath) )
+					{
+						utils::CookedTexture texture(imagePath);
+						texture.load();
+						sortIntoBucket(std::move(texture), bucketTextures);
+					}
+					else
+					{
+						utils::Image image(imagePath);
+						image.load();
+						sortIntoBucket(std::move(image), bucketImages);
+					}
+				}
+				addBuckets(bucketImages);
+				addBuckets(bucketTextures);
+			}
+
+			/*removes the texture at the textureid out of its bucket | all textureids after it will be decremented and the layers after it in the same bucket will also be decremented
+			the bucket itself stays in the registry, even if its empty, so the bucketids dont change*/
+			void removeTexture(int textureId) noexcept
+			{
+#if CLOCKWORK_DEBUG
+				if ( m_slots.size() <= textureId )
+					std::cout << "Error TextureRegistry::removeTexture(): TextureId is not in the textureregistry" << std::endl;
+#endif
+				TextureSlot slot = m_slots.at(textureId);
+				m_buckets.at(slot.bucket).removeTexture(slot.layer);
+				m_slots.erase(m_slots.begin() + textureId);
+				for ( auto& other : m_slots )
+				{
+					if ( other.bucket == slot.bucket && other.layer > slot.layer )
+						--other.layer;
+				}
+				for ( auto entry = m_textureIds.begin(); entry != m_textureIds.end(); )
+				{
+					if ( entry->second == textureId )
+					{
+						entry = m_textureIds.erase(entry);
+						continue;
+					}
+					if ( entry->second > textureId )
+						--entry->second;
+					++entry;
+				}
+			}
+
+			/*removes the texture with the same filepath out of its bucket*/
+			void removeTexture(const utils::Image& image) noexcept
+			{
+				removeTexture(image.getFilepath());
+			}
+
+			/*removes the texture with the same filepath out of its bucket*/
+			void removeTexture(const std::string& imagePath) noexcept
+			{
+				int textureId = findTexture(imagePath);
+				if ( textureId != -1 )
+					removeTexture(textureId);
+#if CLOCKWORK_DEBUG
+				else
+					std::cout << "Error TextureRegistry::removeTexture(): Texture Image is not in the textureregistry" << std::endl;
+#endif
+			}
+
+			/*returns true if the registry contains an image with the same filepath*/
+			bool contains(const utils::Image& image) const noexcept
+			{
+				return findTexture(image.getFilepath()) != -1;
+			}
+
+			/*returns true if the registry contains an image with the same filepath*/
+			bool contains(const std::string& imagePath) const noexcept
+			{
+				return findTexture(imagePath) != -1;
+			}
+
+			/*returns the bucket and the layer of the texture at the textureid*/
+			const TextureSlot& getSlot(int textureId) const noexcept
+			{
+#if CLOCKWORK_DEBUG
+				if ( m_slots.size() <= textureId )
+					std::cout << "Error TextureRegistry::getSlot(): TextureId is not in the textureregistry" << std::endl;
+#endif
+				return m_slots.at(textureId);
+			}
+
+			/*returns the image at the textureid | CAREFUL: this image will have no imagedata, because it will have been cleared!*/
+			const utils::Image& getTexture(int textureId) const noexcept
+			{
+				const TextureSlot& slot = getSlot(textureId);
+				return m_buckets.at(slot.bucket).getTexture(slot.layer);
+			}
+
+			/*returns the texturearray2d of the bucket*/
+			TextureArray2D& getBucket(int bucket) noexcept {return m_buckets.at(bucket);}
+
+			/*returns the texturearray2d of the bucket*/
+			const TextureArray2D& getBucket(int bucket) const noexcept {return m_buckets.at(bucket);}
+
+			/*returns the number of images in all buckets*/
+			const unsigned int getTextureCount() const noexcept {return m_slots.size();}
+
+			/*returns the number of buckets(texturearray2ds with diffrent image sizes/pixelkinds)*/
+			const unsigned int getBucketCount() const noexcept {return m_buckets.size();}
+
+		};
+
+	}
+}
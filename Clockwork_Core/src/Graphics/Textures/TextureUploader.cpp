@@ -0,0 +1,254 @@
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "TextureUploader.h"
+#include "src\Graphics\ContextThread.h"
+#include <cstring>
+#include <memory>
+#include <iostream>
+
+namespace clockwork {
+	namespace graphics {
+
+		TextureUploader* textureUploader = nullptr;
+
+		TextureUploader::TextureUploader(unsigned int slotCount, unsigned int frameBudget) noexcept
+			: m_slots(slotCount), m_running(true), m_frameBudget(frameBudget), m_pendingCount(0), m_uploadedBytes(0)
+		{
+#if CLOCKWORK_DEBUG
+			if ( slotCount == 0 )
+				std::cout << "Error TextureUploader::TextureUploader(): The uploader needs atleast one pixelbuffer" << std::endl;
+#endif
+			m_freeSlots.reserve(slotCount);
+			for ( unsigned int i = 0; i < slotCount; ++i )
+			{
+				Slot& slot = m_slots[i];
+				glGenBuffers(1, &slot.buffer);
+				slot.fence = nullptr;
+				slot.capacity = 0;
+				slot.size = 0;
+				slot.memory = nullptr;
+				m_freeSlots.push_back(slotCount - 1 - i);
+			}
+			m_copyThread = std::thread(&TextureUploader::copyLoop, this);
+		}
+
+		TextureUploader::~TextureUploader() noexcept
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_lock);
+				m_running = false;
+			}
+			m_condition.notify_all();
+			m_copyThread.join();
+			for ( Slot& slot : m_slots )
+			{
+				if ( slot.memory )
+				{
+					glBindBuffer(GL_PIXEL_UNPACK_BUFFER, slot.buffer);
+					glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+				}
+				if ( slot.fence )
+					glDeleteSync(slot.fence);
+				glDeleteBuffers(1, &slot.buffer);
+			}
+			glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+		}
+
+		void TextureUploader::copyLoop() noexcept
+		{
+			std::unique_lock<std::mutex> lock(m_lock);
+			while ( true )
+			{
+				m_condition.wait(lock, [this]() {return !m_running || !m_copySlots.empty();});
+				if ( !m_running )
+					return;
+				unsigned int index = m_copySlots.front();
+				m_copySlots.pop_front();
+				Slot& slot = m_slots[index];
+				lock.unlock();
+				std::memcpy(slot.memory, slot.request.image.getData(), slot.size);
+				slot.request.image.clearData();
+				lock.lock();
+				m_filledSlots.push_back(index);
+			}
+		}
+
+		unsigned int TextureUploader::getDataSize(const utils::Image& image) noexcept
+		{
+			return ( image.getWidth() * image.getPixelSize() + 31 ) / 32 * 4 * image.getHeight();
+		}
+
+		void TextureUploader::upload(utils::Image&& image, GLenum target, GLuint textureId, unsigned int layer, std::function<void()> finished) noexcept
+		{
+#if CLOCKWORK_DEBUG
+			if ( !image.hasData() )
+			{
+				std::cout << "Error TextureUploader::upload(): The image " << image.getFilepath() << " has no imagedata" << std::endl;
+				return;
+			}
+			if ( target != GL_TEXTURE_2D && target != GL_TEXTURE_2D_ARRAY )
+				std::cout << "Error TextureUploader::upload(): Only GL_TEXTURE_2D and GL_TEXTURE_2D_ARRAY textures can be uploaded" << std::endl;
+#endif
+			std::lock_guard<std::mutex> lock(m_lock);
+			m_requests.push_back(Request {std::move(image), target, textureId, layer, std::move(finished)});
+			++m_pendingCount;
+		}
+
+		void TextureUploader::update() noexcept
+		{
+			std::vector<std::function<void()>> finished;
+			std::unique_lock<std::mutex> lock(m_lock);
+
+			//1. free the pixelbuffers whose uploads are done | the fences are signaled in the order of the uploads
+			while ( !m_uploadingSlots.empty() )
+			{
+				Slot& slot = m_slots[m_uploadingSlots.front()];
+				GLenum status = glClientWaitSync(slot.fence, 0, 0);
+				if ( status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED )
+					break;
+				glDeleteSync(slot.fence);
+				slot.fence = nullptr;
+				if ( slot.request.finished )
+					finished.push_back(std::move(slot.request.finished));
+				slot.request.finished = nullptr;
+				m_freeSlots.push_back(m_uploadingSlots.front());
+				m_uploadingSlots.pop_front();
+				--m_pendingCount;
+			}
+
+			//2. upload the filled pixelbuffers into their textures within the framebudget | atleast one upload per frame, so images bigger than the budget are not stuck
+			unsigned int budget = m_frameBudget;
+			bool first = true;
+			while ( !m_filledSlots.empty() )
+			{
+				unsigned int index = m_filledSlots.front();
+				Slot& slot = m_slots[index];
+				if ( !first && slot.size > budget )
+					break;
+				budget = slot.size > budget ? 0 : budget - slot.size;
+				first = false;
+				m_filledSlots.pop_front();
+
+				const utils::Image& image = slot.request.image;
+				GLenum format = image.hasAlpha() ? utils::Image::getColourOrderRGBA() : utils::Image::getColourOrderRGB();
+				glBindBuffer(GL_PIXEL_UNPACK_BUFFER, slot.buffer);
+				glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+				slot.memory = nullptr;
+				glBindTexture(slot.request.target, slot.request.textureId);
+				if ( slot.request.target == GL_TEXTURE_2D_ARRAY )
+					glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, slot.request.layer, image.getWidth(), image.getHeight(), 1, format, GL_UNSIGNED_BYTE, nullptr);//the data pointer is the offset in the bound pixelbuffer
+				else
+					glTexSubImage2D(slot.request.target, 0, 0, 0, image.getWidth(), image.getHeight(), format, GL_UNSIGNED_BYTE, nullptr);
+				slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+				m_uploadingSlots.push_back(index);
+				m_uploadedBytes += slot.size;
+			}
+
+			//3. with a shared context the waiting images are uploaded directly from their imagedata on the context thread, so the driver copies them there and the ring and the framebudget are not needed
+			std::deque<Request> shared;
+			if ( contextThread && contextThread->isValid() )
+				shared.swap(m_requests);
+
+			//4. map the free pixelbuffers for the waiting images, so the copy thread can fill them until the next frame
+			bool mapped = false;
+			while ( !m_requests.empty() && !m_freeSlots.empty() )
+			{
+				unsigned int index = m_freeSlots.back();
+				m_freeSlots.pop_back();
+				Slot& slot = m_slots[index];
+				slot.request = std::move(m_requests.front());
+				m_requests.pop_front();
+				slot.size = getDataSize(slot.request.image);
+				glBindBuffer(GL_PIXEL_UNPACK_BUFFER, slot.buffer);
+				if ( slot.capacity < slot.size )
+				{
+					glBufferData(GL_PIXEL_UNPACK_BUFFER, slot.size, nullptr, GL_STREAM_DRAW);
+					slot.capacity = slot.size;
+				}
+				//the last upload from this pixelbuffer is finished(its fence was signaled), so the buffer can be mapped without synchronisation
+				slot.memory = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, slot.size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+#if CLOCKWORK_DEBUG
+				if ( !slot.memory )
+					std::cout << "Error TextureUploader::update(): The pixelbuffer could not be mapped" << std::endl;
+#endif
+				m_copySlots.push_back(index);
+				mapped = true;
+			}
+			glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+			lock.unlock();
+			if ( mapped )
+				m_condition.notify_one();
+
+			for ( auto& request : shared )
+				uploadShared(std::move(request));
+			for ( auto& callback : finished )
+				callback();
+		}
+
+		void TextureUploader::uploadShared(Request&& request) noexcept
+		{
+			std::shared_ptr<Request> shared = std::make_shared<Request>(std::move(request));//the tasks of the contextthread have to be copyable
+			contextThread->addFillTask([shared]() {//the storage of the texture was created on the render thread
+				const utils::Image& image = shared->image;
+				GLenum format = image.hasAlpha() ? utils::Image::getColourOrderRGBA() : utils::Image::getColourOrderRGB();
+				glBindTexture(shared->target, shared->textureId);
+				if ( shared->target == GL_TEXTURE_2D_ARRAY )
+					glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, shared->layer, image.getWidth(), image.getHeight(), 1, format, GL_UNSIGNED_BYTE, image.getData());//the hidden context has the default GL_UNPACK_ALIGNMENT of 4 like the rows of freeimage
+				else
+					glTexSubImage2D(shared->target, 0, 0, 0, image.getWidth(), image.getHeight(), format, GL_UNSIGNED_BYTE, image.getData());
+				glBindTexture(shared->target, 0);
+				shared->image.clearData();
+			}, [this, shared]() {
+				{
+					std::lock_guard<std::mutex> lock(m_lock);
+					m_uploadedBytes += getDataSize(shared->image);
+					--m_pendingCount;
+				}
+				if ( shared->finished )
+					shared->finished();
+			});
+		}
+
+		void TextureUploader::finish() noexcept
+		{
+			unsigned int frameBudget = m_frameBudget;
+			m_frameBudget = 0xFFFFFFFF;
+			while ( getPendingCount() != 0 )
+			{
+				update();
+				if ( contextThread && contextThread->isValid() )
+					contextThread->finish();//the images that were uploaded on the context thread are finished by its callbacks
+				std::unique_lock<std::mutex> lock(m_lock);
+				if ( !m_uploadingSlots.empty() )
+				{
+					GLsync fence = m_slots[m_uploadingSlots.front()].fence;
+					lock.unlock();
+					glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+				}
+				else
+				{
+					lock.unlock();
+					std::this_thread::yield();//waits for the copy thread
+				}
+			}
+			m_frameBudget = frameBudget;
+		}
+
+		const unsigned int TextureUploader::getPendingCount() noexcept
+		{
+			std::lock_guard<std::mutex> lock(m_lock);
+			return m_pendingCount;
+		}
+
+	}
+}
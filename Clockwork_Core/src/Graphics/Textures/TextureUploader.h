@@ -0,0 +1,136 @@
+#pragma once
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "glad\glad.h"
+#include "src\Utils\Image.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <vector>
+#include <deque>
+
+namespace clockwork {
+	namespace graphics {
+
+		/*streams decoded images into textures through a ring of pixel buffer objects(GL_PIXEL_UNPACK_BUFFER), so the driver does not have to copy the image data synchronously from client memory on the render thread
+		the images can be added from any thread with upload() and each image goes through the ring:
+		1. update() on the render thread maps a free pixelbuffer of the ring for the next waiting image
+		2. the copy thread of the uploader copies the imagedata into the mapped memory of the pixelbuffer(off the render thread)
+		3. update() unmaps the filled pixelbuffer and starts the upload from the pixelbuffer into the texture with glTexSubImage and a fence | only as many bytes per frame as the framebudget allows, so loading textures never causes a frame hitch
+		4. update() frees the pixelbuffer when the fence of its upload has been signaled and calls the finished callback of the image
+		if the engine has a global contextthread with a shared context, update() passes the waiting images to it instead, so glTexSubImage copies the imagedata on the context thread and the finished callback is called after its fence
+		there is one global uploader(textureUploader) which is created by initTextures() and updated by the engine before each frame*/
+		class TextureUploader
+		{
+
+		private:
+			/*an image that waits for its upload into the layer of a texture*/
+			struct Request
+			{
+				utils::Image image;
+				GLenum target;
+				GLuint textureId;
+				unsigned int layer;
+				std::function<void()> finished;
+			};
+
+			/*one pixelbuffer of the ring with the request that is currently using it*/
+			struct Slot
+			{
+				GLuint buffer;
+				GLsync fence;
+				unsigned int capacity;
+				unsigned int size;
+				void* memory;
+				Request request;
+			};
+
+		private:
+			std::vector<Slot> m_slots;
+			std::vector<unsigned int> m_freeSlots;
+			std::deque<unsigned int> m_copySlots;//mapped slots that wait for the copy thread
+			std::deque<unsigned int> m_filledSlots;//slots with copied data that wait for their upload in the order of the requests
+			std::deque<unsigned int> m_uploadingSlots;//slots with a fence in the order of the uploads
+			std::deque<Request> m_requests;
+			std::mutex m_lock;
+			std::condition_variable m_condition;
+			std::thread m_copyThread;
+			bool m_running;
+			unsigned int m_frameBudget;
+			unsigned int m_pendingCount;
+			unsigned long long m_uploadedBytes;
+
+		public:
+			/*creates the pixelbuffers of the ring and starts the copy thread | must be called from the render thread with an active opengl context
+			@param[slotCount] the number of pixelbuffers in the ring | thats the maximum number of images that can be copied and uploaded at the same time
+			@param[frameBudget] the maximum number of bytes that will be uploaded into textures per update() call | an image that is bigger than the budget will be uploaded alone in one frame*/
+			explicit TextureUploader(unsigned int slotCount = 4, unsigned int frameBudget = 4 * 1024 * 1024) noexcept;
+
+			/*stops the copy thread and deletes the pixelbuffers and fences | must be called from the render thread | images that were not uploaded are lost*/
+			~TextureUploader() noexcept;
+
+			TextureUploader(const TextureUploader& other) = delete;
+
+			TextureUploader(TextureUploader&& other) = delete;
+
+			TextureUploader& operator=(const TextureUploader& other) = delete;
+
+			TextureUploader& operator=(TextureUploader&& other) = delete;
+
+		private:
+			/*the loop of the copy thread | waits for mapped slots and copies the imagedata of their requests into the mapped memory*/
+			void copyLoop() noexcept;
+
+			/*returns the size of the imagedata in bytes with the rows aligned to 4 bytes like freeimage and opengl(GL_UNPACK_ALIGNMENT 4) store them*/
+			static unsigned int getDataSize(const utils::Image& image) noexcept;
+
+			/*uploads the image of the request with glTexSubImage on the global contextthread and calls its finished callback after the fence of the upload | must be called from the render thread*/
+			void uploadShared(Request&& request) noexcept;
+
+		public:
+			/*adds an image to the queue of images that will be uploaded into the texture | can be called from any thread
+			the texture needs storage with the size and pixelkind of the image(for example glTexImage with nullptr as data), because only glTexSubImage is used
+			@param[image] the decoded image with image data | the image is moved into the uploader and its data will be cleared after it has been copied
+			@param[target] GL_TEXTURE_2D, or GL_TEXTURE_2D_ARRAY
+			@param[textureId] the opengl id of the texture
+			@param[layer] the layer of the texturearray for GL_TEXTURE_2D_ARRAY
+			@param[finished] is called on the render thread after the imagedata is in the texture(for example to generate the mipmaps) | can be empty*/
+			void upload(utils::Image&& image, GLenum target, GLuint textureId, unsigned int layer = 0, std::function<void()> finished = nullptr) noexcept;
+
+			/*moves the waiting images through the ring and uploads the copied images into their textures within the framebudget | must be called once per frame from the render thread(the engine does this before rendering)*/
+			void update() noexcept;
+
+			/*uploads all waiting images without the framebudget and waits until all uploads are finished | must be called from the render thread | blocks the render thread, so use it only in loading screens*/
+			void finish() noexcept;
+
+		public:
+			/*changes the maximum number of bytes that will be uploaded per update() call*/
+			void setFrameBudget(unsigned int frameBudget) noexcept {m_frameBudget = frameBudget;}
+
+			/*returns the maximum number of bytes that will be uploaded per update() call*/
+			const unsigned int getFrameBudget() const noexcept {return m_frameBudget;}
+
+			/*returns the number of images that were added with upload() and whose upload is not finished yet | can be called from any thread*/
+			const unsigned int getPendingCount() noexcept;
+
+			/*returns the number of bytes that were uploaded by this uploader*/
+			const unsigned long long getUploadedBytes() const noexcept {return m_uploadedBytes;}
+
+		};
+
+		/*the global textureuploader that is created by initTextures() and updated by the engine before each frame*/
+		extern TextureUploader* textureUploader;
+
+	}
+}
@@ -109,11 +109,14 @@ namespace clockwork {
 				if ( m_pitch < -89.0f )
 					m_pitch = -89.0f;
 
+				float sinPitch, cosPitch, sinYaw, cosYaw;
+				maths::sincosD(m_pitch, sinPitch, cosPitch);
+				maths::sincosD(m_yaw, sinYaw, cosYaw);
 				m_direction = maths::Vec3f {//euler angles: triangle with hypotenuse lenght=1 | calculate values for pitch rotation around x-axis(depending on y): coordinate system with y=y and x=x/z: right/up side of triangle y = sin(pitch) | bottom/right and foward side of triangle x/z = cos(pitch)
 											//the same for yaw rotation around the y-axis(depending on x): coordinate system with y=z and x=x: right/up side of triangle z = sin(yaw) | bottom/right sidew of triangle x = cos(yaw) | y is not affected
-					maths::cosR(maths::toRadians(m_pitch))* maths::cosR(maths::toRadians(m_yaw)),
-					maths::sinR(maths::toRadians(m_pitch)),
-					maths::cosR(maths::toRadians(m_pitch)) * maths::sinR(maths::toRadians(m_yaw))
+					cosPitch * cosYaw,
+					sinPitch,
+					cosPitch * sinYaw
 				}.normalizeSelf();
 				m_right = m_worldUp.crossproduct(m_direction).normalizeSelf();
 				m_up = m_direction.crossproduct(m_right).normalizeSelf();
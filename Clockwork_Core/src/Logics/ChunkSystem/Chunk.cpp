@@ -19,6 +19,7 @@
 #include "src\Logics\Entities\Listener\StaticTickListener.h"
 #include "Chunk.h"
 #include "src\Graphics\Renderables\Border\CubeBorder.h"
+#include "src\Graphics\Renderables\Impostor\ChunkImpostor.h"
 
 #include "src\Physics\Colliders\Hitbox.h"
 
@@ -30,6 +31,7 @@ namespace clockwork {
 #if CHUNK_BORDER
 			, m_border(nullptr)
 #endif
+			, m_impostor(nullptr), m_impostorDirty(true)
 		{
 
 		}
@@ -43,6 +45,7 @@ namespace clockwork {
 				m_border = nullptr;
 			}
 #endif
+			delete m_impostor;
 		}
 
 		void Chunk::init(const maths::Vec3f& min, const maths::Vec3f& max, int idX, int idY, int idZ, ChunkSystem* chunkSystem) noexcept
@@ -269,9 +272,55 @@ namespace clockwork {
 			}
 		}
 
+		void Chunk::updateImpostor() noexcept
+		{
+			if ( inImpostorDistance() && !inRenderDistance() )
+			{
+				if ( m_impostorDirty )
+					rebuildImpostor();
+				if ( m_impostor )
+					m_impostor->add();
+			}
+			else if ( m_impostor )
+				m_impostor->remove();
+		}
+
+		void Chunk::rebuildImpostor() noexcept
+		{
+			m_impostorDirty = false;
+			if ( m_renderList.empty() && !m_impostor )
+				return;
+			if ( !m_impostor )
+				m_impostor = new graphics::ChunkImpostor(&m_chunkSystem->getState());
+
+			std::vector<graphics::ImpostorBox> boxes;
+			boxes.reserve(m_renderList.size());
+			for ( unsigned int i = 0; i < m_renderList.size(); ++i )
+			{
+				maths::Vec4f colour = m_renderList[i]->getImpostorColour();
+				if ( colour.w <= 0.0f )
+					continue;
+				const maths::Mat4f& model = m_renderList[i]->getModelMatrix();//the -1 to 1 cube transformed by the modelmatrix
+				maths::Vec3f centre(model.x4, model.y4, model.z4);
+				maths::Vec3f extent(maths::abs(model.x1) + maths::abs(model.x2) + maths::abs(model.x3), maths::abs(model.y1) + maths::abs(model.y2) + maths::abs(model.y3), maths::abs(model.z1) + maths::abs(model.z2) + maths::abs(model.z3));
+				boxes.push_back(graphics::ImpostorBox { centre - extent, centre + extent, colour });
+			}
+			m_impostor->rebuild(std::move(boxes), m_min, m_max, m_chunkSystem->m_impostorResolution);
+		}
+
+		void Chunk::invalidateImpostor() noexcept
+		{
+			if ( !m_impostorDirty )
+			{
+				m_impostorDirty = true;
+				m_chunkSystem->m_dirtyChunks.push_back(this);
+			}
+		}
+
 		void Chunk::addRenderListener(RenderListener* listener) noexcept
 		{
 			m_renderList.push_back(listener);
+			invalidateImpostor();
 		}
 
 		void Chunk::removeRenderListener(RenderListener* listener) noexcept
@@ -282,6 +331,7 @@ namespace clockwork {
 				std::cout << "Error Chunk::removeRenderListener(): The listener pointer is not in the renderList" << std::endl;
 #endif
 			m_renderList.erase(iterator);
+			invalidateImpostor();
 		}
 
 		void Chunk::addMovingTickListener(MovingTickListener* listener) noexcept
@@ -334,6 +384,16 @@ namespace clockwork {
 				return false;
 		}
 
+		const bool Chunk::inImpostorDistance() const noexcept
+		{
+			const maths::Vec3i& otherId = m_chunkSystem->getCurrentChunk().getId();
+			const maths::Vec3i& impostorDistance = m_chunkSystem->getImpostorDistance();
+			if ( m_id.x >= otherId.x - impostorDistance.x && m_id.x <= otherId.x + impostorDistance.x && m_id.y >= otherId.y - impostorDistance.y&& m_id.y <= otherId.y + impostorDistance.y && m_id.z >= otherId.z - impostorDistance.z && m_id.z <= otherId.z + impostorDistance.z )
+				return true;
+			else
+				return false;
+		}
+
 		const ChunkSystem& Chunk::getChunkSystem() const noexcept
 		{
 			return *m_chunkSystem;
@@ -19,6 +19,7 @@
 namespace clockwork {
 	namespace graphics {
 		class CubeBorder;
+		class ChunkImpostor;
 	}
 
 	namespace logics {
@@ -46,6 +47,8 @@ namespace clockwork {
 #if CHUNK_BORDER
 			graphics::CubeBorder* m_border;
 #endif
+			graphics::ChunkImpostor* m_impostor;//is created when the chunk is shown as an impostor for the first time
+			bool m_impostorDirty;//the objects of the chunk changed since the last build of the impostor
 
 			std::vector<RenderListener*> m_renderList;//noch in konstruktor/movekonstruktor/copy/etc einbinden | ggf auch von gameobjects setchunk zum ndern machen und in destruktor von gameobject mssen sie sich auch lschen | die moving sachen knnen sich auch von chunk zu chunk bewegen(ggf testen ob x hher ist, dann id.x++ und auch so fr andere, etc)
 			std::vector<MovingTickListener*> m_movingTickList;
@@ -58,6 +61,8 @@ namespace clockwork {
 		private:
 			void init(const maths::Vec3f& min, const maths::Vec3f& max, int idX, int idY, int idZ, ChunkSystem* chunkSystem) noexcept;
 			void collisionTest(const Chunk& otherChunk) const noexcept;
+			/*copies the boxes and colours of the renderlisteners and builds the impostor again in the background | the impostor is only created if there are renderlisteners*/
+			void rebuildImpostor() noexcept;
 
 		public:
 			void renderAdd() noexcept;
@@ -65,6 +70,11 @@ namespace clockwork {
 			void fastTick() noexcept;
 			void slowTick() noexcept;
 			void updateCollision() const noexcept;
+			/*shows the impostor of the chunk if it is inside of the impostordistance, but outside of the renderdistance of the current chunk and hides it otherwise | an outdated impostor is built again before it is shown*/
+			void updateImpostor() noexcept;
+			/*marks the impostor as outdated, so it will be built again in the next chunksystem update(if it is shown), or when it is shown the next time
+			is called automaticly when a renderlistener is added/removed, but it has to be called manually after objects moved, or changed their colour inside of the chunk*/
+			void invalidateImpostor() noexcept;
 
 			void addRenderListener(RenderListener* listener) noexcept;
 			void removeRenderListener(RenderListener* listener) noexcept;
@@ -88,12 +98,14 @@ namespace clockwork {
 			//in relation zum currentchunk, ob der chunk hier in renderdistance liegt
 			const bool inRenderDistance() const noexcept;
 			const bool inTickDistance() const noexcept;
+			const bool inImpostorDistance() const noexcept;
 		public:
 			friend bool operator==(const Chunk& c1, const Chunk& c2) noexcept;
 			friend bool operator!=(const Chunk& c1, const Chunk& c2) noexcept;
 
 		public:
-			const maths::Vec3i getId() const noexcept{return m_id;}//braucht wahrscheinlich keine mutex, da es nur beim erstellen der chunks verndert wird und dann nicht mehr
+			const maths::Vec3i getId() const noexcept{return m_id;}
+			const graphics::ChunkImpostor* getImpostor() const noexcept{return m_impostor;}//braucht wahrscheinlich keine mutex, da es nur beim erstellen der chunks verndert wird und dann nicht mehr
 			const ChunkSystem& getChunkSystem() const noexcept;
 			ChunkSystem& getChunkSystem() noexcept;
 		};
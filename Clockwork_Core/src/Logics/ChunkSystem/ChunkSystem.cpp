@@ -12,6 +12,7 @@
 *************************************************************************/
 #include "src\Logics\Camera\Camera.h"
 #include "src\Logics\States\State.h"
+#include "src\Graphics\Renderables\Impostor\ChunkImpostor.h"
 #include "ChunkSystem.h"
 
 
@@ -21,7 +22,7 @@ namespace clockwork {
 
 
 		ChunkSystem::ChunkSystem(const maths::Vec3f& min, const maths::Vec3f& max, const maths::Vec3f& chunkSize, const maths::Vec3i& renderDistance, const maths::Vec3i& tickDistance, State* state) noexcept
-			: m_min(min), m_max(max), m_chunkSize(chunkSize), m_state(state), m_renderDistance(renderDistance), m_tickDistance(tickDistance)
+			: m_min(min), m_max(max), m_chunkSize(chunkSize), m_state(state), m_renderDistance(renderDistance), m_tickDistance(tickDistance), m_impostorDistance(renderDistance), m_impostorResolution(8)
 		{
 			maths::Vec3<float> count = ( max - min ) / chunkSize;
 			m_count.x = maths::ceil(count.x);
@@ -117,6 +118,15 @@ namespace clockwork {
 			return m_tickDistance;
 		}
 
+		const maths::Vec3i& ChunkSystem::getImpostorDistance() const noexcept
+		{
+			return m_impostorDistance;
+		}
+		const unsigned int ChunkSystem::getImpostorResolution() const noexcept
+		{
+			return m_impostorResolution;
+		}
+
 		const unsigned int ChunkSystem::getBytes() const noexcept
 		{
 			return m_count.x*m_count.y*m_count.z * sizeof(Chunk);
@@ -138,6 +148,42 @@ namespace clockwork {
 			return *m_state;
 		}
 
+		void ChunkSystem::updateImpostors(const maths::Vec3i& pos1, const maths::Vec3i& pos2) noexcept
+		{
+			maths::Vec3i first(maths::max(pos1.x, 0), maths::max(pos1.y, 0), maths::max(pos1.z, 0));
+			maths::Vec3i last(maths::min(pos2.x, m_count.x - 1), maths::min(pos2.y, m_count.y - 1), maths::min(pos2.z, m_count.z - 1));
+			if ( first.x <= last.x && first.y <= last.y && first.z <= last.z )
+				passFunctionToChunks<ImpostorFunctor>(first, last);
+		}
+
+		void ChunkSystem::setImpostorDistance(const maths::Vec3i& impostorDistance) noexcept
+		{
+#if CLOCKWORK_DEBUG
+			if ( impostorDistance.x < m_renderDistance.x || impostorDistance.y < m_renderDistance.y || impostorDistance.z < m_renderDistance.z )
+				std::cout << "Error ChunkSystem::setImpostorDistance(): ImpostorDistance is smaller than the renderDistance" << std::endl;
+#endif
+			maths::Vec3i outer(maths::max(impostorDistance.x, m_impostorDistance.x), maths::max(impostorDistance.y, m_impostorDistance.y), maths::max(impostorDistance.z, m_impostorDistance.z));
+			m_impostorDistance = impostorDistance;
+			updateImpostors(m_currentChunk->getId() - outer, m_currentChunk->getId() + outer);
+		}
+
+		void ChunkSystem::setImpostorResolution(unsigned int resolution) noexcept
+		{
+#if CLOCKWORK_DEBUG
+			if ( resolution == 0 || resolution > graphics::ChunkImpostor::maxResolution )
+				std::cout << "Error ChunkSystem::setImpostorResolution(): the resolution has to be from 1 to " << graphics::ChunkImpostor::maxResolution << std::endl;
+#endif
+			m_impostorResolution = resolution;
+			for ( int x = 0; x < m_count.x; ++x )
+			{
+				for ( int y = 0; y < m_count.y; ++y )
+				{
+					for ( int z = 0; z < m_count.z; ++z )
+						m_chunks[x][y][z].invalidateImpostor();
+				}
+			}
+		}
+
 		void  ChunkSystem::update() noexcept
 		{
 			if ( *m_currentChunk != getChunkAt(m_state->getCurrentCamera().getPosition()) )
@@ -263,7 +309,21 @@ namespace clockwork {
 				//von normalem chunk zu alwaysactive chunk und andersherum moven wird schwer
 
 				m_currentChunk = &newChunk;
+				if ( m_impostorDistance != m_renderDistance )//the impostors of both the old and the new area are updated
+				{
+					maths::Vec3i first(maths::min(oldId.x, newId.x), maths::min(oldId.y, newId.y), maths::min(oldId.z, newId.z));
+					maths::Vec3i last(maths::max(oldId.x, newId.x), maths::max(oldId.y, newId.y), maths::max(oldId.z, newId.z));
+					updateImpostors(first - m_impostorDistance, last + m_impostorDistance);
+				}
+			}
+
+			for ( unsigned int i = 0; i < m_dirtyChunks.size(); ++i )
+			{
+				Chunk* chunk = m_dirtyChunks[i];
+				if ( chunk->m_impostorDirty && chunk->inImpostorDistance() && !chunk->inRenderDistance() )
+					chunk->rebuildImpostor();
 			}
+			m_dirtyChunks.clear();
 		}
 
 
@@ -331,5 +391,10 @@ namespace clockwork {
 			chunk.updateCollision();
 		}
 
+		void ChunkSystem::ImpostorFunctor::function(Chunk& chunk) noexcept
+		{
+			chunk.updateImpostor();
+		}
+
 	}
 }
\ No newline at end of file
@@ -11,6 +11,7 @@
 * arising from the use of this software.
 * You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
 *************************************************************************/
+#include <vector>
 #include "src\Maths\Vec3.h"
 #include "src\Maths\MathFunctions.h"
 
@@ -45,6 +46,10 @@ namespace clockwork {
 			{
 				void function(Chunk& chunk) noexcept;
 			};
+			struct ImpostorFunctor
+			{
+				void function(Chunk& chunk) noexcept;
+			};
 			
 		private:
 			maths::Vec3f m_min;
@@ -53,8 +58,11 @@ namespace clockwork {
 			maths::Vec3i m_count;//neue gre machen ist noch nicht vorgesehen
 			maths::Vec3i m_renderDistance;///noch miteinbeziehen KONSTRUKTOR | getter/setter(mit debug test) | ist wichtig fr renderadd/renderremove | wird fr tick nicht bentigt, da dort die range mitgegeben werden kann
 			maths::Vec3i m_tickDistance;///sollte nicht grer als count sein ggf in debug abfragen | braucht noch getter und setter, bei setter natrlich auch mutex setzten, da es in tick/render gebraucht wird
+			maths::Vec3i m_impostorDistance;//the chunks between the renderdistance and the impostordistance are drawn as impostors | the default is the renderdistance, so no impostors are drawn
+			unsigned int m_impostorResolution;//the count of voxels of the impostors along each axis of a chunk
 			Chunk*** m_chunks;
 			Chunk* m_currentChunk;
+			std::vector<Chunk*> m_dirtyChunks;//the chunks whose impostors were invalidated since the last update
 			State* m_state;
 
 		public:
@@ -73,6 +81,8 @@ namespace clockwork {
 			Chunk& getCurrentChunk() noexcept;
 			const maths::Vec3i& getRenderDistance() const noexcept;
 			const maths::Vec3i& getTickDistance() const noexcept;
+			const maths::Vec3i& getImpostorDistance() const noexcept;
+			const unsigned int getImpostorResolution() const noexcept;
 			const unsigned int getBytes() const noexcept;
 			const unsigned int getChunkCount() const noexcept;
 			Chunk*** getChunkPointer() noexcept;//nicht wirklich threadsafe, nicht const | kann alles mit gemacht werden | wahrscheinlich nur in passFunction benutzen und dann in passFunction mutex fr chunkSystem locken und in den einzelnen chunk.tick/render/etc methoden dann chunks locken
@@ -80,7 +90,19 @@ namespace clockwork {
 			State& getState() noexcept;
 
 
+		private:
+			/*shows, or hides the impostors of the chunks between and at the 2 positions, which are cut into the range of the chunksystem*/
+			void updateImpostors(const maths::Vec3i& pos1, const maths::Vec3i& pos2) noexcept;
+
 		public:
+			/*the chunks outside of the renderdistance, but inside of the impostordistance are drawn as a coarse voxel mesh(see graphics::ChunkImpostor) instead of their objects
+			so the view distance can be much larger than the renderdistance | the impostordistance has to be atleast the renderdistance and it should be smaller than the count of the chunks*/
+			void setImpostorDistance(const maths::Vec3i& impostorDistance) noexcept;
+
+			/*sets the count of voxels along each axis of a chunk for the impostors from 1 to graphics::ChunkImpostor::maxResolution | the shown impostors are built again*/
+			void setImpostorResolution(unsigned int resolution) noexcept;
+
+			/*also shows/hides the impostors when the current chunk changes and builds the outdated impostors that are shown again in the background*/
 			void update() noexcept;
 			void fastTick() noexcept;
 			void slowTick() noexcept;
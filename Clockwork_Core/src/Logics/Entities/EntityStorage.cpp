@@ -0,0 +1,376 @@
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "EntityStorage.h"
+#include "src\Maths\Batch.h"
+
+namespace clockwork {
+	namespace logics {
+
+		namespace {
+
+			//moves the last element into the row and removes the last element | empty arrays(components the table does not have) are skipped
+			template<typename type>
+			void removeElement(std::vector<type>& elements, unsigned int row) noexcept
+			{
+				if ( elements.empty() )
+					return;
+				elements.at(row) = elements.back();
+				elements.pop_back();
+			}
+
+		}
+
+		EntityStorage::EntityStorage(unsigned int threadCount, unsigned int blockSize) noexcept
+			: m_entityCount(0), m_blockSize(blockSize != 0 ? blockSize : 1), m_pool(threadCount != 0 ? new utils::ThreadPool(threadCount) : nullptr)
+		{
+
+		}
+
+		EntityStorage::~EntityStorage() noexcept
+		{
+			delete m_pool;
+		}
+
+		int EntityStorage::getTable(unsigned int components, int textureId) noexcept
+		{
+			if ( !( components & renderComponent ) )
+				textureId = 0;
+			for ( unsigned int i = 0; i < m_tables.size(); ++i )
+			{
+				if ( m_tables.at(i).components == components && m_tables.at(i).textureId == textureId )
+					return i;
+			}
+			EntityTable table;
+			table.components = components;
+			table.textureId = textureId;
+			m_tables.push_back(std::move(table));
+			return m_tables.size() - 1;
+		}
+
+		void EntityStorage::addRow(int table, const Entity& entity, const maths::Vec3f& size, const maths::Quatf& rotation, const maths::Vec3f& position) noexcept
+		{
+			EntityTable& current = m_tables.at(table);
+			current.entities.push_back(entity);
+			current.positions.push_back(position);
+			current.rotations.push_back(rotation);
+			current.sizes.push_back(size);
+			current.modelMatrices.push_back(rotation.toMatrix(size, position));
+			if ( current.components & velocityComponent )
+				current.velocities.push_back(maths::Vec3f(0, 0, 0));
+			if ( current.components & hitboxComponent )
+			{
+				current.hitboxMins.push_back(maths::Vec3f(0, 0, 0));
+				current.hitboxMaxs.push_back(maths::Vec3f(0, 0, 0));
+				current.boundsMins.push_back(position);
+				current.boundsMaxs.push_back(position);
+			}
+			m_slots.at(entity.index).table = table;
+			m_slots.at(entity.index).row = current.getSize() - 1;
+		}
+
+		void EntityStorage::removeRow(int table, unsigned int row) noexcept
+		{
+			EntityTable& current = m_tables.at(table);
+			m_slots.at(current.entities.back().index).row = row;
+			removeElement(current.entities, row);
+			removeElement(current.positions, row);
+			removeElement(current.rotations, row);
+			removeElement(current.sizes, row);
+			removeElement(current.modelMatrices, row);
+			removeElement(current.velocities, row);
+			removeElement(current.hitboxMins, row);
+			removeElement(current.hitboxMaxs, row);
+			removeElement(current.boundsMins, row);
+			removeElement(current.boundsMaxs, row);
+		}
+
+		const EntityStorage::Slot* EntityStorage::getSlot(const Entity& entity) const noexcept
+		{
+			if ( entity.index >= m_slots.size() )
+				return nullptr;
+			const Slot& slot = m_slots.at(entity.index);
+			if ( slot.table == -1 || slot.generation != entity.generation )
+				return nullptr;
+			return &slot;
+		}
+
+		void EntityStorage::updateRows(EntityTable& table, unsigned int begin, unsigned int end) noexcept
+		{
+			for ( unsigned int i = begin; i < end; ++i )
+				table.modelMatrices[i] = table.rotations[i].toMatrix(table.sizes[i], table.positions[i]);
+			if ( table.components & hitboxComponent )
+			{
+				for ( unsigned int i = begin; i < end; ++i )
+					maths::transformAabb(table.modelMatrices[i], table.hitboxMins[i], table.hitboxMaxs[i], table.boundsMins[i], table.boundsMaxs[i]);
+			}
+		}
+
+		Entity EntityStorage::create(unsigned int components, const maths::Vec3f& size, const maths::Quatf& rotation, const maths::Vec3f& position, int textureId) noexcept
+		{
+#if CLOCKWORK_DEBUG
+			if ( !( components & transformComponent ) && ( components & ( velocityComponent | hitboxComponent | renderComponent ) ) )
+				std::cout << "Error EntityStorage::create(): The velocity, hitbox and render components need the transform component" << std::endl;
+#endif
+			components |= transformComponent;
+			Entity entity;
+			if ( m_freeSlots.empty() )
+			{
+				entity.index = m_slots.size();
+				entity.generation = 0;
+				m_slots.push_back(Slot {-1, 0, 0});
+			}
+			else
+			{
+				entity.index = m_freeSlots.back();
+				entity.generation = m_slots.at(entity.index).generation;
+				m_freeSlots.pop_back();
+			}
+			addRow(getTable(components, textureId), entity, size, rotation, position);
+			++m_entityCount;
+			return entity;
+		}
+
+		void EntityStorage::remove(const Entity& entity) noexcept
+		{
+			const Slot* slot = getSlot(entity);
+			if ( slot == nullptr )
+			{
+#if CLOCKWORK_DEBUG == 2
+				std::cout << "Info EntityStorage::remove(): Entity was already removed" << std::endl;
+#endif
+				return;
+			}
+			removeRow(slot->table, slot->row);
+			Slot& freed = m_slots.at(entity.index);
+			freed.table = -1;
+			++freed.generation;
+			m_freeSlots.push_back(entity.index);
+			--m_entityCount;
+		}
+
+		void EntityStorage::setComponents(const Entity& entity, unsigned int components, int textureId) noexcept
+		{
+			const Slot* slot = getSlot(entity);
+			if ( slot == nullptr )
+			{
+#if CLOCKWORK_DEBUG
+				std::cout << "Error EntityStorage::setComponents(): Entity was removed" << std::endl;
+#endif
+				return;
+			}
+			components |= transformComponent;
+			int oldTable = slot->table;
+			unsigned int oldRow = slot->row;
+			int newTable = getTable(components, textureId);//can add a table, so the references into m_tables are taken afterwards
+			if ( newTable == oldTable )
+				return;
+			const EntityTable& old = m_tables.at(oldTable);
+			maths::Vec3f size = old.sizes.at(oldRow);
+			maths::Quatf rotation = old.rotations.at(oldRow);
+			maths::Vec3f position = old.positions.at(oldRow);
+			bool keepVelocity = ( old.components & components & velocityComponent ) != 0;
+			bool keepHitbox = ( old.components & components & hitboxComponent ) != 0;
+			maths::Vec3f velocity = keepVelocity ? old.velocities.at(oldRow) : maths::Vec3f(0, 0, 0);
+			maths::Vec3f hitboxMin = keepHitbox ? old.hitboxMins.at(oldRow) : maths::Vec3f(0, 0, 0);
+			maths::Vec3f hitboxMax = keepHitbox ? old.hitboxMaxs.at(oldRow) : maths::Vec3f(0, 0, 0);
+			removeRow(oldTable, oldRow);
+			addRow(newTable, entity, size, rotation, position);
+			EntityTable& current = m_tables.at(newTable);
+			unsigned int row = current.getSize() - 1;
+			if ( keepVelocity )
+				current.velocities.at(row) = velocity;
+			if ( keepHitbox )
+			{
+				current.hitboxMins.at(row) = hitboxMin;
+				current.hitboxMaxs.at(row) = hitboxMax;
+				updateRows(current, row, row + 1);
+			}
+		}
+
+		void EntityStorage::setPosition(const Entity& entity, const maths::Vec3f& position) noexcept
+		{
+			const Slot* slot = getSlot(entity);
+			if ( slot == nullptr )
+			{
+#if CLOCKWORK_DEBUG
+				std::cout << "Error EntityStorage::setPosition(): Entity was removed" << std::endl;
+#endif
+				return;
+			}
+			EntityTable& table = m_tables.at(slot->table);
+			table.positions.at(slot->row) = position;
+			updateRows(table, slot->row, slot->row + 1);
+		}
+
+		void EntityStorage::setRotation(const Entity& entity, const maths::Quatf& rotation) noexcept
+		{
+			const Slot* slot = getSlot(entity);
+			if ( slot == nullptr )
+			{
+#if CLOCKWORK_DEBUG
+				std::cout << "Error EntityStorage::setRotation(): Entity was removed" << std::endl;
+#endif
+				return;
+			}
+			EntityTable& table = m_tables.at(slot->table);
+			table.rotations.at(slot->row) = rotation;
+			updateRows(table, slot->row, slot->row + 1);
+		}
+
+		void EntityStorage::setSize(const Entity& entity, const maths::Vec3f& size) noexcept
+		{
+			const Slot* slot = getSlot(entity);
+			if ( slot == nullptr )
+			{
+#if CLOCKWORK_DEBUG
+				std::cout << "Error EntityStorage::setSize(): Entity was removed" << std::endl;
+#endif
+				return;
+			}
+			EntityTable& table = m_tables.at(slot->table);
+			table.sizes.at(slot->row) = size;
+			updateRows(table, slot->row, slot->row + 1);
+		}
+
+		void EntityStorage::setVelocity(const Entity& entity, const maths::Vec3f& velocity) noexcept
+		{
+			const Slot* slot = getSlot(entity);
+			if ( slot == nullptr || !( m_tables.at(slot->table).components & velocityComponent ) )
+			{
+#if CLOCKWORK_DEBUG
+				std::cout << "Error EntityStorage::setVelocity(): Entity was removed, or has no velocity component" << std::endl;
+#endif
+				return;
+			}
+			m_tables.at(slot->table).velocities.at(slot->row) = velocity;
+		}
+
+		void EntityStorage::setHitbox(const Entity& entity, const maths::Vec3f& min, const maths::Vec3f& max) noexcept
+		{
+			const Slot* slot = getSlot(entity);
+			if ( slot == nullptr || !( m_tables.at(slot->table).components & hitboxComponent ) )
+			{
+#if CLOCKWORK_DEBUG
+				std::cout << "Error EntityStorage::setHitbox(): Entity was removed, or has no hitbox component" << std::endl;
+#endif
+				return;
+			}
+			EntityTable& table = m_tables.at(slot->table);
+			table.hitboxMins.at(slot->row) = min;
+			table.hitboxMaxs.at(slot->row) = max;
+			updateRows(table, slot->row, slot->row + 1);
+		}
+
+		bool EntityStorage::isValid(const Entity& entity) const noexcept
+		{
+			return getSlot(entity) != nullptr;
+		}
+
+		const maths::Vec3f& EntityStorage::getPosition(const Entity& entity) const noexcept
+		{
+			static const maths::Vec3f empty;
+			const Slot* slot = getSlot(entity);
+			if ( slot == nullptr )
+			{
+#if CLOCKWORK_DEBUG
+				std::cout << "Error EntityStorage::getPosition(): Entity was removed" << std::endl;
+#endif
+				return empty;
+			}
+			return m_tables.at(slot->table).positions.at(slot->row);
+		}
+
+		const maths::Quatf& EntityStorage::getRotation(const Entity& entity) const noexcept
+		{
+			static const maths::Quatf empty;
+			const Slot* slot = getSlot(entity);
+			if ( slot == nullptr )
+			{
+#if CLOCKWORK_DEBUG
+				std::cout << "Error EntityStorage::getRotation(): Entity was removed" << std::endl;
+#endif
+				return empty;
+			}
+			return m_tables.at(slot->table).rotations.at(slot->row);
+		}
+
+		const maths::Vec3f& EntityStorage::getSize(const Entity& entity) const noexcept
+		{
+			static const maths::Vec3f empty;
+			const Slot* slot = getSlot(entity);
+			if ( slot == nullptr )
+			{
+#if CLOCKWORK_DEBUG
+				std::cout << "Error EntityStorage::getSize(): Entity was removed" << std::endl;
+#endif
+				return empty;
+			}
+			return m_tables.at(slot->table).sizes.at(slot->row);
+		}
+
+		const maths::Vec3f& EntityStorage::getVelocity(const Entity& entity) const noexcept
+		{
+			static const maths::Vec3f empty;
+			const Slot* slot = getSlot(entity);
+			if ( slot == nullptr || !( m_tables.at(slot->table).components & velocityComponent ) )
+			{
+#if CLOCKWORK_DEBUG
+				std::cout << "Error EntityStorage::getVelocity(): Entity was removed, or has no velocity component" << std::endl;
+#endif
+				return empty;
+			}
+			return m_tables.at(slot->table).velocities.at(slot->row);
+		}
+
+		const maths::Mat4f& EntityStorage::getModelMatrix(const Entity& entity) const noexcept
+		{
+			static const maths::Mat4f empty;
+			const Slot* slot = getSlot(entity);
+			if ( slot == nullptr )
+			{
+#if CLOCKWORK_DEBUG
+				std::cout << "Error EntityStorage::getModelMatrix(): Entity was removed" << std::endl;
+#endif
+				return empty;
+			}
+			return m_tables.at(slot->table).modelMatrices.at(slot->row);
+		}
+
+		void EntityStorage::fastTick(float timeFactor) noexcept
+		{
+			forEach(transformComponent | velocityComponent, [timeFactor](EntityTable& table, unsigned int begin, unsigned int end)
+			{
+				for ( unsigned int i = begin; i < end; ++i )
+					table.positions[i] += table.velocities[i] * timeFactor;
+				updateRows(table, begin, end);
+			});
+		}
+
+		void EntityStorage::findOverlapping(const maths::Vec3f& min, const maths::Vec3f& max, std::vector<Entity>& out) const noexcept
+		{
+			for ( const auto& table : m_tables )
+			{
+				if ( !( table.components & hitboxComponent ) )
+					continue;
+				for ( unsigned int i = 0; i < table.getSize(); ++i )
+				{
+					const maths::Vec3f& boundsMin = table.boundsMins[i];
+					const maths::Vec3f& boundsMax = table.boundsMaxs[i];
+					if ( boundsMin.x <= max.x && boundsMax.x >= min.x && boundsMin.y <= max.y && boundsMax.y >= min.y && boundsMin.z <= max.z && boundsMax.z >= min.z )
+						out.push_back(table.entities[i]);
+				}
+			}
+		}
+
+	}
+}
@@ -0,0 +1,193 @@
+#pragma once
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include <vector>
+#include <algorithm>
+#include "src\Maths\Vec3.h"
+#include "src\Maths\Mat4x4.h"
+#include "src\Maths\Quat.h"
+#include "src\Utils\ThreadPool.h"
+
+namespace clockwork {
+	namespace logics {
+
+		/*a handle to an entity of the entitystorage | the index is the slot of the entity in the storage and the generation is increased every time the slot is freed
+		so a handle of a removed entity is not valid anymore, even if its slot is used by a new entity(check it with EntityStorage::isValid())*/
+		struct Entity
+		{
+			unsigned int index;
+			unsigned int generation;
+		};
+
+		/*an archetype table stores all entities with the same components(and the same textureid, if they have the render component) as structure of arrays
+		every component array has one element per row/entity and the arrays of the components the archetype does not have stay empty | rows are removed by moving the last row into their place, so the order of the rows changes
+		transform: positions, rotations, sizes and the modelmatrices composed from them | velocity: velocities in units per second
+		hitbox: the local axis aligned bounding boxes(hitboxMins/hitboxMaxs) and the boxes transformed by the modelmatrices into world space(boundsMins/boundsMaxs)
+		render: the modelmatrices of the transform are drawn as cubes with the normal texture of the textureid in one instanced drawcall per table*/
+		struct EntityTable
+		{
+			unsigned int components;
+			int textureId;
+			std::vector<Entity> entities;
+			std::vector<maths::Vec3f> positions;
+			std::vector<maths::Quatf> rotations;
+			std::vector<maths::Vec3f> sizes;
+			std::vector<maths::Mat4f> modelMatrices;
+			std::vector<maths::Vec3f> velocities;
+			std::vector<maths::Vec3f> hitboxMins;
+			std::vector<maths::Vec3f> hitboxMaxs;
+			std::vector<maths::Vec3f> boundsMins;
+			std::vector<maths::Vec3f> boundsMaxs;
+
+			inline const unsigned int getSize() const noexcept {return entities.size();}
+		};
+
+		/*data oriented storage for many simple entities(for example blocks, or particles) as an alternative to gameobjects with tick/render listeners, which are single heap objects that are ticked with one virtual call each
+		the entities are only data rows in archetype tables(see entitytable) and are updated by systems, which iterate over the contiguous component arrays of all matching tables on the calling thread, or on the worker threads of the storage
+		entities and gameobjects can be used at the same time in one state, so gameobjects can be moved to the entitystorage one by one | the entities are not part of the chunksystem and do not collide with gameobjects
+		the storage is not thread safe: create/remove/set entities only from the tick thread and not while a system is running*/
+		class EntityStorage
+		{
+
+		public:
+			static constexpr unsigned int transformComponent = 1;
+			static constexpr unsigned int velocityComponent = 2;//needs the transform component
+			static constexpr unsigned int hitboxComponent = 4;//needs the transform component
+			static constexpr unsigned int renderComponent = 8;//needs the transform component
+
+		private:
+			struct Slot
+			{
+				int table;//-1 if the slot is free
+				unsigned int row;
+				unsigned int generation;
+			};
+
+		private:
+			std::vector<EntityTable> m_tables;
+			std::vector<Slot> m_slots;
+			std::vector<unsigned int> m_freeSlots;
+			unsigned int m_entityCount;
+			unsigned int m_blockSize;
+			utils::ThreadPool* m_pool;//nullptr without worker threads
+
+		public:
+			/*@param[threadCount] the number of worker threads of the systems | 0 creates no threads and runs the systems on the calling thread
+			the parallel systems are opt in, because they are only measured on one core yet, where they can not be faster | use std::thread::hardware_concurrency() - 1 for all threads except the render thread
+			@param[blockSize] the number of rows one task of a system handles | tables with less rows are handled on the calling thread, because a task needs a lock of the threadpool queue*/
+			explicit EntityStorage(unsigned int threadCount = 0, unsigned int blockSize = 4096) noexcept;
+
+			~EntityStorage() noexcept;
+
+			EntityStorage(const EntityStorage& other) = delete;
+
+			EntityStorage(EntityStorage&& other) = delete;
+
+			EntityStorage& operator=(const EntityStorage& other) = delete;
+
+			EntityStorage& operator=(EntityStorage&& other) = delete;
+
+		private:
+			/*returns the index of the table with the components and the textureid and creates it if it does not exist yet | the textureid is ignored without the render component*/
+			int getTable(unsigned int components, int textureId) noexcept;
+
+			/*adds a row with the transform and the default values of the other components(no velocity, an empty hitbox) to the end of the table*/
+			void addRow(int table, const Entity& entity, const maths::Vec3f& size, const maths::Quatf& rotation, const maths::Vec3f& position) noexcept;
+
+			/*moves the last row of the table into the row and updates the slot of the moved entity*/
+			void removeRow(int table, unsigned int row) noexcept;
+
+			/*returns the slot of the entity, or nullptr if the entity was removed*/
+			const Slot* getSlot(const Entity& entity) const noexcept;
+
+		public:
+			/*composes the modelmatrices of the rows from begin to end out of their transform and transforms their hitboxes with them, if the table has the hitbox component*/
+			static void updateRows(EntityTable& table, unsigned int begin, unsigned int end) noexcept;
+
+			/*creates an entity with the components(combined with |) and returns its handle
+			@param[textureId] the normal texture of the cubemanager of the renderer that draws the entity | only used with the render component*/
+			Entity create(unsigned int components, const maths::Vec3f& size, const maths::Quatf& rotation, const maths::Vec3f& position, int textureId = 0) noexcept;
+
+			void remove(const Entity& entity) noexcept;
+
+			/*moves the entity into the table of the new components and textureid | the transform is kept and the velocity and the hitbox too, if the new components still have them*/
+			void setComponents(const Entity& entity, unsigned int components, int textureId = 0) noexcept;
+
+			//the setters of the transform and the hitbox update the modelmatrix and the bounds of the entity right away, so entities without velocity are not updated in fastTick()
+			void setPosition(const Entity& entity, const maths::Vec3f& position) noexcept;
+
+			void setRotation(const Entity& entity, const maths::Quatf& rotation) noexcept;
+
+			void setSize(const Entity& entity, const maths::Vec3f& size) noexcept;
+
+			void setVelocity(const Entity& entity, const maths::Vec3f& velocity) noexcept;
+
+			void setHitbox(const Entity& entity, const maths::Vec3f& min, const maths::Vec3f& max) noexcept;
+
+			bool isValid(const Entity& entity) const noexcept;
+
+			//the getters return a default value(zero vector, identity rotation/matrix) if the entity was removed, or does not have the component
+			const maths::Vec3f& getPosition(const Entity& entity) const noexcept;
+
+			const maths::Quatf& getRotation(const Entity& entity) const noexcept;
+
+			const maths::Vec3f& getSize(const Entity& entity) const noexcept;
+
+			const maths::Vec3f& getVelocity(const Entity& entity) const noexcept;
+
+			const maths::Mat4f& getModelMatrix(const Entity& entity) const noexcept;
+
+			/*the movement system: moves the entities with velocity(position += velocity * timeFactor) and updates their modelmatrices and bounds in parallel
+			@param[timeFactor] the time scaling factor of the engine(engine->getTimeFactor())*/
+			void fastTick(float timeFactor) noexcept;
+
+			/*writes the entities with a hitbox whose bounds overlap the axis aligned box from min to max into out | can be used by gameobjects to find the entities they touch*/
+			void findOverlapping(const maths::Vec3f& min, const maths::Vec3f& max, std::vector<Entity>& out) const noexcept;
+
+			/*runs a system over all tables that have atleast the components and waits until it is finished
+			the function is called as function(EntityTable& table, unsigned int begin, unsigned int end) for blocks of rows on the worker threads of the storage(or once per table on the calling thread without worker threads) and must only change the rows from begin to end of the table
+			it must not create, or remove entities and must not use opengl | call updateRows() for the changed rows if the function changes the transform*/
+			template<typename Function>
+			void forEach(unsigned int components, Function function) noexcept
+			{
+				for ( auto& table : m_tables )
+				{
+					if ( ( table.components & components ) != components || table.getSize() == 0 )
+						continue;
+					if ( !m_pool || table.getSize() <= m_blockSize )
+					{
+						function(table, 0, table.getSize());
+						continue;
+					}
+					EntityTable* current = &table;
+					for ( unsigned int begin = 0; begin < table.getSize(); begin += m_blockSize )
+					{
+						unsigned int end = std::min(begin + m_blockSize, table.getSize());
+						m_pool->addTask([current, begin, end, &function]() {function(*current, begin, end);});
+					}
+				}
+				if ( m_pool )
+					m_pool->waitWorking();
+			}
+
+			inline const std::vector<EntityTable>& getTables() const noexcept {return m_tables;}
+
+			inline const unsigned int getEntityCount() const noexcept {return m_entityCount;}
+
+			/*returns the number of worker threads | 0 if the systems run on the calling thread*/
+			inline const unsigned int getThreadCount() const noexcept {return m_pool ? m_pool->getThreadCount() : 0;}
+
+		};
+
+	}
+}
@@ -19,16 +19,20 @@
 namespace clockwork {
 	namespace logics {
 
+		constexpr unsigned char GameObject::positionDirty;
+		constexpr unsigned char GameObject::rotationDirty;
+		constexpr unsigned char GameObject::sizeDirty;
+
 		GameObject::GameObject(const maths::Vec3f& size, const maths::Vec3f& rotation, const maths::Vec3f& position, State* state) noexcept
-			: m_size(size), m_rotation(rotation), m_position(position), m_modelMatrix(maths::Mat4f::scaling(size)), m_chunk(&state->getChunkSystem().getChunkAt(position))
+			: GameObject(size, maths::Quatf::eulerD(rotation), position, state)
 		{
-			if ( rotation.x > 0 )
-				m_modelMatrix.rotateXD(rotation.x);
-			if ( rotation.y > 0 )
-				m_modelMatrix.rotateYD(rotation.y);
-			if ( rotation.z > 0 )
-				m_modelMatrix.rotateZD(rotation.z);
-			m_modelMatrix.translate(position);
+
+		}
+
+		GameObject::GameObject(const maths::Vec3f& size, const maths::Quatf& rotation, const maths::Vec3f& position, State* state) noexcept
+			: m_chunk(&state->getChunkSystem().getChunkAt(position)), m_size(size), m_rotation(rotation), m_position(position), m_modelMatrix(rotation.toMatrix(size, position)), m_dirty(0)
+		{
+
 		}
 
 		GameObject::~GameObject() noexcept
@@ -37,54 +41,122 @@ namespace clockwork {
 		}
 
 		GameObject::GameObject(const GameObject& other) noexcept
-			: m_size(other.m_size), m_rotation(other.m_rotation), m_position(other.m_position), m_modelMatrix(other.m_modelMatrix), m_chunk(other.m_chunk)
+			: m_chunk(other.m_chunk), m_size(other.m_size), m_rotation(other.m_rotation), m_position(other.m_position), m_modelMatrix(other.m_modelMatrix), m_dirty(other.m_dirty)
 		{
 
 		}
 
 		GameObject::GameObject(GameObject&& other) noexcept
-			: m_size(other.m_size), m_rotation(other.m_rotation), m_position(other.m_position), m_modelMatrix(other.m_modelMatrix), m_chunk(other.m_chunk)
+			: m_chunk(other.m_chunk), m_size(other.m_size), m_rotation(other.m_rotation), m_position(other.m_position), m_modelMatrix(other.m_modelMatrix), m_dirty(other.m_dirty)
 		{
 			other.m_chunk = nullptr;//auch hier bei listenern add/remove/etc
 		}
 
 		GameObject& GameObject::operator=(const GameObject& other) noexcept
 		{
+			const bool changed = m_size != other.m_size || m_rotation != other.m_rotation || m_position != other.m_position;
 			m_size = other.m_size;
 			m_rotation = other.m_rotation;
 			m_position = other.m_position;
 			m_modelMatrix = other.m_modelMatrix;
+			m_dirty = other.m_dirty;
 			m_chunk = other.m_chunk;
-			this->onMatrixChange();
+			if ( changed )
+				this->onMatrixChange();
 			return *this;
 		}
 
 		GameObject& GameObject::operator=(GameObject&& other) noexcept
 		{
+			const bool changed = m_size != other.m_size || m_rotation != other.m_rotation || m_position != other.m_position;
 			m_size = other.m_size;
 			m_rotation = other.m_rotation;
 			m_position = other.m_position;
 			m_modelMatrix = other.m_modelMatrix;
+			m_dirty = other.m_dirty;
 			m_chunk = other.m_chunk;
 			//hier ggf auch add/remove sachen in den listenern
 			other.m_chunk = nullptr;
-			this->onMatrixChange();
+			if ( changed )
+				this->onMatrixChange();
 			return *this;
 		}
 
-		void GameObject::updateModelMatrix() noexcept
+		void GameObject::change(unsigned char dirty) noexcept
 		{
-			m_modelMatrix = maths::Mat4f::scaling(m_size);
-			if ( m_rotation.x > 0 )
-				m_modelMatrix.rotateXD(m_rotation.x);
-			if ( m_rotation.y > 0 )
-				m_modelMatrix.rotateYD(m_rotation.y);
-			if ( m_rotation.z > 0 )
-				m_modelMatrix.rotateZD(m_rotation.z);
-			m_modelMatrix.translate(m_position);
+			m_dirty |= dirty;
 			this->onMatrixChange();
 		}
 
+		void GameObject::recompose() const noexcept
+		{
+			if ( m_dirty & ( rotationDirty | sizeDirty ) )
+				m_modelMatrix = m_rotation.toMatrix(m_size, m_position);
+			else
+			{
+				m_modelMatrix.x4 = m_position.x;
+				m_modelMatrix.y4 = m_position.y;
+				m_modelMatrix.z4 = m_position.z;
+			}
+			m_dirty = 0;
+		}
+
+		void GameObject::updateModelMatrix() noexcept
+		{
+			if ( m_dirty )
+				recompose();
+		}
+
+		void GameObject::setPosition(const maths::Vec3f& position) noexcept
+		{
+			if ( position != m_position )
+			{
+				m_position = position;
+				change(positionDirty);
+			}
+		}
+
+		void GameObject::changePosition(const maths::Vec3f& offset) noexcept
+		{
+			if ( offset.x != 0 || offset.y != 0 || offset.z != 0 )
+			{
+				m_position += offset;
+				change(positionDirty);
+			}
+		}
+
+		void GameObject::setSize(const maths::Vec3f& size) noexcept
+		{
+			if ( size != m_size )
+			{
+				m_size = size;
+				change(sizeDirty);
+			}
+		}
+
+		void GameObject::setRotation(const maths::Quatf& rotation) noexcept
+		{
+			if ( rotation != m_rotation )
+			{
+				m_rotation = rotation;
+				change(rotationDirty);
+			}
+		}
+
+		void GameObject::setRotation(const maths::Vec3f& degrees) noexcept
+		{
+			setRotation(maths::Quatf::eulerD(degrees));
+		}
+
+		void GameObject::rotate(const maths::Quatf& rotation) noexcept
+		{
+			if ( rotation.x != 0 || rotation.y != 0 || rotation.z != 0 )
+			{
+				m_rotation = ( rotation * m_rotation ).normalizeSelf();
+				change(rotationDirty);
+			}
+		}
+
 		const Chunk& GameObject::getChunk() const noexcept
 		{
 			return *m_chunk;
@@ -13,6 +13,7 @@
 *************************************************************************/
 #include "src\Maths\Vec3.h"
 #include "src\Maths\Mat4x4.h"
+#include "src\Maths\Quat.h"
 
 
 namespace clockwork {
@@ -21,18 +22,29 @@ namespace clockwork {
 		class State;
 		class Chunk;
 
+		/*the transform of a gameobject is stored as translation, rotation(unit quaternion) and scale(TRS) and the modelmatrix is only composed from them when it is read with getModelMatrix() and one of them has changed since the last read
+		every component has its own dirty flag, so a changed position only writes the translation column of the modelmatrix and a changed rotation/size rebuilds the upper 3x3 part without any matrix multiplication
+		the components can only be changed with the setters, which compare the new values and only call onMatrixChange() if something really changed | a gameobject that does not move does not cost anything in the ticks and its instance data is not uploaded again*/
 		class GameObject
 		{
 
 		protected://auch in subklassen immer erst mutex locken, etc | oder getter/setter nehmen 
 			Chunk * m_chunk;
-			maths::Mat4f m_modelMatrix;
+
+		private:
+			static constexpr unsigned char positionDirty = 1;
+			static constexpr unsigned char rotationDirty = 2;
+			static constexpr unsigned char sizeDirty = 4;
 			maths::Vec3f m_size;
-			maths::Vec3f m_rotation;
+			maths::Quatf m_rotation;
 			maths::Vec3f m_position;
+			mutable maths::Mat4f m_modelMatrix;
+			mutable unsigned char m_dirty;
 
 		public:
+			//the rotation is in euler angles as degrees(first around x, then y, then z)
 			GameObject(const maths::Vec3f& size, const maths::Vec3f& rotation, const maths::Vec3f& position, State* state) noexcept;
+			GameObject(const maths::Vec3f& size, const maths::Quatf& rotation, const maths::Vec3f& position, State* state) noexcept;
 			virtual ~GameObject() noexcept;
 			GameObject(const GameObject& other) noexcept;
 			GameObject(GameObject&& other) noexcept;
@@ -41,11 +53,19 @@ namespace clockwork {
 			
 
 		protected:
-			//muss berschrieben werden und dann fr instancedcubes setchanged(true) aufrufen | auch dazuschreiben, dass es protected und nicht public ist
+			/*muss berschrieben werden und dann fr instancedcubes setchanged(true) aufrufen | auch dazuschreiben, dass es protected und nicht public ist
+			is only called when a setter really changed the position, rotation or size and not for setters with the same values | the modelmatrix is not recomposed yet, that happens lazy when it is read*/
 			virtual void onMatrixChange() noexcept = 0;
 
+		private:
+			//marks the components as changed and calls onMatrixChange()
+			void change(unsigned char dirty) noexcept;
+			//composes the outdated parts of the modelmatrix from the components | const, because its only called from the getters
+			void recompose() const noexcept;
+
 		public:
-			//updated modelmatrix und ruft onMatrixChange auf | immer nach verndern der vektoren irgendwann updatemodelmatrix aufrufen
+			/*composes the modelmatrix now if one of the components has changed since the last read | it does not have to be called anymore, because getModelMatrix() does it automatically
+			can be used to compose the matrix at a known time(for example at the end of the tick) and it does nothing if nothing changed*/
 			void updateModelMatrix() noexcept;
 
 			const Chunk& getChunk() const noexcept;
@@ -55,30 +75,47 @@ namespace clockwork {
 			//dont call this method if you dont know what you are doing | it will change the chunk pointer of the gameobject without updating the listeners in the chunk and without changing the position of the gameobject to the new chunk
 			void setChunk(Chunk* newChunk) noexcept;
 
-			inline const maths::Mat4f& getModelMatrix() const noexcept {return m_modelMatrix;}
-			inline const maths::Mat4f* getModelMatrixMemoryLocation() const noexcept {return &m_modelMatrix;}
+			//sets the position and calls onMatrixChange() if its a different one
+			void setPosition(const maths::Vec3f& position) noexcept;
+			//adds the offset to the position and calls onMatrixChange() if its not zero
+			void changePosition(const maths::Vec3f& offset) noexcept;
+			//sets the size(scale on each axis) and calls onMatrixChange() if its a different one
+			void setSize(const maths::Vec3f& size) noexcept;
+			//sets the rotation as unit quaternion and calls onMatrixChange() if its a different one
+			void setRotation(const maths::Quatf& rotation) noexcept;
+			//sets the rotation as euler angles in degrees(first around x, then y, then z) and calls onMatrixChange() if its a different one
+			void setRotation(const maths::Vec3f& degrees) noexcept;
+			/*rotates the gameobject additionally with the unit quaternion around the world axes(rotation * current rotation) and calls onMatrixChange() if its not the identity
+			the result is normalized, so rotating every tick does not scale the modelmatrix over time*/
+			void rotate(const maths::Quatf& rotation) noexcept;
+
+			inline const maths::Mat4f& getModelMatrix() const noexcept
+			{
+				if ( m_dirty )
+					recompose();
+				return m_modelMatrix;
+			}
+			inline const maths::Mat4f* getModelMatrixMemoryLocation() const noexcept
+			{
+				if ( m_dirty )
+					recompose();
+				return &m_modelMatrix;
+			}
 			inline const maths::Vec3f& getSize() const noexcept {return m_size;}
-			inline const maths::Vec3f& getRotation() const noexcept {return m_rotation;}
+			inline const maths::Quatf& getRotation() const noexcept {return m_rotation;}
 			inline const maths::Vec3f& getPosition() const noexcept {return m_position;}
-			inline maths::Vec3f& getSize() noexcept{return m_size;}//ab hier mutex setzen
-			inline maths::Vec3f& getRotation() noexcept{return m_rotation;}
-			inline maths::Vec3f& getPosition() noexcept{return m_position;}
 
 			//setzt position x anders und updated es automatisch in der modelmatrix | dies auch fr changeX machen und auch fr andere position, size, translation,etc machen (wegen lars)
 			inline void setX(float x) noexcept
 			{
-				m_position.x = x;
-				m_modelMatrix.x4 = x;
+				setPosition(maths::Vec3f(x, m_position.y, m_position.z));
 			}
 			inline void changeX(float x) noexcept
 			{
-				m_position.x += x;
-				m_modelMatrix.x4 += x;
+				changePosition(maths::Vec3f(x, 0, 0));
 			}
 
 		};
 
 	}
 }
-
-
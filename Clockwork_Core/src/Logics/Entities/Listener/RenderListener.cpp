@@ -32,5 +32,10 @@ namespace clockwork {
 				renderAdd();
 		}
 
+		maths::Vec4f RenderListener::getImpostorColour() const noexcept
+		{
+			return maths::Vec4f(0.7f, 0.7f, 0.7f, 1.0f);
+		}
+
 	}
 }
\ No newline at end of file
@@ -11,6 +11,7 @@
 * arising from the use of this software.
 * You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
 *************************************************************************/
+#include "src\Maths\Vec4.h"
 #include "src\Logics\Entities\GameObject.h"
 
 namespace clockwork {
@@ -35,6 +36,10 @@ namespace clockwork {
 			virtual void renderAdd() noexcept = 0;
 			virtual void renderRemove() noexcept = 0;
 
+			/*returns the colour of the object in the impostor of its chunk, which is drawn instead of the objects when the chunk is outside of the renderdistance, but inside of the impostordistance
+			the object is taken into the impostor as the box of the -1 to 1 cube transformed by its modelmatrix | an alpha of 0 leaves the object out of the impostor | the default is light grey*/
+			virtual maths::Vec4f getImpostorColour() const noexcept;
+
 
 		};
 
@@ -36,19 +36,14 @@ namespace clockwork {
 			void fastTick() noexcept override
 			{
 				double time = engine->getTimeFactor();//time scaling factor 
-				this->GameObject::updateModelMatrix();
 				if ( engine->getWindow()->isKeyPressed(CLOCKWORK_KEY_RIGHT) )
-					m_rotation.y += 60 * time;
+					rotate(maths::Quatf::axisAngleD({ 0,1,0 }, 60 * time));
 				else if ( engine->getWindow()->isKeyPressed(CLOCKWORK_KEY_LEFT) )
-					m_rotation.y -= 60 * time;
+					rotate(maths::Quatf::axisAngleD({ 0,1,0 }, -60 * time));
 				if ( engine->getWindow()->isKeyPressed(CLOCKWORK_KEY_UP) )
-					m_rotation.x += 60 * time;
+					rotate(maths::Quatf::axisAngleD({ 1,0,0 }, 60 * time));
 				else if ( engine->getWindow()->isKeyPressed(CLOCKWORK_KEY_DOWN) )
-					m_rotation.x -= 60 * time;
-				if ( m_rotation.x < 0 )
-					m_rotation.x += 360;
-				if ( m_rotation.y < 0 )
-					m_rotation.y += 360;
+					rotate(maths::Quatf::axisAngleD({ 1,0,0 }, -60 * time));
 			}
 			void slowTick() noexcept override
 			{
@@ -91,21 +86,16 @@ namespace clockwork {
 			virtual void fastTick() noexcept override
 			{
 				double time = engine->getTimeFactor();//time scaling factor 
-				m_position += m_velocity * time;//WICHTIG in fastTick immer am anfang zuerst position neu kalkulieren anhand direction und modelmatrix updaten, dann ggf direction verndert und danach wird automatisch mit ggf collision direction wieder verndert
-				this->GameObject::updateModelMatrix();
+				changePosition(m_velocity * time);//WICHTIG in fastTick immer am anfang zuerst position neu kalkulieren anhand direction und modelmatrix updaten, dann ggf direction verndert und danach wird automatisch mit ggf collision direction wieder verndert
 
 				if ( engine->getWindow()->isKeyPressed(CLOCKWORK_KEY_RIGHT) )
-					m_rotation.y += 60 * time;
+					rotate(maths::Quatf::axisAngleD({ 0,1,0 }, 60 * time));
 				else if ( engine->getWindow()->isKeyPressed(CLOCKWORK_KEY_LEFT) )
-					m_rotation.y -= 60 * time;
+					rotate(maths::Quatf::axisAngleD({ 0,1,0 }, -60 * time));
 				if ( engine->getWindow()->isKeyPressed(CLOCKWORK_KEY_UP) )
-					m_rotation.x += 60 * time;
+					rotate(maths::Quatf::axisAngleD({ 1,0,0 }, 60 * time));
 				else if ( engine->getWindow()->isKeyPressed(CLOCKWORK_KEY_DOWN) )
-					m_rotation.x -= 60 * time;
-				if ( m_rotation.x < 0 )
-					m_rotation.x += 360;
-				if ( m_rotation.y < 0 )
-					m_rotation.y += 360;
+					rotate(maths::Quatf::axisAngleD({ 1,0,0 }, -60 * time));
 
 				// 				if ( m_position.distance(m_chunk->getChunkSystem().getState().getCurrentCamera().getPosition()) > 25 )
 				// 				{
@@ -125,7 +115,7 @@ namespace clockwork {
 				const MovingBlock* block = dynamic_cast<const MovingBlock*>( otherMoving );//eigentlich noch nullptr test
 				if ( block != nullptr )//ggf noch mass und winkel bercksichtigen | reflektieren und ggf noch speed variable einbauen 
 				{
-					m_velocity = ( m_position - block->getPosition() ) * 2;//other direction
+					m_velocity = ( getPosition() - block->getPosition() ) * 2;//other direction
 				}
 
 			}
@@ -135,7 +125,7 @@ namespace clockwork {
 				const Block* block = dynamic_cast<const Block*>( otherStatic );
 				if ( block != nullptr )
 				{
-					m_velocity = ( m_position - block->getPosition() ) * 2;//other direction
+					m_velocity = ( getPosition() - block->getPosition() ) * 2;//other direction
 				}
 			}
 		protected:
@@ -169,12 +159,11 @@ namespace clockwork {
 			virtual void fastTick() noexcept override
 			{
 				double time = engine->getTimeFactor();//time scaling factor 
-				m_position += m_velocity * time;//WICHTIG in fastTick immer am anfang zuerst position neu kalkulieren anhand direction und modelmatrix updaten, dann ggf direction verndert und danach wird automatisch mit ggf collision direction wieder verndert
-				this->GameObject::updateModelMatrix();
+				changePosition(m_velocity * time);//WICHTIG in fastTick immer am anfang zuerst position neu kalkulieren anhand direction und modelmatrix updaten, dann ggf direction verndert und danach wird automatisch mit ggf collision direction wieder verndert
 				const maths::Vec3f& camDir = m_chunk->getChunkSystem().getState().getCurrentCamera().getDirection() * 5;
 				const maths::Vec3f& camRight = m_chunk->getChunkSystem().getState().getCurrentCamera().getRight() * 5;
 				const maths::Vec3f& camUp = m_chunk->getChunkSystem().getState().getCurrentCamera().getUp() * 5;
-				m_chunk->getChunkSystem().getState().getCurrentCamera().setPosition(m_position - camDir / 3);
+				m_chunk->getChunkSystem().getState().getCurrentCamera().setPosition(getPosition() - camDir / 3);
 
 				m_velocity = maths::Vec3f { 0,0,0 };
 				if ( engine->getWindow()->isKeyPressed(CLOCKWORK_KEY_W) )//lieber spter mit onkeypress machen und dann direction umschalten, aber noch mit boolean und onrelease wieder direction auf 0 | dann von keylistener erben 
@@ -243,7 +232,7 @@ namespace clockwork {
 						else
 							rz += 5;
 						int textureid = rand() % engine->getCurrentState()->getDefaultRenderer().cubeManager.getInstancedTextureCount();
-						maths::Vec3f pos = m_position + maths::Vec3f { rx,ry,rz };
+						maths::Vec3f pos = getPosition() + maths::Vec3f { rx,ry,rz };
 						logics::MovingBlock* inst = new logics::MovingBlock(textureid, maths::Vec3f(1, 1, 1), maths::Vec3f(0, 0, 0), pos, engine->getCurrentState(), &engine->getCurrentState()->getDefaultRenderer());
 						enemys.push_back(inst);
 					}
@@ -258,9 +247,9 @@ namespace clockwork {
 			}
 			virtual void onCollision(StaticTickListener* otherStatic, int ownColliderNumber, int otherColliderNumber) noexcept override
 			{
-				maths::Vec3f dist = m_position - otherStatic->getPosition();
+				maths::Vec3f dist = getPosition() - otherStatic->getPosition();
 				dist.absSelf();
-				dist -= m_size + otherStatic->getSize();
+				dist -= getSize() + otherStatic->getSize();
 				if ( dist.x > dist.y&&dist.x > dist.z )
 					m_velocity.x = 0;
 				else if ( dist.y > dist.z )
@@ -36,6 +36,9 @@
 
 #include "src\Logics\Entities\Test.h"
 #include "src\Logics\ChunkSystem\ChunkSystem.h"
+#include "src\Logics\Entities\EntityStorage.h"
+#include "src\Utils\AssetLoader.h"
+#include "src\Graphics\Textures\TextureUploader.h"
 
 namespace clockwork {
 	namespace logics {
@@ -60,6 +63,47 @@ namespace clockwork {
 			return test;
 		}
 
+		void TestGame::load() noexcept
+		{
+			using namespace graphics;
+			using namespace utils;
+			//the images are decoded by the assetloader in the background and streamed into the textures by the textureuploader | the textureids are in the same order as the imagepaths
+			assetLoader->loadImages({
+				"res/Images/brick.jpg",
+				"res/Images/stone.jpg",
+				"res/Images/granite.jpg",
+				"res/Images/moss.jpg",
+				"res/Images/brick2.jpg",
+				"res/Images/granite2.jpg",
+				"res/Images/wood.jpg",
+				"res/Images/grass.jpg",
+				"res/Images/blue.jpg",
+				"res/Images/red.jpg",
+				"res/Images/purple.jpg",
+				"res/Images/brick3.jpg",
+				"res/Images/green.jpg",
+				"res/Images/abstract.jpg",
+				"res/Images/ice.jpg"
+				}, [this](std::vector<Image>& images) {
+				m_defaultRenderer->cubeManager.addInstancedTextures(std::move(images), *textureUploader);
+			});
+
+			assetLoader->loadImages({
+				"res/Images/transparent/glass.png",
+				"res/Images/transparent/blue.png",
+				"res/Images/transparent/diagmonds.png",
+				"res/Images/transparent/diamond.png",
+				"res/Images/transparent/dust.png",
+				"res/Images/transparent/straws.png",
+				"res/Images/transparent/wall.png",
+				"res/Images/transparent/washi.png",
+				"res/Images/player1.png",
+				"res/Images/player2.png"
+				}, [this](std::vector<Image>& images) {
+				m_defaultRenderer->cubeManager.addNormalTextures(std::move(images), *textureUploader);
+			});
+		}
+
 		void TestGame::enter() noexcept
 		{
 			using namespace graphics;
@@ -68,35 +112,6 @@ namespace clockwork {
 			m_chunkSystem = new ChunkSystem({ -800,-800,-800 }, { 800,800,800 }, { 10,10,10 }, { 4,4,4 }, { 4,4,4 }, this);//chunksystem in erbenden states mit den jeweiligenn gren erstellen | nachdem camera und renderer erstellt wurden, aber bevor gameobjects hinzugefgt werden 
 			///immoment nur renderdistance 1 zum testen | spter auch chunkdistanz erhhen, da man immoment error bekommt, wenn camerapos ausserhalb des chunks ist | auch gucken wie z is(negativ/nicht) wegen opengl right hand system
 
-			m_defaultRenderer->cubeManager.addInstancedTexture(utils::Image("res/Images/brick.jpg").load());
-			m_defaultRenderer->cubeManager.addInstancedTexture(utils::Image("res/Images/stone.jpg").load());
-			m_defaultRenderer->cubeManager.addInstancedTexture(utils::Image("res/Images/granite.jpg").load());
-			m_defaultRenderer->cubeManager.addInstancedTexture(utils::Image("res/Images/moss.jpg").load());
-			m_defaultRenderer->cubeManager.addInstancedTexture(utils::Image("res/Images/brick2.jpg").load());
-			m_defaultRenderer->cubeManager.addInstancedTexture(utils::Image("res/Images/granite2.jpg").load());
-			m_defaultRenderer->cubeManager.addInstancedTexture(utils::Image("res/Images/wood.jpg").load());
-			m_defaultRenderer->cubeManager.addInstancedTexture(utils::Image("res/Images/grass.jpg").load());
-			m_defaultRenderer->cubeManager.addInstancedTexture(utils::Image("res/Images/blue.jpg").load());
-			m_defaultRenderer->cubeManager.addInstancedTexture(utils::Image("res/Images/red.jpg").load());
-			m_defaultRenderer->cubeManager.addInstancedTexture(utils::Image("res/Images/purple.jpg").load());
-			m_defaultRenderer->cubeManager.addInstancedTexture(utils::Image("res/Images/brick3.jpg").load());
-			m_defaultRenderer->cubeManager.addInstancedTexture(utils::Image("res/Images/green.jpg").load());
-			m_defaultRenderer->cubeManager.addInstancedTexture(utils::Image("res/Images/abstract.jpg").load());
-			m_defaultRenderer->cubeManager.addInstancedTexture(utils::Image("res/Images/ice.jpg").load());
-
-
- 			m_defaultRenderer->cubeManager.addNormalTexture("res/Images/transparent/glass.png");
-			m_defaultRenderer->cubeManager.addNormalTexture("res/Images/transparent/blue.png");
-			m_defaultRenderer->cubeManager.addNormalTexture("res/Images/transparent/diagmonds.png");
-			m_defaultRenderer->cubeManager.addNormalTexture("res/Images/transparent/diamond.png");
-			m_defaultRenderer->cubeManager.addNormalTexture("res/Images/transparent/dust.png");
-			m_defaultRenderer->cubeManager.addNormalTexture("res/Images/transparent/straws.png");
-			m_defaultRenderer->cubeManager.addNormalTexture("res/Images/transparent/wall.png");
-			m_defaultRenderer->cubeManager.addNormalTexture("res/Images/transparent/washi.png");
-
-			m_defaultRenderer->cubeManager.addNormalTexture("res/Images/player1.png");
-			m_defaultRenderer->cubeManager.addNormalTexture("res/Images/player2.png");
-
 			std::srand(engine->getWindow()->getTimer() * 10);
 
 			for ( int i = 0; i < 25000; ++i )//10000 objects: normal 300fps, instancing 2300fps | 1000objects: normal 2000fps, instancing 5000fps | 100 objects: normal 5500fps, instancing 6100fps | 10 objects: normal 5500fps, instancing 5500fps | 1 object: normal 6300fps, instancing 6100fps
@@ -111,6 +126,13 @@ namespace clockwork {
 				logics::TransparentBlock* inst = new logics::TransparentBlock(rand() % transparentTexturecount, maths::Vec3f(1, 1, 1), maths::Vec3f(0, 0, 0), pos, this, m_defaultRenderer);
 			}
 
+			const unsigned int entityComponents = EntityStorage::transformComponent | EntityStorage::velocityComponent | EntityStorage::renderComponent;
+			for ( int i = 0; i < 1000; ++i )//moving blocks in the entitystorage, which are moved by its movement system and drawn with one instanced drawcall per texture
+			{
+				Entity entity = m_entityStorage->create(entityComponents, maths::Vec3f(1, 1, 1), maths::Quatf(), maths::Vec3f(getRand(), getRand(), getRand()), rand() % texturecount);
+				m_entityStorage->setVelocity(entity, maths::Vec3f(getRand(), getRand(), getRand()) / 1000.0f);
+			}
+
 			logics::Player* player = new logics::Player(this, m_defaultRenderer);
 
 		}
@@ -151,6 +173,7 @@ namespace clockwork {
 // 			}
 
 			m_chunkSystem->fastTick();
+			m_entityStorage->fastTick(static_cast<float>( time ));
 
 		}
 
@@ -164,6 +187,7 @@ namespace clockwork {
 		{
 			m_chunkSystem->update();
 			m_defaultRenderer->render();//ggf in state render verschieben | gennauso mit allen weiterleitungen ans chunksystem
+			m_defaultRenderer->renderEntities(*m_entityStorage);
 			m_defaultRenderer->renderTransparent();
 		}
 
@@ -28,6 +28,7 @@ namespace clockwork {
 			virtual ~TestGame() noexcept;
 
 		public:
+			virtual void load() noexcept override;
 			virtual void enter() noexcept override;
 			virtual void leave() noexcept override;
 			virtual void fastTick() noexcept override;
@@ -11,6 +11,9 @@
 * You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
 *************************************************************************/
 #include "Loading.h"
+#include "src\Utils\AssetLoader.h"
+#include "src\Graphics\Textures\TextureUploader.h"
+#include "src\Graphics\ContextThread.h"
 
 namespace clockwork {
 	namespace logics {
@@ -28,25 +31,105 @@ namespace clockwork {
 
 		void Loading::changeState(State* prevState, State* newState, State** statePointer) noexcept
 		{
-			*m_statePointer = *statePointer;
+			m_statePointer = statePointer;
 			m_newState = newState;
 			if ( prevState != nullptr )
-			prevState->leave();//vielleicht wenn es schnell genug geht, einfach alles lschen, sonst die aktionen dem threadworker system zuweisen
-			newState->enter();//hier auch wie oben und natrlich texturen, etc zur renderwarteschlange adden
+			{
+				prevState->leave();
+				prevState->State::leave();
+			}
+			utils::assetLoader->resetProgress();
+			newState->State::enter();
+			newState->load();//die assets werden im hintergrund geladen und enter wird erst in fasttick aufgerufen, wenn alles fertig geladen ist
+		}
+
+		void Loading::enter() noexcept
+		{
+
+		}
+
+		void Loading::leave() noexcept
+		{
+
 		}
 
 		void Loading::fastTick() noexcept
 		{
-			//irgendwie testen wie lange es noch loaden muss 
 			//es muss auch mit dem server ausgetauscht werden, ob eine welt, oder hnliches geladen werden muss und loadingscreen darf ja erst 
 			//state wieder wechseln, wenn alles fertig geladen ist 
-			*m_statePointer = m_newState;//hier state von engine auf den neuen state setzten, WENN ALLES FERTIG GELADEN HAT ! also hier noch irgendwie testen, ob renderloop fertig mit laden ist und ob der threadworkerthread fertig ist und der server sachen fr den state geschickt hat 
+			if ( m_newState == nullptr || !utils::assetLoader->isFinished() || graphics::textureUploader->getPendingCount() != 0 )
+				return;
+			if ( graphics::contextThread && graphics::contextThread->getPendingCount() != 0 )
+				return;
+			State* newState = m_newState;
+			m_newState = nullptr;
+			newState->enter();
+			*m_statePointer = newState;
+		}
+
+		void Loading::slowTick() noexcept
+		{
 
 		}
 
 		void Loading::render() noexcept
 		{
-			//immer loadingscreen zeichnen | ggf auch erbende klasse mit loadingbalken machen 
+			//immer loadingscreen zeichnen | ggf auch erbende klasse mit loadingbalken machen(getProgress)
+		}
+
+		void Loading::onResize(int width, int height, graphics::Window* window) noexcept
+		{
+
+		}
+
+		void Loading::onKeyPress(int key, int scancode, int action, int mods, graphics::Window* window) noexcept
+		{
+
+		}
+
+		void Loading::onCharTyped(unsigned int keycode, int mods, graphics::Window* window) noexcept
+		{
+
+		}
+
+		void Loading::onMousePress(int button, int action, int mods, graphics::Window* window) noexcept
+		{
+
+		}
+
+		void Loading::onMouseMove(double xoffset, double yoffset, graphics::Window* window) noexcept
+		{
+
+		}
+
+		void Loading::onScroll(int xoffset, int yoffset, graphics::Window* window) noexcept
+		{
+
+		}
+
+		void Loading::onCursorEnter(int entered, graphics::Window* window) noexcept
+		{
+
+		}
+
+		void Loading::onFileDrop(int count, const char** paths, graphics::Window* window) noexcept
+		{
+
+		}
+
+		void Loading::onFocus(int focus, graphics::Window* window) noexcept
+		{
+
+		}
+
+		void Loading::onClose(graphics::Window* window) noexcept
+		{
+
+		}
+
+		const float Loading::getProgress() const noexcept
+		{
+			return utils::assetLoader->getProgress();
 		}
 
 	}
@@ -16,6 +16,8 @@
 namespace clockwork {
 	namespace logics {
 
+		/*the loading screen between 2 states | changeState() leaves the old state and lets the new state request its assets with load(), which are then loaded in the background by the global assetloader
+		fastTick() switches the engine to the new state(and calls its enter() method) once all requested assets are loaded and all textures are uploaded | until then the loading screen is rendered and getProgress() can be used for a loading bar*/
 		class Loading
 			: public State//muss noch angepasst werden und alles berschreiben
 		{
@@ -29,10 +31,35 @@ namespace clockwork {
 			virtual ~Loading() noexcept;
 
 		public:
+			/*leaves the previous state, creates the default renderer and camera of the new state and calls its load() method | the engine will use the loading state until the new state is ready
+			@param[prevState] the state that will be left | can be nullptr
+			@param[newState] the state that will be loaded and entered
+			@param[statePointer] the pointer to the current state of the engine, which will be set to the new state when it is ready*/
 			virtual void changeState(State* prevState, State* newState, State** statePointer) noexcept;
+			virtual void enter() noexcept override;
+			virtual void leave() noexcept override;
+			/*switches to the new state, if all assets that were requested by the new state are loaded, all textures are uploaded and all tasks of the contextthread are finished*/
 			virtual void fastTick() noexcept override;
+			virtual void slowTick() noexcept override;
 			virtual void render() noexcept override;
 
+			virtual void onResize(int width, int height, graphics::Window* window) noexcept override;
+			virtual void onKeyPress(int key, int scancode, int action, int mods, graphics::Window* window) noexcept override;
+			virtual void onCharTyped(unsigned int keycode, int mods, graphics::Window* window) noexcept override;
+			virtual void onMousePress(int button, int action, int mods, graphics::Window* window) noexcept override;
+			virtual void onMouseMove(double xoffset, double yoffset, graphics::Window* window) noexcept override;
+			virtual void onScroll(int xoffset, int yoffset, graphics::Window* window) noexcept override;
+			virtual void onCursorEnter(int entered, graphics::Window* window) noexcept override;
+			virtual void onFileDrop(int count, const char** paths, graphics::Window* window) noexcept override;
+			virtual void onFocus(int focus, graphics::Window* window) noexcept override;
+			virtual void onClose(graphics::Window* window) noexcept override;
+
+		public:
+			/*returns the progress of the loading from 0 to 1 for a loading bar | its the part of the requested assets that are finished*/
+			const float getProgress() const noexcept;
+
+			/*returns true if the loading state is loading a new state right now*/
+			const bool isLoading() const noexcept {return m_newState != nullptr;}
 
 		};
 
@@ -16,11 +16,13 @@
 #include "src\Logics\Camera\Camera.h"
 #include "src\Graphics\Renderer\Renderer.h"
 #include "src\Logics\ChunkSystem\ChunkSystem.h"
+#include "src\Logics\Entities\EntityStorage.h"
 
 namespace clockwork {
 	namespace logics {
 
 			State::State() noexcept
+				: m_currentCamera(nullptr), m_defaultRenderer(nullptr), m_defaultCamera(nullptr), m_chunkSystem(nullptr), m_entityStorage(nullptr)
 			{
 			
 			}
@@ -34,14 +36,21 @@ namespace clockwork {
 			{
 				//sachen/texturen vorbereiten/der renterwarteschlange adden 
 				m_defaultCamera = new Camera(this, { 0,5,5 });
+				m_entityStorage = new EntityStorage();
 				m_defaultRenderer = new graphics::Renderer(new graphics::Shader("res/Shaders/Default/Instancing.vs", "res/Shaders/Default/Instancing.fs"), new graphics::Shader("res/Shaders/Default/Normal.vs", "res/Shaders/Default/Normal.fs"), &m_currentCamera, &m_perspectiveProjection);
 			}
 
+			void State::load() noexcept
+			{
+
+			}
+
 			void State::leave() noexcept
 			{
+				delete m_chunkSystem;//before the renderer, because the chunks remove their impostors from the impostormanager of the renderer
 				delete m_defaultCamera;
 				delete m_defaultRenderer;
-				delete m_chunkSystem;
+				delete m_entityStorage;
 				//sachen/texturen lschen
 			}
 
@@ -67,6 +76,8 @@ namespace clockwork {
 
 			void State::updateProjection() noexcept
 			{
+				if ( m_currentCamera == nullptr )//states without a camera(for example the loading state)
+					return;
 				if ( engine->getWindow()->getWidth() != 0 && engine->getWindow()->getHeight() != 0 )
 				{
 					m_perspectiveProjection = maths::Mat4x4<float>::perspective(maths::toRadians<float>(m_currentCamera->getFov()), static_cast<double>( engine->getWindow()->getWidth() ) / static_cast<double>( engine->getWindow()->getHeight() ), m_currentCamera->getNear(), m_currentCamera->getFar());//projection matrix for the scene to transform world coordinates into screen coordinates | has to be set once per update of the window size
@@ -92,6 +103,14 @@ namespace clockwork {
 			{
 				return *m_chunkSystem;
 			}
+			logics::EntityStorage& State::getEntityStorage() noexcept
+			{
+				return *m_entityStorage;
+			}
+			const logics::EntityStorage& State::getEntityStorage() const noexcept
+			{
+				return *m_entityStorage;
+			}
 			graphics::Renderer& State::getDefaultRenderer() noexcept
 			{
 				return *m_defaultRenderer;
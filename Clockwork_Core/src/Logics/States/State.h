@@ -23,6 +23,7 @@ namespace clockwork {
 
 		class Camera;
 		class ChunkSystem;
+		class EntityStorage;
 
 		class State
 		{
@@ -36,6 +37,7 @@ namespace clockwork {
 			graphics::Renderer* m_defaultRenderer;
 			logics::Camera* m_defaultCamera;
 			logics::ChunkSystem* m_chunkSystem;
+			logics::EntityStorage* m_entityStorage;//the data oriented entities of the state next to the gameobjects of the chunksystem | created in enter() and deleted in leave()
 
 		public:
 			State() noexcept;
@@ -46,6 +48,10 @@ namespace clockwork {
 			virtual void onProjectionUpdate() noexcept;
 
 		public:
+			/*is called by the loading state before enter() | the state should request its assets(images, textures, etc) here with the global assetloader(utils::assetLoader)
+			the files are then loaded in the background while the loading screen is shown and enter() is called on the render thread after all assets are loaded and uploaded
+			the default renderer and camera of the state already exist when this is called*/
+			virtual void load() noexcept;
 			virtual void enter() noexcept = 0;
 			virtual void leave() noexcept = 0;
 			virtual void fastTick() noexcept = 0;
@@ -63,6 +69,9 @@ namespace clockwork {
 			logics::ChunkSystem& getChunkSystem() noexcept;
 			const logics::ChunkSystem& getChunkSystem() const noexcept;
 
+			logics::EntityStorage& getEntityStorage() noexcept;
+			const logics::EntityStorage& getEntityStorage() const noexcept;
+
 			graphics::Renderer& getDefaultRenderer() noexcept;
 			const graphics::Renderer& getDefaultRenderer() const noexcept;
 
@@ -0,0 +1,254 @@
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "Batch.h"
+#include "Simd.h"
+
+namespace clockwork {
+	namespace maths {
+
+#if CLOCKWORK_SIMD_SSE2
+		namespace {
+
+			//a*b+c
+			inline __m128 multiplyAdd(__m128 a, __m128 b, __m128 c) noexcept
+			{
+#if CLOCKWORK_SIMD_FMA
+				return _mm_fmadd_ps(a, b, c);
+#else
+				return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+			}
+
+			/*reorders 4 Vec3f in the 3 registers first(x0 y0 z0 x1), second(y1 z1 x2 y2) and third(z2 x3 y3 z3) into x(x0 x1 x2 x3), y and z*/
+			inline void deinterleave(__m128 first, __m128 second, __m128 third, __m128& x, __m128& y, __m128& z) noexcept
+			{
+				__m128 xy23 = _mm_shuffle_ps(second, third, _MM_SHUFFLE(2, 1, 3, 2));//x2 y2 x3 y3
+				__m128 yz01 = _mm_shuffle_ps(first, second, _MM_SHUFFLE(1, 0, 2, 1));//y0 z0 y1 z1
+				x = _mm_shuffle_ps(first, xy23, _MM_SHUFFLE(2, 0, 3, 0));
+				y = _mm_shuffle_ps(yz01, xy23, _MM_SHUFFLE(3, 1, 2, 0));
+				z = _mm_shuffle_ps(yz01, third, _MM_SHUFFLE(3, 0, 3, 1));
+			}
+
+			//the reverse of deinterleave()
+			inline void interleave(__m128 x, __m128 y, __m128 z, __m128& first, __m128& second, __m128& third) noexcept
+			{
+				__m128 xy01 = _mm_unpacklo_ps(x, y);//x0 y0 x1 y1
+				__m128 xy23 = _mm_unpackhi_ps(x, y);//x2 y2 x3 y3
+				first = _mm_shuffle_ps(xy01, _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 1, 0));
+				second = _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), xy23, _MM_SHUFFLE(1, 0, 2, 0));
+				__m128 z23xy3 = _mm_shuffle_ps(z, xy23, _MM_SHUFFLE(3, 2, 3, 2));//z2 z3 x3 y3
+				third = _mm_shuffle_ps(z23xy3, z23xy3, _MM_SHUFFLE(1, 3, 2, 0));
+			}
+
+			//the broadcasted values of the matrix | row is x1 x2 x3 x4 for the new x
+			struct MatrixRows
+			{
+				__m128 x1, x2, x3, x4, y1, y2, y3, y4, z1, z2, z3, z4;
+				MatrixRows(const Mat4f& matrix) noexcept
+					: x1(_mm_set1_ps(matrix.x1)), x2(_mm_set1_ps(matrix.x2)), x3(_mm_set1_ps(matrix.x3)), x4(_mm_set1_ps(matrix.x4)),
+					y1(_mm_set1_ps(matrix.y1)), y2(_mm_set1_ps(matrix.y2)), y3(_mm_set1_ps(matrix.y3)), y4(_mm_set1_ps(matrix.y4)),
+					z1(_mm_set1_ps(matrix.z1)), z2(_mm_set1_ps(matrix.z2)), z3(_mm_set1_ps(matrix.z3)), z4(_mm_set1_ps(matrix.z4))
+				{}
+				inline void transform(__m128 x, __m128 y, __m128 z, __m128& outX, __m128& outY, __m128& outZ) const noexcept
+				{
+					outX = multiplyAdd(x3, z, multiplyAdd(x2, y, multiplyAdd(x1, x, x4)));
+					outY = multiplyAdd(y3, z, multiplyAdd(y2, y, multiplyAdd(y1, x, y4)));
+					outZ = multiplyAdd(z3, z, multiplyAdd(z2, y, multiplyAdd(z1, x, z4)));
+				}
+			};
+
+#if CLOCKWORK_SIMD_AVX2
+			inline __m256 multiplyAdd(__m256 a, __m256 b, __m256 c) noexcept
+			{
+#if CLOCKWORK_SIMD_FMA
+				return _mm256_fmadd_ps(a, b, c);
+#else
+				return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif
+			}
+#endif
+
+		}
+#endif
+
+		void transformPoints(const Mat4f& matrix, const Vec3f* in, Vec3f* out, unsigned int count) noexcept
+		{
+			unsigned int i = 0;
+#if CLOCKWORK_SIMD_SSE2
+			const MatrixRows rows(matrix);
+			const float* source = reinterpret_cast<const float*>( in );
+			float* destination = reinterpret_cast<float*>( out );
+			for ( ; i + 4 <= count; i += 4 )//4 Vec3f are 3 registers
+			{
+				__m128 x, y, z;
+				deinterleave(_mm_loadu_ps(source + i * 3), _mm_loadu_ps(source + i * 3 + 4), _mm_loadu_ps(source + i * 3 + 8), x, y, z);
+				rows.transform(x, y, z, x, y, z);
+				__m128 first, second, third;
+				interleave(x, y, z, first, second, third);
+				_mm_storeu_ps(destination + i * 3, first);
+				_mm_storeu_ps(destination + i * 3 + 4, second);
+				_mm_storeu_ps(destination + i * 3 + 8, third);
+			}
+#endif
+			for ( ; i < count; ++i )
+				out[i] = Mat4f::genericTransform(matrix, in[i]);
+		}
+
+		void transformPoints(const Mat4f& matrix, const float* inX, const float* inY, const float* inZ, float* outX, float* outY, float* outZ, unsigned int count) noexcept
+		{
+			unsigned int i = 0;
+#if CLOCKWORK_SIMD_AVX2
+			const __m256 x1 = _mm256_set1_ps(matrix.x1), x2 = _mm256_set1_ps(matrix.x2), x3 = _mm256_set1_ps(matrix.x3), x4 = _mm256_set1_ps(matrix.x4);
+			const __m256 y1 = _mm256_set1_ps(matrix.y1), y2 = _mm256_set1_ps(matrix.y2), y3 = _mm256_set1_ps(matrix.y3), y4 = _mm256_set1_ps(matrix.y4);
+			const __m256 z1 = _mm256_set1_ps(matrix.z1), z2 = _mm256_set1_ps(matrix.z2), z3 = _mm256_set1_ps(matrix.z3), z4 = _mm256_set1_ps(matrix.z4);
+			for ( ; i + 8 <= count; i += 8 )
+			{
+				__m256 x = _mm256_loadu_ps(inX + i), y = _mm256_loadu_ps(inY + i), z = _mm256_loadu_ps(inZ + i);
+				_mm256_storeu_ps(outX + i, multiplyAdd(x3, z, multiplyAdd(x2, y, multiplyAdd(x1, x, x4))));
+				_mm256_storeu_ps(outY + i, multiplyAdd(y3, z, multiplyAdd(y2, y, multiplyAdd(y1, x, y4))));
+				_mm256_storeu_ps(outZ + i, multiplyAdd(z3, z, multiplyAdd(z2, y, multiplyAdd(z1, x, z4))));
+			}
+#endif
+#if CLOCKWORK_SIMD_SSE2
+			const MatrixRows rows(matrix);
+			for ( ; i + 4 <= count; i += 4 )
+			{
+				__m128 x, y, z;
+				rows.transform(_mm_loadu_ps(inX + i), _mm_loadu_ps(inY + i), _mm_loadu_ps(inZ + i), x, y, z);
+				_mm_storeu_ps(outX + i, x);
+				_mm_storeu_ps(outY + i, y);
+				_mm_storeu_ps(outZ + i, z);
+			}
+#endif
+			for ( ; i < count; ++i )
+			{
+				Vec3f point = Mat4f::genericTransform(matrix, Vec3f(inX[i], inY[i], inZ[i]));
+				outX[i] = point.x;
+				outY[i] = point.y;
+				outZ[i] = point.z;
+			}
+		}
+
+		void transformAabb(const Mat4f& matrix, const Vec3f& min, const Vec3f& max, Vec3f& outMin, Vec3f& outMax) noexcept
+		{
+			Vec3f center((min.x + max.x) * 0.5f, (min.y + max.y) * 0.5f, (min.z + max.z) * 0.5f);
+			Vec3f halfSize((max.x - min.x) * 0.5f, (max.y - min.y) * 0.5f, (max.z - min.z) * 0.5f);
+			Vec3f newCenter = Mat4f::genericTransform(matrix, center);
+			Vec3f newHalfSize(
+				maths::abs(matrix.x1) * halfSize.x + maths::abs(matrix.x2) * halfSize.y + maths::abs(matrix.x3) * halfSize.z,
+				maths::abs(matrix.y1) * halfSize.x + maths::abs(matrix.y2) * halfSize.y + maths::abs(matrix.y3) * halfSize.z,
+				maths::abs(matrix.z1) * halfSize.x + maths::abs(matrix.z2) * halfSize.y + maths::abs(matrix.z3) * halfSize.z);
+			outMin = Vec3f(newCenter.x - newHalfSize.x, newCenter.y - newHalfSize.y, newCenter.z - newHalfSize.z);
+			outMax = Vec3f(newCenter.x + newHalfSize.x, newCenter.y + newHalfSize.y, newCenter.z + newHalfSize.z);
+		}
+
+		void transformAabbs(const Mat4f& matrix, const Vec3f* mins, const Vec3f* maxs, Vec3f* outMins, Vec3f* outMaxs, unsigned int count) noexcept
+		{
+			unsigned int i = 0;
+#if CLOCKWORK_SIMD_SSE2
+			const MatrixRows rows(matrix);
+			const __m128 signMask = _mm_set1_ps(-0.0f);
+			const __m128 half = _mm_set1_ps(0.5f);
+			//the absolute values of the rotation/scaling part of the matrix
+			const __m128 x1 = _mm_andnot_ps(signMask, rows.x1), x2 = _mm_andnot_ps(signMask, rows.x2), x3 = _mm_andnot_ps(signMask, rows.x3);
+			const __m128 y1 = _mm_andnot_ps(signMask, rows.y1), y2 = _mm_andnot_ps(signMask, rows.y2), y3 = _mm_andnot_ps(signMask, rows.y3);
+			const __m128 z1 = _mm_andnot_ps(signMask, rows.z1), z2 = _mm_andnot_ps(signMask, rows.z2), z3 = _mm_andnot_ps(signMask, rows.z3);
+			const float* minSource = reinterpret_cast<const float*>( mins );
+			const float* maxSource = reinterpret_cast<const float*>( maxs );
+			float* minDestination = reinterpret_cast<float*>( outMins );
+			float* maxDestination = reinterpret_cast<float*>( outMaxs );
+			for ( ; i + 4 <= count; i += 4 )//4 boxes at once, like 4 points in transformPoints()
+			{
+				__m128 minX, minY, minZ, maxX, maxY, maxZ;
+				deinterleave(_mm_loadu_ps(minSource + i * 3), _mm_loadu_ps(minSource + i * 3 + 4), _mm_loadu_ps(minSource + i * 3 + 8), minX, minY, minZ);
+				deinterleave(_mm_loadu_ps(maxSource + i * 3), _mm_loadu_ps(maxSource + i * 3 + 4), _mm_loadu_ps(maxSource + i * 3 + 8), maxX, maxY, maxZ);
+				__m128 centerX, centerY, centerZ;
+				rows.transform(_mm_mul_ps(_mm_add_ps(minX, maxX), half), _mm_mul_ps(_mm_add_ps(minY, maxY), half), _mm_mul_ps(_mm_add_ps(minZ, maxZ), half), centerX, centerY, centerZ);
+				__m128 halfX = _mm_mul_ps(_mm_sub_ps(maxX, minX), half), halfY = _mm_mul_ps(_mm_sub_ps(maxY, minY), half), halfZ = _mm_mul_ps(_mm_sub_ps(maxZ, minZ), half);
+				__m128 sizeX = multiplyAdd(x3, halfZ, multiplyAdd(x2, halfY, _mm_mul_ps(x1, halfX)));
+				__m128 sizeY = multiplyAdd(y3, halfZ, multiplyAdd(y2, halfY, _mm_mul_ps(y1, halfX)));
+				__m128 sizeZ = multiplyAdd(z3, halfZ, multiplyAdd(z2, halfY, _mm_mul_ps(z1, halfX)));
+				__m128 first, second, third;
+				interleave(_mm_sub_ps(centerX, sizeX), _mm_sub_ps(centerY, sizeY), _mm_sub_ps(centerZ, sizeZ), first, second, third);
+				_mm_storeu_ps(minDestination + i * 3, first);
+				_mm_storeu_ps(minDestination + i * 3 + 4, second);
+				_mm_storeu_ps(minDestination + i * 3 + 8, third);
+				interleave(_mm_add_ps(centerX, sizeX), _mm_add_ps(centerY, sizeY), _mm_add_ps(centerZ, sizeZ), first, second, third);
+				_mm_storeu_ps(maxDestination + i * 3, first);
+				_mm_storeu_ps(maxDestination + i * 3 + 4, second);
+				_mm_storeu_ps(maxDestination + i * 3 + 8, third);
+			}
+#endif
+			for ( ; i < count; ++i )
+			{
+				Vec3f min = mins[i];//copies, so the output can be the input
+				Vec3f max = maxs[i];
+				transformAabb(matrix, min, max, outMins[i], outMaxs[i]);
+			}
+		}
+
+		void distancesSquared(const Vec3f& point, const Vec3f* positions, float* out, unsigned int count) noexcept
+		{
+			unsigned int i = 0;
+#if CLOCKWORK_SIMD_SSE2
+			const __m128 pointX = _mm_set1_ps(point.x), pointY = _mm_set1_ps(point.y), pointZ = _mm_set1_ps(point.z);
+			const float* source = reinterpret_cast<const float*>( positions );
+			for ( ; i + 4 <= count; i += 4 )
+			{
+				__m128 x, y, z;
+				deinterleave(_mm_loadu_ps(source + i * 3), _mm_loadu_ps(source + i * 3 + 4), _mm_loadu_ps(source + i * 3 + 8), x, y, z);
+				x = _mm_sub_ps(x, pointX);
+				y = _mm_sub_ps(y, pointY);
+				z = _mm_sub_ps(z, pointZ);
+				_mm_storeu_ps(out + i, multiplyAdd(z, z, multiplyAdd(y, y, _mm_mul_ps(x, x))));
+			}
+#endif
+			for ( ; i < count; ++i )
+			{
+				float x = positions[i].x - point.x, y = positions[i].y - point.y, z = positions[i].z - point.z;
+				out[i] = x * x + y * y + z * z;
+			}
+		}
+
+		void distancesSquared(const Vec3f& point, const float* x, const float* y, const float* z, float* out, unsigned int count) noexcept
+		{
+			unsigned int i = 0;
+#if CLOCKWORK_SIMD_AVX2
+			const __m256 wideX = _mm256_set1_ps(point.x), wideY = _mm256_set1_ps(point.y), wideZ = _mm256_set1_ps(point.z);
+			for ( ; i + 8 <= count; i += 8 )
+			{
+				__m256 dx = _mm256_sub_ps(_mm256_loadu_ps(x + i), wideX);
+				__m256 dy = _mm256_sub_ps(_mm256_loadu_ps(y + i), wideY);
+				__m256 dz = _mm256_sub_ps(_mm256_loadu_ps(z + i), wideZ);
+				_mm256_storeu_ps(out + i, multiplyAdd(dz, dz, multiplyAdd(dy, dy, _mm256_mul_ps(dx, dx))));
+			}
+#endif
+#if CLOCKWORK_SIMD_SSE2
+			const __m128 pointX = _mm_set1_ps(point.x), pointY = _mm_set1_ps(point.y), pointZ = _mm_set1_ps(point.z);
+			for ( ; i + 4 <= count; i += 4 )
+			{
+				__m128 dx = _mm_sub_ps(_mm_loadu_ps(x + i), pointX);
+				__m128 dy = _mm_sub_ps(_mm_loadu_ps(y + i), pointY);
+				__m128 dz = _mm_sub_ps(_mm_loadu_ps(z + i), pointZ);
+				_mm_storeu_ps(out + i, multiplyAdd(dz, dz, multiplyAdd(dy, dy, _mm_mul_ps(dx, dx))));
+			}
+#endif
+			for ( ; i < count; ++i )
+			{
+				float dx = x[i] - point.x, dy = y[i] - point.y, dz = z[i] - point.z;
+				out[i] = dx * dx + dy * dy + dz * dz;
+			}
+		}
+
+	}
+}
@@ -0,0 +1,44 @@
+#pragma once
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "Mat4x4.h"
+#include "Vec3.h"
+
+namespace clockwork {
+	namespace maths {
+
+		/*batch versions of the Mat4f*Vec3f transforms and the distance calculations for arrays of points | the loops in the cpp work on 4(sse) or 8(avx2) points at once(see Simd.h) and the rest is calculated one by one
+		the points can either be an array of Vec3f(array of structures), which is reordered into x, y and z registers inside of the loop, or 3 arrays with the x, y and z values(structure of arrays), which can be loaded directly and is faster
+		the output arrays can be the same as the input arrays, but they must not overlap otherwise | all functions are not thread safe for the same output array*/
+
+		/*transforms the points with the matrix as positions(w=1) like matrix*point and writes them into out | the count is the number of points*/
+		void transformPoints(const Mat4f& matrix, const Vec3f* in, Vec3f* out, unsigned int count) noexcept;
+
+		/*transforms the points given as x, y and z arrays with the matrix as positions(w=1) and writes them into the x, y and z output arrays | the count is the number of points*/
+		void transformPoints(const Mat4f& matrix, const float* inX, const float* inY, const float* inZ, float* outX, float* outY, float* outZ, unsigned int count) noexcept;
+
+		/*transforms the axis aligned bounding box from min to max with the matrix and writes the axis aligned bounding box around the transformed box into outMin and outMax
+		the center is transformed and the new half size is the sum of the absolute columns of the rotation/scaling multiplied with the old half size, so not all 8 corners have to be transformed | its exact for the transformed box, also with rotations and negative scalings*/
+		void transformAabb(const Mat4f& matrix, const Vec3f& min, const Vec3f& max, Vec3f& outMin, Vec3f& outMax) noexcept;
+
+		/*transforms count axis aligned bounding boxes from mins to maxs with the same matrix like transformAabb()*/
+		void transformAabbs(const Mat4f& matrix, const Vec3f* mins, const Vec3f* maxs, Vec3f* outMins, Vec3f* outMaxs, unsigned int count) noexcept;
+
+		/*writes the squared distances from the point to the positions into out | use them to compare/sort distances without the sqrt of Vec3::distance()*/
+		void distancesSquared(const Vec3f& point, const Vec3f* positions, float* out, unsigned int count) noexcept;
+
+		/*writes the squared distances from the point to the positions given as x, y and z arrays into out*/
+		void distancesSquared(const Vec3f& point, const float* x, const float* y, const float* z, float* out, unsigned int count) noexcept;
+
+	}
+}
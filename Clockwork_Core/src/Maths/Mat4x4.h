@@ -30,13 +30,8 @@ namespace clockwork {
 		template<typename type>struct Mat4x4;
 
 		template<typename type>Mat4x4<type> operator*(const Mat4x4<type>& left, const Mat4x4<type>& right) noexcept;
-		template<typename type>Mat4x4<type>&& operator*(Mat4x4<type>&& left, const Mat4x4<type>& right) noexcept;
-		template<typename type>Mat4x4<type>&& operator*(const Mat4x4<type>& left, Mat4x4<type>&& right) noexcept;
-		template<typename type>Vec4<type>&& operator*(const Mat4x4<type>& left, Vec4<type>&& right) noexcept;
 		template<typename type>Vec4<type> operator*(const Mat4x4<type>& left, const Vec4<type>& right) noexcept;
-		template<typename type>Vec3<type>&& operator*(const Mat4x4<type>& left, Vec3<type>&& right) noexcept;
 		template<typename type>Vec3<type> operator*(const Mat4x4<type>& left, const Vec3<type>& right) noexcept;
-		template<typename type>Vec2<type>&& operator*(const Mat4x4<type>& left, Vec2<type>&& right) noexcept;
 		template<typename type>Vec2<type> operator*(const Mat4x4<type>& left, const Vec2<type>& right) noexcept;
 
 
@@ -182,7 +177,7 @@ namespace clockwork {
 			y1 y2 y3 y4
 			z1 z2 z3 z4
 			w1 w2 w3 w4*/
-			explicit Mat4x4
+			explicit constexpr Mat4x4
 			(
 				type x1=1, type x2=0, type x3=0, type x4=0,
 				type y1=0, type y2=1, type y3=0, type y4=0,
@@ -197,22 +192,13 @@ namespace clockwork {
 			v1.y v2.y v3.y v4.y
 			v1.z v2.z v3.z v4.z
 			v1.w v2.w v3.w v4.w*/
-			Mat4x4(const Vec4<type>& v1, const Vec4<type>& v2, const Vec4<type>& v3, const Vec4<type>& v4) noexcept
+			constexpr Mat4x4(const Vec4<type>& v1, const Vec4<type>& v2, const Vec4<type>& v3, const Vec4<type>& v4) noexcept
 				: x1(v1.x), y1(v1.y), z1(v1.z), w1(v1.w), x2(v2.x), y2(v2.y), z2(v2.z), w2(v2.w), x3(v3.x), y3(v3.y), z3(v3.z), w3(v3.w), x4(v4.x), y4(v4.y), z4(v4.z), w4(v4.w)
 			{}
 			/*copy a matrix*/
-			Mat4x4(const Mat4x4<type>& other)
-				: x1(other.x1), x2(other.x2), x3(other.x3), x4(other.x4), y1(other.y1), y2(other.y2), y3(other.y3), y4(other.y4), z1(other.z1), z2(other.z2), z3(other.z3), z4(other.z4), w1(other.w1), w2(other.w2), w3(other.w3), w4(other.w4)
-			{}
+			Mat4x4(const Mat4x4<type>& other) noexcept = default;
 			/*copy a matrix*/
-			Mat4x4<type>& operator=(const Mat4x4<type>& other)
-			{
-				x1 = other.x1; x2 = other.x2; x3 = other.x3; x4 = other.x4;
-				y1 = other.y1; y2 = other.y2; y3 = other.y3; y4 = other.y4;
-				z1 = other.z1; z2 = other.z2; z3 = other.z3; z4 = other.z4;
-				w1 = other.w1; w2 = other.w2; w3 = other.w3; w4 = other.w4;
-				return *this;
-			}
+			Mat4x4<type>& operator=(const Mat4x4<type>& other) noexcept = default;
 
 			/*returns an identity matrix | matrices or vectors multiplied by this do not change
 			1 0 0 0
@@ -238,7 +224,7 @@ namespace clockwork {
 			s2*y
 			s3*z
 			1*/
-			static Mat4x4<type> scaling(type s1, type s2, type s3) noexcept
+			static constexpr Mat4x4<type> scaling(type s1, type s2, type s3) noexcept
 			{
 				return Mat4x4<type> {
 						s1, 0, 0, 0,
@@ -257,7 +243,7 @@ namespace clockwork {
 			sy*y
 			sz*z
 			1*/
-			static Mat4x4<type> scaling(const Vec3<type>& s) noexcept
+			static constexpr Mat4x4<type> scaling(const Vec3<type>& s) noexcept
 			{
 				return Mat4x4<type> {
 						s.x, 0, 0, 0,
@@ -318,7 +304,7 @@ namespace clockwork {
 			y+t2
 			z+t3
 			1*/
-			static Mat4x4<type> translation(type t1, type t2, type t3) noexcept
+			static constexpr Mat4x4<type> translation(type t1, type t2, type t3) noexcept
 			{
 				return Mat4x4<type> {
 						1, 0, 0, t1, 
@@ -337,7 +323,7 @@ namespace clockwork {
 			y+ty
 			z+tz
 			1*/
-			static Mat4x4<type> translation(const Vec3<type>& t) noexcept
+			static constexpr Mat4x4<type> translation(const Vec3<type>& t) noexcept
 			{
 				return Mat4x4<type> {
 						1, 0, 0, t.x,
@@ -421,7 +407,7 @@ namespace clockwork {
 			y*s2+t2
 			z*s3+t3
 			1*/
-			static Mat4x4<type> scaleTrans(type s1, type s2, type s3, type t1, type t2, type t3) noexcept
+			static constexpr Mat4x4<type> scaleTrans(type s1, type s2, type s3, type t1, type t2, type t3) noexcept
 			{
 				return Mat4x4<type> {
 						s1, 0, 0, t1,
@@ -441,7 +427,7 @@ namespace clockwork {
 			y*s2+t2
 			z*s3+t3
 			1*/
-			static Mat4x4<type> scaleTrans(const Vec3<type>& s, const Vec3<type>& t) noexcept
+			static constexpr Mat4x4<type> scaleTrans(const Vec3<type>& s, const Vec3<type>& t) noexcept
 			{
 				return Mat4x4<type> {
 						s.x, 0, 0, t.x,
@@ -466,10 +452,12 @@ namespace clockwork {
 			1*/
 			static Mat4x4<type> rotationXD(type degrees) noexcept
 			{
+				type s, c;
+				maths::sincosD(degrees, s, c);
 				return Mat4x4<type> {
 						1, 0, 0, 0,
-						0, maths::cosD(degrees),-maths::sinD(degrees), 0,
-						0, maths::sinD(degrees), maths::cosD(degrees), 0,
+						0, c,-s, 0,
+						0, s, c, 0,
 						0, 0, 0, 1 };
 			}
 
@@ -486,10 +474,12 @@ namespace clockwork {
 			1*/
 			static Mat4x4<type> rotationXR(type radians) noexcept
 			{
+				type s, c;
+				maths::sincos(radians, s, c);
 				return Mat4x4<type> {
 						1, 0, 0, 0,
-						0, maths::cosR(radians),-maths::sinR(radians), 0,
-						0, maths::sinR(radians), maths::cosR(radians), 0,
+						0, c,-s, 0,
+						0, s, c, 0,
 						0, 0, 0, 1 };
 			}
 
@@ -508,17 +498,19 @@ namespace clockwork {
 			1*/
 			Mat4x4<type>& rotateXD(type degrees) noexcept
 			{
-				type temp = maths::cosD(degrees) * y1 + -maths::sinD(degrees) * z1;
-				z1 = maths::sinD(degrees) * y1 + maths::cosD(degrees) * z1;
+				type s, c;
+				maths::sincosD(degrees, s, c);
+				type temp = c * y1 + -s * z1;
+				z1 = s * y1 + c * z1;
 				y1 = temp;
-				temp = maths::cosD(degrees) * y2 + -maths::sinD(degrees) * z2;
-				z2 = maths::sinD(degrees) * y2 + maths::cosD(degrees) * z2;
+				temp = c * y2 + -s * z2;
+				z2 = s * y2 + c * z2;
 				y2 = temp;
-				temp = maths::cosD(degrees) * y3 + -maths::sinD(degrees) * z3;
-				z3 = maths::sinD(degrees) * y3 + maths::cosD(degrees) * z3;
+				temp = c * y3 + -s * z3;
+				z3 = s * y3 + c * z3;
 				y3 = temp;
-				temp = maths::cosD(degrees) * y4 + -maths::sinD(degrees) * z4;
-				z4 = maths::sinD(degrees) * y4 + maths::cosD(degrees) * z4;
+				temp = c * y4 + -s * z4;
+				z4 = s * y4 + c * z4;
 				y4 = temp;
 				return *this;
 			}
@@ -538,17 +530,19 @@ namespace clockwork {
 			1*/
 			Mat4x4<type>& rotateXR(type radians) noexcept
 			{
-				type temp = maths::cosR(radians) * y1 + -maths::sinR(radians) * z1;
-				z1 = maths::sinR(radians) * y1 + maths::cosR(radians) * z1;
+				type s, c;
+				maths::sincos(radians, s, c);
+				type temp = c * y1 + -s * z1;
+				z1 = s * y1 + c * z1;
 				y1 = temp;
-				temp = maths::cosR(radians) * y2 + -maths::sinR(radians) * z2;
-				z2 = maths::sinR(radians) * y2 + maths::cosR(radians) * z2;
+				temp = c * y2 + -s * z2;
+				z2 = s * y2 + c * z2;
 				y2 = temp;
-				temp = maths::cosR(radians) * y3 + -maths::sinR(radians) * z3;
-				z3 = maths::sinR(radians) * y3 + maths::cosR(radians) * z3;
+				temp = c * y3 + -s * z3;
+				z3 = s * y3 + c * z3;
 				y3 = temp;
-				temp = maths::cosR(radians) * y4 + -maths::sinR(radians) * z4;
-				z4 = maths::sinR(radians) * y4 + maths::cosR(radians) * z4;
+				temp = c * y4 + -s * z4;
+				z4 = s * y4 + c * z4;
 				y4 = temp;
 				return *this;
 			}
@@ -566,10 +560,12 @@ namespace clockwork {
 			1*/
 			static Mat4x4<type> rotationYD(type degrees) noexcept
 			{
+				type s, c;
+				maths::sincosD(degrees, s, c);
 				return Mat4x4<type> {
-						maths::cosD(degrees), 0, maths::sinD(degrees), 0,
+						c, 0, s, 0,
 						0, 1, 0, 0,
-						-maths::sinD(degrees), 0, maths::cosD(degrees), 0,
+						-s, 0, c, 0,
 						0, 0, 0, 1 };
 			}
 			/*returns a rotation matrix for the y-axis with the angle parameter as radians | rotation matrices are used to rotate a vector at a given angle along the rotation axis
@@ -586,10 +582,12 @@ namespace clockwork {
 
 			static Mat4x4<type> rotationYR(type radians) noexcept
 			{
+				type s, c;
+				maths::sincos(radians, s, c);
 				return Mat4x4<type> {
-						maths::cosR(radians), 0, maths::sinR(radians), 0,
+						c, 0, s, 0,
 						0, 1, 0, 0,
-						-maths::sinR(radians), 0, maths::cosR(radians), 0,
+						-s, 0, c, 0,
 						0, 0, 0, 1 };
 			}
 
@@ -608,17 +606,19 @@ namespace clockwork {
 			1*/
 			Mat4x4<type>& rotateYD(type degrees) noexcept
 			{
-				type temp = maths::cosD(degrees) * x1 + maths::sinD(degrees) * z1;
-				z1 = -maths::sinD(degrees) * x1 + maths::cosD(degrees) * z1;
+				type s, c;
+				maths::sincosD(degrees, s, c);
+				type temp = c * x1 + s * z1;
+				z1 = -s * x1 + c * z1;
 				x1 = temp;
-				temp = maths::cosD(degrees) * x2 + maths::sinD(degrees) * z2;
-				z2 = -maths::sinD(degrees) * x2 + maths::cosD(degrees) * z2;
+				temp = c * x2 + s * z2;
+				z2 = -s * x2 + c * z2;
 				x2 = temp;
-				temp = maths::cosD(degrees) * x3 + maths::sinD(degrees) * z3;
-				z3 = -maths::sinD(degrees) * x3 + maths::cosD(degrees) * z3;
+				temp = c * x3 + s * z3;
+				z3 = -s * x3 + c * z3;
 				x3 = temp;
-				temp = maths::cosD(degrees) * x4 + maths::sinD(degrees) * z4;
-				z4 = -maths::sinD(degrees) * x4 + maths::cosD(degrees) * z4;
+				temp = c * x4 + s * z4;
+				z4 = -s * x4 + c * z4;
 				x4 = temp;
 				return *this;
 			}
@@ -638,17 +638,19 @@ namespace clockwork {
 			1*/
 			Mat4x4<type>& rotateYR(type radians) noexcept
 			{
-				type temp = maths::cosR(radians) * x1 + maths::sinR(radians) * z1;
-				z1 = -maths::sinR(radians) * x1 + maths::cosR(radians) * z1;
+				type s, c;
+				maths::sincos(radians, s, c);
+				type temp = c * x1 + s * z1;
+				z1 = -s * x1 + c * z1;
 				x1 = temp;
-				temp = maths::cosR(radians) * x2 + maths::sinR(radians) * z2;
-				z2 = -maths::sinR(radians) * x2 + maths::cosR(radians) * z2;
+				temp = c * x2 + s * z2;
+				z2 = -s * x2 + c * z2;
 				x2 = temp;
-				temp = maths::cosR(radians) * x3 + maths::sinR(radians) * z3;
-				z3 = -maths::sinR(radians) * x3 + maths::cosR(radians) * z3;
+				temp = c * x3 + s * z3;
+				z3 = -s * x3 + c * z3;
 				x3 = temp;
-				temp = maths::cosR(radians) * x4 + maths::sinR(radians) * z4;
-				z4 = -maths::sinR(radians) * x4 + maths::cosR(radians) * z4;
+				temp = c * x4 + s * z4;
+				z4 = -s * x4 + c * z4;
 				x4 = temp;
 				return *this;
 			}
@@ -667,9 +669,11 @@ namespace clockwork {
 			1*/
 			static Mat4x4<type> rotationZD(type degrees) noexcept
 			{
+				type s, c;
+				maths::sincosD(degrees, s, c);
 				return Mat4x4<type> {
-						maths::cosD(degrees), -maths::sinD(degrees), 0, 0,
-						maths::sinD(degrees), maths::cosD(degrees), 0, 0,
+						c, -s, 0, 0,
+						s, c, 0, 0,
 						0, 0, 1, 0,
 						0, 0, 0, 1 };
 			}
@@ -687,9 +691,11 @@ namespace clockwork {
 			1*/
 			static Mat4x4<type> rotationZR(type radians) noexcept
 			{
+				type s, c;
+				maths::sincos(radians, s, c);
 				return Mat4x4<type> {
-						maths::cosR(radians), -maths::sinR(radians), 0, 0,
-						maths::sinR(radians), maths::cosR(radians), 0, 0,
+						c, -s, 0, 0,
+						s, c, 0, 0,
 						0, 0, 1, 0,
 						0, 0, 0, 1 };
 			}
@@ -709,17 +715,19 @@ namespace clockwork {
 			1*/
 			Mat4x4<type>& rotateZD(type degrees) noexcept
 			{
-				type temp = maths::cosD(degrees) * x1 + -maths::sinD(degrees) * y1;
-				y1 = maths::sinD(degrees) * x1 + maths::cosD(degrees) * y1;
+				type s, c;
+				maths::sincosD(degrees, s, c);
+				type temp = c * x1 + -s * y1;
+				y1 = s * x1 + c * y1;
 				x1 = temp;
-				temp = maths::cosD(degrees) * x2 + -maths::sinD(degrees) * y2;
-				y2 = maths::sinD(degrees) * x2 + maths::cosD(degrees) * y2;
+				temp = c * x2 + -s * y2;
+				y2 = s * x2 + c * y2;
 				x2 = temp;
-				temp = maths::cosD(degrees) * x3 + -maths::sinD(degrees) * y3;
-				y3 = maths::sinD(degrees) * x3 + maths::cosD(degrees) * y3;
+				temp = c * x3 + -s * y3;
+				y3 = s * x3 + c * y3;
 				x3 = temp;
-				temp = maths::cosD(degrees) * x4 + -maths::sinD(degrees) * y4;
-				y4 = maths::sinD(degrees) * x4 + maths::cosD(degrees) * y4;
+				temp = c * x4 + -s * y4;
+				y4 = s * x4 + c * y4;
 				x4 = temp;
 				return *this;
 			}
@@ -739,17 +747,19 @@ namespace clockwork {
 			1*/
 			Mat4x4<type>& rotateZR(type radians) noexcept
 			{
-				type temp = maths::cosR(radians) * x1 + -maths::sinR(radians) * y1;
-				y1 = maths::sinR(radians) * x1 + maths::cosR(radians) * y1;
+				type s, c;
+				maths::sincos(radians, s, c);
+				type temp = c * x1 + -s * y1;
+				y1 = s * x1 + c * y1;
 				x1 = temp;
-				temp = maths::cosR(radians) * x2 + -maths::sinR(radians) * y2;
-				y2 = maths::sinR(radians) * x2 + maths::cosR(radians) * y2;
+				temp = c * x2 + -s * y2;
+				y2 = s * x2 + c * y2;
 				x2 = temp;
-				temp = maths::cosR(radians) * x3 + -maths::sinR(radians) * y3;
-				y3 = maths::sinR(radians) * x3 + maths::cosR(radians) * y3;
+				temp = c * x3 + -s * y3;
+				y3 = s * x3 + c * y3;
 				x3 = temp;
-				temp = maths::cosR(radians) * x4 + -maths::sinR(radians) * y4;
-				y4 = maths::sinR(radians) * x4 + maths::cosR(radians) * y4;
+				temp = c * x4 + -s * y4;
+				y4 = s * x4 + c * y4;
 				x4 = temp;
 				return *this;
 			}
@@ -758,18 +768,20 @@ namespace clockwork {
 			static Mat4x4<type> rotationD(type degrees, Vec3<type> axis) noexcept
 			{
 				axis.normalizeSelf();
+				type s, c;
+				maths::sincosD(degrees, s, c);
 				return Mat4x4<type> {
-						maths::cosD(degrees) + axis.x * axis.x*( static_cast<type>(1) - maths::cosD(degrees) ),
-						axis.x*axis.y*( static_cast<type>(1) - maths::cosD(degrees) ) - axis.z * maths::sinD(degrees),
-						axis.x*axis.z*( static_cast<type>(1) - maths::cosD(degrees) ) + axis.y * maths::sinD(degrees),
+						c + axis.x * axis.x*( static_cast<type>(1) - c ),
+						axis.x*axis.y*( static_cast<type>(1) - c ) - axis.z * s,
+						axis.x*axis.z*( static_cast<type>(1) - c ) + axis.y * s,
 						0,
-						axis.y*axis.x*( static_cast<type>(1) - maths::cosD(degrees) ) + axis.z * maths::sinD(degrees),
-						maths::cosD(degrees) + axis.y * axis.y*( static_cast<type>(1) - maths::cosD(degrees) ),
-						axis.y*axis.z*( static_cast<type>(1) - maths::cosD(degrees) ) - axis.x * maths::sinD(degrees),
+						axis.y*axis.x*( static_cast<type>(1) - c ) + axis.z * s,
+						c + axis.y * axis.y*( static_cast<type>(1) - c ),
+						axis.y*axis.z*( static_cast<type>(1) - c ) - axis.x * s,
 						0,
-						axis.z*axis.x*( static_cast<type>(1) - maths::cosD(degrees) ) - axis.y * maths::sinD(degrees),
-						axis.z*axis.y*( static_cast<type>(1) - maths::cosD(degrees) ) + axis.x * maths::sinD(degrees),
-						maths::cosD(degrees) + axis.z * axis.z*( static_cast<type>(1) - maths::cosD(degrees) ),
+						axis.z*axis.x*( static_cast<type>(1) - c ) - axis.y * s,
+						axis.z*axis.y*( static_cast<type>(1) - c ) + axis.x * s,
+						c + axis.z * axis.z*( static_cast<type>(1) - c ),
 						0,
 						0,
 						0,
@@ -781,18 +793,20 @@ namespace clockwork {
 			static Mat4x4<type> rotationR(type radians, Vec3<type> axis) noexcept
 			{
 				axis.normalizeSelf();
+				type s, c;
+				maths::sincos(radians, s, c);
 				return Mat4x4<type> {
-						maths::cosR(radians) + axis.x * axis.x*( 1 - maths::cosR(radians) ),
-						axis.x*axis.y*( 1 - maths::cosR(radians) ) - axis.z * maths::sinR(radians),
-						axis.x*axis.z*( 1 - maths::cosR(radians) ) + axis.y * maths::sinR(radians),
+						c + axis.x * axis.x*( 1 - c ),
+						axis.x*axis.y*( 1 - c ) - axis.z * s,
+						axis.x*axis.z*( 1 - c ) + axis.y * s,
 						0,
-						axis.y*axis.x*( 1 - maths::cosR(radians) ) + axis.z * maths::sinR(radians),
-						maths::cosR(radians) + axis.y * axis.y*( 1 - maths::cosR(radians) ),
-						axis.y*axis.z*( 1 - maths::cosR(radians) ) - axis.x * maths::sinR(radians),
+						axis.y*axis.x*( 1 - c ) + axis.z * s,
+						c + axis.y * axis.y*( 1 - c ),
+						axis.y*axis.z*( 1 - c ) - axis.x * s,
 						0,
-						axis.z*axis.x*( 1 - maths::cosR(radians) ) - axis.y * maths::sinR(radians),
-						axis.z*axis.y*( 1 - maths::cosR(radians) ) + axis.x * maths::sinR(radians),
-						maths::cosR(radians) + axis.z * axis.z*( 1 - maths::cosR(radians) ),
+						axis.z*axis.x*( 1 - c ) - axis.y * s,
+						axis.z*axis.y*( 1 - c ) + axis.x * s,
+						c + axis.z * axis.z*( 1 - c ),
 						0,
 						0,
 						0,
@@ -817,7 +831,7 @@ namespace clockwork {
 			
 			orthographic projection matrix: cube like frustum box for clipping space between 2 planes(near and far) with a width/height | does not change the w component for scaling of each vector(leaves it at 1) | all objects have the same size | better for 2d
 			left(x), right(x+width), bottom(y), top(y+height) are the 4 points that define the size of the near/far planes and the parameter near(z)/far(z+depth) define the distance between the planes */
-			static Mat4x4<type> orthographic(type left, type right, type bottom, type top, type near1, type far1)
+			static constexpr Mat4x4<type> orthographic(type left, type right, type bottom, type top, type near1, type far1) noexcept
 			{
 				return Mat4x4<type>{
 						static_cast<type>( 2 ) / ( right - left ), 0, 0, -( right + left ) / ( right - left ),
@@ -846,7 +860,7 @@ namespace clockwork {
 			@param[fov] angle in degrees of the field of view defines how large the viewspace is | realistic would be 45 degrees, but can be bigger for a bigger viewspace(90, 120, etc)
 			@param[aspect] the screen ratio | divide viewport width by its height to get the aspect ratio(screen size in pixel) | so this matrix has to be recalculated when the window is resized and the viewport changed
 			@param[near1/far1] the z coordinates of the planes of the frustum to get the distance */
-			static Mat4x4<type> perspective(type fov, type aspect, type near1, type far1)
+			static constexpr Mat4x4<type> perspective(type fov, type aspect, type near1, type far1) noexcept
 			{
 				type tan = maths::tanR(fov / static_cast<type>( 2 ));
 				return Mat4x4<type>{
@@ -884,7 +898,7 @@ namespace clockwork {
 			the absolut value of the determinant describes the volume/area of the matrix | det(mat1*mat2) = det(mat1)*det(mat2) | det(value*mat) = value^n * det(mat) n=number of rows/columns 
 			the determinant of 2 matrices is the same, if the rows and columns swap values(like turning the matrix diagonal)
 			*/
-			type determinant() noexcept
+			type determinant() const noexcept
 			{
 				/*2x2 return (x1*y2-x2*y1);*/
 				/*3x3 return x1*y2*z3 + x2*y3*z1 + x3*y1*z2 - x3*y2*z1 - x1*y3*z2 - x1*y1*z3    */
@@ -902,7 +916,13 @@ namespace clockwork {
 			returns a copy of the matrix and does not modify this matrix | the number of rows have to be the same as the number of columns, so it has to be a square matrix and the determinant has to be not zero
 			newmat = this * this; | identity^-1 = identity | (mat^-1)^-1=mat | (mat1*mat2)^-1 = mat1^-1*mat2^-1 | (mat^n)^-1 = (mat^-1)^n
 			*/
-			Mat4x4<type> inverse() noexcept
+			Mat4x4<type> inverse() const noexcept
+			{
+				return genericInverse();
+			}
+
+			//the per element inverse for every type | inverse() is specialised for Mat4f like product()
+			Mat4x4<type> genericInverse() const noexcept
 			{
 				/*2x2
 				return Mat2x2<type>(y2,-x2,-y1,x1).multiply( 1/determinant() );
@@ -932,6 +952,44 @@ namespace clockwork {
 					x2 * y3*z1 - x3 * y2*z1 + x3 * y1*z2 - x1 * y3*z2 - x2 * y1*z3 + x1 * y2*z3).multiply(static_cast<type>(1) / determinant());
 			}
 
+			/*returns the inverse of an affine matrix(translation, rotation and scaling, but no projection) | the fourth row has to be 0,0,0,1 and the upper 3x3 part must not have a determinant of zero
+			it is cheaper than inverse(), because only the 3x3 part is inverted and the translation is transformed by it: (T*M)^-1 = M^-1 * -T | for example for modelmatrices and viewmatrices*/
+			Mat4x4<type> affineInverse() const noexcept
+			{
+				return genericAffineInverse();
+			}
+
+			//the per element affine inverse for every type | affineInverse() is specialised for Mat4f like product()
+			Mat4x4<type> genericAffineInverse() const noexcept
+			{
+				//the rows of the inverse 3x3 part are the crossproducts of the columns divided by the determinant
+				const type i11 = y2 * z3 - z2 * y3, i12 = z2 * x3 - x2 * z3, i13 = x2 * y3 - y2 * x3;
+				const type i21 = y3 * z1 - z3 * y1, i22 = z3 * x1 - x3 * z1, i23 = x3 * y1 - y3 * x1;
+				const type i31 = y1 * z2 - z1 * y2, i32 = z1 * x2 - x1 * z2, i33 = x1 * y2 - y1 * x2;
+				const type inv = static_cast<type>( 1 ) / ( x1 * i11 + y1 * i12 + z1 * i13 );
+				return Mat4x4<type>(
+					i11 * inv, i12 * inv, i13 * inv, -( i11 * x4 + i12 * y4 + i13 * z4 ) * inv,
+					i21 * inv, i22 * inv, i23 * inv, -( i21 * x4 + i22 * y4 + i23 * z4 ) * inv,
+					i31 * inv, i32 * inv, i33 * inv, -( i31 * x4 + i32 * y4 + i33 * z4 ) * inv,
+					0, 0, 0, 1);
+			}
+
+			/*returns the transposed matrix, where the rows and the columns are swapped(x2 becomes y1, etc) | for a pure rotation matrix the transposed matrix is also the inverse matrix*/
+			Mat4x4<type> transpose() const noexcept
+			{
+				return genericTranspose();
+			}
+
+			//the per element transpose for every type | transpose() is specialised for Mat4f like product()
+			Mat4x4<type> genericTranspose() const noexcept
+			{
+				return Mat4x4<type>(
+					x1, y1, z1, w1,
+					x2, y2, z2, w2,
+					x3, y3, z3, w3,
+					x4, y4, z4, w4);
+			}
+
 			/*multiplies the matrix n times with itself | use this method instead of this*=this; | scalar product matrix-matrix multiplication, not elementwise multiplication | use the multiply method for the elementwise multiplication
 			returns a copy of the matrix and does not modify this matrix | mat^0 = identity | m1^n * m2^n = (m1*m2)^n | determinant(mat^n)= det(mat)^n | only use positive count numbers and dont use 0
 			the number of rows have to be the same as the number of columns, so it has to be a square matrix
@@ -1074,6 +1132,68 @@ namespace clockwork {
 
 
 		public:
+			/*scalar product matrix-matrix multiplication left*right | used by all operators * and *= of two matrices | this is the generic per element version, for Mat4f it is specialised with sse/avx in Mat4x4Simd.h when CLOCKWORK_SIMD is enabled(see Simd.h)
+			the generic version is still available as genericProduct() for every type*/
+			static Mat4x4<type> product(const Mat4x4<type>& left, const Mat4x4<type>& right) noexcept
+			{
+				return genericProduct(left, right);
+			}
+			//the per element scalar product matrix-matrix multiplication left*right for every type
+			static Mat4x4<type> genericProduct(const Mat4x4<type>& left, const Mat4x4<type>& right) noexcept
+			{
+				//the constructor takes the values row per row
+				return Mat4x4<type>{
+					left.x1 * right.x1 + left.x2 * right.y1 + left.x3 * right.z1 + left.x4 * right.w1,//new x1: first row of left mat times first column of right mat
+					left.x1 * right.x2 + left.x2 * right.y2 + left.x3 * right.z2 + left.x4 * right.w2,//new x2: first row of left mat times second column of right mat
+					left.x1 * right.x3 + left.x2 * right.y3 + left.x3 * right.z3 + left.x4 * right.w3,//new x3: first row of left mat times third column of right mat
+					left.x1 * right.x4 + left.x2 * right.y4 + left.x3 * right.z4 + left.x4 * right.w4,//new x4: first row of left mat times fourth column of right mat
+
+					left.y1 * right.x1 + left.y2 * right.y1 + left.y3 * right.z1 + left.y4 * right.w1,//new y1: second row of left mat times first column of right mat
+					left.y1 * right.x2 + left.y2 * right.y2 + left.y3 * right.z2 + left.y4 * right.w2,//new y2: second row of left mat times second column of right mat
+					left.y1 * right.x3 + left.y2 * right.y3 + left.y3 * right.z3 + left.y4 * right.w3,//new y3: second row of left mat times third column of right mat
+					left.y1 * right.x4 + left.y2 * right.y4 + left.y3 * right.z4 + left.y4 * right.w4,//new y4: second row of left mat times fourth column of right mat
+
+					left.z1 * right.x1 + left.z2 * right.y1 + left.z3 * right.z1 + left.z4 * right.w1,//new z1: third row of left mat times first column of right mat
+					left.z1 * right.x2 + left.z2 * right.y2 + left.z3 * right.z2 + left.z4 * right.w2,//new z2: third row of left mat times second column of right mat
+					left.z1 * right.x3 + left.z2 * right.y3 + left.z3 * right.z3 + left.z4 * right.w3,//new z3: third row of left mat times third column of right mat
+					left.z1 * right.x4 + left.z2 * right.y4 + left.z3 * right.z4 + left.z4 * right.w4,//new z4: third row of left mat times fourth column of right mat
+
+					left.w1 * right.x1 + left.w2 * right.y1 + left.w3 * right.z1 + left.w4 * right.w1,//new w1: fourth row of left mat times first column of right mat
+					left.w1 * right.x2 + left.w2 * right.y2 + left.w3 * right.z2 + left.w4 * right.w2,//new w2: fourth row of left mat times second column of right mat
+					left.w1 * right.x3 + left.w2 * right.y3 + left.w3 * right.z3 + left.w4 * right.w3,//new w3: fourth row of left mat times third column of right mat
+					left.w1 * right.x4 + left.w2 * right.y4 + left.w3 * right.z4 + left.w4 * right.w4//new w4: fourth row of left mat times fourth column of right mat
+				};
+			}
+			//transforms the vector with the matrix left*right | used by the operators * of a matrix and a Vec4 | specialised for Mat4f like product()
+			static Vec4<type> transform(const Mat4x4<type>& left, const Vec4<type>& right) noexcept
+			{
+				return genericTransform(left, right);
+			}
+			//transforms the vector as position(w=1) with the matrix left*right | used by the operators * of a matrix and a Vec3 | specialised for Mat4f like product()
+			static Vec3<type> transform(const Mat4x4<type>& left, const Vec3<type>& right) noexcept
+			{
+				return genericTransform(left, right);
+			}
+			//the per element matrix-vector multiplication left*right for every type
+			static Vec4<type> genericTransform(const Mat4x4<type>& left, const Vec4<type>& right) noexcept
+			{
+				return Vec4<type>{
+					left.x1 * right.x + left.x2 * right.y + left.x3 * right.z + left.x4 * right.w,//new x1: first row of left mat times first column of right mat
+					left.y1 * right.x + left.y2 * right.y + left.y3 * right.z + left.y4 * right.w,//new y1: second row of left mat times first column of right mat   
+					left.z1 * right.x + left.z2 * right.y + left.z3 * right.z + left.z4 * right.w,//new z1: third row of left mat times first column of right mat
+					left.w1 * right.x + left.w2 * right.y + left.w3 * right.z + left.w4 * right.w//new w1: fourth row of left mat times first column of right mat   
+				};
+			}
+			//the per element matrix-vector multiplication left*right with w=1 for every type
+			static Vec3<type> genericTransform(const Mat4x4<type>& left, const Vec3<type>& right) noexcept
+			{
+				return Vec3<type>{
+					left.x1 * right.x + left.x2 * right.y + left.x3 * right.z + left.x4,//new x1: first row of left mat times first column of right mat
+					left.y1 * right.x + left.y2 * right.y + left.y3 * right.z + left.y4,//new y1: second row of left mat times first column of right mat   
+					left.z1 * right.x + left.z2 * right.y + left.z3 * right.z + left.z4//new z1: third row of left mat times first column of right mat
+				};
+			}
+
 			/*multiply another matrix to this matrix | scalar product matrix-matrix multiplication, not elementwise multiplication | use the multiply method for the elementwise multiplication | DO NOT MULTIPLY A MATRIX WITH ITSELF, IT WILL DESTROY THE MATRIX, use the square method instead
 			this matrix is the right side matrix in the multiplication and this(right side matrix) will be modified by the multiplication | so this = other*this;
 			matrix multiplication is not commutative: a*b is not equal to b*a | but matrix multiplication is associative: (a*b)*c is equal to a*(b*c) | also (a+b) * c is equal to a*c + b*c and a * (b+c) is equal to a*b + a*c
@@ -1084,29 +1204,7 @@ namespace clockwork {
 			the resulting matrix has the dimension(n,m) with the number of rows of the left side matrix(n) and the number of columns of the right side matrix(m) */
 			Mat4x4<type>& operator*=(const Mat4x4<type>& left) noexcept
 			{
-				type temp1 = left.x1 * x1 + left.x2 * y1 + left.x3 * z1 + left.x4 * w1;//new x1: first row of left mat times first column of right mat
-				type temp2 = left.y1 * x1 + left.y2 * y1 + left.y3 * z1 + left.y4 * w1;//new y1: second row of left mat times first column of right mat   
-				type temp3 = left.z1 * x1 + left.z2 * y1 + left.z3 * z1 + left.z4 * w1;//new z1: third row of left mat times first column of right mat   
-				w1 = left.w1 * x1 + left.w2 * y1 + left.w3 * z1 + left.w4 * w1;//new w1: fourth row of left mat times first column of right mat   
-				x1 = temp1; y1 = temp2; z1 = temp3;
-
-				temp1 = left.x1 * x2 + left.x2 * y2 + left.x3 * z2 + left.x4 * w2;//new x2: first row of left mat times second column of right mat
-				temp2 = left.y1 * x2 + left.y2 * y2 + left.y3 * z2 + left.y4 * w2;//new y2: second row of left mat times second column of right mat   
-				temp3 = left.z1 * x2 + left.z2 * y2 + left.z3 * z2 + left.z4 * w2;//new z2: third row of left mat times second column of right mat   
-				w2 = left.w1 * x2 + left.w2 * y2 + left.w3 * z2 + left.w4 * w2;//new w2: fourth row of left mat times second column of right mat   
-				x2 = temp1; y2 = temp2; z2 = temp3;
-
-				temp1 = left.x1 * x3 + left.x2 * y3 + left.x3 * z3 + left.x4 * w3;//new x3: first row of left mat times third column of right mat
-				temp2 = left.y1 * x3 + left.y2 * y3 + left.y3 * z3 + left.y4 * w3;//new y3: second row of left mat times third column of right mat   
-				temp3 = left.z1 * x3 + left.z2 * y3 + left.z3 * z3 + left.z4 * w3;//new z3: third row of left mat times third column of right mat   
-				w3 = left.w1 * x3 + left.w2 * y3 + left.w3 * z3 + left.w4 * w3;//new w3: fourth row of left mat times third column of right mat   
-				x3 = temp1; y3 = temp2; z3 = temp3;
-
-				temp1 = left.x1 * x4 + left.x2 * y4 + left.x3 * z4 + left.x4 * w4;//new x4: first row of left mat times fourth column of right mat
-				temp2 = left.y1 * x4 + left.y2 * y4 + left.y3 * z4 + left.y4 * w4;//new y4: second row of left mat times fourth column of right mat  
-				temp3 = left.z1 * x4 + left.z2 * y4 + left.z3 * z4 + left.z4 * w4;//new z4: third row of left mat times fourth column of right mat   
-				w4 = left.w1 * x4 + left.w2 * y4 + left.w3 * z4 + left.w4 * w4;//new w4: fourth row of left mat times fourth column of right mat   
-				x4 = temp1; y4 = temp2; z4 = temp3;
+				*this = product(left, *this);
 				return *this;
 			}
 
@@ -1141,155 +1239,12 @@ namespace clockwork {
 			the resulting matrix has the dimension(n,m) with the number of rows of the left side matrix(n) and the number of columns of the right side matrix(m) */
 			friend Mat4x4<type> operator*(const Mat4x4<type>& left, const Mat4x4<type>& right) noexcept
 			{
-				return Mat4x4<type>{
-					left.x1 * right.x1 + left.x2 * right.y1 + left.x3 * right.z1 + left.x4 * right.w1,//new x1: first row of left mat times first column of right mat
-					left.y1 * right.x1 + left.y2 * right.y1 + left.y3 * right.z1 + left.y4 * right.w1,//new y1: second row of left mat times first column of right mat   
-					left.z1 * right.x1 + left.z2 * right.y1 + left.z3 * right.z1 + left.z4 * right.w1,//new z1: third row of left mat times first column of right mat   
-					left.w1 * right.x1 + left.w2 * right.y1 + left.w3 * right.z1 + left.w4 * right.w1,//new w1: fourth row of left mat times first column of right mat
-
-					left.x1 * right.x2 + left.x2 * right.y2 + left.x3 * right.z2 + left.x4 * right.w2,//new x2: first row of left mat times second column of right mat
-					left.y1 * right.x2 + left.y2 * right.y2 + left.y3 * right.z2 + left.y4 * right.w2,//new y2: second row of left mat times second column of right mat   
-					left.z1 * right.x2 + left.z2 * right.y2 + left.z3 * right.z2 + left.z4 * right.w2,//new z2: third row of left mat times second column of right mat   
-					left.w1 * right.x2 + left.w2 * right.y2 + left.w3 * right.z2 + left.w4 * right.w2,//new w2: fourth row of left mat times second column of right mat   
-
-					left.x1 * right.x3 + left.x2 * right.y3 + left.x3 * right.z3 + left.x4 * right.w3,//new x3: first row of left mat times third column of right mat
-					left.y1 * right.x3 + left.y2 * right.y3 + left.y3 * right.z3 + left.y4 * right.w3,//new y3: second row of left mat times third column of right mat   
-					left.z1 * right.x3 + left.z2 * right.y3 + left.z3 * right.z3 + left.z4 * right.w3,//new z3: third row of left mat times third column of right mat   
-					left.w1 * right.x3 + left.w2 * right.y3 + left.w3 * right.z3 + left.w4 * right.w3,//new w3: fourth row of left mat times third column of right mat   
-
-					left.x1 * right.x4 + left.x2 * right.y4 + left.x3 * right.z4 + left.x4 * right.w4,//new x4: first row of left mat times fourth column of right mat
-					left.y1 * right.x4 + left.y2 * right.y4 + left.y3 * right.z4 + left.y4 * right.w4,//new y4: second row of left mat times fourth column of right mat  
-					left.z1 * right.x4 + left.z2 * right.y4 + left.z3 * right.z4 + left.z4 * right.w4,//new z4: third row of left mat times fourth column of right mat   
-					left.w1 * right.x4 + left.w2 * right.y4 + left.w3 * right.z4 + left.w4 * right.w4//new w4: fourth row of left mat times fourth column of right mat   
-				};
+				return product(left, right);
 			}
 
-			/*multiply a rvalue matrix to another lvalue matrix | scalar product matrix-matrix multiplication, not elementwise multiplication | use the multiply method for the elementwise multiplication | DO NOT MULTIPLY A MATRIX WITH ITSELF, IT WILL DESTROY THE MATRIX, use the square method instead
-			the left matrix is multiplied to the right side matrix and the left sside matrix is returned | result = left*right;
-			matrix multiplication is not commutative: a*b is not equal to b*a | but matrix multiplication is associative: (a*b)*c is equal to a*(b*c) | also (a+b) * c is equal to a*c + b*c and a * (b+c) is equal to a*b + a*c
-			the order of matrix multiplication is important because its not commutative, so the left matrix is always multiplied/applied to the right matrix and if you apply more matrices to a vector, the most right matrix is always first multiplied to the vector and you should read the multiplication from right to left, because all the left matrices affect all the right matrices
-			it is advised to first do scaling, then rotations and then translations, otherwise they might negatively affect each other(for example first translate, then scale would also scale the translation) | the order here is from right to left(because the left matrix is multiplied to the right): translation * rotations * scale * vector; is the right way to first scale the vector and lastly apply the translation
-			you can also do first matrix = scaling; then matrix*=rotation; and then matrix*=translation; because the operator*= always multiplies the right matrix of the assignment to the left matrix(this) and therefor the order is correct: first scaling, then rotation and then translation | important: the left matrix of the assignment with *=(the this object) is logicly the right side matrix of the multiplication 
-			you can only multiply two matrices if the number of columns on the left side matrix is equal to the number of rows on the right side matrix | mat(m,n) * mat(i,j) only if n is equal to i
-			the resulting matrix has the dimension(n,m) with the number of rows of the left side matrix(n) and the number of columns of the right side matrix(m) */
-			friend Mat4x4<type>&& operator*(Mat4x4<type>&& left, const Mat4x4<type>& right) noexcept
-			{
-				type temp1 = left.x1 * right.x1 + left.x2 * right.y1 + left.x3 * right.z1 + left.x4 * right.w1;//new x1: first row of left mat times first column of right mat
-				type temp2 = left.x1 * right.x2 + left.x2 * right.y2 + left.x3 * right.z2 + left.x4 * right.w2;//new x2: first row of left mat times second column of right mat
-				type temp3 = left.x1 * right.x3 + left.x2 * right.y3 + left.x3 * right.z3 + left.x4 * right.w3;//new x3: first row of left mat times third column of right mat
-				left.x4 = left.x1 * right.x4 + left.x2 * right.y4 + left.x3 * right.z4 + left.x4 * right.w4;//new x4: first row of left mat times fourth column of right mat
-				left.x1 = temp1; left.x2 = temp2; left.x3 = temp3;
-
-				temp1 = left.y1 * right.x1 + left.y2 * right.y1 + left.y3 * right.z1 + left.y4 * right.w1;//new y1: second row of left mat times first column of right mat   
-				temp2 = left.y1 * right.x2 + left.y2 * right.y2 + left.y3 * right.z2 + left.y4 * right.w2;//new y2: second row of left mat times second column of right mat   
-				temp3 = left.y1 * right.x3 + left.y2 * right.y3 + left.y3 * right.z3 + left.y4 * right.w3;//new y3: second row of left mat times third column of right mat   
-				left.y4 = left.y1 * right.x4 + left.y2 * right.y4 + left.y3 * right.z4 + left.y4 * right.w4;//new y4: second row of left mat times fourth column of right mat  
-				left.y1 = temp1; left.y2 = temp2; left.y3 = temp3;
-
-				temp1 = left.z1 * right.x1 + left.z2 * right.y1 + left.z3 * right.z1 + left.z4 * right.w1;//new z1: third row of left mat times first column of right mat
-				temp2 = left.z1 * right.x2 + left.z2 * right.y2 + left.z3 * right.z2 + left.z4 * right.w2;//new z2: third row of left mat times second column of right mat 
-				temp3 = left.z1 * right.x3 + left.z2 * right.y3 + left.z3 * right.z3 + left.z4 * right.w3;//new z3: third row of left mat times third column of right mat   
-				left.z4 = left.z1 * right.x4 + left.z2 * right.y4 + left.z3 * right.z4 + left.z4 * right.w4;//new z4: third row of left mat times fourth column of right mat   
-				left.z1 = temp1; left.z2 = temp2; left.z3 = temp3;
-
-				temp1 = left.w1 * right.x1 + left.w2 * right.y1 + left.w3 * right.z1 + left.w4 * right.w1;//new w1: fourth row of left mat times first column of right mat   
-				temp2 = left.w1 * right.x2 + left.w2 * right.y2 + left.w3 * right.z2 + left.w4 * right.w2;//new w2: fourth row of left mat times second column of right mat   
-				temp3 = left.w1 * right.x3 + left.w2 * right.y3 + left.w3 * right.z3 + left.w4 * right.w3;//new w3: fourth row of left mat times third column of right mat   
-				left.w4 = left.w1 * right.x4 + left.w2 * right.y4 + left.w3 * right.z4 + left.w4 * right.w4;//new w4: fourth row of left mat times fourth column of right mat   
-				left.w1 = temp1; left.w2 = temp2; left.w3 = temp3;
-				return std::move(left);
-			}
 
-			/*multiply a lvalue matrix to another rvalue matrix | scalar product matrix-matrix multiplication, not elementwise multiplication | use the multiply method for the elementwise multiplication | DO NOT MULTIPLY A MATRIX WITH ITSELF, IT WILL DESTROY THE MATRIX, use the square method instead
-			the left matrix is multiplied to the right side matrix and the right side matrix is returned | result = left*right;
-			matrix multiplication is not commutative: a*b is not equal to b*a | but matrix multiplication is associative: (a*b)*c is equal to a*(b*c) | also (a+b) * c is equal to a*c + b*c and a * (b+c) is equal to a*b + a*c
-			the order of matrix multiplication is important because its not commutative, so the left matrix is always multiplied/applied to the right matrix and if you apply more matrices to a vector, the most right matrix is always first multiplied to the vector and you should read the multiplication from right to left, because all the left matrices affect all the right matrices
-			it is advised to first do scaling, then rotations and then translations, otherwise they might negatively affect each other(for example first translate, then scale would also scale the translation) | the order here is from right to left(because the left matrix is multiplied to the right): translation * rotations * scale * vector; is the right way to first scale the vector and lastly apply the translation
-			you can also do first matrix = scaling; then matrix*=rotation; and then matrix*=translation; because the operator*= always multiplies the right matrix of the assignment to the left matrix(this) and therefor the order is correct: first scaling, then rotation and then translation | important: the left matrix of the assignment with *=(the this object) is logicly the right side matrix of the multiplication 
-			you can only multiply two matrices if the number of columns on the left side matrix is equal to the number of rows on the right side matrix | mat(m,n) * mat(i,j) only if n is equal to i
-			the resulting matrix has the dimension(n,m) with the number of rows of the left side matrix(n) and the number of columns of the right side matrix(m) */
-			friend Mat4x4<type>&& operator*(const Mat4x4<type>& left, Mat4x4<type>&& right) noexcept
-			{
-				type temp1 = left.x1 * right.x1 + left.x2 * right.y1 + left.x3 * right.z1 + left.x4 * right.w1;//new x1: first row of left mat times first column of right mat
-				type temp2 = left.y1 * right.x1 + left.y2 * right.y1 + left.y3 * right.z1 + left.y4 * right.w1;//new y1: second row of left mat times first column of right mat   
-				type temp3 = left.z1 * right.x1 + left.z2 * right.y1 + left.z3 * right.z1 + left.z4 * right.w1;//new z1: third row of left mat times first column of right mat
-				right.w1 = left.w1 * right.x1 + left.w2 * right.y1 + left.w3 * right.z1 + left.w4 * right.w1;//new w1: fourth row of left mat times first column of right mat   
-				right.x1 = temp1; right.y1 = temp2; right.z1 = temp3;
-
-				temp1 = left.x1 * right.x2 + left.x2 * right.y2 + left.x3 * right.z2 + left.x4 * right.w2;//new x2: first row of left mat times second column of right mat
-				temp2 = left.y1 * right.x2 + left.y2 * right.y2 + left.y3 * right.z2 + left.y4 * right.w2;//new y2: second row of left mat times second column of right mat   
-				temp3 = left.z1 * right.x2 + left.z2 * right.y2 + left.z3 * right.z2 + left.z4 * right.w2;//new z2: third row of left mat times second column of right mat 
-				right.w2 = left.w1 * right.x2 + left.w2 * right.y2 + left.w3 * right.z2 + left.w4 * right.w2;//new w2: fourth row of left mat times second column of right mat   
-				right.x2 = temp1; right.y2 = temp2; right.z2 = temp3;
-
-				temp1 = left.x1 * right.x3 + left.x2 * right.y3 + left.x3 * right.z3 + left.x4 * right.w3;//new x3: first row of left mat times third column of right mat
-				temp2 = left.y1 * right.x3 + left.y2 * right.y3 + left.y3 * right.z3 + left.y4 * right.w3;//new y3: second row of left mat times third column of right mat   
-				temp3 = left.z1 * right.x3 + left.z2 * right.y3 + left.z3 * right.z3 + left.z4 * right.w3;//new z3: third row of left mat times third column of right mat   
-				right.w3 = left.w1 * right.x3 + left.w2 * right.y3 + left.w3 * right.z3 + left.w4 * right.w3;//new w3: fourth row of left mat times third column of right mat   
-				right.x3 = temp1; right.y3 = temp2; right.z3 = temp3;
-
-				temp1 = left.x1 * right.x4 + left.x2 * right.y4 + left.x3 * right.z4 + left.x4 * right.w4;//new x4: first row of left mat times fourth column of right mat
-				temp2 = left.y1 * right.x4 + left.y2 * right.y4 + left.y3 * right.z4 + left.y4 * right.w4;//new y4: second row of left mat times fourth column of right mat  
-				temp3 = left.z1 * right.x4 + left.z2 * right.y4 + left.z3 * right.z4 + left.z4 * right.w4;//new z4: third row of left mat times fourth column of right mat   
-				right.w4 = left.w1 * right.x4 + left.w2 * right.y4 + left.w3 * right.z4 + left.w4 * right.w4;//new w4: fourth row of left mat times fourth column of right mat   
-				right.x4 = temp1; right.y4 = temp2; right.z4 = temp3;
-				return std::move(right);
-			}
 
-			/*multiply a rvalue matrix to another rvalue matrix | scalar product matrix-matrix multiplication, not elementwise multiplication | use the multiply method for the elementwise multiplication | DO NOT MULTIPLY A MATRIX WITH ITSELF, IT WILL DESTROY THE MATRIX, use the square method instead
-			the left matrix is multiplied to the right side matrix and the right side matrix is returned | result = left*right;
-			matrix multiplication is not commutative: a*b is not equal to b*a | but matrix multiplication is associative: (a*b)*c is equal to a*(b*c) | also (a+b) * c is equal to a*c + b*c and a * (b+c) is equal to a*b + a*c
-			the order of matrix multiplication is important because its not commutative, so the left matrix is always multiplied/applied to the right matrix and if you apply more matrices to a vector, the most right matrix is always first multiplied to the vector and you should read the multiplication from right to left, because all the left matrices affect all the right matrices
-			it is advised to first do scaling, then rotations and then translations, otherwise they might negatively affect each other(for example first translate, then scale would also scale the translation) | the order here is from right to left(because the left matrix is multiplied to the right): translation * rotations * scale * vector; is the right way to first scale the vector and lastly apply the translation
-			you can also do first matrix = scaling; then matrix*=rotation; and then matrix*=translation; because the operator*= always multiplies the right matrix of the assignment to the left matrix(this) and therefor the order is correct: first scaling, then rotation and then translation | important: the left matrix of the assignment with *=(the this object) is logicly the right side matrix of the multiplication 
-			you can only multiply two matrices if the number of columns on the left side matrix is equal to the number of rows on the right side matrix | mat(m,n) * mat(i,j) only if n is equal to i
-			the resulting matrix has the dimension(n,m) with the number of rows of the left side matrix(n) and the number of columns of the right side matrix(m) */
-			friend Mat4x4<type>&& operator*(Mat4x4<type>&& left, Mat4x4<type>&& right) noexcept
-			{
-				type temp1 = left.x1 * right.x1 + left.x2 * right.y1 + left.x3 * right.z1 + left.x4 * right.w1;//new x1: first row of left mat times first column of right mat
-				type temp2 = left.y1 * right.x1 + left.y2 * right.y1 + left.y3 * right.z1 + left.y4 * right.w1;//new y1: second row of left mat times first column of right mat   
-				type temp3 = left.z1 * right.x1 + left.z2 * right.y1 + left.z3 * right.z1 + left.z4 * right.w1;//new z1: third row of left mat times first column of right mat
-				right.w1 = left.w1 * right.x1 + left.w2 * right.y1 + left.w3 * right.z1 + left.w4 * right.w1;//new w1: fourth row of left mat times first column of right mat   
-				right.x1 = temp1; right.y1 = temp2; right.z1 = temp3;
-
-				temp1 = left.x1 * right.x2 + left.x2 * right.y2 + left.x3 * right.z2 + left.x4 * right.w2;//new x2: first row of left mat times second column of right mat
-				temp2 = left.y1 * right.x2 + left.y2 * right.y2 + left.y3 * right.z2 + left.y4 * right.w2;//new y2: second row of left mat times second column of right mat   
-				temp3 = left.z1 * right.x2 + left.z2 * right.y2 + left.z3 * right.z2 + left.z4 * right.w2;//new z2: third row of left mat times second column of right mat 
-				right.w2 = left.w1 * right.x2 + left.w2 * right.y2 + left.w3 * right.z2 + left.w4 * right.w2;//new w2: fourth row of left mat times second column of right mat   
-				right.x2 = temp1; right.y2 = temp2; right.z2 = temp3;
-
-				temp1 = left.x1 * right.x3 + left.x2 * right.y3 + left.x3 * right.z3 + left.x4 * right.w3;//new x3: first row of left mat times third column of right mat
-				temp2 = left.y1 * right.x3 + left.y2 * right.y3 + left.y3 * right.z3 + left.y4 * right.w3;//new y3: second row of left mat times third column of right mat   
-				temp3 = left.z1 * right.x3 + left.z2 * right.y3 + left.z3 * right.z3 + left.z4 * right.w3;//new z3: third row of left mat times third column of right mat   
-				right.w3 = left.w1 * right.x3 + left.w2 * right.y3 + left.w3 * right.z3 + left.w4 * right.w3;//new w3: fourth row of left mat times third column of right mat   
-				right.x3 = temp1; right.y3 = temp2; right.z3 = temp3;
-
-				temp1 = left.x1 * right.x4 + left.x2 * right.y4 + left.x3 * right.z4 + left.x4 * right.w4;//new x4: first row of left mat times fourth column of right mat
-				temp2 = left.y1 * right.x4 + left.y2 * right.y4 + left.y3 * right.z4 + left.y4 * right.w4;//new y4: second row of left mat times fourth column of right mat  
-				temp3 = left.z1 * right.x4 + left.z2 * right.y4 + left.z3 * right.z4 + left.z4 * right.w4;//new z4: third row of left mat times fourth column of right mat   
-				right.w4 = left.w1 * right.x4 + left.w2 * right.y4 + left.w3 * right.z4 + left.w4 * right.w4;//new w4: fourth row of left mat times fourth column of right mat   
-				right.x4 = temp1; right.y4 = temp2; right.z4 = temp3;
-				return std::move(right);
-			}
 
-			/*multiply a matrix to a rvalue vector | scalar product matrix-matrix multiplication, not elementwise multiplication | use the multiply method for the elementwise multiplication | DO NOT MULTIPLY A MATRIX WITH ITSELF, IT WILL DESTROY THE MATRIX, use the square method instead
-			the left matrix is multiplied to the right vector and the right side vector is returned | result = left*right; 
-			with vectors its almost the same, its just a matrix with 1 column and the matrix transforms the vector with translation, rotation, scaling, etc | translation(x4/y4/z4 of Mat4x4) only works on Vec4 with w=1 and not w=0 | when called with Vec3 the w is always 1 | when called with Vec2 the z is always 0 and the w is always one
-			matrix multiplication is not commutative: a*b is not equal to b*a | but matrix multiplication is associative: (a*b)*c is equal to a*(b*c) | also (a+b) * c is equal to a*c + b*c and a * (b+c) is equal to a*b + a*c
-			the order of matrix multiplication is important because its not commutative, so the left matrix is always multiplied/applied to the right matrix and if you apply more matrices to a vector, the most right matrix is always first multiplied to the vector and you should read the multiplication from right to left, because all the left matrices affect all the right matrices
-			it is advised to first do scaling, then rotations and then translations, otherwise they might negatively affect each other(for example first translate, then scale would also scale the translation) | the order here is from right to left(because the left matrix is multiplied to the right): translation * rotations * scale * vector; is the right way to first scale the vector and lastly apply the translation
-			you can also do first matrix = scaling; then matrix*=rotation; and then matrix*=translation; because the operator*= always multiplies the right matrix of the assignment to the left matrix(this) and therefor the order is correct: first scaling, then rotation and then translation | important: the left matrix of the assignment with *=(the this object) is logicly the right side matrix of the multiplication 
-			you can only multiply two matrices if the number of columns on the left side matrix is equal to the number of rows on the right side matrix | mat(m,n) * mat(i,j) only if n is equal to i
-			the resulting matrix has the dimension(n,m) with the number of rows of the left side matrix(n) and the number of columns of the right side matrix(m) */
-			friend Vec4<type>&& operator*(const Mat4x4<type>& left, Vec4<type>&& right) noexcept
-			{
-				type temp1 = left.x1 * right.x + left.x2 * right.y + left.x3 * right.z + left.x4 * right.w;//new x1: first row of left mat times first column of right mat
-				type temp2 = left.y1 * right.x + left.y2 * right.y + left.y3 * right.z + left.y4 * right.w;//new y1: second row of left mat times first column of right mat   
-				type temp3 = left.z1 * right.x + left.z2 * right.y + left.z3 * right.z + left.z4 * right.w;//new z1: third row of left mat times first column of right mat
-				right.w = left.w1 * right.x + left.w2 * right.y + left.w3 * right.z + left.w4 * right.w;//new w1: fourth row of left mat times first column of right mat   
-				right.x = temp1; right.y = temp2; right.z = temp3;
-				return std::move(right);
-			}
 
 			/*multiply a matrix to a rvalue vector | scalar product matrix-matrix multiplication, not elementwise multiplication | use the multiply method for the elementwise multiplication | DO NOT MULTIPLY A MATRIX WITH ITSELF, IT WILL DESTROY THE MATRIX, use the square method instead
 			the left matrix is multiplied to the right vector and a copy of the right side vector is returned | result = left*right;
@@ -1302,31 +1257,9 @@ namespace clockwork {
 			the resulting matrix has the dimension(n,m) with the number of rows of the left side matrix(n) and the number of columns of the right side matrix(m) */
 			friend Vec4<type> operator*(const Mat4x4<type>& left, const Vec4<type>& right) noexcept
 			{
-				return Vec4<type>{
-					left.x1 * right.x + left.x2 * right.y + left.x3 * right.z + left.x4 * right.w,//new x1: first row of left mat times first column of right mat
-					left.y1 * right.x + left.y2 * right.y + left.y3 * right.z + left.y4 * right.w,//new y1: second row of left mat times first column of right mat   
-					left.z1 * right.x + left.z2 * right.y + left.z3 * right.z + left.z4 * right.w,//new z1: third row of left mat times first column of right mat
-					left.w1 * right.x + left.w2 * right.y + left.w3 * right.z + left.w4 * right.w//new w1: fourth row of left mat times first column of right mat   
-				};
+				return transform(left, right);
 			}
 
-			/*multiply a matrix to a rvalue vector | scalar product matrix-matrix multiplication, not elementwise multiplication | use the multiply method for the elementwise multiplication | DO NOT MULTIPLY A MATRIX WITH ITSELF, IT WILL DESTROY THE MATRIX, use the square method instead
-			the left matrix is multiplied to the right vector and the right side vector is returned | result = left*right;
-			with vectors its almost the same, its just a matrix with 1 column and the matrix transforms the vector with translation, rotation, scaling, etc | translation(x4/y4/z4 of Mat4x4) only works on Vec4 with w=1 and not w=0 | when called with Vec3 the w is always 1 | when called with Vec2 the z is always 0 and the w is always one
-			matrix multiplication is not commutative: a*b is not equal to b*a | but matrix multiplication is associative: (a*b)*c is equal to a*(b*c) | also (a+b) * c is equal to a*c + b*c and a * (b+c) is equal to a*b + a*c
-			the order of matrix multiplication is important because its not commutative, so the left matrix is always multiplied/applied to the right matrix and if you apply more matrices to a vector, the most right matrix is always first multiplied to the vector and you should read the multiplication from right to left, because all the left matrices affect all the right matrices
-			it is advised to first do scaling, then rotations and then translations, otherwise they might negatively affect each other(for example first translate, then scale would also scale the translation) | the order here is from right to left(because the left matrix is multiplied to the right): translation * rotations * scale * vector; is the right way to first scale the vector and lastly apply the translation
-			you can also do first matrix = scaling; then matrix*=rotation; and then matrix*=translation; because the operator*= always multiplies the right matrix of the assignment to the left matrix(this) and therefor the order is correct: first scaling, then rotation and then translation | important: the left matrix of the assignment with *=(the this object) is logicly the right side matrix of the multiplication 
-			you can only multiply two matrices if the number of columns on the left side matrix is equal to the number of rows on the right side matrix | mat(m,n) * mat(i,j) only if n is equal to i
-			the resulting matrix has the dimension(n,m) with the number of rows of the left side matrix(n) and the number of columns of the right side matrix(m) */
-			friend Vec3<type>&& operator*(const Mat4x4<type>& left, Vec3<type>&& right) noexcept
-			{
-				type temp1 = left.x1 * right.x + left.x2 * right.y + left.x3 * right.z + left.x4;//new x1: first row of left mat times first column of right mat
-				type temp2 = left.y1 * right.x + left.y2 * right.y + left.y3 * right.z + left.y4;//new y1: second row of left mat times first column of right mat   
-				right.z = left.z1 * right.x + left.z2 * right.y + left.z3 * right.z + left.z4;//new z1: third row of left mat times first column of right mat
-				right.x = temp1; right.y = temp2;
-				return std::move(right);
-			}
 
 			/*multiply a matrix to a rvalue vector | scalar product matrix-matrix multiplication, not elementwise multiplication | use the multiply method for the elementwise multiplication | DO NOT MULTIPLY A MATRIX WITH ITSELF, IT WILL DESTROY THE MATRIX, use the square method instead
 			the left matrix is multiplied to the right vector and a copy of the right side vector is returned | result = left*right;
@@ -1339,29 +1272,9 @@ namespace clockwork {
 			the resulting matrix has the dimension(n,m) with the number of rows of the left side matrix(n) and the number of columns of the right side matrix(m) */
 			friend Vec3<type> operator*(const Mat4x4<type>& left, const Vec3<type>& right) noexcept
 			{
-				return Vec3<type>{
-					left.x1 * right.x + left.x2 * right.y + left.x3 * right.z + left.x4,//new x1: first row of left mat times first column of right mat
-					left.y1 * right.x + left.y2 * right.y + left.y3 * right.z + left.y4,//new y1: second row of left mat times first column of right mat   
-					left.z1 * right.x + left.z2 * right.y + left.z3 * right.z + left.z4//new z1: third row of left mat times first column of right mat
-				};
+				return transform(left, right);
 			}
 
-			/*multiply a matrix to a rvalue vector | scalar product matrix-matrix multiplication, not elementwise multiplication | use the multiply method for the elementwise multiplication | DO NOT MULTIPLY A MATRIX WITH ITSELF, IT WILL DESTROY THE MATRIX, use the square method instead
-			the left matrix is multiplied to the right vector and the right side vector is returned | result = left*right;
-			with vectors its almost the same, its just a matrix with 1 column and the matrix transforms the vector with translation, rotation, scaling, etc | translation(x4/y4/z4 of Mat4x4) only works on Vec4 with w=1 and not w=0 | when called with Vec3 the w is always 1 | when called with Vec2 the z is always 0 and the w is always one
-			matrix multiplication is not commutative: a*b is not equal to b*a | but matrix multiplication is associative: (a*b)*c is equal to a*(b*c) | also (a+b) * c is equal to a*c + b*c and a * (b+c) is equal to a*b + a*c
-			the order of matrix multiplication is important because its not commutative, so the left matrix is always multiplied/applied to the right matrix and if you apply more matrices to a vector, the most right matrix is always first multiplied to the vector and you should read the multiplication from right to left, because all the left matrices affect all the right matrices
-			it is advised to first do scaling, then rotations and then translations, otherwise they might negatively affect each other(for example first translate, then scale would also scale the translation) | the order here is from right to left(because the left matrix is multiplied to the right): translation * rotations * scale * vector; is the right way to first scale the vector and lastly apply the translation
-			you can also do first matrix = scaling; then matrix*=rotation; and then matrix*=translation; because the operator*= always multiplies the right matrix of the assignment to the left matrix(this) and therefor the order is correct: first scaling, then rotation and then translation | important: the left matrix of the assignment with *=(the this object) is logicly the right side matrix of the multiplication 
-			you can only multiply two matrices if the number of columns on the left side matrix is equal to the number of rows on the right side matrix | mat(m,n) * mat(i,j) only if n is equal to i
-			the resulting matrix has the dimension(n,m) with the number of rows of the left side matrix(n) and the number of columns of the right side matrix(m) */
-			friend Vec2<type>&& operator*(const Mat4x4<type>& left, Vec2<type>&& right) noexcept
-			{
-				type temp1 = left.x1 * right.x + left.x2 * right.y + left.x4;//new x1: first row of left mat times first column of right mat
-				right.y = left.y1 * right.x + left.y2 * right.y + left.y4;//new y1: second row of left mat times first column of right mat   
-				right.x = temp1;
-				return std::move(right);
-			}
 
 			/*multiply a matrix to a lvalue vector | scalar product matrix-matrix multiplication, not elementwise multiplication | use the multiply method for the elementwise multiplication | DO NOT MULTIPLY A MATRIX WITH ITSELF, IT WILL DESTROY THE MATRIX, use the square method instead
 			the left matrix is multiplied to the right vector and a copy of the right side vector is returned | result = left*right;
@@ -1429,4 +1342,6 @@ namespace clockwork {
 
 		using Mat4f = Mat4x4<float>;
 	}
-}
\ No newline at end of file
+}
+
+#include "Mat4x4Simd.h"
\ No newline at end of file
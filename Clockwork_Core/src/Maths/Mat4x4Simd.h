@@ -0,0 +1,249 @@
+#pragma once
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "Simd.h"
+#include "Mat4x4.h"
+
+/*the sse/avx specialisations of the Mat4x4<float> kernels, which are used by the operators * and by inverse(), affineInverse() and transpose() | included at the end of Mat4x4.h, so every user of Mat4f gets them
+the matrices are column-major in memory, so every column(x1,y1,z1,w1) is loaded into one register and a product is the sum of the columns of the left matrix multiplied by the broadcasted values of the right column
+only the kernels that are faster than the generic versions for the instruction set are specialised(see the benchmark of Clockwork_Benchmark) | the generic versions(genericProduct(), genericInverse(), etc) stay available for comparisons | the results can differ in the last bits from the generic versions, because the additions happen in another order*/
+#if CLOCKWORK_SIMD_SSE2
+
+namespace clockwork {
+	namespace maths {
+
+		namespace simd {
+
+			//left column * x + left column * y + left column * z + left column * w of the right column
+			inline __m128 combineColumns(__m128 c0, __m128 c1, __m128 c2, __m128 c3, __m128 right) noexcept
+			{
+				__m128 result = _mm_mul_ps(c0, _mm_shuffle_ps(right, right, _MM_SHUFFLE(0, 0, 0, 0)));
+				result = _mm_add_ps(result, _mm_mul_ps(c1, _mm_shuffle_ps(right, right, _MM_SHUFFLE(1, 1, 1, 1))));
+				result = _mm_add_ps(result, _mm_mul_ps(c2, _mm_shuffle_ps(right, right, _MM_SHUFFLE(2, 2, 2, 2))));
+				return _mm_add_ps(result, _mm_mul_ps(c3, _mm_shuffle_ps(right, right, _MM_SHUFFLE(3, 3, 3, 3))));
+			}
+
+#if CLOCKWORK_SIMD_AVX2
+			//the same for 2 right columns at once, where every left column is in both halfs of a register
+			inline __m256 combineColumns(__m256 c0, __m256 c1, __m256 c2, __m256 c3, __m256 right) noexcept
+			{
+				__m256 result = _mm256_mul_ps(c0, _mm256_permute_ps(right, _MM_SHUFFLE(0, 0, 0, 0)));
+#if CLOCKWORK_SIMD_FMA
+				result = _mm256_fmadd_ps(c1, _mm256_permute_ps(right, _MM_SHUFFLE(1, 1, 1, 1)), result);
+				result = _mm256_fmadd_ps(c2, _mm256_permute_ps(right, _MM_SHUFFLE(2, 2, 2, 2)), result);
+				return _mm256_fmadd_ps(c3, _mm256_permute_ps(right, _MM_SHUFFLE(3, 3, 3, 3)), result);
+#else
+				result = _mm256_add_ps(result, _mm256_mul_ps(c1, _mm256_permute_ps(right, _MM_SHUFFLE(1, 1, 1, 1))));
+				result = _mm256_add_ps(result, _mm256_mul_ps(c2, _mm256_permute_ps(right, _MM_SHUFFLE(2, 2, 2, 2))));
+				return _mm256_add_ps(result, _mm256_mul_ps(c3, _mm256_permute_ps(right, _MM_SHUFFLE(3, 3, 3, 3))));
+#endif
+			}
+#endif
+
+			//the product of two 2x2 matrices stored row per row in one register(a b c d = a b | c d)
+			inline __m128 mat2Mul(__m128 left, __m128 right) noexcept
+			{
+				return _mm_add_ps(_mm_mul_ps(left, _mm_shuffle_ps(right, right, _MM_SHUFFLE(3, 0, 3, 0))),
+					_mm_mul_ps(_mm_shuffle_ps(left, left, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(right, right, _MM_SHUFFLE(1, 2, 1, 2))));
+			}
+			//the adjugate of the left 2x2 matrix multiplied to the right one
+			inline __m128 mat2AdjMul(__m128 left, __m128 right) noexcept
+			{
+				return _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(left, left, _MM_SHUFFLE(0, 0, 3, 3)), right),
+					_mm_mul_ps(_mm_shuffle_ps(left, left, _MM_SHUFFLE(2, 2, 1, 1)), _mm_shuffle_ps(right, right, _MM_SHUFFLE(1, 0, 3, 2))));
+			}
+			//the left 2x2 matrix multiplied to the adjugate of the right one
+			inline __m128 mat2MulAdj(__m128 left, __m128 right) noexcept
+			{
+				return _mm_sub_ps(_mm_mul_ps(left, _mm_shuffle_ps(right, right, _MM_SHUFFLE(0, 3, 0, 3))),
+					_mm_mul_ps(_mm_shuffle_ps(left, left, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(right, right, _MM_SHUFFLE(1, 2, 1, 2))));
+			}
+
+			//the sum of x, y and z in all 4 values
+			inline __m128 sum3(__m128 value) noexcept
+			{
+				return _mm_add_ps(_mm_add_ps(_mm_shuffle_ps(value, value, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(value, value, _MM_SHUFFLE(1, 1, 1, 1))), _mm_shuffle_ps(value, value, _MM_SHUFFLE(2, 2, 2, 2)));
+			}
+
+			//the crossproduct of x, y and z | w stays 0, if both w are the same
+			inline __m128 cross(__m128 left, __m128 right) noexcept
+			{
+				return _mm_sub_ps(
+					_mm_mul_ps(_mm_shuffle_ps(left, left, _MM_SHUFFLE(3, 0, 2, 1)), _mm_shuffle_ps(right, right, _MM_SHUFFLE(3, 1, 0, 2))),
+					_mm_mul_ps(_mm_shuffle_ps(left, left, _MM_SHUFFLE(3, 1, 0, 2)), _mm_shuffle_ps(right, right, _MM_SHUFFLE(3, 0, 2, 1))));
+			}
+
+		}
+
+		template<>
+		inline Mat4x4<float> Mat4x4<float>::product(const Mat4x4<float>& left, const Mat4x4<float>& right) noexcept
+		{
+			Mat4x4<float> result;
+#if CLOCKWORK_SIMD_AVX2
+			//every left column is in both halfs of a register and every register of the right matrix holds 2 columns, so 2 columns of the result are calculated at once
+			const __m256 c0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>( left.data ));
+			const __m256 c1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>( left.data + 4 ));
+			const __m256 c2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>( left.data + 8 ));
+			const __m256 c3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>( left.data + 12 ));
+			_mm256_storeu_ps(result.data, simd::combineColumns(c0, c1, c2, c3, _mm256_loadu_ps(right.data)));
+			_mm256_storeu_ps(result.data + 8, simd::combineColumns(c0, c1, c2, c3, _mm256_loadu_ps(right.data + 8)));
+#else
+			const __m128 c0 = _mm_loadu_ps(left.data);
+			const __m128 c1 = _mm_loadu_ps(left.data + 4);
+			const __m128 c2 = _mm_loadu_ps(left.data + 8);
+			const __m128 c3 = _mm_loadu_ps(left.data + 12);
+			//no loop over the columns, because the compiler did not unroll it and then kept the result on the stack and copied it afterwards, which was slower than the generic version
+			_mm_storeu_ps(result.data, simd::combineColumns(c0, c1, c2, c3, _mm_loadu_ps(right.data)));
+			_mm_storeu_ps(result.data + 4, simd::combineColumns(c0, c1, c2, c3, _mm_loadu_ps(right.data + 4)));
+			_mm_storeu_ps(result.data + 8, simd::combineColumns(c0, c1, c2, c3, _mm_loadu_ps(right.data + 8)));
+			_mm_storeu_ps(result.data + 12, simd::combineColumns(c0, c1, c2, c3, _mm_loadu_ps(right.data + 12)));
+#endif
+			return result;
+		}
+
+		/*not specialised for avx2, because the compiler generates the same broadcasts and fmas from the generic version and can also vectorise loops over many vectors with it(2 vectors per 256 bit register), which the intrinsics prevent*/
+#if !CLOCKWORK_SIMD_AVX2
+		template<>
+		inline Vec4<float> Mat4x4<float>::transform(const Mat4x4<float>& left, const Vec4<float>& right) noexcept
+		{
+			Vec4<float> result;
+			_mm_storeu_ps(result.data, simd::combineColumns(_mm_loadu_ps(left.data), _mm_loadu_ps(left.data + 4), _mm_loadu_ps(left.data + 8), _mm_loadu_ps(left.data + 12), _mm_loadu_ps(right.data)));
+			return result;
+		}
+#endif
+
+		template<>
+		inline Vec3<float> Mat4x4<float>::transform(const Mat4x4<float>& left, const Vec3<float>& right) noexcept
+		{
+			__m128 sum = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(left.data), _mm_set1_ps(right.x)), _mm_loadu_ps(left.data + 12));//w=1 so the translation is just added
+			sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(left.data + 4), _mm_set1_ps(right.y)));
+			sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(left.data + 8), _mm_set1_ps(right.z)));
+			float result[4];
+			_mm_storeu_ps(result, sum);
+			return Vec3<float>(result[0], result[1], result[2]);
+		}
+
+		/*avx2 transposes 2 columns per register with 2 unpacks and 2 lane crossing permutes instead of the 8 shuffles of _MM_TRANSPOSE4_PS, which were slower than the generic version with avx2*/
+		template<>
+		inline Mat4x4<float> Mat4x4<float>::transpose() const noexcept
+		{
+#if CLOCKWORK_SIMD_AVX2
+			const __m256 c01 = _mm256_loadu_ps(data);
+			const __m256 c23 = _mm256_loadu_ps(data + 8);
+			const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);//x1 x3 y1 y3 x2 x4 y2 y4 to x1 x2 x3 x4 y1 y2 y3 y4
+			Mat4x4<float> result;
+			_mm256_storeu_ps(result.data, _mm256_permutevar8x32_ps(_mm256_unpacklo_ps(c01, c23), order));
+			_mm256_storeu_ps(result.data + 8, _mm256_permutevar8x32_ps(_mm256_unpackhi_ps(c01, c23), order));
+			return result;
+#else
+			__m128 c0 = _mm_loadu_ps(data);
+			__m128 c1 = _mm_loadu_ps(data + 4);
+			__m128 c2 = _mm_loadu_ps(data + 8);
+			__m128 c3 = _mm_loadu_ps(data + 12);
+			_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+			Mat4x4<float> result;
+			_mm_storeu_ps(result.data, c0);
+			_mm_storeu_ps(result.data + 4, c1);
+			_mm_storeu_ps(result.data + 8, c2);
+			_mm_storeu_ps(result.data + 12, c3);
+			return result;
+#endif
+		}
+
+		/*the inverse with 2x2 blocks | M = A B | C D and every block is a 2x2 matrix in one register | it works the same on the columns as on the rows, because inverse(transpose(M)) = transpose(inverse(M))
+		the inverse is 1/det(M) * X Y | Z W with X = det(D)*A - B*(adj(D)*C), W = det(A)*D - C*(adj(A)*B), Y = det(B)*C - D*adj(adj(A)*B), Z = det(C)*B - A*adj(adj(D)*C) and the adjugate of every block*/
+		template<>
+		inline Mat4x4<float> Mat4x4<float>::inverse() const noexcept
+		{
+			const __m128 c0 = _mm_loadu_ps(data);
+			const __m128 c1 = _mm_loadu_ps(data + 4);
+			const __m128 c2 = _mm_loadu_ps(data + 8);
+			const __m128 c3 = _mm_loadu_ps(data + 12);
+			const __m128 a = _mm_movelh_ps(c0, c1);
+			const __m128 b = _mm_movehl_ps(c1, c0);
+			const __m128 c = _mm_movelh_ps(c2, c3);
+			const __m128 d = _mm_movehl_ps(c3, c2);
+
+			//det(A) det(B) det(C) det(D)
+			const __m128 detSub = _mm_sub_ps(
+				_mm_mul_ps(_mm_shuffle_ps(c0, c2, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(c1, c3, _MM_SHUFFLE(3, 1, 3, 1))),
+				_mm_mul_ps(_mm_shuffle_ps(c0, c2, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(c1, c3, _MM_SHUFFLE(2, 0, 2, 0))));
+			const __m128 detA = _mm_shuffle_ps(detSub, detSub, _MM_SHUFFLE(0, 0, 0, 0));
+			const __m128 detB = _mm_shuffle_ps(detSub, detSub, _MM_SHUFFLE(1, 1, 1, 1));
+			const __m128 detC = _mm_shuffle_ps(detSub, detSub, _MM_SHUFFLE(2, 2, 2, 2));
+			const __m128 detD = _mm_shuffle_ps(detSub, detSub, _MM_SHUFFLE(3, 3, 3, 3));
+
+			const __m128 dc = simd::mat2AdjMul(d, c);
+			const __m128 ab = simd::mat2AdjMul(a, b);
+			__m128 x = _mm_sub_ps(_mm_mul_ps(detD, a), simd::mat2Mul(b, dc));
+			__m128 w = _mm_sub_ps(_mm_mul_ps(detA, d), simd::mat2Mul(c, ab));
+			__m128 y = _mm_sub_ps(_mm_mul_ps(detB, c), simd::mat2MulAdj(d, ab));
+			__m128 z = _mm_sub_ps(_mm_mul_ps(detC, b), simd::mat2MulAdj(a, dc));
+
+			//det(M) = det(A)*det(D) + det(B)*det(C) - trace(adj(A)*B * adj(D)*C)
+			__m128 trace = _mm_mul_ps(ab, _mm_shuffle_ps(dc, dc, _MM_SHUFFLE(3, 1, 2, 0)));
+			trace = _mm_add_ps(trace, _mm_shuffle_ps(trace, trace, _MM_SHUFFLE(2, 3, 0, 1)));
+			trace = _mm_add_ps(trace, _mm_shuffle_ps(trace, trace, _MM_SHUFFLE(1, 0, 3, 2)));
+			const __m128 det = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), trace);
+			const __m128 inverseDet = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), det);
+			x = _mm_mul_ps(x, inverseDet);
+			y = _mm_mul_ps(y, inverseDet);
+			z = _mm_mul_ps(z, inverseDet);
+			w = _mm_mul_ps(w, inverseDet);
+
+			//the adjugate of every block while storing them
+			Mat4x4<float> result;
+			_mm_storeu_ps(result.data, _mm_shuffle_ps(x, y, _MM_SHUFFLE(1, 3, 1, 3)));
+			_mm_storeu_ps(result.data + 4, _mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 2, 0, 2)));
+			_mm_storeu_ps(result.data + 8, _mm_shuffle_ps(z, w, _MM_SHUFFLE(1, 3, 1, 3)));
+			_mm_storeu_ps(result.data + 12, _mm_shuffle_ps(z, w, _MM_SHUFFLE(0, 2, 0, 2)));
+			return result;
+		}
+
+		/*the rows of the inverse 3x3 part are the crossproducts of the columns divided by the determinant and the new translation is -(inverse 3x3 * translation)
+		transposing the rows gives the columns of the inverse and the translation is then the sum of the columns multiplied by the old translation like in transform()*/
+		template<>
+		inline Mat4x4<float> Mat4x4<float>::affineInverse() const noexcept
+		{
+			const __m128 c0 = _mm_loadu_ps(data);
+			const __m128 c1 = _mm_loadu_ps(data + 4);
+			const __m128 c2 = _mm_loadu_ps(data + 8);
+			__m128 r0 = simd::cross(c1, c2);
+			__m128 r1 = simd::cross(c2, c0);
+			__m128 r2 = simd::cross(c0, c1);
+#if CLOCKWORK_SIMD_SSE4
+			const __m128 det = _mm_dp_ps(c0, r0, 0x7F);
+#else
+			const __m128 det = simd::sum3(_mm_mul_ps(c0, r0));
+#endif
+			const __m128 inverseDet = _mm_div_ps(_mm_set1_ps(1.0f), det);
+			r0 = _mm_mul_ps(r0, inverseDet);
+			r1 = _mm_mul_ps(r1, inverseDet);
+			r2 = _mm_mul_ps(r2, inverseDet);
+			__m128 r3 = _mm_setzero_ps();
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+			__m128 translation = _mm_mul_ps(r0, _mm_set1_ps(x4));
+			translation = _mm_add_ps(translation, _mm_mul_ps(r1, _mm_set1_ps(y4)));
+			translation = _mm_add_ps(translation, _mm_mul_ps(r2, _mm_set1_ps(z4)));
+			Mat4x4<float> result;
+			_mm_storeu_ps(result.data, r0);
+			_mm_storeu_ps(result.data + 4, r1);
+			_mm_storeu_ps(result.data + 8, r2);
+			_mm_storeu_ps(result.data + 12, _mm_sub_ps(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f), translation));
+			return result;
+		}
+
+	}
+}
+
+#endif
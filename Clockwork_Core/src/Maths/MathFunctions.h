@@ -12,15 +12,13 @@
 * You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
 *************************************************************************/
 #include <cmath>
+#include "Trigonometry.h"
 
 namespace clockwork {
 	namespace maths {
 
 		/*3.14159265359 as specified type*/
 		template<typename type> constexpr type pi = 3.14159265359;
-		extern double* sintable;
-		extern double* costable;
-		extern double* tantable;
 
 		/*returns the absolut/non negative value of the type as a copy*/
 		template<typename type> inline constexpr type abs(type value) noexcept
@@ -156,34 +154,48 @@ namespace clockwork {
 			return 0;
 		}
 
-		/*the fast unprecise way for integers between 0 and 360*/
-		template<typename type = float> inline constexpr type sinD(unsigned int degrees) noexcept
+		/*the sin/cos/tan of an angle in degrees with sincos() | works with every angle, not only whole degrees from 0 to 360 like the old lookup tables*/
+		template<typename type> inline constexpr type sinD(type degrees) noexcept
 		{
-			degrees %= 360;
-			return sintable[degrees];
+			type sin = 0, cos = 0;
+			sincos(toRadians(degrees), sin, cos);
+			return sin;
 		}
-		template<typename type = float> inline constexpr type cosD(unsigned int degrees) noexcept
+		template<typename type> inline constexpr type cosD(type degrees) noexcept
 		{
-			degrees %= 360;
-			return costable[degrees];
+			type sin = 0, cos = 0;
+			sincos(toRadians(degrees), sin, cos);
+			return cos;
 		}
-		template<typename type = float> inline constexpr type tanD(unsigned int degrees) noexcept
+		template<typename type> inline constexpr type tanD(type degrees) noexcept
 		{
-			degrees %= 360;
-			return tantable[degrees];
+			type sin = 0, cos = 0;
+			sincos(toRadians(degrees), sin, cos);
+			return sin / cos;
 		}
-		/*the slow precise way for doubles between 0 and 2*pi*/
+		/*the sin/cos/tan of an angle in radians with sincos() | use sincos() directly, if both sin and cos are needed*/
 		template<typename type> inline constexpr type sinR(type radians) noexcept
 		{
-			return std::sin(radians);
+			type sin = 0, cos = 0;
+			sincos(radians, sin, cos);
+			return sin;
 		}
 		template<typename type> inline constexpr type cosR(type radians) noexcept
 		{
-			return std::cos(radians);
+			type sin = 0, cos = 0;
+			sincos(radians, sin, cos);
+			return cos;
 		}
 		template<typename type> inline constexpr type tanR(type radians) noexcept
 		{
-			return std::tan(radians);
+			type sin = 0, cos = 0;
+			sincos(radians, sin, cos);
+			return sin / cos;
+		}
+		/*sincos() with the angle in degrees*/
+		template<typename type> inline constexpr void sincosD(type degrees, type& sin, type& cos) noexcept
+		{
+			sincos(toRadians(degrees), sin, cos);
 		}
 
 
@@ -212,38 +224,5 @@ namespace clockwork {
 			return 0;
 		}
 
-
-
-
-
-
-
-
-
-
-
-
-
-		/*has to be called before mathfunctions are used | will be called from the engine constructor*/
-		inline void initMaths() noexcept
-		{
-			sintable = new double[360];
-			costable = new double[360];
-			tantable = new double[360];
-			for ( unsigned int i = 0; i < 360; ++i )
-			{
-				sintable[i] = std::sin(toRadians<double>(i));
-				costable[i] = std::cos(toRadians<double>(i));
-				tantable[i] = std::tan(toRadians<double>(i));
-			}
-		}
-		/*has to be called after mathfunctions are used | will be called from the engine destructor*/
-		inline void destroyMaths() noexcept
-		{
-			delete[] sintable;
-			delete[] costable;
-			delete[] tantable;
-		}
-
 	}
 }
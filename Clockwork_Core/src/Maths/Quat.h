@@ -0,0 +1,193 @@
+#pragma once
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include <iostream>
+#include <sstream>
+#include <cmath>
+#include "MathFunctions.h"
+#include "Vec3.h"
+#include "Mat4x4.h"
+
+namespace clockwork {
+	namespace maths {
+
+		/*a quaternion x*i + y*j + z*k + w that is used to store a rotation without the gimbal lock and the precision loss of euler angles | only unit quaternions(magnitude 1) describe a rotation, so normalize after many multiplications
+		the rotation of a unit quaternion around the normalized axis a with the angle t is: x=a.x*sin(t/2), y=a.y*sin(t/2), z=a.z*sin(t/2), w=cos(t/2) | the default constructor is the identity quaternion(no rotation)
+		the multiplication order is the same as with matrices: q1*q2 first rotates with q2 and then with q1*/
+		template<typename type>
+		struct Quat
+		{
+
+		public:
+			union
+			{
+				struct
+				{
+					type x;
+					type y;
+					type z;
+					type w;
+				};
+				type data[4];
+			};
+
+		public:
+			//identity constructor, no rotation
+			Quat() noexcept
+				:x(0), y(0), z(0), w(1)
+			{}
+			//seperate values constructor | w is the real part
+			Quat(type x, type y, type z, type w) noexcept
+				:x(x), y(y), z(z), w(w)
+			{}
+
+			/*returns the rotation around the axis with the angle parameter as radians | the axis does not have to be normalized*/
+			static Quat<type> axisAngleR(const Vec3<type>& axis, type radians) noexcept
+			{
+				const type length = std::sqrt(axis.x * axis.x + axis.y * axis.y + axis.z * axis.z);
+				if ( length == 0 )
+					return Quat<type>();
+				type s, c;
+				maths::sincos(radians / 2, s, c);
+				s /= length;
+				return Quat<type>(axis.x * s, axis.y * s, axis.z * s, c);
+			}
+			/*returns the rotation around the axis with the angle parameter as degrees | the axis does not have to be normalized*/
+			static Quat<type> axisAngleD(const Vec3<type>& axis, type degrees) noexcept
+			{
+				return axisAngleR(axis, toRadians<type>(degrees));
+			}
+
+			/*returns the rotation of euler angles in degrees (pitch around x, yaw around y, roll around z) | the order is the same as Mat4x4::rotateXD(x).rotateYD(y).rotateZD(z): first around the x-axis, then y and lastly z
+			so its qz*qy*qx and the resulting matrix is the same as the one of the rotate methods*/
+			static Quat<type> eulerD(const Vec3<type>& degrees) noexcept
+			{
+				const type hx = toRadians<type>(degrees.x) / 2;
+				const type hy = toRadians<type>(degrees.y) / 2;
+				const type hz = toRadians<type>(degrees.z) / 2;
+				type sx, cx, sy, cy, sz, cz;
+				maths::sincos(hx, sx, cx);
+				maths::sincos(hy, sy, cy);
+				maths::sincos(hz, sz, cz);
+				return Quat<type>(
+					sx * cy * cz - cx * sy * sz,
+					cx * sy * cz + sx * cy * sz,
+					cx * cy * sz - sx * sy * cz,
+					cx * cy * cz + sx * sy * sz);
+			}
+
+			/*hamilton product q1*q2 | the result first rotates with q2 and then with q1 | not commutative*/
+			Quat<type> operator*(const Quat<type>& other) const noexcept
+			{
+				return Quat<type>(
+					w * other.x + x * other.w + y * other.z - z * other.y,
+					w * other.y - x * other.z + y * other.w + z * other.x,
+					w * other.z + x * other.y - y * other.x + z * other.w,
+					w * other.w - x * other.x - y * other.y - z * other.z);
+			}
+			//this = this * other
+			Quat<type>& operator*=(const Quat<type>& other) noexcept
+			{
+				*this = *this * other;
+				return *this;
+			}
+			bool operator==(const Quat<type>& other) const noexcept
+			{
+				return x == other.x && y == other.y && z == other.z && w == other.w;
+			}
+			bool operator!=(const Quat<type>& other) const noexcept
+			{
+				return !( *this == other );
+			}
+
+			//returns the inverse rotation of a unit quaternion(-x,-y,-z,w)
+			Quat<type> conjugate() const noexcept
+			{
+				return Quat<type>(-x, -y, -z, w);
+			}
+			//|quat| returns the lenght of the quaternion | its 1 for a rotation
+			type magnitude() const noexcept
+			{
+				return std::sqrt(x * x + y * y + z * z + w * w);
+			}
+			type dotproduct(const Quat<type>& other) const noexcept
+			{
+				return x * other.x + y * other.y + z * other.z + w * other.w;
+			}
+			//returns a normalized copy | should be used after many multiplications, because the floating point errors would scale the rotation matrix
+			Quat<type> normalize() const noexcept
+			{
+				const type length = magnitude();
+				return Quat<type>(x / length, y / length, z / length, w / length);
+			}
+			//normalizes the quaternion itself
+			Quat<type>& normalizeSelf() noexcept
+			{
+				const type length = magnitude();
+				x /= length;
+				y /= length;
+				z /= length;
+				w /= length;
+				return *this;
+			}
+
+			/*rotates the vector with this unit quaternion | the same as toMatrix()*vec, but cheaper for a single vector*/
+			Vec3<type> rotate(const Vec3<type>& vec) const noexcept
+			{
+				//t = 2 * cross(q.xyz, v) | v' = v + w*t + cross(q.xyz, t)
+				const type tx = 2 * ( y * vec.z - z * vec.y );
+				const type ty = 2 * ( z * vec.x - x * vec.z );
+				const type tz = 2 * ( x * vec.y - y * vec.x );
+				return Vec3<type>(vec.x + w * tx + y * tz - z * ty, vec.y + w * ty + z * tx - x * tz, vec.z + w * tz + x * ty - y * tx);
+			}
+
+			/*returns the rotation matrix of this unit quaternion*/
+			Mat4x4<type> toMatrix() const noexcept
+			{
+				return toMatrix(Vec3<type>(1, 1, 1), Vec3<type>(0, 0, 0));
+			}
+			/*returns translation * rotation * scale as one matrix without the 3 matrix multiplications | it is the same as Mat4x4::scaling(scale), then the rotation and then translate(translation)
+			the columns of the rotation matrix are multiplied with the scale of their axis and the translation is put in x4/y4/z4*/
+			Mat4x4<type> toMatrix(const Vec3<type>& scale, const Vec3<type>& translation) const noexcept
+			{
+				const type xx = x * x, yy = y * y, zz = z * z;
+				const type xy = x * y, xz = x * z, yz = y * z;
+				const type wx = w * x, wy = w * y, wz = w * z;
+				return Mat4x4<type>(
+					( 1 - 2 * ( yy + zz ) ) * scale.x, 2 * ( xy - wz ) * scale.y, 2 * ( xz + wy ) * scale.z, translation.x,
+					2 * ( xy + wz ) * scale.x, ( 1 - 2 * ( xx + zz ) ) * scale.y, 2 * ( yz - wx ) * scale.z, translation.y,
+					2 * ( xz - wy ) * scale.x, 2 * ( yz + wx ) * scale.y, ( 1 - 2 * ( xx + yy ) ) * scale.z, translation.z,
+					0, 0, 0, 1);
+			}
+
+			//quaternion as string: "Quat<type>(x,y,z,w)"
+			std::string toString() const noexcept
+			{
+				std::stringstream stream;
+				stream << "Quat<" << typeid( type ).name() << ">(" << x << "," << y << "," << z << "," << w << ")";
+				return stream.str();
+			}
+			//ostream operator: "Quat<type>(x,y,z,w)"
+			friend std::ostream& operator<<(std::ostream& stream, const Quat<type>& quat) noexcept
+			{
+				stream << "Quat<" << typeid( type ).name() << ">(" << quat.x << "," << quat.y << "," << quat.z << "," << quat.w << ")";
+				return stream;
+			}
+
+		};
+
+		using Quatf = Quat<float>;
+		using Quatd = Quat<double>;
+
+	}
+}
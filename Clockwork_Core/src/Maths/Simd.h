@@ -0,0 +1,47 @@
+#pragma once
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+
+/*selects the simd instruction set of the maths kernels at compile time from the instruction set the compiler is allowed to use | there is no check at runtime, so the engine only runs on cpus that support the instruction set of the build
+CLOCKWORK_SIMD is 0 for the generic scalar code, 1 for sse2, 2 for sse4.1 and 3 for avx2 | msvc only defines __AVX__/__AVX2__ for /arch:AVX and /arch:AVX2, so x64 builds without /arch use sse2(which every x64 cpu has) and /arch:AVX also selects sse4.1
+define CLOCKWORK_SIMD in the preprocessor definitions of the project to force a level, for example CLOCKWORK_SIMD=0 to compare the generic code or to debug it*/
+#ifndef CLOCKWORK_SIMD
+#if defined(__AVX2__)
+#define CLOCKWORK_SIMD 3
+#elif defined(__SSE4_1__) || defined(__AVX__)
+#define CLOCKWORK_SIMD 2
+#elif defined(__SSE2__) || defined(_M_X64) || ( defined(_M_IX86_FP) && _M_IX86_FP >= 2 )
+#define CLOCKWORK_SIMD 1
+#else
+#define CLOCKWORK_SIMD 0
+#endif
+#endif
+
+#define CLOCKWORK_SIMD_SSE2 ( CLOCKWORK_SIMD >= 1 )
+#define CLOCKWORK_SIMD_SSE4 ( CLOCKWORK_SIMD >= 2 )
+#define CLOCKWORK_SIMD_AVX2 ( CLOCKWORK_SIMD >= 3 )
+
+//fused multiply add comes with avx2 on all cpus, but gcc/clang only allow it with -mfma
+#if CLOCKWORK_SIMD_AVX2 && ( defined(__FMA__) || defined(_MSC_VER) )
+#define CLOCKWORK_SIMD_FMA 1
+#else
+#define CLOCKWORK_SIMD_FMA 0
+#endif
+
+#if CLOCKWORK_SIMD_AVX2
+#include <immintrin.h>
+#elif CLOCKWORK_SIMD_SSE4
+#include <smmintrin.h>
+#elif CLOCKWORK_SIMD_SSE2
+#include <emmintrin.h>
+#endif
@@ -0,0 +1,79 @@
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "Trigonometry.h"
+
+namespace clockwork {
+	namespace maths {
+
+		void sincos(const float* radians, float* sin, float* cos, unsigned int count) noexcept
+		{
+			unsigned int i = 0;
+#if CLOCKWORK_SIMD_AVX2
+			for ( ; i + 8 <= count; i += 8 )
+			{
+				__m256 s, c;
+				simd::sincos(_mm256_loadu_ps(radians + i), s, c);
+				_mm256_storeu_ps(sin + i, s);
+				_mm256_storeu_ps(cos + i, c);
+			}
+#endif
+#if CLOCKWORK_SIMD_SSE2
+			for ( ; i + 4 <= count; i += 4 )
+			{
+				__m128 s, c;
+				simd::sincos(_mm_loadu_ps(radians + i), s, c);
+				_mm_storeu_ps(sin + i, s);
+				_mm_storeu_ps(cos + i, c);
+			}
+#endif
+			for ( ; i < count; ++i )
+			{
+				float s, c;
+				sincos(radians[i], s, c);
+				sin[i] = s;
+				cos[i] = c;
+			}
+		}
+
+		void sincos(const double* radians, double* sin, double* cos, unsigned int count) noexcept
+		{
+			unsigned int i = 0;
+#if CLOCKWORK_SIMD_AVX2
+			for ( ; i + 4 <= count; i += 4 )
+			{
+				__m256d s, c;
+				simd::sincos(_mm256_loadu_pd(radians + i), s, c);
+				_mm256_storeu_pd(sin + i, s);
+				_mm256_storeu_pd(cos + i, c);
+			}
+#endif
+#if CLOCKWORK_SIMD_SSE2
+			for ( ; i + 2 <= count; i += 2 )
+			{
+				__m128d s, c;
+				simd::sincos(_mm_loadu_pd(radians + i), s, c);
+				_mm_storeu_pd(sin + i, s);
+				_mm_storeu_pd(cos + i, c);
+			}
+#endif
+			for ( ; i < count; ++i )
+			{
+				double s, c;
+				sincos(radians[i], s, c);
+				sin[i] = s;
+				cos[i] = c;
+			}
+		}
+
+	}
+}
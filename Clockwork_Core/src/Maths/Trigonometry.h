@@ -0,0 +1,260 @@
+#pragma once
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include <cmath>
+#include "Simd.h"
+
+namespace clockwork {
+	namespace maths {
+
+		/*the constants of sincos() | the polynomials are the minimax approximations of sin(r) = r + r^3*s(r^2) and cos(r) = 1 - r^2/2 + r^4*c(r^2) for r from -pi/4 to pi/4 from the cephes library
+		pi/2 is split into 3 parts(cody-waite), where the first parts have so few bits, that the multiplication with the quadrant is exact and the subtraction of the nearest multiple of pi/2 does not lose precision*/
+		namespace trigonometry {
+
+			constexpr float floatTwoOverPi = 0.636619772367581343f;
+			constexpr float floatPiHalf1 = 1.5703125f;
+			constexpr float floatPiHalf2 = 4.837512969970703125e-4f;
+			constexpr float floatPiHalf3 = 7.54978995489188216e-8f;
+			constexpr float floatSin0 = -1.9515295891e-4f;
+			constexpr float floatSin1 = 8.3321608736e-3f;
+			constexpr float floatSin2 = -1.6666654611e-1f;
+			constexpr float floatCos0 = 2.443315711809948e-5f;
+			constexpr float floatCos1 = -1.388731625493765e-3f;
+			constexpr float floatCos2 = 4.166664568298827e-2f;
+			constexpr float floatLimit = 10000.0f;//above the rounding of quadrant * floatPiHalf2 adds more error than the polynomials
+
+			constexpr double doubleTwoOverPi = 0.636619772367581343075535;
+			constexpr double doublePiHalf1 = 1.57079625129699707031;
+			constexpr double doublePiHalf2 = 7.54978941586159635336e-8;
+			constexpr double doublePiHalf3 = 5.39030285815811905290e-15;
+			constexpr double doubleSin0 = 1.58962301576546568060e-10;
+			constexpr double doubleSin1 = -2.50507477628578072866e-8;
+			constexpr double doubleSin2 = 2.75573136213857245213e-6;
+			constexpr double doubleSin3 = -1.98412698295895385996e-4;
+			constexpr double doubleSin4 = 8.33333333332211858878e-3;
+			constexpr double doubleSin5 = -1.66666666666666307295e-1;
+			constexpr double doubleCos0 = -1.13585365213876817300e-11;
+			constexpr double doubleCos1 = 2.08757008419747316778e-9;
+			constexpr double doubleCos2 = -2.75573141792967388112e-7;
+			constexpr double doubleCos3 = 2.48015872888517045348e-5;
+			constexpr double doubleCos4 = -1.38888888888730564116e-3;
+			constexpr double doubleCos5 = 4.16666666666665929218e-2;
+			constexpr double doubleLimit = 100000000.0;//the quadrant still fits into an int and the reduction stays exact
+
+			//swaps and negates sin/cos of the reduced angle for the quadrant: 0 = (s, c) | 1 = (c, -s) | 2 = (-s, -c) | 3 = (-c, s)
+			template<typename type> inline constexpr void applyQuadrant(int quadrant, type s, type c, type& sin, type& cos) noexcept
+			{
+				switch ( quadrant & 3 )
+				{
+				case 0:
+					sin = s;
+					cos = c;
+					break;
+				case 1:
+					sin = c;
+					cos = -s;
+					break;
+				case 2:
+					sin = -s;
+					cos = -c;
+					break;
+				default:
+					sin = -c;
+					cos = s;
+					break;
+				}
+			}
+
+		}
+
+		/*calculates the sin and the cos of the angle in radians at once with a polynomial | replaces std::sin/std::cos and the old lookup tables in the rotations and the camera
+		the angle is reduced to -pi/4 to pi/4 by subtracting the nearest multiple of pi/2 and the quadrant decides which polynomial is the sin and which the cos
+		max error to the exact result for |radians| <= 10000: 7.8e-8(about 1 ulp of 1.0f) | bigger angles use std::sin/std::cos
+		constexpr, so constant angles are calculated at compile time(for example in a constexpr perspective matrix)*/
+		inline constexpr void sincos(float radians, float& sin, float& cos) noexcept
+		{
+			using namespace trigonometry;
+			if ( !( radians <= floatLimit && radians >= -floatLimit ) )//also for nan
+			{
+				sin = std::sin(radians);
+				cos = std::cos(radians);
+				return;
+			}
+			int quadrant = static_cast<int>( radians * floatTwoOverPi + ( radians < 0 ? -0.5f : 0.5f ) );
+			float j = static_cast<float>( quadrant );
+			float r = ( ( radians - j * floatPiHalf1 ) - j * floatPiHalf2 ) - j * floatPiHalf3;
+			float z = r * r;
+			float s = ( ( floatSin0 * z + floatSin1 ) * z + floatSin2 ) * z * r + r;
+			float c = ( ( floatCos0 * z + floatCos1 ) * z + floatCos2 ) * z * z - 0.5f * z + 1.0f;
+			applyQuadrant(quadrant, s, c, sin, cos);
+		}
+
+		/*the double version of sincos(float) with longer polynomials
+		max error to the exact result for |radians| <= 100000000: 1.5e-16(about 1 ulp of 1.0) | bigger angles use std::sin/std::cos*/
+		inline constexpr void sincos(double radians, double& sin, double& cos) noexcept
+		{
+			using namespace trigonometry;
+			if ( !( radians <= doubleLimit && radians >= -doubleLimit ) )
+			{
+				sin = std::sin(radians);
+				cos = std::cos(radians);
+				return;
+			}
+			int quadrant = static_cast<int>( radians * doubleTwoOverPi + ( radians < 0 ? -0.5 : 0.5 ) );
+			double j = static_cast<double>( quadrant );
+			double r = ( ( radians - j * doublePiHalf1 ) - j * doublePiHalf2 ) - j * doublePiHalf3;
+			double z = r * r;
+			double s = ( ( ( ( ( doubleSin0 * z + doubleSin1 ) * z + doubleSin2 ) * z + doubleSin3 ) * z + doubleSin4 ) * z + doubleSin5 ) * z * r + r;
+			double c = ( ( ( ( ( doubleCos0 * z + doubleCos1 ) * z + doubleCos2 ) * z + doubleCos3 ) * z + doubleCos4 ) * z + doubleCos5 ) * z * z - 0.5 * z + 1.0;
+			applyQuadrant(quadrant, s, c, sin, cos);
+		}
+
+		//every other type is calculated as double
+		template<typename type> inline constexpr void sincos(type radians, type& sin, type& cos) noexcept
+		{
+			double s = 0, c = 0;
+			sincos(static_cast<double>( radians ), s, c);
+			sin = static_cast<type>( s );
+			cos = static_cast<type>( c );
+		}
+
+		/*sincos() of count angles in the array radians into the arrays sin and cos | uses the simd versions for 4/8 floats or 2/4 doubles at once and the scalar version for the rest
+		the arrays may not overlap, except that radians can be the same as sin or cos*/
+		void sincos(const float* radians, float* sin, float* cos, unsigned int count) noexcept;
+		void sincos(const double* radians, double* sin, double* cos, unsigned int count) noexcept;
+
+#if CLOCKWORK_SIMD_SSE2
+		namespace simd {
+
+			/*sincos(float) for 4 floats at once | same max error, but without the fallback to std::sin/std::cos for angles bigger than 10000, so those lose precision(1e-6 at 100000)*/
+			inline void sincos(__m128 radians, __m128& sin, __m128& cos) noexcept
+			{
+				using namespace trigonometry;
+				const __m128i one = _mm_set1_epi32(1);
+				const __m128i two = _mm_set1_epi32(2);
+				__m128i quadrant = _mm_cvtps_epi32(_mm_mul_ps(radians, _mm_set1_ps(floatTwoOverPi)));//rounds to the nearest integer
+				__m128 j = _mm_cvtepi32_ps(quadrant);
+				__m128 r = _mm_sub_ps(radians, _mm_mul_ps(j, _mm_set1_ps(floatPiHalf1)));
+				r = _mm_sub_ps(r, _mm_mul_ps(j, _mm_set1_ps(floatPiHalf2)));
+				r = _mm_sub_ps(r, _mm_mul_ps(j, _mm_set1_ps(floatPiHalf3)));
+				__m128 z = _mm_mul_ps(r, r);
+				__m128 s = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(floatSin0), z), _mm_set1_ps(floatSin1));
+				s = _mm_add_ps(_mm_mul_ps(s, z), _mm_set1_ps(floatSin2));
+				s = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(s, z), r), r);
+				__m128 c = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(floatCos0), z), _mm_set1_ps(floatCos1));
+				c = _mm_add_ps(_mm_mul_ps(c, z), _mm_set1_ps(floatCos2));
+				c = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(_mm_mul_ps(c, z), z), _mm_mul_ps(_mm_set1_ps(0.5f), z)), _mm_set1_ps(1.0f));
+				//odd quadrants swap sin and cos | quadrant 2 and 3 negate the sin and 1 and 2 the cos, so bit 2 of the quadrant(+1 for the cos) is moved into the sign bit
+				__m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(quadrant, one), one));
+				__m128 sinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(quadrant, two), 30));
+				__m128 cosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrant, one), two), 30));
+				sin = _mm_xor_ps(_mm_or_ps(_mm_and_ps(swap, c), _mm_andnot_ps(swap, s)), sinSign);
+				cos = _mm_xor_ps(_mm_or_ps(_mm_and_ps(swap, s), _mm_andnot_ps(swap, c)), cosSign);
+			}
+
+			/*sincos(double) for 2 doubles at once | same max error, but without the fallback to std::sin/std::cos for angles bigger than 100000000*/
+			inline void sincos(__m128d radians, __m128d& sin, __m128d& cos) noexcept
+			{
+				using namespace trigonometry;
+				const __m128i one = _mm_set1_epi32(1);
+				const __m128i two = _mm_set1_epi32(2);
+				__m128i rounded = _mm_cvtpd_epi32(_mm_mul_pd(radians, _mm_set1_pd(doubleTwoOverPi)));//the 2 quadrants in the lower 64 bits
+				__m128d j = _mm_cvtepi32_pd(rounded);
+				__m128i quadrant = _mm_shuffle_epi32(rounded, _MM_SHUFFLE(1, 1, 0, 0));//every quadrant in both halfs of its 64 bits
+				__m128d r = _mm_sub_pd(radians, _mm_mul_pd(j, _mm_set1_pd(doublePiHalf1)));
+				r = _mm_sub_pd(r, _mm_mul_pd(j, _mm_set1_pd(doublePiHalf2)));
+				r = _mm_sub_pd(r, _mm_mul_pd(j, _mm_set1_pd(doublePiHalf3)));
+				__m128d z = _mm_mul_pd(r, r);
+				__m128d s = _mm_add_pd(_mm_mul_pd(_mm_set1_pd(doubleSin0), z), _mm_set1_pd(doubleSin1));
+				s = _mm_add_pd(_mm_mul_pd(s, z), _mm_set1_pd(doubleSin2));
+				s = _mm_add_pd(_mm_mul_pd(s, z), _mm_set1_pd(doubleSin3));
+				s = _mm_add_pd(_mm_mul_pd(s, z), _mm_set1_pd(doubleSin4));
+				s = _mm_add_pd(_mm_mul_pd(s, z), _mm_set1_pd(doubleSin5));
+				s = _mm_add_pd(_mm_mul_pd(_mm_mul_pd(s, z), r), r);
+				__m128d c = _mm_add_pd(_mm_mul_pd(_mm_set1_pd(doubleCos0), z), _mm_set1_pd(doubleCos1));
+				c = _mm_add_pd(_mm_mul_pd(c, z), _mm_set1_pd(doubleCos2));
+				c = _mm_add_pd(_mm_mul_pd(c, z), _mm_set1_pd(doubleCos3));
+				c = _mm_add_pd(_mm_mul_pd(c, z), _mm_set1_pd(doubleCos4));
+				c = _mm_add_pd(_mm_mul_pd(c, z), _mm_set1_pd(doubleCos5));
+				c = _mm_add_pd(_mm_sub_pd(_mm_mul_pd(_mm_mul_pd(c, z), z), _mm_mul_pd(_mm_set1_pd(0.5), z)), _mm_set1_pd(1.0));
+				__m128d swap = _mm_castsi128_pd(_mm_cmpeq_epi32(_mm_and_si128(quadrant, one), one));
+				__m128d sinSign = _mm_castsi128_pd(_mm_slli_epi64(_mm_and_si128(quadrant, two), 62));//the upper copy of the quadrant is shifted out
+				__m128d cosSign = _mm_castsi128_pd(_mm_slli_epi64(_mm_and_si128(_mm_add_epi32(quadrant, one), two), 62));
+				sin = _mm_xor_pd(_mm_or_pd(_mm_and_pd(swap, c), _mm_andnot_pd(swap, s)), sinSign);
+				cos = _mm_xor_pd(_mm_or_pd(_mm_and_pd(swap, s), _mm_andnot_pd(swap, c)), cosSign);
+			}
+
+#if CLOCKWORK_SIMD_AVX2
+			/*sincos(float) for 8 floats at once like the sse version*/
+			inline void sincos(__m256 radians, __m256& sin, __m256& cos) noexcept
+			{
+				using namespace trigonometry;
+				const __m256i one = _mm256_set1_epi32(1);
+				const __m256i two = _mm256_set1_epi32(2);
+				__m256i quadrant = _mm256_cvtps_epi32(_mm256_mul_ps(radians, _mm256_set1_ps(floatTwoOverPi)));
+				__m256 j = _mm256_cvtepi32_ps(quadrant);
+				__m256 r = _mm256_sub_ps(radians, _mm256_mul_ps(j, _mm256_set1_ps(floatPiHalf1)));
+				r = _mm256_sub_ps(r, _mm256_mul_ps(j, _mm256_set1_ps(floatPiHalf2)));
+				r = _mm256_sub_ps(r, _mm256_mul_ps(j, _mm256_set1_ps(floatPiHalf3)));
+				__m256 z = _mm256_mul_ps(r, r);
+				__m256 s = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(floatSin0), z), _mm256_set1_ps(floatSin1));
+				s = _mm256_add_ps(_mm256_mul_ps(s, z), _mm256_set1_ps(floatSin2));
+				s = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(s, z), r), r);
+				__m256 c = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(floatCos0), z), _mm256_set1_ps(floatCos1));
+				c = _mm256_add_ps(_mm256_mul_ps(c, z), _mm256_set1_ps(floatCos2));
+				c = _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(_mm256_mul_ps(c, z), z), _mm256_mul_ps(_mm256_set1_ps(0.5f), z)), _mm256_set1_ps(1.0f));
+				__m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(quadrant, one), one));
+				__m256 sinSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(quadrant, two), 30));
+				__m256 cosSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(quadrant, one), two), 30));
+				sin = _mm256_xor_ps(_mm256_blendv_ps(s, c, swap), sinSign);
+				cos = _mm256_xor_ps(_mm256_blendv_ps(c, s, swap), cosSign);
+			}
+
+			/*sincos(double) for 4 doubles at once like the sse version*/
+			inline void sincos(__m256d radians, __m256d& sin, __m256d& cos) noexcept
+			{
+				using namespace trigonometry;
+				const __m256i one = _mm256_set1_epi64x(1);
+				const __m256i two = _mm256_set1_epi64x(2);
+				__m128i rounded = _mm256_cvtpd_epi32(_mm256_mul_pd(radians, _mm256_set1_pd(doubleTwoOverPi)));
+				__m256d j = _mm256_cvtepi32_pd(rounded);
+				__m256i quadrant = _mm256_cvtepi32_epi64(rounded);
+				__m256d r = _mm256_sub_pd(radians, _mm256_mul_pd(j, _mm256_set1_pd(doublePiHalf1)));
+				r = _mm256_sub_pd(r, _mm256_mul_pd(j, _mm256_set1_pd(doublePiHalf2)));
+				r = _mm256_sub_pd(r, _mm256_mul_pd(j, _mm256_set1_pd(doublePiHalf3)));
+				__m256d z = _mm256_mul_pd(r, r);
+				__m256d s = _mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(doubleSin0), z), _mm256_set1_pd(doubleSin1));
+				s = _mm256_add_pd(_mm256_mul_pd(s, z), _mm256_set1_pd(doubleSin2));
+				s = _mm256_add_pd(_mm256_mul_pd(s, z), _mm256_set1_pd(doubleSin3));
+				s = _mm256_add_pd(_mm256_mul_pd(s, z), _mm256_set1_pd(doubleSin4));
+				s = _mm256_add_pd(_mm256_mul_pd(s, z), _mm256_set1_pd(doubleSin5));
+				s = _mm256_add_pd(_mm256_mul_pd(_mm256_mul_pd(s, z), r), r);
+				__m256d c = _mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(doubleCos0), z), _mm256_set1_pd(doubleCos1));
+				c = _mm256_add_pd(_mm256_mul_pd(c, z), _mm256_set1_pd(doubleCos2));
+				c = _mm256_add_pd(_mm256_mul_pd(c, z), _mm256_set1_pd(doubleCos3));
+				c = _mm256_add_pd(_mm256_mul_pd(c, z), _mm256_set1_pd(doubleCos4));
+				c = _mm256_add_pd(_mm256_mul_pd(c, z), _mm256_set1_pd(doubleCos5));
+				c = _mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(_mm256_mul_pd(c, z), z), _mm256_mul_pd(_mm256_set1_pd(0.5), z)), _mm256_set1_pd(1.0));
+				__m256d swap = _mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_and_si256(quadrant, one), one));
+				__m256d sinSign = _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_and_si256(quadrant, two), 62));
+				__m256d cosSign = _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_and_si256(_mm256_add_epi64(quadrant, one), two), 62));
+				sin = _mm256_xor_pd(_mm256_blendv_pd(s, c, swap), sinSign);
+				cos = _mm256_xor_pd(_mm256_blendv_pd(c, s, swap), cosSign);
+			}
+#endif
+
+		}
+#endif
+
+	}
+}
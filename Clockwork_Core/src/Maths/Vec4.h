@@ -32,30 +32,14 @@ namespace clockwork {
 		template<typename type>struct Mat4x3;
 		template<typename type>struct Mat4x4;
 
-		template<typename type> Vec4<type>&& operator+(Vec4<type>&& v1, Vec2<type>&& v2) noexcept;
-		template<typename type> Vec4<type>&& operator+(Vec4<type>&& v1, const Vec2<type>& v2) noexcept;
-		template<typename type> Vec4<type> operator+(const Vec4<type>& v1, const Vec2<type>& v2) noexcept;
-		template<typename type> Vec4<type>&& operator+(Vec4<type>&& v1, Vec3<type>&& v2) noexcept;
-		template<typename type> Vec4<type>&& operator+(Vec4<type>&& v1, const Vec3<type>& v2) noexcept;
-		template<typename type> Vec4<type> operator+(const Vec4<type>& v1, const Vec3<type>& v2) noexcept;
-		template<typename type> Vec4<type>&& operator-(Vec4<type>&& v1, Vec2<type>&& v2) noexcept;
-		template<typename type> Vec4<type>&& operator-(Vec4<type>&& v1, const Vec2<type>& v2) noexcept;
-		template<typename type> Vec4<type> operator-(const Vec4<type>& v1, const Vec2<type>& v2) noexcept;
-		template<typename type> Vec4<type>&& operator-(Vec4<type>&& v1, Vec3<type>&& v2) noexcept;
-		template<typename type> Vec4<type>&& operator-(Vec4<type>&& v1, const Vec3<type>& v2) noexcept;
-		template<typename type> Vec4<type> operator-(const Vec4<type>& v1, const Vec3<type>& v2) noexcept;
-		template<typename type> Vec4<type>&& operator*(Vec4<type>&& v1, Vec2<type>&& v2) noexcept;
-		template<typename type> Vec4<type>&& operator*(Vec4<type>&& v1, const Vec2<type>& v2) noexcept;
-		template<typename type> Vec4<type> operator*(const Vec4<type>& v1, const Vec2<type>& v2) noexcept;
-		template<typename type> Vec4<type>&& operator*(Vec4<type>&& v1, Vec3<type>&& v2) noexcept;
-		template<typename type> Vec4<type>&& operator*(Vec4<type>&& v1, const Vec3<type>& v2) noexcept;
-		template<typename type> Vec4<type> operator*(const Vec4<type>& v1, const Vec3<type>& v2) noexcept;
-		template<typename type> Vec4<type>&& operator/(Vec4<type>&& v1, Vec2<type>&& v2) noexcept;
-		template<typename type> Vec4<type>&& operator/(Vec4<type>&& v1, const Vec2<type>& v2) noexcept;
-		template<typename type> Vec4<type> operator/(const Vec4<type>& v1, const Vec2<type>& v2) noexcept;
-		template<typename type> Vec4<type>&& operator/(Vec4<type>&& v1, Vec3<type>&& v2) noexcept;
-		template<typename type> Vec4<type>&& operator/(Vec4<type>&& v1, const Vec3<type>& v2) noexcept;
-		template<typename type> Vec4<type> operator/(const Vec4<type>& v1, const Vec3<type>& v2) noexcept;
+		template<typename type> constexpr Vec4<type> operator+(const Vec4<type>& v1, const Vec2<type>& v2) noexcept;
+		template<typename type> constexpr Vec4<type> operator+(const Vec4<type>& v1, const Vec3<type>& v2) noexcept;
+		template<typename type> constexpr Vec4<type> operator-(const Vec4<type>& v1, const Vec2<type>& v2) noexcept;
+		template<typename type> constexpr Vec4<type> operator-(const Vec4<type>& v1, const Vec3<type>& v2) noexcept;
+		template<typename type> constexpr Vec4<type> operator*(const Vec4<type>& v1, const Vec2<type>& v2) noexcept;
+		template<typename type> constexpr Vec4<type> operator*(const Vec4<type>& v1, const Vec3<type>& v2) noexcept;
+		template<typename type> constexpr Vec4<type> operator/(const Vec4<type>& v1, const Vec2<type>& v2) noexcept;
+		template<typename type> constexpr Vec4<type> operator/(const Vec4<type>& v1, const Vec3<type>& v2) noexcept;
 		template<typename type>Vec4<type> operator-(Vec4<type> vec) noexcept;
 
 		template<typename type>
@@ -91,15 +75,15 @@ namespace clockwork {
 
 		public:
 			//default constructor
-			Vec4() noexcept
+			constexpr Vec4() noexcept
 				:x(0), y(0), z(0), w(0)
 			{}
 			//1 value for all constructor
-			explicit Vec4(type val) noexcept
+			explicit constexpr Vec4(type val) noexcept
 				:x(val), y(val), z(val), w(val)
 			{}
 			//seperate values constructor
-			Vec4(type x, type y, type z, type w) noexcept
+			constexpr Vec4(type x, type y, type z, type w) noexcept
 				:x(x), y(y), z(z), w(w)
 			{}
 			//vector constructor
@@ -111,61 +95,26 @@ namespace clockwork {
 				w = other.at(3);
 			}
 			//vec4 copy constructor
-			Vec4(const Vec4<type>& other) noexcept
-				:x(other.x), y(other.y), z(other.z), w(other.w)
-			{}
-			//vec4 move constructor
-			Vec4(Vec4<type>&& other) noexcept
-				:x(std::move(other.x)), y(std::move(other.y)), z(std::move(other.z)), w(std::move(other.w))
-			{}
+			Vec4(const Vec4<type>& other) noexcept = default;
 			//vec4 assign operator
-			Vec4<type>& operator=(const Vec4<type>& other) noexcept
-			{
-				x = other.x;
-				y = other.y;
-				z = other.z;
-				w = other.w;
-				return *this;
-			}
-			//vec4 move operator
-			Vec4<type>& operator=(Vec4<type>&& other) noexcept
-			{
-				x = std::move(other.x);
-				y = std::move(other.y);
-				z = std::move(other.z);
-				w = std::move(other.w);
-				return *this;
-			}
+			Vec4<type>& operator=(const Vec4<type>& other) noexcept = default;
 			//vec2 copy constructor 
-			explicit Vec4(const Vec2<type>& other) noexcept;
-			//vec2 move constructor 
-			explicit Vec4(Vec2<type>&& other) noexcept;
+			explicit constexpr Vec4(const Vec2<type>& other) noexcept;
 			//vec3 copy constructor
-			explicit Vec4(const Vec3<type>& other) noexcept;
-			//vec3 move constructor
-			explicit Vec4(Vec3<type>&& other) noexcept;
+			explicit constexpr Vec4(const Vec3<type>& other) noexcept;
 			//vec2 assign operator
-			Vec4<type>& operator=(const Vec2<type>& other) noexcept;
-			//vec2 move operator
-			Vec4<type>& operator=(Vec2<type>&& other) noexcept;
+			constexpr Vec4<type>& operator=(const Vec2<type>& other) noexcept;
 			//vec3 assign operator
-			Vec4<type>& operator=(const Vec3<type>& other) noexcept;
-			//vec3 move operator
-			Vec4<type>& operator=(Vec3<type>&& other) noexcept;
+			constexpr Vec4<type>& operator=(const Vec3<type>& other) noexcept;
 
 			//Vec4 other type copy constructor
 			template<typename othertype>
-			explicit Vec4(const Vec4<othertype>& other) noexcept
+			explicit constexpr Vec4(const Vec4<othertype>& other) noexcept
 				:x(static_cast<type>( other.x )), y(static_cast<type>( other.y )), z(static_cast<type>( other.z )), w(static_cast<type>( other.w ))
 			{}
-			//Vec4 other type move constructor
-			template<typename othertype>
-			explicit Vec4(Vec4<othertype>&& other) noexcept
-				: x(static_cast<type>( std::move(other.x) )), y(static_cast<type>( std::move(other.y) )), z(static_cast<type>( std::move(other.z) )), w(static_cast<type>( std::move(other.w) ))
-			{}
 			//Vec4 other type assign operator
 			template<typename othertype>
-			Vec4<type>& operator=(const Vec4<othertype>& other) noexcept
+			constexpr Vec4<type>& operator=(const Vec4<othertype>& other) noexcept
 			{
 				x = static_cast<type>( other.x );
 				y = static_cast<type>( other.y );
@@ -173,20 +122,10 @@ namespace clockwork {
 				w = static_cast<type>( other.w );
 				return *this;
 			}
-			//Vec4 other type move operator
-			template<typename othertype>
-			Vec4<type>& operator=(Vec4<othertype>&& other) noexcept
-			{
-				x = static_cast<type>( std::move(other.x) );
-				y = static_cast<type>( std::move(other.y) );
-				z = static_cast<type>( std::move(other.z) );
-				w = static_cast<type>( std::move(other.w) );
-				return *this;
-			}
 
 		public:
 			//add a value to this 
-			Vec4<type>& add(type val) noexcept
+			constexpr Vec4<type>& add(type val) noexcept
 			{
 				x += val;
 				y += val;
@@ -195,16 +134,7 @@ namespace clockwork {
 				return *this;
 			}
 			//add another Vec4 to this 
-			Vec4<type>& add(const Vec4<type>& other) noexcept
-			{
-				x += other.x;
-				y += other.y;
-				z += other.z;
-				w += other.w;
-				return *this;
-			}
-			//add another Vec4 to this 
-			Vec4<type>& add(Vec4<type>&& other) noexcept
+			constexpr Vec4<type>& add(const Vec4<type>& other) noexcept
 			{
 				x += other.x;
 				y += other.y;
@@ -213,7 +143,7 @@ namespace clockwork {
 				return *this;
 			}
 			//substract a value from this 
-			Vec4<type>& substract(type val) noexcept
+			constexpr Vec4<type>& substract(type val) noexcept
 			{
 				x -= val;
 				y -= val;
@@ -222,16 +152,7 @@ namespace clockwork {
 				return *this;
 			}
 			//substract another Vec4 from this 
-			Vec4<type>& substract(const Vec4<type>& other) noexcept
-			{
-				x -= other.x;
-				y -= other.y;
-				z -= other.z;
-				w -= other.w;
-				return *this;
-			}
-			//substract another Vec4 from this 
-			Vec4<type>& substract(Vec4<type>&& other) noexcept
+			constexpr Vec4<type>& substract(const Vec4<type>& other) noexcept
 			{
 				x -= other.x;
 				y -= other.y;
@@ -240,7 +161,7 @@ namespace clockwork {
 				return *this;
 			}
 			//multiply a value to this | elementwise, not dotproduct
-			Vec4<type>& multiply(type val) noexcept
+			constexpr Vec4<type>& multiply(type val) noexcept
 			{
 				x *= val;
 				y *= val;
@@ -249,16 +170,7 @@ namespace clockwork {
 				return *this;
 			}
 			//multiply another Vec4 to this | elementwise, not dotproduct
-			Vec4<type>& multiply(const Vec4<type>& other) noexcept
-			{
-				x *= other.x;
-				y *= other.y;
-				z *= other.z;
-				w *= other.w;
-				return *this;
-			}
-			//multiply another Vec4 to this | elementwise, not dotproduct
-			Vec4<type>& multiply(Vec4<type>&& other) noexcept
+			constexpr Vec4<type>& multiply(const Vec4<type>& other) noexcept
 			{
 				x *= other.x;
 				y *= other.y;
@@ -267,7 +179,7 @@ namespace clockwork {
 				return *this;
 			}
 			//divide a value from this 
-			Vec4<type>& divide(type val) noexcept
+			constexpr Vec4<type>& divide(type val) noexcept
 			{
 				x /= val;
 				y /= val;
@@ -276,7 +188,7 @@ namespace clockwork {
 				return *this;
 			}
 			//divide another Vec4 from this 
-			Vec4<type>& divide(const Vec4<type>& other) noexcept
+			constexpr Vec4<type>& divide(const Vec4<type>& other) noexcept
 			{
 				x /= other.x;
 				y /= other.y;
@@ -284,51 +196,26 @@ namespace clockwork {
 				w /= other.w;
 				return *this;
 			}
-			//divide another Vec4 from this 
-			Vec4<type>& divide(Vec4<type>&& other) noexcept
-			{
-				x /= other.x;
-				y /= other.y;
-				z /= other.z;
-				w /= other.w;
-				return *this;
-			}
-			//add another Vec2 to this 
-			Vec4<type>& add(const Vec2<type>& other) noexcept;
 			//add another Vec2 to this 
-			Vec4<type>& add(Vec2<type>&& other) noexcept;
-			//add another Vec3 to this 
-			Vec4<type>& add(const Vec3<type>& other) noexcept;
+			constexpr Vec4<type>& add(const Vec2<type>& other) noexcept;
 			//add another Vec3 to this 
-			Vec4<type>& add(Vec3<type>&& other) noexcept;
+			constexpr Vec4<type>& add(const Vec3<type>& other) noexcept;
 			//substract another Vec2 from this 
-			Vec4<type>& substract(const Vec2<type>& other) noexcept;
-			//substract another Vec2 from this 
-			Vec4<type>& substract(Vec2<type>&& other) noexcept;
-			//substract another Vec3 from this 
-			Vec4<type>& substract(const Vec3<type>& other) noexcept;
+			constexpr Vec4<type>& substract(const Vec2<type>& other) noexcept;
 			//substract another Vec3 from this 
-			Vec4<type>& substract(Vec3<type>&& other) noexcept;
+			constexpr Vec4<type>& substract(const Vec3<type>& other) noexcept;
 			//multiply another Vec2 to this | elementwise, not dotproduct
-			Vec4<type>& multiply(const Vec2<type>& other) noexcept;
-			//multiply another Vec2 to this | elementwise, not dotproduct
-			Vec4<type>& multiply(Vec2<type>&& other) noexcept;
-			//multiply another Vec3 to this | elementwise, not dotproduct
-			Vec4<type>& multiply(const Vec3<type>& other) noexcept;
+			constexpr Vec4<type>& multiply(const Vec2<type>& other) noexcept;
 			//multiply another Vec3 to this | elementwise, not dotproduct
-			Vec4<type>& multiply(Vec3<type>&& other) noexcept;
-			//divide another Vec2 from this 
-			Vec4<type>& divide(const Vec2<type>& other) noexcept;
+			constexpr Vec4<type>& multiply(const Vec3<type>& other) noexcept;
 			//divide another Vec2 from this 
-			Vec4<type>& divide(Vec2<type>&& other) noexcept;
+			constexpr Vec4<type>& divide(const Vec2<type>& other) noexcept;
 			//divide another Vec3 from this 
-			Vec4<type>& divide(const Vec3<type>& other) noexcept;
-			//divide another Vec3 from this 
-			Vec4<type>& divide(Vec3<type>&& other) noexcept;
+			constexpr Vec4<type>& divide(const Vec3<type>& other) noexcept;
 
 		public:
 			//negate the vec
-			friend Vec4<type> operator-(Vec4<type> vec) noexcept
+			friend constexpr Vec4<type> operator-(Vec4<type> vec) noexcept
 			{
 				vec.x = -vec.x;
 				vec.y = -vec.y;
@@ -337,7 +224,7 @@ namespace clockwork {
 				return vec;
 			}
 			//add a value to this 
-			Vec4<type>& operator+=(type val) noexcept
+			constexpr Vec4<type>& operator+=(type val) noexcept
 			{
 				x += val;
 				y += val;
@@ -346,16 +233,7 @@ namespace clockwork {
 				return *this;
 			}
 			//add another Vec4 to this 
-			Vec4<type>& operator+=(const Vec4<type>& other) noexcept
-			{
-				x += other.x;
-				y += other.y;
-				z += other.z;
-				w += other.w;
-				return *this;
-			}
-			//add another Vec4 to this 
-			Vec4<type>& operator+=(Vec4<type>&& other) noexcept
+			constexpr Vec4<type>& operator+=(const Vec4<type>& other) noexcept
 			{
 				x += other.x;
 				y += other.y;
@@ -364,7 +242,7 @@ namespace clockwork {
 				return *this;
 			}
 			//substract a value from this 
-			Vec4<type>& operator-=(type val) noexcept
+			constexpr Vec4<type>& operator-=(type val) noexcept
 			{
 				x -= val;
 				y -= val;
@@ -373,16 +251,7 @@ namespace clockwork {
 				return *this;
 			}
 			//substract another Vec4 from this 
-			Vec4<type>& operator-=(const Vec4<type>& other) noexcept
-			{
-				x -= other.x;
-				y -= other.y;
-				z -= other.z;
-				w -= other.w;
-				return *this;
-			}
-			//substract another Vec4 from this 
-			Vec4<type>& operator-=(Vec4<type>&& other) noexcept
+			constexpr Vec4<type>& operator-=(const Vec4<type>& other) noexcept
 			{
 				x -= other.x;
 				y -= other.y;
@@ -391,7 +260,7 @@ namespace clockwork {
 				return *this;
 			}
 			//multiply a value to this | elementwise, not dotproduct
-			Vec4<type>& operator*=(type val) noexcept
+			constexpr Vec4<type>& operator*=(type val) noexcept
 			{
 				x *= val;
 				y *= val;
@@ -400,16 +269,7 @@ namespace clockwork {
 				return *this;
 			}
 			//multiply another Vec4 to this | elementwise, not dotproduct
-			Vec4<type>& operator*=(const Vec4<type>& other) noexcept
-			{
-				x *= other.x;
-				y *= other.y;
-				z *= other.z;
-				w *= other.w;
-				return *this;
-			}
-			//multiply another Vec4 to this | elementwise, not dotproduct
-			Vec4<type>& operator*=(Vec4<type>&& other) noexcept
+			constexpr Vec4<type>& operator*=(const Vec4<type>& other) noexcept
 			{
 				x *= other.x;
 				y *= other.y;
@@ -418,7 +278,7 @@ namespace clockwork {
 				return *this;
 			}
 			//divide a value from this 
-			Vec4<type>& operator/=(type val) noexcept
+			constexpr Vec4<type>& operator/=(type val) noexcept
 			{
 				x /= val;
 				y /= val;
@@ -427,16 +287,7 @@ namespace clockwork {
 				return *this;
 			}
 			//divide another Vec4 from this 
-			Vec4<type>& operator/=(const Vec4<type>& other) noexcept
-			{
-				x /= other.x;
-				y /= other.y;
-				z /= other.z;
-				w /= other.w;
-				return *this;
-			}
-			//divide another Vec4 from this 
-			Vec4<type>& operator/=(Vec4<type>&& other) noexcept
+			constexpr Vec4<type>& operator/=(const Vec4<type>& other) noexcept
 			{
 				x /= other.x;
 				y /= other.y;
@@ -445,294 +296,100 @@ namespace clockwork {
 				return *this;
 			}
 			//add another Vec2 to this 
-			Vec4<type>& operator+=(const Vec2<type>& other) noexcept;
-			//add another Vec2 to this 
-			Vec4<type>& operator+=(Vec2<type>&& other) noexcept;
+			constexpr Vec4<type>& operator+=(const Vec2<type>& other) noexcept;
 			//add another Vec3 to this 
-			Vec4<type>& operator+=(const Vec3<type>& other) noexcept;
-			//add another Vec3 to this 
-			Vec4<type>& operator+=(Vec3<type>&& other) noexcept;
-			//substract another Vec2 from this 
-			Vec4<type>& operator-=(const Vec2<type>& other) noexcept;
+			constexpr Vec4<type>& operator+=(const Vec3<type>& other) noexcept;
 			//substract another Vec2 from this 
-			Vec4<type>& operator-=(Vec2<type>&& other) noexcept;
+			constexpr Vec4<type>& operator-=(const Vec2<type>& other) noexcept;
 			//substract another Vec3 from this 
-			Vec4<type>& operator-=(const Vec3<type>& other) noexcept;
-			//substract another Vec3 from this 
-			Vec4<type>& operator-=(Vec3<type>&& other) noexcept;
-			//multiply another Vec2 to this | elementwise, not dotproduct
-			Vec4<type>& operator*=(const Vec2<type>& other) noexcept;
+			constexpr Vec4<type>& operator-=(const Vec3<type>& other) noexcept;
 			//multiply another Vec2 to this | elementwise, not dotproduct
-			Vec4<type>& operator*=(Vec2<type>&& other) noexcept;
-			//multiply another Vec3 to this | elementwise, not dotproduct
-			Vec4<type>& operator*=(const Vec3<type>& other) noexcept;
+			constexpr Vec4<type>& operator*=(const Vec2<type>& other) noexcept;
 			//multiply another Vec3 to this | elementwise, not dotproduct
-			Vec4<type>& operator*=(Vec3<type>&& other) noexcept;
+			constexpr Vec4<type>& operator*=(const Vec3<type>& other) noexcept;
 			//divide another Vec2 from this 
-			Vec4<type>& operator/=(const Vec2<type>& other) noexcept;
-			//divide another Vec2 from this 
-			Vec4<type>& operator/=(Vec2<type>&& other) noexcept;
-			//divide another Vec3 from this 
-			Vec4<type>& operator/=(const Vec3<type>& other) noexcept;
+			constexpr Vec4<type>& operator/=(const Vec2<type>& other) noexcept;
 			//divide another Vec3 from this 
-			Vec4<type>& operator/=(Vec3<type>&& other) noexcept;
+			constexpr Vec4<type>& operator/=(const Vec3<type>& other) noexcept;
 			//compare all values to another lvalue Vec4
-			bool operator==(const Vec4<type>& other) const noexcept
-			{
-				return x == other.x && y == other.y && z == other.z && w == other.w;
-			}
-			//compare all values to another rvalue Vec4
-			bool operator==(Vec4<type>&& other) const noexcept
+			constexpr bool operator==(const Vec4<type>& other) const noexcept
 			{
 				return x == other.x && y == other.y && z == other.z && w == other.w;
 			}
 			//compare all values to another lvalue Vec4
-			bool operator!=(const Vec4<type>& other) const noexcept
-			{
-				return x != other.x || y != other.y || z != other.z || w != other.w;
-			}
-			//compare all values to another rvalue Vec4
-			bool operator!=(Vec4<type>&& other) const noexcept
+			constexpr bool operator!=(const Vec4<type>& other) const noexcept
 			{
 				return x != other.x || y != other.y || z != other.z || w != other.w;
 			}
 			//compare all values to another lvalue Vec4 | values are added up
-			bool operator<=(const Vec4<type>& other) const noexcept
-			{
-				return ( x + y + z + w ) <= ( other.x + other.y + other.z + other.w );
-			}
-			//compare all values to another rvalue Vec4 | values are added up
-			bool operator<=(Vec4<type>&& other) const noexcept
+			constexpr bool operator<=(const Vec4<type>& other) const noexcept
 			{
 				return ( x + y + z + w ) <= ( other.x + other.y + other.z + other.w );
 			}
 			//compare all values to another lvalue Vec4 | values are added up
-			bool operator>=(const Vec4<type>& other) const noexcept
-			{
-				return ( x + y + z + w ) >= ( other.x + other.y + other.z + other.w );
-			}
-			//compare all values to another rvalue Vec4 | values are added up
-			bool operator>=(Vec4<type>&& other) const noexcept
+			constexpr bool operator>=(const Vec4<type>& other) const noexcept
 			{
 				return ( x + y + z + w ) >= ( other.x + other.y + other.z + other.w );
 			}
 			//compare all values to another lvalue Vec4 | values are added up
-			bool operator<(const Vec4<type>& other) const noexcept
-			{
-				return ( x + y + z + w ) < ( other.x + other.y + other.z + other.w );
-			}
-			//compare all values to another rvalue Vec4 | values are added up
-			bool operator<(Vec4<type>&& other) const noexcept
+			constexpr bool operator<(const Vec4<type>& other) const noexcept
 			{
 				return ( x + y + z + w ) < ( other.x + other.y + other.z + other.w );
 			}
 			//compare all values to another lvalue Vec4 | values are added up
-			bool operator>(const Vec4<type>& other) const noexcept
-			{
-				return ( x + y + z + w ) > ( other.x + other.y + other.z + other.w );
-			}
-			//compare all values to another rvalue Vec4 | values are added up
-			bool operator>(Vec4<type>&& other) const noexcept
+			constexpr bool operator>(const Vec4<type>& other) const noexcept
 			{
 				return ( x + y + z + w ) > ( other.x + other.y + other.z + other.w );
 			}
 
 
-			//add a rvalue Vec4 object to a rvalue Vec4 object
-			friend Vec4<type>&& operator+(Vec4<type>&& v1, Vec4<type>&& v2) noexcept
-			{
-				v1.x += v2.x;
-				v1.y += v2.y;
-				v1.z += v2.z;
-				v1.w += v2.w;
-				return std::move(v1);
-			}
-			//add a rvalue Vec4 object to a lvalue Vec4 object 
-			friend Vec4<type>&& operator+(const Vec4<type>& v1, Vec4<type>&& v2) noexcept
-			{
-				v2.x += v1.x;
-				v2.y += v1.y;
-				v2.z += v1.z;
-				v2.w += v1.w;
-				return std::move(v2);
-			}
-			//add a lvalue Vec4 object to a rvalue Vec4 object
-			friend Vec4<type>&& operator+(Vec4<type>&& v1, const Vec4<type>& v2) noexcept
-			{
-				v1.x += v2.x;
-				v1.y += v2.y;
-				v1.z += v2.z;
-				v1.w += v2.w;
-				return std::move(v1);
-			}
 			//add a type to a lvalue Vec4 object
-			friend Vec4<type> operator+(const Vec4<type>& vec, type val) noexcept
+			friend constexpr Vec4<type> operator+(const Vec4<type>& vec, type val) noexcept
 			{
 				return Vec4<type>(vec.x + val, vec.y + val, vec.z + val, vec.w + val);
 			}
 			//add a lvalue Vec4 object to a lvalue Vec4 object
-			friend Vec4<type> operator+(const Vec4<type>& v1, const Vec4<type>& v2) noexcept
+			friend constexpr Vec4<type> operator+(const Vec4<type>& v1, const Vec4<type>& v2) noexcept
 			{
 				return Vec4<type>(v1.x + v2.x, v1.y + v2.y, v1.z + v2.z, v1.w + v2.w);
 			}
-			//add a rvalue Vec2 object to a rvalue Vec4 object
-			friend Vec4<type>&& operator+<type>( Vec4<type>&& v1, Vec2<type>&& v2 ) noexcept;
-			//add a lvalue Vec2 object to a rvalue Vec4 object
-			friend Vec4<type>&& operator+<type>( Vec4<type>&& v1, const Vec2<type>& v2 ) noexcept;
-			//add a lvalue Vec2 object to a lvalue Vec4 object
-			friend Vec4<type> operator+<type>( const Vec4<type>& v1, const Vec2<type>& v2 ) noexcept;
-			//add a rvalue Vec3 object to a rvalue Vec4 object
-			friend Vec4<type>&& operator+<type>( Vec4<type>&& v1, Vec3<type>&& v2 ) noexcept;
-			//add a lvalue Vec3 object to a rvalue Vec4 object
-			friend Vec4<type>&& operator+<type>( Vec4<type>&& v1, const Vec3<type>& v2 ) noexcept;
-			//add a lvalue Vec3 object to a lvalue Vec4 object
-			friend Vec4<type> operator+<type>( const Vec4<type>& v1, const Vec3<type>& v2 ) noexcept;
-			//substract a rvalue Vec4 object from a rvalue Vec4 object
-			friend Vec4<type>&& operator-(Vec4<type>&& v1, Vec4<type>&& v2) noexcept
-			{
-				v1.x -= v2.x;
-				v1.y -= v2.y;
-				v1.z -= v2.z;
-				v1.w -= v2.w;
-				return std::move(v1);
-			}
-			//substract a rvalue Vec4 object from a lvalue Vec4 object 
-			friend Vec4<type> operator-(const Vec4<type>& v1, Vec4<type>&& v2) noexcept
-			{
-				return Vec4<type>(v1.x - v2.x, v1.y - v2.y, v1.z - v2.z, v1.w - v2.w);
-			}
-			//substract a lvalue Vec4 object from a rvalue Vec4 object
-			friend Vec4<type>&& operator-(Vec4<type>&& v1, const Vec4<type>& v2) noexcept
-			{
-				v1.x -= v2.x;
-				v1.y -= v2.y;
-				v1.z -= v2.z;
-				v1.w -= v2.w;
-				return std::move(v1);
-			}
 			//substract a type from a lvalue Vec4 object
-			friend Vec4<type> operator-(const Vec4<type>& vec, type val) noexcept
+			friend constexpr Vec4<type> operator-(const Vec4<type>& vec, type val) noexcept
 			{
 				return Vec4<type>(vec.x - val, vec.y - val, vec.z - val, vec.w - val);
 			}
 			//substract a lvalue Vec4 object from a lvalue Vec4 object
-			friend Vec4<type> operator-(const Vec4<type>& v1, const Vec4<type>& v2) noexcept
+			friend constexpr Vec4<type> operator-(const Vec4<type>& v1, const Vec4<type>& v2) noexcept
 			{
 				return Vec4<type>(v1.x - v2.x, v1.y - v2.y, v1.z - v2.z, v1.w - v2.w);
 			}
-			//substract a rvalue Vec2 object from a rvalue Vec4 object
-			friend Vec4<type>&& operator-<type>( Vec4<type>&& v1, Vec2<type>&& v2 ) noexcept;
-			//substract a lvalue Vec2 object from a rvalue Vec4 object
-			friend Vec4<type>&& operator-<type>( Vec4<type>&& v1, const Vec2<type>& v2 ) noexcept;
-			//substract a lvalue Vec2 object from a lvalue Vec4 object
-			friend Vec4<type> operator-<type>( const Vec4<type>& v1, const Vec2<type>& v2 ) noexcept;
-			//substract a rvalue Vec3 object from a rvalue Vec4 object
-			friend Vec4<type>&& operator-<type>( Vec4<type>&& v1, Vec3<type>&& v2 ) noexcept;
-			//substract a lvalue Vec3 object from a rvalue Vec4 object
-			friend Vec4<type>&& operator-<type>( Vec4<type>&& v1, const Vec3<type>& v2 ) noexcept;
-			//substract a lvalue Vec3 object from a lvalue Vec4 object
-			friend Vec4<type> operator-<type>( const Vec4<type>& v1, const Vec3<type>& v2 ) noexcept;
-			//multiply a rvalue Vec4 object to a rvalue Vec4 object | elementwise, not dotproduct
-			friend Vec4<type>&& operator*(Vec4<type>&& v1, Vec4<type>&& v2) noexcept
-			{
-				v1.x *= v2.x;
-				v1.y *= v2.y;
-				v1.z *= v2.z;
-				v1.w *= v2.w;
-				return std::move(v1);
-			}
-			//multiply a rvalue Vec4 object to a lvalue Vec4 object | elementwise, not dotproduct
-			friend Vec4<type>&& operator*(const Vec4<type>& v1, Vec4<type>&& v2) noexcept
-			{
-				v2.x *= v1.x;
-				v2.y *= v1.y;
-				v2.z *= v1.z;
-				v2.w *= v1.w;
-				return std::move(v2);
-			}
-			//multiply a lvalue Vec4 object to a rvalue Vec4 object | elementwise, not dotproduct
-			friend Vec4<type>&& operator*(Vec4<type>&& v1, const Vec4<type>& v2) noexcept
-			{
-				v1.x *= v2.x;
-				v1.y *= v2.y;
-				v1.z *= v2.z;
-				v1.w *= v2.w;
-				return std::move(v1);
-			}
 			//multiply a type to a lvalue Vec4 object | elementwise, not dotproduct
-			friend Vec4<type> operator*(type val, const Vec4<type>& vec) noexcept
+			friend constexpr Vec4<type> operator*(type val, const Vec4<type>& vec) noexcept
 			{
 				return Vec4<type>(vec.x * val, vec.y * val, vec.z * val, vec.w * val);
 			}
 			//multiply a type to a lvalue Vec4 object | elementwise, not dotproduct
-			friend Vec4<type> operator*(const Vec4<type>& vec, type val) noexcept
+			friend constexpr Vec4<type> operator*(const Vec4<type>& vec, type val) noexcept
 			{
 				return Vec4<type>(vec.x * val, vec.y * val, vec.z * val, vec.w * val);
 			}
 			//multiply a lvalue Vec4 object to a lvalue Vec4 object | elementwise, not dotproduct
-			friend Vec4<type> operator*(const Vec4<type>& v1, const Vec4<type>& v2) noexcept
+			friend constexpr Vec4<type> operator*(const Vec4<type>& v1, const Vec4<type>& v2) noexcept
 			{
 				return Vec4<type>(v1.x * v2.x, v1.y * v2.y, v1.z * v2.z, v1.w * v2.w);
 			}
-			//multiply a rvalue Vec2 object to a rvalue Vec4 object | elementwise, not dotproduct
-			friend Vec4<type>&& operator*<type>( Vec4<type>&& v1, Vec2<type>&& v2 ) noexcept;
-			//multiply a lvalue Vec2 object to a rvalue Vec4 object | elementwise, not dotproduct
-			friend Vec4<type>&& operator*<type>( Vec4<type>&& v1, const Vec2<type>& v2 ) noexcept;
-			//multiply a lvalue Vec2 object to a lvalue Vec4 object | elementwise, not dotproduct
-			friend Vec4<type> operator*<type>( const Vec4<type>& v1, const Vec2<type>& v2 ) noexcept;
-			//multiply a rvalue Vec3 object to a rvalue Vec4 object | elementwise, not dotproduct
-			friend Vec4<type>&& operator*<type>( Vec4<type>&& v1, Vec3<type>&& v2 ) noexcept;
-			//multiply a lvalue Vec3 object to a rvalue Vec4 object | elementwise, not dotproduct
-			friend Vec4<type>&& operator*<type>( Vec4<type>&& v1, const Vec3<type>& v2 ) noexcept;
-			//multiply a lvalue Vec3 object to a lvalue Vec4 object | elementwise, not dotproduct
-			friend Vec4<type> operator*<type>( const Vec4<type>& v1, const Vec3<type>& v2 ) noexcept;
-			//divide a rvalue Vec4 object to a rvalue Vec4 object
-			friend Vec4<type>&& operator/(Vec4<type>&& v1, Vec4<type>&& v2) noexcept
-			{
-				v1.x /= v2.x;
-				v1.y /= v2.y;
-				v1.z /= v2.z;
-				v1.w /= v2.w;
-				return std::move(v1);
-			}
-			//divide a rvalue Vec4 object to a lvalue Vec4 object 
-			friend Vec4<type> operator/(const Vec4<type>& v1, Vec4<type>&& v2) noexcept
-			{
-				return Vec4<type>(v1.x / v2.x, v1.y / v2.y, v1.z / v2.z, v1.w / v2.w);
-			}
-			//divide a lvalue Vec4 object to a rvalue Vec4 object
-			friend Vec4<type>&& operator/(Vec4<type>&& v1, const Vec4<type>& v2) noexcept
-			{
-				v1.x /= v2.x;
-				v1.y /= v2.y;
-				v1.z /= v2.z;
-				v1.w /= v2.w;
-				return std::move(v1);
-			}
 			//divide a type to a lvalue Vec4 object
-			friend Vec4<type> operator/(const Vec4<type>& vec, type val) noexcept
+			friend constexpr Vec4<type> operator/(const Vec4<type>& vec, type val) noexcept
 			{
 				return Vec4<type>(vec.x / val, vec.y / val, vec.z / val, vec.w / val);
 			}
 			//divide a lvalue Vec4 object to a lvalue Vec4 object
-			friend Vec4<type> operator/(const Vec4<type>& v1, const Vec4<type>& v2) noexcept
+			friend constexpr Vec4<type> operator/(const Vec4<type>& v1, const Vec4<type>& v2) noexcept
 			{
 				return Vec4<type>(v1.x / v2.x, v1.y / v2.y, v1.z / v2.z, v1.w / v2.w);
 			}
-			//divide a rvalue Vec2 object to a rvalue Vec4 object
-			friend Vec4<type>&& operator/<type>( Vec4<type>&& v1, Vec2<type>&& v2 ) noexcept;
-			//divide a lvalue Vec2 object to a rvalue Vec4 object
-			friend Vec4<type>&& operator/<type>( Vec4<type>&& v1, const Vec2<type>& v2 ) noexcept;
-			//divide a lvalue Vec2 object to a lvalue Vec4 object
-			friend Vec4<type> operator/<type>( const Vec4<type>& v1, const Vec2<type>& v2 ) noexcept;
-			//divide a rvalue Vec3 object to a rvalue Vec4 object
-			friend Vec4<type>&& operator/<type>( Vec4<type>&& v1, Vec3<type>&& v2 ) noexcept;
-			//divide a lvalue Vec3 object to a rvalue Vec4 object
-			friend Vec4<type>&& operator/<type>( Vec4<type>&& v1, const Vec3<type>& v2 ) noexcept;
-			//divide a lvalue Vec3 object to a lvalue Vec4 object
-			friend Vec4<type> operator/<type>( const Vec4<type>& v1, const Vec3<type>& v2 ) noexcept;
 			//modulo a vec4 with a number(only works with int and will take int values)
-			friend Vec4<type> operator%(const Vec4<type>& vec, int val) noexcept
+			friend constexpr Vec4<type> operator%(const Vec4<type>& vec, int val) noexcept
 			{
 				return Vec4<type>(static_cast<int>( vec.x ) % val, static_cast<int>( vec.y ) % val, static_cast<int>( vec.z ) % val, static_cast<int>( vec.w ) % val);
 			}
@@ -754,7 +411,7 @@ namespace clockwork {
 				return std::sqrt(x * x + y * y + z * z + w * w);
 			}
 			//|vec| returns the lenght of the vec/direct distance from origin vec(0,0,0,0) | the fast method
-			type fastLenght() const noexcept
+			constexpr type fastLenght() const noexcept
 			{
 				type result = 0;
 				if ( x < 0 )
@@ -810,7 +467,7 @@ namespace clockwork {
 				return std::sqrt(( x - other.x ) * ( x - other.x ) + ( y - other.y ) * ( y - other.y ) + ( z - other.z ) * ( z - other.z ) + ( w - other.w ) * ( w - other.w ));
 			}
 			//|vec1-vec2| can be used to compare distances, will return the non negative value of the components added together 
-			type fastDistance(const Vec4<type>& other) const noexcept
+			constexpr type fastDistance(const Vec4<type>& other) const noexcept
 			{
 				type tempx;
 				if ( other.x < x )
@@ -836,13 +493,7 @@ namespace clockwork {
 			}
 			/*vec1*vec2 = |vec1|*|vec2|*cos(vec1,vec2) returns the dotproduct of 2 vecs, vecs are orthogonal(_|_) if the result is 0 and vecs are parallel if the result is 1(||) | x * other.x + y * other.y + z * other.z + w * other.w | not the normal multiply method 
 			its more efficient than comparing the vecs with the magnitude method*/
-			type dotproduct(const Vec4<type>& other) const noexcept
-			{
-				return x * other.x + y * other.y + z * other.z + w * other.w;
-			}
-			/*vec1*vec2 = |vec1|*|vec2|*cos(vec1,vec2) returns the dotproduct of 2 vecs, vecs are orthogonal(_|_) if the result is 0 and vecs are parallel if the result is 1(||) | x * other.x + y * other.y + z * other.z + w * other.w | not the normal multiply method 
-			its more efficient than comparing the vecs with the magnitude method*/
-			type dotproduct(Vec4<type>&& other) const noexcept
+			constexpr type dotproduct(const Vec4<type>& other) const noexcept
 			{
 				return x * other.x + y * other.y + z * other.z + w * other.w;
 			}
@@ -851,28 +502,13 @@ namespace clockwork {
 			{
 				return std::acos(( x * other.x + y * other.y + z * other.z + w * other.w ) / ( std::sqrt(x * x + y * y + z * z + w * w) * std::sqrt(other.x * other.x + other.y * other.y + other.z * other.z + other.w * other.w) ));
 			}
-			//acos(dotproduct() / (magnitude()*other.magnitude())) returns the angle between 2 vecs in radians 
-			type angleR(Vec4<type>&& other) const noexcept
-			{
-				return std::acos(( x * other.x + y * other.y + z * other.z + w * other.w ) / ( std::sqrt(x * x + y * y + z * z + w * w) * std::sqrt(other.x * other.x + other.y * other.y + other.z * other.z + other.w * other.w) ));
-			}
 			//acos(dotproduct() / (magnitude()*other.magnitude())) returns the angle between 2 vecs in degrees 
 			type angleD(const Vec4<type>& other) const noexcept
 			{
 				return std::acos(( x * other.x + y * other.y + z * other.z + w * other.w ) / ( std::sqrt(x * x + y * y + z * z + w * w) * std::sqrt(other.x * other.x + other.y * other.y + other.z * other.z + other.w * other.w) ))*( 180.0 / 3.14159265359 );
 			}
-			//acos(dotproduct() / (magnitude()*other.magnitude())) returns the angle between 2 vecs in degrees 
-			type angleD(Vec4<type>&& other) const noexcept
-			{
-				return std::acos(( x * other.x + y * other.y + z * other.z + w * other.w ) / ( std::sqrt(x * x + y * y + z * z + w * w) * std::sqrt(other.x * other.x + other.y * other.y + other.z * other.z + other.w * other.w) ))*( 180.0 / 3.14159265359 );
-			}
 			//vec1xvec2 returns the orthogonal vec to the level of the 2 other vecs(_|/), magnitude of the vec is the area of the 2 vecs | ignores w, w is 0 
-			Vec4<type> crossproduct(const Vec4<type>& other) const noexcept
-			{
-				return Vec4<type>(y*other.z - z * other.y, z* other.x - x * other.z, x * other.y - y * other.x, 0);
-			}
-			//vec1xvec2 returns the orthogonal vec to the level of the 2 other vecs(_|/), magnitude of the vec is the area of the 2 vecs | ignores w, w is 0 
-			Vec4<type> crossproduct(Vec4<type>&& other) const noexcept
+			constexpr Vec4<type> crossproduct(const Vec4<type>& other) const noexcept
 			{
 				return Vec4<type>(y*other.z - z * other.y, z* other.x - x * other.z, x * other.y - y * other.x, 0);
 			}
@@ -881,31 +517,11 @@ namespace clockwork {
 			{
 				return std::sqrt(( y*other.z - z * other.y ) * ( y*other.z - z * other.y ) + ( z* other.x - x * other.z ) * ( z* other.x - x * other.z ) + ( x * other.y - y * other.x ) * ( x * other.y - y * other.x ));
 			}
-			//|vec1xvec2| returns the area of the 2 vecs, also is the magnitude of the crossproduct | ignores w, w is 0 
-			type area(Vec4<type>&& other) const noexcept
-			{
-				return std::sqrt(( y*other.z - z * other.y ) * ( y*other.z - z * other.y ) + ( z* other.x - x * other.z ) * ( z* other.x - x * other.z ) + ( x * other.y - y * other.x ) * ( x * other.y - y * other.x ));
-			}
 			//(vec1xvec2)*vec3 returns the non negative |volume| of the 3 vecs, also called triple product | ignores w, w is 0 | std::sqrt(( this->crossproduct(v2).dotproduct(v3) ) *( this->crossproduct(v2).dotproduct(v3) )) | not the normal multiply method 
 			type volume(const Vec4<type>& v2, const Vec4<type>& v3) const noexcept
 			{
 				return std::sqrt(( this->crossproduct(v2).dotproduct(v3) ) *( this->crossproduct(v2).dotproduct(v3) ));
 			}
-			//(vec1xvec2)*vec3 returns the non negative |volume| of the 3 vecs, also called triple product | ignores w, w is 0 | std::sqrt(( this->crossproduct(v2).dotproduct(v3) ) *( this->crossproduct(v2).dotproduct(v3) )) | not the normal multiply method 
-			type volume(Vec4<type>&& v2, Vec4<type>&& v3) const noexcept
-			{
-				return std::sqrt(( this->crossproduct(v2).dotproduct(v3) ) *( this->crossproduct(v2).dotproduct(v3) ));
-			}
-			//(vec1xvec2)*vec3 returns the non negative |volume| of the 3 vecs, also called triple product | ignores w, w is 0 | std::sqrt(( this->crossproduct(v2).dotproduct(v3) ) *( this->crossproduct(v2).dotproduct(v3) )) | not the normal multiply method 
-			type volume(Vec4<type>&& v2, const Vec4<type>& v3) const noexcept
-			{
-				return std::sqrt(( this->crossproduct(v2).dotproduct(v3) ) *( this->crossproduct(v2).dotproduct(v3) ));
-			}
-			//(vec1xvec2)*vec3 returns the non negative |volume| of the 3 vecs, also called triple product | ignores w, w is 0 | std::sqrt(( this->crossproduct(v2).dotproduct(v3) ) *( this->crossproduct(v2).dotproduct(v3) )) | not the normal multiply method 
-			type volume(const Vec4<type>& v2, Vec4<type>&& v3) const noexcept
-			{
-				return std::sqrt(( this->crossproduct(v2).dotproduct(v3) ) *( this->crossproduct(v2).dotproduct(v3) ));
-			}
 			//vec as string: "Vec4<type>(x,y,z,w)"
 			std::string toString() const noexcept
 			{
@@ -933,76 +549,38 @@ namespace clockwork {
 	namespace maths {
 
 		//vec2 copy constructor
-		template<typename type>Vec4<type>::Vec4(const Vec2<type>& other) noexcept
+		template<typename type>constexpr Vec4<type>::Vec4(const Vec2<type>& other) noexcept
 			:x(other.x), y(other.y), z(0), w(0)
 		{}
-		//vec2 move constructor
-		template<typename type>Vec4<type>::Vec4(Vec2<type>&& other) noexcept
-			: x(std::move(other.x)), y(std::move(other.y)), z(0), w(0)
-		{}
 		//vec3 copy constructor
-		template<typename type>Vec4<type>::Vec4(const Vec3<type>& other) noexcept
+		template<typename type>constexpr Vec4<type>::Vec4(const Vec3<type>& other) noexcept
 			: x(other.x), y(other.y), z(other.z), w(0)
 		{}
-		//vec3 move constructor
-		template<typename type>Vec4<type>::Vec4(Vec3<type>&& other) noexcept
-			: x(std::move(other.x)), y(std::move(other.y)), z(std::move(other.z)), w(0)
-		{}
 		//vec2 assign operator
-		template<typename type>Vec4<type>& Vec4<type>::operator=(const Vec2<type>& other) noexcept
+		template<typename type>constexpr Vec4<type>& Vec4<type>::operator=(const Vec2<type>& other) noexcept
 		{
 			x = other.x;
 			y = other.y;
 			return *this;
 		}
-		//vec2 move operator
-		template<typename type>Vec4<type>& Vec4<type>::operator=(Vec2<type>&& other) noexcept
-		{
-			x = std::move(other.x);
-			y = std::move(other.y);
-			return *this;
-		}
 		//vec3 assign operator
-		template<typename type>Vec4<type>& Vec4<type>::operator=(const Vec3<type>& other) noexcept
+		template<typename type>constexpr Vec4<type>& Vec4<type>::operator=(const Vec3<type>& other) noexcept
 		{
 			x = other.x;
 			y = other.y;
 			z = other.z;
 			return *this;
 		}
-		//vec3 move operator
-		template<typename type>Vec4<type>& Vec4<type>::operator=(Vec3<type>&& other) noexcept
-		{
-			x = std::move(other.x);
-			y = std::move(other.y);
-			z = std::move(other.z);
-			return *this;
-		}
 
 		//add another Vec2 to this 
-		template<typename type>Vec4<type>& Vec4<type>::add(const Vec2<type>& other) noexcept
-		{
-			x += other.x;
-			y += other.y;
-			return *this;
-		}
-		//add another Vec2 to this 
-		template<typename type>Vec4<type>& Vec4<type>::add(Vec2<type>&& other) noexcept
-		{
-			x += other.x;
-			y += other.y;
-			return *this;
-		}
-		//add another Vec3 to this 
-		template<typename type>Vec4<type>& Vec4<type>::add(const Vec3<type>& other) noexcept
+		template<typename type>constexpr Vec4<type>& Vec4<type>::add(const Vec2<type>& other) noexcept
 		{
 			x += other.x;
 			y += other.y;
-			z += other.z;
 			return *this;
 		}
 		//add another Vec3 to this 
-		template<typename type>Vec4<type>& Vec4<type>::add(Vec3<type>&& other) noexcept
+		template<typename type>constexpr Vec4<type>& Vec4<type>::add(const Vec3<type>& other) noexcept
 		{
 			x += other.x;
 			y += other.y;
@@ -1010,59 +588,29 @@ namespace clockwork {
 			return *this;
 		}
 		//substract another Vec2 from this 
-		template<typename type>Vec4<type>& Vec4<type>::substract(const Vec2<type>& other) noexcept
-		{
-			x -= other.x;
-			y -= other.y;
-			return *this;
-		}
-		//substract another Vec2 from this 
-		template<typename type>Vec4<type>& Vec4<type>::substract(Vec2<type>&& other) noexcept
+		template<typename type>constexpr Vec4<type>& Vec4<type>::substract(const Vec2<type>& other) noexcept
 		{
 			x -= other.x;
 			y -= other.y;
 			return *this;
 		}
 		//substract another Vec3 from this 
-		template<typename type>Vec4<type>& Vec4<type>::substract(const Vec3<type>& other) noexcept
+		template<typename type>constexpr Vec4<type>& Vec4<type>::substract(const Vec3<type>& other) noexcept
 		{
 			x -= other.x;
 			y -= other.y;
 			z -= other.z;
 			return *this;
 		}
-		//substract another Vec3 from this 
-		template<typename type>Vec4<type>& Vec4<type>::substract(Vec3<type>&& other) noexcept
-		{
-			x -= other.x;
-			y -= other.y;
-			z -= other.z;
-			return *this;
-		}
-		//multiply another Vec2 to this | elementwise, not dotproduct
-		template<typename type>Vec4<type>& Vec4<type>::multiply(const Vec2<type>& other) noexcept
-		{
-			x *= other.x;
-			y *= other.y;
-			return *this;
-		}
 		//multiply another Vec2 to this | elementwise, not dotproduct
-		template<typename type>Vec4<type>& Vec4<type>::multiply(Vec2<type>&& other) noexcept
-		{
-			x *= other.x;
-			y *= other.y;
-			return *this;
-		}
-		//multiply another Vec3 to this | elementwise, not dotproduct
-		template<typename type>Vec4<type>& Vec4<type>::multiply(const Vec3<type>& other) noexcept
+		template<typename type>constexpr Vec4<type>& Vec4<type>::multiply(const Vec2<type>& other) noexcept
 		{
 			x *= other.x;
 			y *= other.y;
-			z *= other.z;
 			return *this;
 		}
 		//multiply another Vec3 to this | elementwise, not dotproduct
-		template<typename type>Vec4<type>& Vec4<type>::multiply(Vec3<type>&& other) noexcept
+		template<typename type>constexpr Vec4<type>& Vec4<type>::multiply(const Vec3<type>& other) noexcept
 		{
 			x *= other.x;
 			y *= other.y;
@@ -1070,29 +618,14 @@ namespace clockwork {
 			return *this;
 		}
 		//divide another Vec2 from this 
-		template<typename type>Vec4<type>& Vec4<type>::divide(const Vec2<type>& other) noexcept
-		{
-			x /= other.x;
-			y /= other.y;
-			return *this;
-		}
-		//divide another Vec2 from this 
-		template<typename type>Vec4<type>& Vec4<type>::divide(Vec2<type>&& other) noexcept
+		template<typename type>constexpr Vec4<type>& Vec4<type>::divide(const Vec2<type>& other) noexcept
 		{
 			x /= other.x;
 			y /= other.y;
 			return *this;
 		}
 		//divide another Vec3 from this 
-		template<typename type>Vec4<type>& Vec4<type>::divide(const Vec3<type>& other) noexcept
-		{
-			x /= other.x;
-			y /= other.y;
-			z /= other.z;
-			return *this;
-		}
-		//divide another Vec3 from this 
-		template<typename type>Vec4<type>& Vec4<type>::divide(Vec3<type>&& other) noexcept
+		template<typename type>constexpr Vec4<type>& Vec4<type>::divide(const Vec3<type>& other) noexcept
 		{
 			x /= other.x;
 			y /= other.y;
@@ -1101,59 +634,29 @@ namespace clockwork {
 		}
 
 		//add another Vec2 to this 
-		template<typename type>Vec4<type>& Vec4<type>::operator+=(const Vec2<type>& other) noexcept
-		{
-			x += other.x;
-			y += other.y;
-			return *this;
-		}
-		//add another Vec2 to this 
-		template<typename type>Vec4<type>& Vec4<type>::operator+=(Vec2<type>&& other) noexcept
+		template<typename type>constexpr Vec4<type>& Vec4<type>::operator+=(const Vec2<type>& other) noexcept
 		{
 			x += other.x;
 			y += other.y;
 			return *this;
 		}
 		//add another Vec3 to this 
-		template<typename type>Vec4<type>& Vec4<type>::operator+=(const Vec3<type>& other) noexcept
+		template<typename type>constexpr Vec4<type>& Vec4<type>::operator+=(const Vec3<type>& other) noexcept
 		{
 			x += other.x;
 			y += other.y;
 			z += other.z;
 			return *this;
 		}
-		//add another Vec3 to this 
-		template<typename type>Vec4<type>& Vec4<type>::operator+=(Vec3<type>&& other) noexcept
-		{
-			x += other.x;
-			y += other.y;
-			z += other.z;
-			return *this;
-		}
-		//substract another Vec2 from this 
-		template<typename type>Vec4<type>& Vec4<type>::operator-=(const Vec2<type>& other) noexcept
-		{
-			x -= other.x;
-			y -= other.y;
-			return *this;
-		}
 		//substract another Vec2 from this 
-		template<typename type>Vec4<type>& Vec4<type>::operator-=(Vec2<type>&& other) noexcept
-		{
-			x -= other.x;
-			y -= other.y;
-			return *this;
-		}
-		//substract another Vec3 from this 
-		template<typename type>Vec4<type>& Vec4<type>::operator-=(const Vec3<type>& other) noexcept
+		template<typename type>constexpr Vec4<type>& Vec4<type>::operator-=(const Vec2<type>& other) noexcept
 		{
 			x -= other.x;
 			y -= other.y;
-			z -= other.z;
 			return *this;
 		}
 		//substract another Vec3 from this 
-		template<typename type>Vec4<type>& Vec4<type>::operator-=(Vec3<type>&& other) noexcept
+		template<typename type>constexpr Vec4<type>& Vec4<type>::operator-=(const Vec3<type>& other) noexcept
 		{
 			x -= other.x;
 			y -= other.y;
@@ -1161,59 +664,29 @@ namespace clockwork {
 			return *this;
 		}
 		//multiply another Vec2 to this | elementwise, not dotproduct
-		template<typename type>Vec4<type>& Vec4<type>::operator*=(const Vec2<type>& other) noexcept
-		{
-			x *= other.x;
-			y *= other.y;
-			return *this;
-		}
-		//multiply another Vec2 to this | elementwise, not dotproduct
-		template<typename type>Vec4<type>& Vec4<type>::operator*=(Vec2<type>&& other) noexcept
+		template<typename type>constexpr Vec4<type>& Vec4<type>::operator*=(const Vec2<type>& other) noexcept
 		{
 			x *= other.x;
 			y *= other.y;
 			return *this;
 		}
 		//multiply another Vec3 to this | elementwise, not dotproduct
-		template<typename type>Vec4<type>& Vec4<type>::operator*=(const Vec3<type>& other) noexcept
+		template<typename type>constexpr Vec4<type>& Vec4<type>::operator*=(const Vec3<type>& other) noexcept
 		{
 			x *= other.x;
 			y *= other.y;
 			z *= other.z;
 			return *this;
 		}
-		//multiply another Vec3 to this | elementwise, not dotproduct
-		template<typename type>Vec4<type>& Vec4<type>::operator*=(Vec3<type>&& other) noexcept
-		{
-			x *= other.x;
-			y *= other.y;
-			z *= other.z;
-			return *this;
-		}
-		//divide another Vec2 from this 
-		template<typename type>Vec4<type>& Vec4<type>::operator/=(const Vec2<type>& other) noexcept
-		{
-			x /= other.x;
-			y /= other.y;
-			return *this;
-		}
 		//divide another Vec2 from this 
-		template<typename type>Vec4<type>& Vec4<type>::operator/=(Vec2<type>&& other) noexcept
+		template<typename type>constexpr Vec4<type>& Vec4<type>::operator/=(const Vec2<type>& other) noexcept
 		{
 			x /= other.x;
 			y /= other.y;
 			return *this;
 		}
 		//divide another Vec3 from this 
-		template<typename type>Vec4<type>& Vec4<type>::operator/=(const Vec3<type>& other) noexcept
-		{
-			x /= other.x;
-			y /= other.y;
-			z /= other.z;
-			return *this;
-		}
-		//divide another Vec3 from this 
-		template<typename type>Vec4<type>& Vec4<type>::operator/=(Vec3<type>&& other) noexcept
+		template<typename type>constexpr Vec4<type>& Vec4<type>::operator/=(const Vec3<type>& other) noexcept
 		{
 			x /= other.x;
 			y /= other.y;
@@ -1222,163 +695,43 @@ namespace clockwork {
 		}
 
 
-		//add a rvalue Vec2 object to a rvalue Vec4 object
-		template<typename type>Vec4<type>&& operator+(Vec4<type>&& v1, Vec2<type>&& v2) noexcept
-		{
-			v1.x += v2.x;
-			v1.y += v2.y;
-			return std::move(v1);
-		}
-		//add a lvalue Vec2 object to a rvalue Vec4 object
-		template<typename type>Vec4<type>&& operator+(Vec4<type>&& v1, const Vec2<type>& v2) noexcept
-		{
-			v1.x += v2.x;
-			v1.y += v2.y;
-			return std::move(v1);
-		}
 		//add a lvalue Vec2 object to a lvalue Vec4 object
-		template<typename type>Vec4<type> operator+(const Vec4<type>& v1, const Vec2<type>& v2) noexcept
+		template<typename type>constexpr Vec4<type> operator+(const Vec4<type>& v1, const Vec2<type>& v2) noexcept
 		{
 			return Vec4<type>(v1.x + v2.x, v1.y + v2.y, v1.z, v1.w);
 		}
-		//add a rvalue Vec3 object to a rvalue Vec4 object
-		template<typename type>Vec4<type>&& operator+(Vec4<type>&& v1, Vec3<type>&& v2) noexcept
-		{
-			v1.x += v2.x;
-			v1.y += v2.y;
-			v1.z += v2.z;
-			return std::move(v1);
-		}
-		//add a lvalue Vec3 object to a rvalue Vec4 object
-		template<typename type>Vec4<type>&& operator+(Vec4<type>&& v1, const Vec3<type>& v2) noexcept
-		{
-			v1.x += v2.x;
-			v1.y += v2.y;
-			v1.z += v2.z;
-			return std::move(v1);
-		}
 		//add a lvalue Vec3 object to a lvalue Vec4 object
-		template<typename type>Vec4<type> operator+(const Vec4<type>& v1, const Vec3<type>& v2) noexcept
+		template<typename type>constexpr Vec4<type> operator+(const Vec4<type>& v1, const Vec3<type>& v2) noexcept
 		{
 			return Vec4<type>(v1.x + v2.x, v1.y + v2.y, v1.z + v2.z, v1.w);
 		}
-		//substract a rvalue Vec2 object from a rvalue Vec4 object
-		template<typename type>Vec4<type>&& operator-(Vec4<type>&& v1, Vec2<type>&& v2) noexcept
-		{
-			v1.x -= v2.x;
-			v1.y -= v2.y;
-			return std::move(v1);
-		}
-		//substract a lvalue Vec2 object from a rvalue Vec4 object
-		template<typename type>Vec4<type>&& operator-(Vec4<type>&& v1, const Vec2<type>& v2) noexcept
-		{
-			v1.x -= v2.x;
-			v1.y -= v2.y;
-			return std::move(v1);
-		}
 		//substract a lvalue Vec2 object from a lvalue Vec4 object
-		template<typename type>Vec4<type> operator-(const Vec4<type>& v1, const Vec2<type>& v2) noexcept
+		template<typename type>constexpr Vec4<type> operator-(const Vec4<type>& v1, const Vec2<type>& v2) noexcept
 		{
 			return Vec4<type>(v1.x - v2.x, v1.y - v2.y, v1.z, v1.w);
 		}
-		//substract a rvalue Vec3 object from a rvalue Vec4 object
-		template<typename type>Vec4<type>&& operator-(Vec4<type>&& v1, Vec3<type>&& v2) noexcept
-		{
-			v1.x -= v2.x;
-			v1.y -= v2.y;
-			v1.z -= v2.z;
-			return std::move(v1);
-		}
-		//substract a lvalue Vec3 object from a rvalue Vec4 object
-		template<typename type>Vec4<type>&& operator-(Vec4<type>&& v1, const Vec3<type>& v2) noexcept
-		{
-			v1.x -= v2.x;
-			v1.y -= v2.y;
-			v1.z -= v2.z;
-			return std::move(v1);
-		}
 		//substract a lvalue Vec3 object from a lvalue Vec4 object
-		template<typename type>Vec4<type> operator-(const Vec4<type>& v1, const Vec3<type>& v2) noexcept
+		template<typename type>constexpr Vec4<type> operator-(const Vec4<type>& v1, const Vec3<type>& v2) noexcept
 		{
 			return Vec4<type>(v1.x - v2.x, v1.y - v2.y, v1.z - v2.z, v1.w);
 		}
-		//multiply a rvalue Vec2 object to a rvalue Vec4 object | elementwise, not dotproduct
-		template<typename type>Vec4<type>&& operator*(Vec4<type>&& v1, Vec2<type>&& v2) noexcept
-		{
-			v1.x *= v2.x;
-			v1.y *= v2.y;
-			return std::move(v1);
-		}
-		//multiply a lvalue Vec2 object to a rvalue Vec4 object | elementwise, not dotproduct
-		template<typename type>Vec4<type>&& operator*(Vec4<type>&& v1, const Vec2<type>& v2) noexcept
-		{
-			v1.x *= v2.x;
-			v1.y *= v2.y;
-			return std::move(v1);
-		}
 		//multiply a lvalue Vec2 object to a lvalue Vec4 object | elementwise, not dotproduct
-		template<typename type>Vec4<type> operator*(const Vec4<type>& v1, const Vec2<type>& v2) noexcept
+		template<typename type>constexpr Vec4<type> operator*(const Vec4<type>& v1, const Vec2<type>& v2) noexcept
 		{
 			return Vec4<type>(v1.x * v2.x, v1.y * v2.y, v1.z, v1.w);
 		}
-		//multiply a rvalue Vec3 object to a rvalue Vec4 object | elementwise, not dotproduct
-		template<typename type>Vec4<type>&& operator*(Vec4<type>&& v1, Vec3<type>&& v2) noexcept
-		{
-			v1.x *= v2.x;
-			v1.y *= v2.y;
-			v1.z *= v2.z;
-			return std::move(v1);
-		}
-		//multiply a lvalue Vec3 object to a rvalue Vec4 object | elementwise, not dotproduct
-		template<typename type>Vec4<type>&& operator*(Vec4<type>&& v1, const Vec3<type>& v2) noexcept
-		{
-			v1.x *= v2.x;
-			v1.y *= v2.y;
-			v1.z *= v2.z;
-			return std::move(v1);
-		}
 		//multiply a lvalue Vec3 object to a lvalue Vec4 object | elementwise, not dotproduct
-		template<typename type>Vec4<type> operator*(const Vec4<type>& v1, const Vec3<type>& v2) noexcept
+		template<typename type>constexpr Vec4<type> operator*(const Vec4<type>& v1, const Vec3<type>& v2) noexcept
 		{
 			return Vec4<type>(v1.x * v2.x, v1.y * v2.y, v1.z * v2.z, v1.w);
 		}
-		//divide a rvalue Vec2 object from a rvalue Vec4 object
-		template<typename type>Vec4<type>&& operator/(Vec4<type>&& v1, Vec2<type>&& v2) noexcept
-		{
-			v1.x /= v2.x;
-			v1.y /= v2.y;
-			return std::move(v1);
-		}
-		//divide a lvalue Vec2 object from a rvalue Vec4 object
-		template<typename type>Vec4<type>&& operator/(Vec4<type>&& v1, const Vec2<type>& v2) noexcept
-		{
-			v1.x /= v2.x;
-			v1.y /= v2.y;
-			return std::move(v1);
-		}
 		//divide a lvalue Vec2 object from a lvalue Vec4 object
-		template<typename type>Vec4<type> operator/(const Vec4<type>& v1, const Vec2<type>& v2) noexcept
+		template<typename type>constexpr Vec4<type> operator/(const Vec4<type>& v1, const Vec2<type>& v2) noexcept
 		{
 			return Vec4<type>(v1.x / v2.x, v1.y / v2.y, v1.z, v1.w);
 		}
-		//divide a rvalue Vec3 object from a rvalue Vec4 object
-		template<typename type>Vec4<type>&& operator/(Vec4<type>&& v1, Vec3<type>&& v2) noexcept
-		{
-			v1.x /= v2.x;
-			v1.y /= v2.y;
-			v1.z /= v2.z;
-			return std::move(v1);
-		}
-		//divide a lvalue Vec3 object from a rvalue Vec4 object
-		template<typename type>Vec4<type>&& operator/(Vec4<type>&& v1, const Vec3<type>& v2) noexcept
-		{
-			v1.x /= v2.x;
-			v1.y /= v2.y;
-			v1.z /= v2.z;
-			return std::move(v1);
-		}
 		//divide a lvalue Vec3 object from a lvalue Vec4 object
-		template<typename type>Vec4<type> operator/(const Vec4<type>& v1, const Vec3<type>& v2) noexcept
+		template<typename type>constexpr Vec4<type> operator/(const Vec4<type>& v1, const Vec3<type>& v2) noexcept
 		{
 			return Vec4<type>(v1.x / v2.x, v1.y / v2.y, v1.z / v2.z, v1.w);
 		}
@@ -0,0 +1,83 @@
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "AssetCache.h"
+#include "PackFile.h"
+#include <cstring>
+#include <deque>
+#include <mutex>
+
+namespace clockwork {
+	namespace utils {
+
+		namespace {
+
+			std::mutex internMutex;
+			std::unordered_map<std::string, unsigned int> internedIds;
+			std::deque<std::string> internedPaths { std::string() };//id 0 is the empty path | a deque, so the references of getInternedPath stay valid when new paths are added
+
+		}
+
+		unsigned int internPath(const std::string& path) noexcept
+		{
+			std::string normalised = PackFile::normalisePath(path);
+			std::lock_guard<std::mutex> lock(internMutex);
+			auto interned = internedIds.find(normalised);
+			if ( interned != internedIds.end() )
+				return interned->second;
+			unsigned int pathId = internedPaths.size();
+			internedPaths.push_back(normalised);
+			internedIds.emplace(std::move(normalised), pathId);
+			return pathId;
+		}
+
+		const std::string& getInternedPath(unsigned int pathId) noexcept
+		{
+			std::lock_guard<std::mutex> lock(internMutex);
+#if CLOCKWORK_DEBUG
+			if ( pathId >= internedPaths.size() )
+			{
+				std::cout << "Error utils::getInternedPath(): The path id " << pathId << " was not interned" << std::endl;
+				return internedPaths.front();
+			}
+#endif
+			return internedPaths.at(pathId);
+		}
+
+		unsigned long long hashContent(const unsigned char* data, unsigned long long size) noexcept
+		{
+			constexpr unsigned long long prime1 = 0x9E3779B185EBCA87ULL;
+			constexpr unsigned long long prime2 = 0xC2B2AE3D27D4EB4FULL;
+			unsigned long long hash = size * prime1;
+			unsigned long long pos = 0;
+			for ( ; pos + 8 <= size; pos += 8 )
+			{
+				unsigned long long value;
+				std::memcpy(&value, data + pos, 8);
+				value *= prime2;
+				value = ( value << 31 ) | ( value >> 33 );
+				hash ^= value * prime1;
+				hash = ( ( hash << 27 ) | ( hash >> 37 ) ) * prime1 + prime2;
+			}
+			for ( ; pos < size; ++pos )
+			{
+				hash ^= data[pos] * prime1;
+				hash = ( ( hash << 11 ) | ( hash >> 53 ) ) * prime2;
+			}
+			hash ^= hash >> 33;
+			hash *= prime2;
+			hash ^= hash >> 29;
+			return hash == 0 ? 1 : hash;//0 means no content hash in the assetcache
+		}
+
+	}
+}
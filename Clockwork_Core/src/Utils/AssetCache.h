@@ -0,0 +1,155 @@
+#pragma once
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "Helper.h"
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace clockwork {
+	namespace utils {
+
+		/*returns the unique id of the path | the path is normalised first(see PackFile::normalisePath), so res\Images\Dirt.png and res/images/dirt.png get the same id
+		the ids start at 1 and stay the same while the engine runs, so they can be compared and used as keys of hash maps instead of comparing the path strings | can be called from any thread*/
+		unsigned int internPath(const std::string& path) noexcept;
+
+		/*returns the normalised path of the id from internPath | the reference stays valid while the engine runs*/
+		const std::string& getInternedPath(unsigned int pathId) noexcept;
+
+		/*returns a 64 bit hash of the data, so assets with the same content under different paths can be found | hashes 8 bytes per step, so hashing the pixels of an image is much faster than uploading them*/
+		unsigned long long hashContent(const unsigned char* data, unsigned long long size) noexcept;
+
+		/*the resident memory and the lookups of one assetcache*/
+		struct AssetStatistics
+		{
+			unsigned int residentCount = 0;//the assets that are alive, because atleast one handle uses them
+			unsigned long long residentBytes = 0;//the memory of the resident assets | gpu memory for gpu assets
+			unsigned int pathHits = 0;//lookups that found an asset with the same path
+			unsigned int contentHits = 0;//lookups that found an asset with the same content under another path
+			unsigned int misses = 0;//lookups that had to create a new asset
+		};
+
+		/*caches assets of one type by their interned path and by the hash of their content | the assets are shared with reference counted handles(std::shared_ptr) and the cache only keeps weak references
+		so an asset is deleted when its last handle is released and the next lookup creates it again | all lookups are O(1) hash map lookups
+		the cache is not thread safe, so gpu asset caches must only be used from the render thread*/
+		template<typename Type>
+		class AssetCache
+		{
+
+		public:
+			using Handle = std::shared_ptr<Type>;
+
+		private:
+			struct Entry
+			{
+				std::weak_ptr<Type> asset;
+				unsigned long long contentHash;
+			};
+
+		private:
+			std::unordered_map<unsigned int, Entry> m_paths;
+			std::unordered_map<unsigned long long, std::weak_ptr<Type>> m_contents;
+			std::shared_ptr<AssetStatistics> m_statistics;//shared with the deleters of the handles, so handles can outlive the cache
+			std::string m_name;
+
+		public:
+			/*@param[name] the name of the assettype for the statistics, for example "Texture2D"*/
+			explicit AssetCache(const std::string& name) noexcept
+				: m_statistics(std::make_shared<AssetStatistics>()), m_name(name)
+			{}
+
+			AssetCache(const AssetCache& other) = delete;
+
+			AssetCache& operator=(const AssetCache& other) = delete;
+
+		public:
+			/*returns the asset with the interned path and counts a path hit, or returns an empty handle if it is not resident*/
+			Handle find(unsigned int pathId) noexcept
+			{
+				auto entry = m_paths.find(pathId);
+				if ( entry == m_paths.end() )
+					return nullptr;
+				Handle asset = entry->second.asset.lock();
+				if ( asset )
+					++m_statistics->pathHits;
+				else
+					m_paths.erase(entry);
+				return asset;
+			}
+
+			/*returns the resident asset with the same content, which is then also stored for the path, so the next find(pathId) finds it
+			returns an empty handle and counts a miss if there is no asset with the content, so the caller has to create it with insert() | should be called after find(pathId) did not find the asset
+			@param[equal] is called with the handle of the resident asset with the same hash and returns true if the content is really the same, so a collision of the 64 bit hash does not share a wrong asset*/
+			template<typename Equal>
+			Handle findContent(unsigned int pathId, unsigned long long contentHash, Equal equal) noexcept
+			{
+				auto content = m_contents.find(contentHash);
+				if ( content != m_contents.end() )
+				{
+					Handle asset = content->second.lock();
+					if ( asset && equal(asset) )
+					{
+						++m_statistics->contentHits;
+						m_paths[pathId] = Entry { asset, contentHash };
+						return asset;
+					}
+					if ( !asset )
+						m_contents.erase(content);
+				}
+				++m_statistics->misses;
+				return nullptr;
+			}
+
+			/*stores the asset for the path and the content hash and returns its handle | the asset is deleted when the last copy of the handle is released
+			a content hash of 0 only stores the asset for the path, for example when the content could not be compared, or another asset with the same hash is already resident
+			@param[bytes] the memory of the asset for the statistics*/
+			Handle insert(unsigned int pathId, unsigned long long contentHash, unsigned long long bytes, Type&& asset) noexcept
+			{
+				std::shared_ptr<AssetStatistics> statistics = m_statistics;
+				Handle handle(new Type(std::move(asset)), [statistics, bytes](Type* released) {
+					--statistics->residentCount;
+					statistics->residentBytes -= bytes;
+					delete released;
+				});
+				++m_statistics->residentCount;
+				m_statistics->residentBytes += bytes;
+				m_paths[pathId] = Entry { handle, contentHash };
+				if ( contentHash != 0 )
+					m_contents[contentHash] = handle;
+				return handle;
+			}
+
+			/*removes the entries of released assets from the hash maps*/
+			void prune() noexcept
+			{
+				for ( auto entry = m_paths.begin(); entry != m_paths.end(); )
+					entry = entry->second.asset.expired() ? m_paths.erase(entry) : ++entry;
+				for ( auto content = m_contents.begin(); content != m_contents.end(); )
+					content = content->second.expired() ? m_contents.erase(content) : ++content;
+			}
+
+		public:
+			const AssetStatistics& getStatistics() const noexcept {return *m_statistics;}
+
+			const std::string& getName() const noexcept {return m_name;}
+
+			/*prints the statistics of the cache into the console*/
+			void printStatistics() const noexcept
+			{
+				std::cout << m_name << " cache: " << m_statistics->residentCount << " resident(" << m_statistics->residentBytes / 1024 << " kb) | " << m_statistics->pathHits << " path hits, " << m_statistics->contentHits << " content hits, " << m_statistics->misses << " misses" << std::endl;
+			}
+
+		};
+
+	}
+}
@@ -0,0 +1,116 @@
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "AssetLoader.h"
+#include "PixelConversion.h"
+
+namespace clockwork {
+	namespace utils {
+
+		AssetLoader* assetLoader = nullptr;
+
+		AssetLoader::AssetLoader(unsigned int threadCount) noexcept
+			: m_pool(threadCount), m_requested(0), m_finished(0)
+		{
+
+		}
+
+		AssetLoader::~AssetLoader() noexcept
+		{
+			m_pool.waitWorking();
+		}
+
+		ImageHandle AssetLoader::loadImage(const std::string& imagePath, std::function<void(Image&)> upload) noexcept
+		{
+			return load<Image>([imagePath](Image& image) {
+				image.setFilepath(imagePath);
+				image.load();
+#if CLOCKWORK_DEBUG
+				if ( !image.hasData() )
+					std::cout << "Error AssetLoader::loadImage(): The image " << imagePath << " could not be loaded" << std::endl;
+#endif
+				return image.hasData();
+			}, std::move(upload));
+		}
+
+		ImagesHandle AssetLoader::loadImages(const std::vector<std::string>& imagePaths, std::function<void(std::vector<Image>&)> upload) noexcept
+		{
+			return loadImages(imagePaths, 0, 0, 0, std::move(upload));
+		}
+
+		ImagesHandle AssetLoader::loadImages(const std::vector<std::string>& imagePaths, unsigned int width, unsigned int height, unsigned int pixelSize, std::function<void(std::vector<Image>&)> upload) noexcept
+		{
+			std::shared_ptr<ImagesHandle::Data> data = std::make_shared<ImagesHandle::Data>();
+			++m_requested;
+			if ( imagePaths.empty() )
+			{
+				finishAsset<std::vector<Image>>(data, false, upload);
+				return ImagesHandle(data);
+			}
+			data->asset.reserve(imagePaths.size());
+			for ( const auto& imagePath : imagePaths )
+				data->asset.push_back(Image(imagePath));
+
+			//each image is decoded by its own task and the last finished task finishes the whole asset
+			std::shared_ptr<std::atomic<unsigned int>> remaining = std::make_shared<std::atomic<unsigned int>>(static_cast<unsigned int>( imagePaths.size() ));
+			std::shared_ptr<std::atomic<bool>> failed = std::make_shared<std::atomic<bool>>(false);
+			for ( unsigned int i = 0; i < imagePaths.size(); ++i )
+			{
+				m_pool.addTask([this, data, remaining, failed, upload, i, width, height, pixelSize]() {
+					Image& image = data->asset.at(i);
+					image.load();
+					if ( !image.hasData() )
+					{
+#if CLOCKWORK_DEBUG
+						std::cout << "Error AssetLoader::loadImages(): The image " << image.getFilepath() << " could not be loaded" << std::endl;
+#endif
+						*failed = true;
+					}
+					else if ( width != 0 )//a size of 0 keeps the decoded size
+					{
+						image = normaliseImage(image, width, height, pixelSize);
+						if ( !image.hasData() )
+							*failed = true;
+					}
+					if ( --*remaining == 0 )
+						finishAsset<std::vector<Image>>(data, failed->load(), upload);
+				});
+			}
+			return ImagesHandle(data);
+		}
+
+		void AssetLoader::runOnRenderThread(std::function<void()>&& task) noexcept
+		{
+			std::lock_guard<std::mutex> lock(m_lock);
+			m_renderTasks.push_back(std::move(task));
+		}
+
+		void AssetLoader::update() noexcept
+		{
+			std::vector<std::function<void()>> tasks;
+			{
+				std::lock_guard<std::mutex> lock(m_lock);
+				tasks.swap(m_renderTasks);
+			}
+			for ( auto& task : tasks )//the tasks are executed without the lock, so they can give new tasks to the render thread
+				task();
+		}
+
+		void AssetLoader::resetProgress() noexcept
+		{
+			unsigned int loading = m_requested.load() - m_finished.load();
+			m_finished = 0;
+			m_requested = loading;
+		}
+
+	}
+}
@@ -0,0 +1,207 @@
+#pragma once
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "src\Utils\ThreadPool.h"
+#include "src\Utils\Image.h"
+#include <atomic>
+#include <memory>
+#include <string>
+
+namespace clockwork {
+	namespace utils {
+
+		class AssetLoader;
+
+		/*the loading state of an asset*/
+		enum class AssetState : unsigned char
+		{
+			Loading,//the asset is read/decoded by the threadpool, or waits for its upload on the render thread
+			Ready,//the asset is loaded and uploaded and can be used
+			Failed//the asset could not be loaded(for example a wrong filepath)
+		};
+
+		/*a handle to an asset that is loaded by the assetloader in the background | handles can be copied and all copies share the same asset
+		the asset must only be accessed after the handle is ready, because until then it is used by the threadpool, or the render thread*/
+		template<typename Type>
+		class AssetHandle
+		{
+
+		private:
+			friend class AssetLoader;
+
+			struct Data
+			{
+				std::atomic<AssetState> state;
+				Type asset;
+
+				Data() noexcept
+					: state(AssetState::Loading), asset()
+				{}
+			};
+
+		private:
+			std::shared_ptr<Data> m_data;
+
+		public:
+			/*creates an empty handle without an asset*/
+			AssetHandle() noexcept
+				: m_data(nullptr)
+			{}
+
+		private:
+			explicit AssetHandle(const std::shared_ptr<Data>& data) noexcept
+				: m_data(data)
+			{}
+
+		public:
+			/*returns the asset | CAREFUL: only call this after the handle is ready*/
+			Type& get() noexcept
+			{
+#if CLOCKWORK_DEBUG
+				if ( !isReady() )
+					std::cout << "Error AssetHandle::get(): The asset is not ready" << std::endl;
+#endif
+				return m_data->asset;
+			}
+
+			/*returns the asset | CAREFUL: only call this after the handle is ready*/
+			const Type& get() const noexcept
+			{
+#if CLOCKWORK_DEBUG
+				if ( !isReady() )
+					std::cout << "Error AssetHandle::get(): The asset is not ready" << std::endl;
+#endif
+				return m_data->asset;
+			}
+
+		public:
+			/*returns the loading state of the asset | can be called from any thread*/
+			const AssetState getState() const noexcept {return m_data->state.load();}
+			const bool isValid() const noexcept {return m_data != nullptr;}
+			const bool isReady() const noexcept {return m_data && m_data->state.load() == AssetState::Ready;}
+			const bool hasFailed() const noexcept {return m_data && m_data->state.load() == AssetState::Failed;}
+			/*returns true if the asset is either ready, or has failed*/
+			const bool isFinished() const noexcept {return m_data && m_data->state.load() != AssetState::Loading;}
+
+		};
+
+		using ImageHandle = AssetHandle<Image>;
+		using ImagesHandle = AssetHandle<std::vector<Image>>;
+
+		/*loads assets in the background: the files are read and decoded by the tasks of a threadpool and the gpu uploads are given back to the render thread, which executes them in update()
+		each load method returns a handle that will be ready after the asset is decoded and its upload function has been called on the render thread
+		the assetloader counts all requested and finished assets since the last resetProgress() call, so a loading screen can show the progress and wait until everything is loaded
+		there is one global assetloader(assetLoader) which is created and updated by the engine*/
+		class AssetLoader
+		{
+
+		private:
+			ThreadPool m_pool;
+			std::mutex m_lock;
+			std::vector<std::function<void()>> m_renderTasks;
+			std::atomic<unsigned int> m_requested;
+			std::atomic<unsigned int> m_finished;
+
+		public:
+			/*@param[threadCount] the number of worker threads that read and decode the files | 0 uses the number of hardware threads minus the render thread*/
+			explicit AssetLoader(unsigned int threadCount = 0) noexcept;
+
+			/*waits for the running tasks of the threadpool | the render tasks that were not executed are lost*/
+			~AssetLoader() noexcept;
+
+			AssetLoader(const AssetLoader& other) = delete;
+
+			AssetLoader(AssetLoader&& other) = delete;
+
+			AssetLoader& operator=(const AssetLoader& other) = delete;
+
+			AssetLoader& operator=(AssetLoader&& other) = delete;
+
+		private:
+			/*sets the asset to ready, or failed | the upload function is given to the render thread first, if the asset was decoded*/
+			template<typename Type>
+			void finishAsset(const std::shared_ptr<typename AssetHandle<Type>::Data>& data, bool failed, const std::function<void(Type&)>& upload) noexcept
+			{
+				if ( failed || !upload )
+				{
+					data->state = failed ? AssetState::Failed : AssetState::Ready;
+					++m_finished;
+					return;
+				}
+				runOnRenderThread([this, data, upload]() {
+					upload(data->asset);
+					data->state = AssetState::Ready;
+					++m_finished;
+				});
+			}
+
+		public:
+			/*loads any kind of asset in the background | can be called from any thread
+			@param[decode] reads and decodes the asset on a worker thread of the threadpool | returns false if the asset could not be loaded | must not use opengl
+			@param[upload] is called on the render thread with the decoded asset(for example to create a texture) | can be empty*/
+			template<typename Type>
+			AssetHandle<Type> load(std::function<bool(Type&)> decode, std::function<void(Type&)> upload = nullptr) noexcept
+			{
+				std::shared_ptr<typename AssetHandle<Type>::Data> data = std::make_shared<typename AssetHandle<Type>::Data>();
+				++m_requested;
+				m_pool.addTask([this, data, decode, upload]() {
+					finishAsset<Type>(data, !decode(data->asset), upload);
+				});
+				return AssetHandle<Type>(data);
+			}
+
+			/*reads and decodes the image in the background | can be called from any thread
+			@param[upload] is called on the render thread with the decoded image(for example to create a texture with the textureuploader) | can be empty*/
+			ImageHandle loadImage(const std::string& imagePath, std::function<void(Image&)> upload = nullptr) noexcept;
+
+			/*reads and decodes the images in parallel in the background | can be called from any thread
+			the handle will be ready after all images are decoded and the upload function has been called once for all images, so they can be added at once(for example to a textureregistry)
+			@param[upload] is called on the render thread with the decoded images in the same order as the imagepaths | can be empty*/
+			ImagesHandle loadImages(const std::vector<std::string>& imagePaths, std::function<void(std::vector<Image>&)> upload = nullptr) noexcept;
+
+			/*reads and decodes the images in parallel in the background like loadImages, but each task also converts its image to the width, height and pixelsize(see utils::normaliseImage)
+			so images of mixed sizes and pixelkinds can be added to one texturearray2d without converting them on the render thread
+			@param[pixelSize] 24 = RGB and 32 = RGBA*/
+			ImagesHandle loadImages(const std::vector<std::string>& imagePaths, unsigned int width, unsigned int height, unsigned int pixelSize, std::function<void(std::vector<Image>&)> upload = nullptr) noexcept;
+
+			/*the task will be executed on the render thread in the next update() call | can be called from any thread*/
+			void runOnRenderThread(std::function<void()>&& task) noexcept;
+
+			/*executes the tasks that were given to the render thread, for example the gpu uploads of the loaded assets | must be called once per frame from the render thread(the engine does this before rendering)*/
+			void update() noexcept;
+
+			/*resets the counters of the requested and finished assets, so the progress starts again at 0 | the assets that are still loading stay in the count of the requested assets*/
+			void resetProgress() noexcept;
+
+		public:
+			/*returns the part of the requested assets that are finished(ready, or failed) from 0 to 1 since the last resetProgress() call | returns 1 if no assets were requested*/
+			const float getProgress() const noexcept
+			{
+				unsigned int requested = m_requested.load();
+				return requested == 0 ? 1.0f : static_cast<float>( m_finished.load() ) / static_cast<float>( requested );
+			}
+
+			/*returns true if all assets that were requested since the last resetProgress() call are finished(ready, or failed)*/
+			const bool isFinished() const noexcept {return m_finished.load() >= m_requested.load();}
+
+			const unsigned int getRequestedCount() const noexcept {return m_requested.load();}
+
+			const unsigned int getFinishedCount() const noexcept {return m_finished.load();}
+
+		};
+
+		/*the global assetloader that is created and updated by the engine*/
+		extern AssetLoader* assetLoader;
+
+	}
+}
@@ -0,0 +1,305 @@
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "BlockCompression.h"
+#include <cstring>
+
+namespace clockwork {
+	namespace utils {
+
+		namespace {
+
+			/*the weights of the 16 interpolated colours of a bc7 block with 4 bit indices in 1/64 steps*/
+			const int bc7Weights[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+			/*writes the lowest count bits of the value into the bitstream of the block(starting with the lowest bit of the first byte) and moves the bit position behind the written bits*/
+			void writeBits(unsigned char* block, unsigned int& position, unsigned int value, unsigned int count) noexcept
+			{
+				for ( unsigned int i = 0; i < count; ++i, ++position )
+				{
+					if ( ( value >> i ) & 1 )
+						block[position >> 3] |= static_cast<unsigned char>( 1 << ( position & 7 ) );
+				}
+			}
+
+			/*fits a line through the pixels of the block and returns the 2 endpoints where the pixels projected onto the line start and end
+			the direction of the line is the principal axis of the pixels, which is found by a few power iterations of the covariance matrix
+			@param[channels] 3 for rgb and 4 for rgba*/
+			void fitEndpoints(const unsigned char* pixels, unsigned int channels, float* start, float* end) noexcept
+			{
+				float mean[4] = { 0, 0, 0, 0 };
+				for ( unsigned int i = 0; i < 16; ++i )
+				{
+					for ( unsigned int c = 0; c < channels; ++c )
+						mean[c] += pixels[i * 4 + c];
+				}
+				for ( unsigned int c = 0; c < channels; ++c )
+					mean[c] /= 16.0f;
+
+				float covariance[4][4] = {};
+				for ( unsigned int i = 0; i < 16; ++i )
+				{
+					for ( unsigned int a = 0; a < channels; ++a )
+					{
+						for ( unsigned int b = 0; b < channels; ++b )
+							covariance[a][b] += ( pixels[i * 4 + a] - mean[a] ) * ( pixels[i * 4 + b] - mean[b] );
+					}
+				}
+
+				float axis[4] = { 1, 1, 1, 1 };
+				for ( unsigned int iteration = 0; iteration < 8; ++iteration )
+				{
+					float next[4] = { 0, 0, 0, 0 };
+					float length = 0;
+					for ( unsigned int a = 0; a < channels; ++a )
+					{
+						for ( unsigned int b = 0; b < channels; ++b )
+							next[a] += covariance[a][b] * axis[b];
+						if ( next[a] > length )
+							length = next[a];
+						else if ( -next[a] > length )
+							length = -next[a];
+					}
+					if ( length < 0.000001f )
+						break;//all pixels have the same colour, or the axis is already stable enough
+					for ( unsigned int c = 0; c < channels; ++c )
+						axis[c] = next[c] / length;
+				}
+
+				float axisLength = 0;
+				for ( unsigned int c = 0; c < channels; ++c )
+					axisLength += axis[c] * axis[c];
+				float minimum = 0;
+				float maximum = 0;
+				for ( unsigned int i = 0; i < 16; ++i )
+				{
+					float projection = 0;
+					for ( unsigned int c = 0; c < channels; ++c )
+						projection += ( pixels[i * 4 + c] - mean[c] ) * axis[c];
+					projection /= axisLength;
+					if ( projection < minimum )
+						minimum = projection;
+					if ( projection > maximum )
+						maximum = projection;
+				}
+				for ( unsigned int c = 0; c < channels; ++c )
+				{
+					start[c] = mean[c] + axis[c] * minimum;
+					end[c] = mean[c] + axis[c] * maximum;
+					start[c] = start[c] < 0 ? 0 : start[c] > 255 ? 255 : start[c];
+					end[c] = end[c] < 0 ? 0 : end[c] > 255 ? 255 : end[c];
+				}
+			}
+
+			/*returns the index of the colour in the palette with the smallest squared distance to the pixel*/
+			unsigned int findNearest(const unsigned char* pixel, const int( *palette )[4], unsigned int paletteSize, unsigned int channels) noexcept
+			{
+				unsigned int best = 0;
+				int bestError = 0x7FFFFFFF;
+				for ( unsigned int i = 0; i < paletteSize; ++i )
+				{
+					int error = 0;
+					for ( unsigned int c = 0; c < channels; ++c )
+						error += ( pixel[c] - palette[i][c] ) * ( pixel[c] - palette[i][c] );
+					if ( error < bestError )
+					{
+						bestError = error;
+						best = i;
+					}
+				}
+				return best;
+			}
+
+			unsigned short packRGB565(const float* colour) noexcept
+			{
+				unsigned int r = static_cast<unsigned int>( colour[0] * 31.0f / 255.0f + 0.5f );
+				unsigned int g = static_cast<unsigned int>( colour[1] * 63.0f / 255.0f + 0.5f );
+				unsigned int b = static_cast<unsigned int>( colour[2] * 31.0f / 255.0f + 0.5f );
+				return static_cast<unsigned short>( ( r << 11 ) | ( g << 5 ) | b );
+			}
+
+			void unpackRGB565(unsigned short colour, int* rgb) noexcept
+			{
+				int r = ( colour >> 11 ) & 31;
+				int g = ( colour >> 5 ) & 63;
+				int b = colour & 31;
+				rgb[0] = ( r << 3 ) | ( r >> 2 );
+				rgb[1] = ( g << 2 ) | ( g >> 4 );
+				rgb[2] = ( b << 3 ) | ( b >> 2 );
+			}
+
+			/*encodes the rgb colours of the block into the 8 byte colour block of bc1/bc3 in the 4 colour mode(colour0 > colour1)*/
+			void compressColourBlock(const unsigned char* pixels, unsigned char* block) noexcept
+			{
+				float start[4];
+				float end[4];
+				fitEndpoints(pixels, 3, start, end);
+				for ( unsigned int c = 0; c < 3; ++c )//move the endpoints a bit inside, so the rounding to 565 does not push the interpolated colours outside of the block colours
+				{
+					float inset = ( end[c] - start[c] ) / 16.0f;
+					start[c] += inset;
+					end[c] -= inset;
+				}
+				unsigned short colour0 = packRGB565(end);
+				unsigned short colour1 = packRGB565(start);
+				if ( colour0 < colour1 )
+				{
+					unsigned short temp = colour0;
+					colour0 = colour1;
+					colour1 = temp;
+				}
+
+				unsigned int indices = 0;
+				if ( colour0 != colour1 )
+				{
+					int palette[4][4];
+					unpackRGB565(colour0, palette[0]);
+					unpackRGB565(colour1, palette[1]);
+					for ( unsigned int c = 0; c < 3; ++c )
+					{
+						palette[2][c] = ( 2 * palette[0][c] + palette[1][c] ) / 3;
+						palette[3][c] = ( palette[0][c] + 2 * palette[1][c] ) / 3;
+					}
+					for ( unsigned int i = 0; i < 16; ++i )
+						indices |= findNearest(pixels + i * 4, palette, 4, 3) << ( i * 2 );
+				}
+
+				block[0] = colour0 & 0xFF;
+				block[1] = colour0 >> 8;
+				block[2] = colour1 & 0xFF;
+				block[3] = colour1 >> 8;
+				for ( unsigned int i = 0; i < 4; ++i )
+					block[4 + i] = ( indices >> ( i * 8 ) ) & 0xFF;
+			}
+
+			/*encodes the alpha values of the block into the 8 byte alpha block of bc3 in the 8 alpha mode(alpha0 > alpha1)*/
+			void compressAlphaBlock(const unsigned char* pixels, unsigned char* block) noexcept
+			{
+				int minimum = 255;
+				int maximum = 0;
+				for ( unsigned int i = 0; i < 16; ++i )
+				{
+					if ( pixels[i * 4 + 3] < minimum )
+						minimum = pixels[i * 4 + 3];
+					if ( pixels[i * 4 + 3] > maximum )
+						maximum = pixels[i * 4 + 3];
+				}
+
+				unsigned long long indices = 0;
+				if ( minimum != maximum )
+				{
+					int palette[8][4];
+					palette[0][0] = maximum;
+					palette[1][0] = minimum;
+					for ( unsigned int i = 2; i < 8; ++i )
+						palette[i][0] = ( ( 8 - i ) * maximum + ( i - 1 ) * minimum ) / 7;
+					for ( unsigned int i = 0; i < 16; ++i )
+						indices |= static_cast<unsigned long long>( findNearest(pixels + i * 4 + 3, palette, 8, 1) ) << ( i * 3 );
+				}
+
+				block[0] = static_cast<unsigned char>( maximum );
+				block[1] = static_cast<unsigned char>( minimum );
+				for ( unsigned int i = 0; i < 6; ++i )
+					block[2 + i] = ( indices >> ( i * 8 ) ) & 0xFF;
+			}
+
+			/*rounds the 8 bit endpoint to 7 bits per channel and picks the p-bit(the shared lowest bit of all channels) with the smallest error*/
+			void quantizeEndpointBC7(const float* colour, int* endpoint, int& pbit) noexcept
+			{
+				float bestError = -1;
+				for ( int p = 0; p < 2; ++p )
+				{
+					int candidate[4];
+					float error = 0;
+					for ( unsigned int c = 0; c < 4; ++c )
+					{
+						int value = static_cast<int>( ( colour[c] - p ) / 2.0f + 0.5f );
+						candidate[c] = value < 0 ? 0 : value > 127 ? 127 : value;
+						float difference = ( ( candidate[c] << 1 ) | p ) - colour[c];
+						error += difference * difference;
+					}
+					if ( bestError < 0 || error < bestError )
+					{
+						bestError = error;
+						pbit = p;
+						std::memcpy(endpoint, candidate, sizeof(candidate));
+					}
+				}
+			}
+
+		}
+
+		void compressBlockBC1(const unsigned char* pixels, unsigned char* block) noexcept
+		{
+			compressColourBlock(pixels, block);
+		}
+
+		void compressBlockBC3(const unsigned char* pixels, unsigned char* block) noexcept
+		{
+			compressAlphaBlock(pixels, block);
+			compressColourBlock(pixels, block + 8);
+		}
+
+		void compressBlockBC7(const unsigned char* pixels, unsigned char* block) noexcept
+		{
+			float start[4];
+			float end[4];
+			fitEndpoints(pixels, 4, start, end);
+			int endpoints[2][4];
+			int pbits[2];
+			quantizeEndpointBC7(start, endpoints[0], pbits[0]);
+			quantizeEndpointBC7(end, endpoints[1], pbits[1]);
+
+			int palette[16][4];
+			for ( unsigned int c = 0; c < 4; ++c )
+			{
+				int first = ( endpoints[0][c] << 1 ) | pbits[0];
+				int second = ( endpoints[1][c] << 1 ) | pbits[1];
+				for ( unsigned int i = 0; i < 16; ++i )
+					palette[i][c] = ( ( 64 - bc7Weights[i] ) * first + bc7Weights[i] * second + 32 ) >> 6;
+			}
+			unsigned int indices[16];
+			for ( unsigned int i = 0; i < 16; ++i )
+				indices[i] = findNearest(pixels + i * 4, palette, 16, 4);
+
+			if ( indices[0] & 8 )//the highest bit of the first index is not stored, so the endpoints are swapped and the indices are inverted if its set
+			{
+				for ( unsigned int c = 0; c < 4; ++c )
+				{
+					int temp = endpoints[0][c];
+					endpoints[0][c] = endpoints[1][c];
+					endpoints[1][c] = temp;
+				}
+				int temp = pbits[0];
+				pbits[0] = pbits[1];
+				pbits[1] = temp;
+				for ( unsigned int i = 0; i < 16; ++i )
+					indices[i] = 15 - indices[i];
+			}
+
+			std::memset(block, 0, 16);
+			unsigned int position = 0;
+			writeBits(block, position, 1 << 6, 7);//mode 6
+			for ( unsigned int c = 0; c < 4; ++c )
+			{
+				writeBits(block, position, endpoints[0][c], 7);
+				writeBits(block, position, endpoints[1][c], 7);
+			}
+			writeBits(block, position, pbits[0], 1);
+			writeBits(block, position, pbits[1], 1);
+			writeBits(block, position, indices[0], 3);
+			for ( unsigned int i = 1; i < 16; ++i )
+				writeBits(block, position, indices[i], 4);
+		}
+
+	}
+}
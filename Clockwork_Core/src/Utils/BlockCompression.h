@@ -0,0 +1,36 @@
+#pragma once
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+
+namespace clockwork {
+	namespace utils {
+
+		/*encodes one 4x4 block of pixels into 8 bytes of bc1(dxt1) data | the block has no alpha channel and the colours are stored as 2 rgb565 endpoints with 2 bit indices per pixel
+		the endpoints are fitted along the principal axis of the colours in the block, so gradients keep their direction
+		@param[pixels] 16 pixels as rgba bytes(64 bytes) row by row | the alpha value is ignored
+		@param[block] the output of 8 bytes*/
+		void compressBlockBC1(const unsigned char* pixels, unsigned char* block) noexcept;
+
+		/*encodes one 4x4 block of pixels into 16 bytes of bc3(dxt5) data | the first 8 bytes are the alpha block with 2 alpha endpoints and 3 bit indices per pixel and the last 8 bytes are the colour block like bc1
+		@param[pixels] 16 pixels as rgba bytes(64 bytes) row by row
+		@param[block] the output of 16 bytes*/
+		void compressBlockBC3(const unsigned char* pixels, unsigned char* block) noexcept;
+
+		/*encodes one 4x4 block of pixels into 16 bytes of bc7 data with mode 6 | mode 6 stores one rgba7777 endpoint pair with a p-bit per endpoint and 4 bit indices per pixel
+		thats one subset without partitions, so the encoder is fast and still has a much better quality than bc1/bc3 for colour and alpha
+		@param[pixels] 16 pixels as rgba bytes(64 bytes) row by row
+		@param[block] the output of 16 bytes*/
+		void compressBlockBC7(const unsigned char* pixels, unsigned char* block) noexcept;
+
+	}
+}
@@ -0,0 +1,167 @@
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "Compression.h"
+#include <cstring>
+#include <vector>
+
+namespace clockwork {
+	namespace utils {
+
+		namespace {
+
+			const unsigned int minMatch = 4;
+			const unsigned int lastLiterals = 5;//the last bytes of a block are always literals
+			const unsigned int matchLimit = 12;//the last match has to start atleast 12 bytes before the end of the block
+			const unsigned int hashBits = 12;
+			const unsigned int maxOffset = 65535;
+
+			inline unsigned int readInt(const unsigned char* data) noexcept
+			{
+				unsigned int value;
+				std::memcpy(&value, data, 4);
+				return value;
+			}
+
+			inline unsigned int hashSequence(unsigned int sequence) noexcept
+			{
+				return ( sequence * 2654435761u ) >> ( 32 - hashBits );
+			}
+
+			/*writes a length that doesnt fit into the 4 bits of the token as a row of 255 bytes and the rest*/
+			inline void writeLength(unsigned char*& target, unsigned int length) noexcept
+			{
+				for ( ; length >= 255; length -= 255 )
+					*target++ = 255;
+				*target++ = static_cast<unsigned char>( length );
+			}
+
+			/*reads the rest of a length after the 4 bits of the token | returns false if the length runs over the end of the source*/
+			inline bool readLength(const unsigned char*& source, const unsigned char* end, unsigned int& length) noexcept
+			{
+				unsigned char value;
+				do
+				{
+					if ( source >= end )
+						return false;
+					value = *source++;
+					length += value;
+				}
+				while ( value == 255 );
+				return true;
+			}
+
+			/*writes one sequence with the literals and the match behind them | a match length of 0 writes only the literals for the end of the block*/
+			bool writeSequence(unsigned char*& target, const unsigned char* targetEnd, const unsigned char* literals, unsigned int literalCount, unsigned int offset, unsigned int matchLength) noexcept
+			{
+				if ( target + 1 + literalCount / 255 + 1 + literalCount + 2 + ( matchLength / 255 + 1 ) > targetEnd )
+					return false;
+				unsigned char* token = target++;
+				*token = static_cast<unsigned char>( ( literalCount < 15 ? literalCount : 15 ) << 4 );
+				if ( literalCount >= 15 )
+					writeLength(target, literalCount - 15);
+				std::memcpy(target, literals, literalCount);
+				target += literalCount;
+				if ( matchLength == 0 )
+					return true;
+				*target++ = static_cast<unsigned char>( offset & 255 );
+				*target++ = static_cast<unsigned char>( offset >> 8 );
+				unsigned int length = matchLength - minMatch;
+				*token |= static_cast<unsigned char>( length < 15 ? length : 15 );
+				if ( length >= 15 )
+					writeLength(target, length - 15);
+				return true;
+			}
+
+		}
+
+		unsigned int compressLZ4(const unsigned char* source, unsigned int sourceSize, unsigned char* target, unsigned int capacity) noexcept
+		{
+			unsigned char* output = target;
+			const unsigned char* outputEnd = target + capacity;
+			unsigned int anchor = 0;
+			if ( sourceSize > matchLimit )
+			{
+				std::vector<unsigned int> table(1 << hashBits, 0);//the position + 1 of the last sequence with the hash | 0 = no sequence
+				unsigned int position = 0;
+				unsigned int positionLimit = sourceSize - matchLimit;
+				unsigned int lengthLimit = sourceSize - lastLiterals;
+				while ( position < positionLimit )
+				{
+					unsigned int sequence = readInt(source + position);
+					unsigned int& entry = table[hashSequence(sequence)];
+					unsigned int candidate = entry;
+					entry = position + 1;
+					if ( candidate == 0 || position - ( candidate - 1 ) > maxOffset || readInt(source + candidate - 1) != sequence )
+					{
+						++position;
+						continue;
+					}
+					unsigned int match = candidate - 1;
+					unsigned int length = minMatch;
+					while ( position + length < lengthLimit && source[match + length] == source[position + length] )
+						++length;
+					if ( !writeSequence(output, outputEnd, source + anchor, position - anchor, position - match, length) )
+						return 0;
+					position += length;
+					anchor = position;
+				}
+			}
+			if ( !writeSequence(output, outputEnd, source + anchor, sourceSize - anchor, 0, 0) )
+				return 0;
+			return static_cast<unsigned int>( output - target );
+		}
+
+		unsigned int decompressLZ4(const unsigned char* source, unsigned int sourceSize, unsigned char* target, unsigned int targetSize) noexcept
+		{
+			const unsigned char* input = source;
+			const unsigned char* inputEnd = source + sourceSize;
+			unsigned int written = 0;
+			while ( input < inputEnd )
+			{
+				unsigned int token = *input++;
+				unsigned int literalCount = token >> 4;
+				if ( literalCount == 15 && !readLength(input, inputEnd, literalCount) )
+					return 0;
+				if ( literalCount > static_cast<unsigned int>( inputEnd - input ) || literalCount > targetSize - written )
+					return 0;
+				std::memcpy(target + written, input, literalCount);
+				input += literalCount;
+				written += literalCount;
+				if ( input >= inputEnd )//the last sequence has no match
+					break;
+				if ( inputEnd - input < 2 )
+					return 0;
+				unsigned int offset = input[0] | ( input[1] << 8 );
+				input += 2;
+				unsigned int length = token & 15;
+				if ( length == 15 && !readLength(input, inputEnd, length) )
+					return 0;
+				length += minMatch;
+				if ( offset == 0 || offset > written || length > targetSize - written )
+					return 0;
+				unsigned char* output = target + written;
+				const unsigned char* match = output - offset;
+				if ( offset >= length )
+					std::memcpy(output, match, length);
+				else
+				{
+					for ( unsigned int i = 0; i < length; ++i )//the match overlaps the output for repeated patterns
+						output[i] = match[i];
+				}
+				written += length;
+			}
+			return written;
+		}
+
+	}
+}
@@ -0,0 +1,30 @@
+#pragma once
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+
+namespace clockwork {
+	namespace utils {
+
+		/*returns the largest size the lz4 data of size bytes can have | the target of compressLZ4 should have this capacity, so incompressible data still fits*/
+		inline unsigned int getLZ4Bound(unsigned int size) noexcept {return size + size / 255 + 16;}
+
+		/*compresses the data into the lz4 block format(without the frame header), so it can be decompressed by any lz4 decoder | uses a greedy parser with a hash table of 4 byte sequences, which is fast enough for the build tools
+		returns the size of the compressed data, or 0 if the compressed data does not fit into the capacity of the target*/
+		unsigned int compressLZ4(const unsigned char* source, unsigned int sourceSize, unsigned char* target, unsigned int capacity) noexcept;
+
+		/*decompresses lz4 block data into the target, which has to be big enough for the decompressed size(it is stored next to the compressed data, for example in the table of contents of a packfile)
+		returns the size of the decompressed data, or 0 if the data is corrupt and would read/write outside of the source/target*/
+		unsigned int decompressLZ4(const unsigned char* source, unsigned int sourceSize, unsigned char* target, unsigned int targetSize) noexcept;
+
+	}
+}
@@ -0,0 +1,455 @@
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "CookedMesh.h"
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+namespace clockwork {
+	namespace utils {
+
+		constexpr unsigned int CookedMesh::version;
+		constexpr unsigned int CookedMesh::halfFloatUVs;
+
+		namespace {
+
+			const char cookedMagic[4] = { 'C', 'W', 'M', 'S' };
+			const unsigned int headerSize = 80;
+			const unsigned int dataAlignment = 16;
+
+			static_assert( sizeof(PackedVertex) == 16, "the vertices of cooked meshes have to be 16 bytes like in the file" );
+			static_assert( sizeof(Submesh) == 48, "the submeshes have to be 48 bytes like in the file" );
+			static_assert( sizeof(SubmeshLod) == 8, "the submeshlods have to be 8 bytes like in the file" );
+
+			template<typename type> void writeValue(std::vector<unsigned char>& data, unsigned long long position, const type& value) noexcept
+			{
+				std::memcpy(data.data() + position, &value, sizeof(type));
+			}
+
+			template<typename type> type readValue(const unsigned char* data, unsigned long long position) noexcept
+			{
+				type value;
+				std::memcpy(&value, data + position, sizeof(type));
+				return value;
+			}
+
+			inline unsigned int alignSize(unsigned int size) noexcept
+			{
+				return ( size + dataAlignment - 1 ) / dataAlignment * dataAlignment;
+			}
+
+			/*writes the indices with indexSize bytes per index at the position*/
+			void writeIndices(std::vector<unsigned char>& data, unsigned long long position, const std::vector<unsigned int>& indices, unsigned int indexSize) noexcept
+			{
+				for ( unsigned int i = 0; i < indices.size(); ++i )
+				{
+					if ( indexSize == 2 )
+						writeValue(data, position + static_cast<unsigned long long>( i ) * indexSize, static_cast<unsigned short>( indices.at(i) ));
+					else
+						writeValue(data, position + static_cast<unsigned long long>( i ) * indexSize, indices.at(i));
+				}
+			}
+
+			/*grows the bounds, so they contain the position*/
+			inline void addToBounds(MeshBounds& bounds, const float* position) noexcept
+			{
+				for ( unsigned int i = 0; i < 3; ++i )
+				{
+					bounds.min[i] = position[i] < bounds.min[i] ? position[i] : bounds.min[i];
+					bounds.max[i] = position[i] > bounds.max[i] ? position[i] : bounds.max[i];
+				}
+			}
+
+			inline MeshBounds emptyBounds() noexcept
+			{
+				const float infinity = std::numeric_limits<float>::max();
+				return MeshBounds { { infinity, infinity, infinity }, { -infinity, -infinity, -infinity } };
+			}
+
+			/*returns the value from 0 to 1 as normalized unsigned short*/
+			inline unsigned short toUnorm16(float value) noexcept
+			{
+				value = value < 0.0f ? 0.0f : ( value > 1.0f ? 1.0f : value );
+				return static_cast<unsigned short>( value * 65535.0f + 0.5f );
+			}
+
+			/*encodes the normal with the octahedral mapping into 2 normalized unsigned shorts | the normal is projected onto an octahedron, whose lower half is folded over the upper half*/
+			void encodeOctahedral(const float* normal, unsigned short* encoded) noexcept
+			{
+				float length = std::abs(normal[0]) + std::abs(normal[1]) + std::abs(normal[2]);
+				float x = 0.0f;
+				float y = 0.0f;
+				if ( length > 0.0f )
+				{
+					x = normal[0] / length;
+					y = normal[1] / length;
+					if ( normal[2] < 0.0f )
+					{
+						float foldedX = ( 1.0f - std::abs(y) ) * ( x >= 0.0f ? 1.0f : -1.0f );
+						float foldedY = ( 1.0f - std::abs(x) ) * ( y >= 0.0f ? 1.0f : -1.0f );
+						x = foldedX;
+						y = foldedY;
+					}
+				}
+				encoded[0] = toUnorm16(x * 0.5f + 0.5f);
+				encoded[1] = toUnorm16(y * 0.5f + 0.5f);
+			}
+
+			/*quantises the vertex into a packedvertex with the position relative to the bounds of the mesh*/
+			PackedVertex packVertex(const MeshVertex& vertex, const MeshBounds& bounds, bool halfFloat) noexcept
+			{
+				PackedVertex packed;
+				for ( unsigned int i = 0; i < 3; ++i )
+				{
+					float extent = bounds.max[i] - bounds.min[i];
+					packed.position[i] = toUnorm16(extent > 0.0f ? ( vertex.position[i] - bounds.min[i] ) / extent : 0.0f);
+				}
+				packed.position[3] = 0;
+				for ( unsigned int i = 0; i < 2; ++i )
+					packed.uv[i] = halfFloat ? toHalfFloat(vertex.uv[i]) : toUnorm16(vertex.uv[i]);
+				encodeOctahedral(vertex.normal, packed.normal);
+				return packed;
+			}
+
+		}
+
+		unsigned short toHalfFloat(float value) noexcept
+		{
+			unsigned int bits;
+			std::memcpy(&bits, &value, sizeof(float));
+			unsigned int sign = ( bits >> 16 ) & 0x8000;
+			unsigned int mantissa = bits & 0x7FFFFF;
+			int exponent = static_cast<int>( ( bits >> 23 ) & 0xFF ) - 127 + 15;
+			if ( ( ( bits >> 23 ) & 0xFF ) == 0xFF )//infinity, or nan
+				return static_cast<unsigned short>( sign | 0x7C00 | ( mantissa != 0 ? 0x200 : 0 ) );
+			if ( exponent >= 31 )
+				return static_cast<unsigned short>( sign | 0x7C00 );
+			if ( exponent <= 0 )
+			{
+				if ( exponent < -10 )
+					return static_cast<unsigned short>( sign );
+				mantissa |= 0x800000;
+				unsigned int shift = 14 - exponent;
+				unsigned int half = mantissa >> shift;
+				if ( ( mantissa >> ( shift - 1 ) ) & 1 )
+					++half;
+				return static_cast<unsigned short>( sign | half );
+			}
+			unsigned int half = sign | ( exponent << 10 ) | ( mantissa >> 13 );
+			if ( mantissa & 0x1000 )//rounding can carry into the exponent, which is still the nearest half float
+				++half;
+			return static_cast<unsigned short>( half );
+		}
+
+		CookedMesh::CookedMesh() noexcept
+			: m_data(nullptr), m_size(0)
+		{}
+
+		CookedMesh::CookedMesh(const std::string& filepath) noexcept
+			: m_data(nullptr), m_size(0), m_filepath(filepath)
+		{}
+
+		CookedMesh::CookedMesh(const std::string& filepath, const std::vector<MeshPart>& parts) noexcept
+			: m_data(nullptr), m_size(0), m_filepath(filepath)
+		{
+			unsigned int vertexCount = 0;
+			unsigned int indexCount = 0;
+			unsigned int namesSize = 0;
+			unsigned int indexSize = 2;
+			unsigned int flags = 0;
+			unsigned int lodCount = 1;
+			MeshBounds bounds = emptyBounds();
+			for ( const auto& part : parts )
+			{
+				vertexCount += part.vertices.size();
+				indexCount += part.indices.size();
+				namesSize += part.material.size();
+				lodCount = part.lods.size() + 1 > lodCount ? part.lods.size() + 1 : lodCount;
+				for ( const auto& lod : part.lods )
+					indexCount += lod.indices.size();
+				if ( part.vertices.size() > 65536 )
+					indexSize = 4;
+				for ( const auto& vertex : part.vertices )
+				{
+					addToBounds(bounds, vertex.position);
+					if ( vertex.uv[0] < 0.0f || vertex.uv[0] > 1.0f || vertex.uv[1] < 0.0f || vertex.uv[1] > 1.0f )
+						flags |= halfFloatUVs;
+				}
+			}
+			if ( vertexCount == 0 )
+				bounds = MeshBounds { { 0, 0, 0 }, { 0, 0, 0 } };
+			unsigned int namesOffset = headerSize + parts.size() * sizeof(Submesh);
+			unsigned int lodOffset = alignSize(namesOffset + namesSize);
+			unsigned int lodRangesOffset = lodOffset + lodCount * sizeof(float);
+			unsigned int vertexOffset = alignSize(lodRangesOffset + lodCount * parts.size() * sizeof(SubmeshLod));
+			unsigned int indexOffset = alignSize(vertexOffset + vertexCount * sizeof(PackedVertex));
+			m_buffer.resize(indexOffset + indexCount * indexSize);
+
+			unsigned int firstIndex = 0;
+			unsigned int baseVertex = 0;
+			unsigned int nameOffset = namesOffset;
+			for ( unsigned int i = 0; i < parts.size(); ++i )
+			{
+				const MeshPart& part = parts.at(i);
+				Submesh submesh { firstIndex, static_cast<unsigned int>( part.indices.size() ), baseVertex, static_cast<unsigned int>( part.vertices.size() ), nameOffset, static_cast<unsigned int>( part.material.size() ), emptyBounds() };
+				for ( unsigned int j = 0; j < part.vertices.size(); ++j )
+				{
+					const MeshVertex& vertex = part.vertices.at(j);
+					addToBounds(submesh.bounds, vertex.position);
+					writeValue(m_buffer, vertexOffset + static_cast<unsigned long long>( baseVertex + j ) * sizeof(PackedVertex), packVertex(vertex, bounds, ( flags & halfFloatUVs ) != 0));
+				}
+				writeValue(m_buffer, headerSize + i * sizeof(Submesh), submesh);
+				writeValue(m_buffer, lodRangesOffset + i * sizeof(SubmeshLod), SubmeshLod { firstIndex, submesh.indexCount });
+				std::memcpy(m_buffer.data() + nameOffset, part.material.data(), part.material.size());
+				writeIndices(m_buffer, indexOffset + static_cast<unsigned long long>( firstIndex ) * indexSize, part.indices, indexSize);
+				firstIndex += part.indices.size();
+				baseVertex += part.vertices.size();
+				nameOffset += part.material.size();
+			}
+
+			//the higher levels of detail are stored after the indices of level 0 | a part without this level uses the index range of its previous level
+			writeValue(m_buffer, lodOffset, 0.0f);
+			for ( unsigned int lod = 1; lod < lodCount; ++lod )
+			{
+				float error = 0.0f;
+				for ( unsigned int i = 0; i < parts.size(); ++i )
+				{
+					const MeshPart& part = parts.at(i);
+					unsigned long long rangePosition = lodRangesOffset + ( static_cast<unsigned long long>( lod ) * parts.size() + i ) * sizeof(SubmeshLod);
+					if ( lod <= part.lods.size() )
+					{
+						const MeshLod& partLod = part.lods.at(lod - 1);
+						writeValue(m_buffer, rangePosition, SubmeshLod { firstIndex, static_cast<unsigned int>( partLod.indices.size() ) });
+						writeIndices(m_buffer, indexOffset + static_cast<unsigned long long>( firstIndex ) * indexSize, partLod.indices, indexSize);
+						firstIndex += partLod.indices.size();
+						error = partLod.error > error ? partLod.error : error;
+					}
+					else
+					{
+						writeValue(m_buffer, rangePosition, readValue<SubmeshLod>(m_buffer.data(), rangePosition - parts.size() * sizeof(SubmeshLod)));
+						if ( !part.lods.empty() )
+							error = part.lods.back().error > error ? part.lods.back().error : error;
+					}
+				}
+				writeValue(m_buffer, lodOffset + lod * sizeof(float), error);
+			}
+
+			std::memcpy(m_buffer.data(), cookedMagic, 4);
+			writeValue<unsigned int>(m_buffer, 4, version);
+			writeValue<unsigned int>(m_buffer, 8, sizeof(PackedVertex));
+			writeValue<unsigned int>(m_buffer, 12, vertexCount);
+			writeValue<unsigned int>(m_buffer, 16, indexCount);
+			writeValue<unsigned int>(m_buffer, 20, indexSize);
+			writeValue<unsigned int>(m_buffer, 24, parts.size());
+			writeValue<unsigned int>(m_buffer, 28, vertexOffset);
+			writeValue<unsigned int>(m_buffer, 32, indexOffset);
+			writeValue<unsigned int>(m_buffer, 36, namesOffset);
+			writeValue(m_buffer, 40, bounds);
+			writeValue<unsigned int>(m_buffer, 64, flags);
+			writeValue<unsigned int>(m_buffer, 68, lodCount);
+			writeValue<unsigned int>(m_buffer, 72, lodOffset);
+			m_data = m_buffer.data();
+			m_size = m_buffer.size();
+		}
+
+		CookedMesh::CookedMesh(CookedMesh&& other) noexcept
+			: m_file(std::move(other.m_file)), m_buffer(std::move(other.m_buffer)), m_data(other.m_data), m_size(other.m_size), m_filepath(std::move(other.m_filepath))
+		{
+			other.m_data = nullptr;
+			other.m_size = 0;
+		}
+
+		CookedMesh& CookedMesh::operator=(CookedMesh&& other) noexcept
+		{
+			m_file = std::move(other.m_file);
+			m_buffer = std::move(other.m_buffer);
+			m_data = other.m_data;
+			m_size = other.m_size;
+			m_filepath = std::move(other.m_filepath);
+			other.m_data = nullptr;
+			other.m_size = 0;
+			return *this;
+		}
+
+		bool CookedMesh::isCookedFile(const std::string& filepath) noexcept
+		{
+			return filepath.size() > 5 && filepath.compare(filepath.size() - 5, 5, ".cwms") == 0;
+		}
+
+		std::string CookedMesh::getCookedPath(const std::string& modelPath) noexcept
+		{
+			size_t dot = modelPath.find_last_of('.');
+			size_t slash = modelPath.find_last_of("/\\");
+			if ( dot == std::string::npos || ( slash != std::string::npos && dot < slash ) )
+				return modelPath + ".cwms";
+			return modelPath.substr(0, dot) + ".cwms";
+		}
+
+		CookedMesh& CookedMesh::load() noexcept
+		{
+			clearData();
+			m_file = File(m_filepath);
+			m_file.read();
+			const unsigned char* data = m_file.getData();
+			unsigned int size = m_file.getSize();
+			if ( data == nullptr || size < headerSize || std::memcmp(data, cookedMagic, 4) != 0 || readValue<unsigned int>(data, 4) != version || readValue<unsigned int>(data, 8) != sizeof(PackedVertex) )
+			{
+#if CLOCKWORK_DEBUG
+				std::cout << "Failed to load CookedMesh(no .cwms file, or wrong version): " << m_filepath << std::endl;
+#endif
+				m_file = File();
+				return *this;
+			}
+			unsigned long long vertexCount = readValue<unsigned int>(data, 12);
+			unsigned long long indexCount = readValue<unsigned int>(data, 16);
+			unsigned int indexSize = readValue<unsigned int>(data, 20);
+			unsigned long long submeshCount = readValue<unsigned int>(data, 24);
+			unsigned long long vertexOffset = readValue<unsigned int>(data, 28);
+			unsigned long long indexOffset = readValue<unsigned int>(data, 32);
+			unsigned long long lodCount = readValue<unsigned int>(data, 68);
+			unsigned long long lodOffset = readValue<unsigned int>(data, 72);
+			unsigned long long lodRangesOffset = lodOffset + lodCount * sizeof(float);
+			bool valid = ( indexSize == 2 || indexSize == 4 ) && headerSize + submeshCount * sizeof(Submesh) <= size
+				&& vertexOffset + vertexCount * sizeof(PackedVertex) <= size && indexOffset + indexCount * indexSize <= size
+				&& lodCount >= 1 && lodRangesOffset + lodCount * submeshCount * sizeof(SubmeshLod) <= size;
+			for ( unsigned int i = 0; valid && i < submeshCount; ++i )
+			{
+				Submesh submesh = readValue<Submesh>(data, headerSize + i * sizeof(Submesh));
+				valid = static_cast<unsigned long long>( submesh.firstIndex ) + submesh.indexCount <= indexCount && static_cast<unsigned long long>( submesh.baseVertex ) + submesh.vertexCount <= vertexCount
+					&& static_cast<unsigned long long>( submesh.nameOffset ) + submesh.nameLength <= size;
+			}
+			for ( unsigned long long i = 0; valid && i < lodCount * submeshCount; ++i )
+			{
+				SubmeshLod range = readValue<SubmeshLod>(data, lodRangesOffset + i * sizeof(SubmeshLod));
+				valid = static_cast<unsigned long long>( range.firstIndex ) + range.indexCount <= indexCount;
+			}
+			if ( !valid )
+			{
+#if CLOCKWORK_DEBUG
+				std::cout << "Failed to load CookedMesh(broken submeshtable): " << m_filepath << std::endl;
+#endif
+				m_file = File();
+				return *this;
+			}
+			m_data = data;
+			m_size = size;
+			return *this;
+		}
+
+		CookedMesh& CookedMesh::save() noexcept
+		{
+#if CLOCKWORK_DEBUG
+			if ( m_data == nullptr )
+				std::cout << "Error CookedMesh::save(): the cooked mesh has no data " << m_filepath << std::endl;
+#endif
+			std::ofstream file(m_filepath, std::ios::binary | std::ios::trunc);
+			if ( m_data )
+				file.write(reinterpret_cast<const char*>( m_data ), m_size);
+#if CLOCKWORK_DEBUG
+			if ( !file )
+				std::cout << "Failed to save CookedMesh: " << m_filepath << std::endl;
+#endif
+			return *this;
+		}
+
+		void CookedMesh::clearData() noexcept
+		{
+			m_file = File();
+			m_buffer.clear();
+			m_buffer.shrink_to_fit();
+			m_data = nullptr;
+			m_size = 0;
+		}
+
+		const unsigned char* CookedMesh::getVertexData() const noexcept
+		{
+			return m_data ? m_data + readValue<unsigned int>(m_data, 28) : nullptr;
+		}
+
+		const unsigned char* CookedMesh::getIndexData() const noexcept
+		{
+			return m_data ? m_data + readValue<unsigned int>(m_data, 32) : nullptr;
+		}
+
+		const unsigned int CookedMesh::getVertexCount() const noexcept
+		{
+			return m_data ? readValue<unsigned int>(m_data, 12) : 0;
+		}
+
+		const unsigned int CookedMesh::getIndexCount() const noexcept
+		{
+			return m_data ? readValue<unsigned int>(m_data, 16) : 0;
+		}
+
+		const unsigned int CookedMesh::getIndexSize() const noexcept
+		{
+			return m_data ? readValue<unsigned int>(m_data, 20) : 0;
+		}
+
+		const unsigned int CookedMesh::getSubmeshCount() const noexcept
+		{
+			return m_data ? readValue<unsigned int>(m_data, 24) : 0;
+		}
+
+		Submesh CookedMesh::getSubmesh(unsigned int submesh) const noexcept
+		{
+#if CLOCKWORK_DEBUG
+			if ( submesh >= getSubmeshCount() )
+				std::cout << "Error CookedMesh::getSubmesh(): the submesh " << submesh << " is not in the mesh " << m_filepath << std::endl;
+#endif
+			return readValue<Submesh>(m_data, headerSize + submesh * sizeof(Submesh));
+		}
+
+		std::string CookedMesh::getMaterial(unsigned int submesh) const noexcept
+		{
+			Submesh part = getSubmesh(submesh);
+			return std::string(reinterpret_cast<const char*>( m_data + part.nameOffset ), part.nameLength);
+		}
+
+		MeshBounds CookedMesh::getBounds() const noexcept
+		{
+			return m_data ? readValue<MeshBounds>(m_data, 40) : MeshBounds { { 0, 0, 0 }, { 0, 0, 0 } };
+		}
+
+		const unsigned int CookedMesh::getLodCount() const noexcept
+		{
+			return m_data ? readValue<unsigned int>(m_data, 68) : 0;
+		}
+
+		float CookedMesh::getLodError(unsigned int lod) const noexcept
+		{
+#if CLOCKWORK_DEBUG
+			if ( lod >= getLodCount() )
+				std::cout << "Error CookedMesh::getLodError(): the level of detail " << lod << " is not in the mesh " << m_filepath << std::endl;
+#endif
+			return readValue<float>(m_data, readValue<unsigned int>(m_data, 72) + lod * sizeof(float));
+		}
+
+		SubmeshLod CookedMesh::getSubmeshLod(unsigned int submesh, unsigned int lod) const noexcept
+		{
+#if CLOCKWORK_DEBUG
+			if ( submesh >= getSubmeshCount() || lod >= getLodCount() )
+				std::cout << "Error CookedMesh::getSubmeshLod(): the submesh " << submesh << " at the level of detail " << lod << " is not in the mesh " << m_filepath << std::endl;
+#endif
+			unsigned long long lodRangesOffset = readValue<unsigned int>(m_data, 72) + static_cast<unsigned long long>( getLodCount() ) * sizeof(float);
+			return readValue<SubmeshLod>(m_data, lodRangesOffset + ( static_cast<unsigned long long>( lod ) * getSubmeshCount() + submesh ) * sizeof(SubmeshLod));
+		}
+
+		const bool CookedMesh::hasHalfFloatUVs() const noexcept
+		{
+			return m_data ? ( readValue<unsigned int>(m_data, 64) & halfFloatUVs ) != 0 : false;
+		}
+
+	}
+}
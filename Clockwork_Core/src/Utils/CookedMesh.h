@@ -0,0 +1,195 @@
+#pragma once
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "Helper.h"
+#include "File.h"
+#include <string>
+#include <vector>
+
+namespace clockwork {
+	namespace utils {
+
+		/*one vertex of a mesh that is cooked with the same attributes as the vertices of the cubes: 3d position, 2d texture coords and 3d vertex normal as floats | the vertices are quantised into packedvertices when they are cooked*/
+		struct MeshVertex
+		{
+			float position[3];
+			float uv[2];
+			float normal[3];
+		};
+
+		/*one quantised vertex of a cooked mesh(16 bytes instead of the 32 bytes of a meshvertex) | all attributes are normalized unsigned shorts, so the gpu converts them to floats from 0 to 1
+		position: relative to the bounds of the mesh(0 = min, 65535 = max) | the 4th value is only padding | the vertex shader gets the position from 0 to 1, so the modelmatrix has to be multiplied with Mesh::getVertexTransform()
+		uv: the texture coords from 0 to 1, or half floats if a texture coord of the mesh is outside of 0 to 1(see CookedMesh::hasHalfFloatUVs())
+		normal: the octahedral encoding of the normalized vertex normal from 0 to 1 | decode it in the shader with: n = vec3(e * 2 - 1, 0); n.z = 1 - abs(n.x) - abs(n.y); if(n.z < 0) n.xy = (1 - abs(n.yx)) * sign(n.xy); normalize(n)*/
+		struct PackedVertex
+		{
+			unsigned short position[4];
+			unsigned short uv[2];
+			unsigned short normal[2];
+		};
+
+		/*returns the bits of the nearest half float of the value | too big values become infinity and too small values become subnormal half floats, or 0*/
+		unsigned short toHalfFloat(float value) noexcept;
+
+		/*the axis aligned bounding box of a mesh, or a submesh in model space*/
+		struct MeshBounds
+		{
+			float min[3];
+			float max[3];
+		};
+
+		/*one part of a cooked mesh that is drawn with one material | the indices start at firstIndex in the indexdata and are relative to baseVertex, so 16 bit indices can be used for each submesh with less than 65536 vertices*/
+		struct Submesh
+		{
+			unsigned int firstIndex;
+			unsigned int indexCount;
+			unsigned int baseVertex;
+			unsigned int vertexCount;
+			unsigned int nameOffset;//the position of the materialname in the file
+			unsigned int nameLength;
+			MeshBounds bounds;
+		};
+
+		/*the index range of one submesh at one level of detail in the indexdata | the indices use the same vertices(and basevertex) as the submesh at level 0*/
+		struct SubmeshLod
+		{
+			unsigned int firstIndex;
+			unsigned int indexCount;
+		};
+
+		/*the simplified indices of one level of detail of a meshpart and its error(the distance from the surface of the full detail mesh in model space)*/
+		struct MeshLod
+		{
+			std::vector<unsigned int> indices;
+			float error;
+		};
+
+		/*the vertices and indices of one submesh and its material(the path of its diffuse texture) | used to cook a mesh
+		lods are the simplified levels of detail(level 1 and higher) of the indices that are generated by utils::generateLods() | they use the same vertices as the indices*/
+		struct MeshPart
+		{
+			std::string material;
+			std::vector<MeshVertex> vertices;
+			std::vector<unsigned int> indices;
+			std::vector<MeshLod> lods;
+		};
+
+		/*a mesh that was cooked offline from a model file(for example with assimp by the meshcooker) into the binary layout that is uploaded to the gpu, so there is no parsing at runtime and loading a mesh is only reading the file
+		the cooked file(.cwms) is read through utils::File, so a mesh that is stored uncompressed in the resource packfile is not copied and the vertices and indices are uploaded directly from the mapped packfile
+		header(80 bytes): "CWMS", version, vertexstride, vertexcount, indexcount, indexsize(2 or 4 bytes), submeshcount, vertexoffset, indexoffset, nameoffset as 32 bit unsigned integers, the bounds of the whole mesh as 6 floats,
+		flags(1 = half float texture coords), lodcount, lodoffset and 1 reserved 32 bit unsigned integer
+		submeshtable: one submesh(48 bytes) per material | names: the materialnames of the submeshes
+		lodtable(aligned to 16 bytes): the error of each level of detail as float and then the submeshlods of all submeshes for each level(level 0 is the index range of the submeshes)
+		vertexdata: the packedvertices of all submeshes aligned to 16 bytes | indexdata: the indices of all submeshes(level 0) followed by the indices of the higher levels aligned to 16 bytes*/
+		class CookedMesh
+		{
+
+		private:
+			File m_file;//the data of a loaded mesh
+			std::vector<unsigned char> m_buffer;//the data of a cooked mesh
+			const unsigned char* m_data;
+			unsigned int m_size;
+			std::string m_filepath;
+
+		public:
+			static constexpr unsigned int version = 3;
+
+			/*the flag in the header for texture coords that are stored as half floats instead of normalized unsigned shorts*/
+			static constexpr unsigned int halfFloatUVs = 1;
+
+		public:
+			/*creates an empty cooked mesh with no filepath and no data*/
+			CookedMesh() noexcept;
+
+			/*creates an empty cooked mesh with a filepath relative to the engine.exe that should point to a .cwms file | for loading the data of the file, YOU HAVE TO CALL the method load()*/
+			explicit CookedMesh(const std::string& filepath) noexcept;
+
+			/*cooks the parts into one mesh with one submesh per part | the indices are stored with 16 bits if every part has less than 65536 vertices, otherwise with 32 bits(utils::splitMeshPart() can split bigger parts)
+			the bounds are calculated from the vertices and the vertices are quantised into packedvertices | call save() to write the mesh into the file with the filepath
+			the mesh has as many levels of detail as the part with the most lods | parts with less lods use their last level for the higher levels and the error of a level is the biggest error of the parts at that level*/
+			CookedMesh(const std::string& filepath, const std::vector<MeshPart>& parts) noexcept;
+
+			CookedMesh(const CookedMesh& other) = delete;
+
+			CookedMesh(CookedMesh&& other) noexcept;
+
+			CookedMesh& operator=(const CookedMesh& other) = delete;
+
+			CookedMesh& operator=(CookedMesh&& other) noexcept;
+
+		public:
+			/*returns true if the filepath has the .cwms extension of cooked meshes*/
+			static bool isCookedFile(const std::string& filepath) noexcept;
+
+			/*returns the modelpath with the extension replaced by .cwms*/
+			static std::string getCookedPath(const std::string& modelPath) noexcept;
+
+		public:
+			/*reads the .cwms file with the filepath | the header and the submeshtable are checked, so the cooked mesh will be empty if the file is broken or has another version*/
+			CookedMesh& load() noexcept;
+
+			/*saves the data of the cooked mesh into the file with the filepath*/
+			CookedMesh& save() noexcept;
+
+			/*releases the data after the mesh has been uploaded to the gpu*/
+			void clearData() noexcept;
+
+			/*returns the packedvertices of all submeshes*/
+			const unsigned char* getVertexData() const noexcept;
+
+			/*returns the indices of all submeshes with getIndexSize() bytes per index*/
+			const unsigned char* getIndexData() const noexcept;
+
+			const unsigned int getVertexCount() const noexcept;
+
+			const unsigned int getIndexCount() const noexcept;
+
+			/*returns the size of one index in bytes | 2 for unsigned short indices and 4 for unsigned int indices*/
+			const unsigned int getIndexSize() const noexcept;
+
+			const unsigned int getSubmeshCount() const noexcept;
+
+			/*returns the submesh of the submeshtable*/
+			Submesh getSubmesh(unsigned int submesh) const noexcept;
+
+			/*returns the materialname of the submesh | it is the path of the diffuse texture of the submesh, or empty*/
+			std::string getMaterial(unsigned int submesh) const noexcept;
+
+			/*returns the bounds of the whole mesh | the quantised positions are relative to these bounds*/
+			MeshBounds getBounds() const noexcept;
+
+			/*returns the count of the levels of detail of the mesh including level 0(the full detail) | it is at least 1 for a mesh with data*/
+			const unsigned int getLodCount() const noexcept;
+
+			/*returns the error of the level of detail in model space(0 for level 0) | it is the biggest distance of the simplified surface from the full detail surface*/
+			float getLodError(unsigned int lod) const noexcept;
+
+			/*returns the index range of the submesh at the level of detail*/
+			SubmeshLod getSubmeshLod(unsigned int submesh, unsigned int lod) const noexcept;
+
+			/*returns true if the texture coords of the packedvertices are half floats, because a texture coord of the mesh is outside of 0 to 1 | otherwise they are normalized unsigned shorts*/
+			const bool hasHalfFloatUVs() const noexcept;
+
+		public:
+			const std::string& getFilepath() const noexcept {return m_filepath;}
+
+			/*returns the size of the file in bytes*/
+			const unsigned int getSize() const noexcept {return m_size;}
+
+			/*returns true if the cooked mesh has data that can be uploaded*/
+			const bool hasData() const noexcept {return m_data != nullptr;}
+
+		};
+
+	}
+}
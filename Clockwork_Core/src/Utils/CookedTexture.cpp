@@ -0,0 +1,358 @@
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "CookedTexture.h"
+#include "BlockCompression.h"
+#include "PixelConversion.h"
+#include "PackFile.h"
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace clockwork {
+	namespace utils {
+
+		namespace {
+
+			const char cookedMagic[4] = { 'C', 'W', 'T', 'X' };
+			const unsigned int headerSize = 32;
+			const unsigned int levelIndexSize = 16;
+			const unsigned int alphaFlag = 1;
+
+			template<typename type> void writeValue(std::vector<unsigned char>& data, unsigned long long position, const type& value) noexcept
+			{
+				std::memcpy(data.data() + position, &value, sizeof(type));
+			}
+
+			template<typename type> type readValue(const std::vector<unsigned char>& data, unsigned long long position) noexcept
+			{
+				type value;
+				std::memcpy(&value, data.data() + position, sizeof(type));
+				return value;
+			}
+
+			/*converts the image data of freeimage(rows aligned to 4 bytes and plattform dependant colour order) to tightly packed rgba pixels | images without alpha channel get an alpha of 255*/
+			std::vector<unsigned char> convertToRGBA(const Image& image) noexcept
+			{
+				std::vector<unsigned char> pixels;
+				unsigned int bytesPerPixel = image.getPixelSize() / 8;
+				if ( !image.hasData() || ( bytesPerPixel != 3 && bytesPerPixel != 4 ) )
+				{
+#if CLOCKWORK_DEBUG
+					std::cout << "Error CookedTexture::CookedTexture(): the image has no data, or not 24/32 bits per pixel: " << image.getFilepath() << std::endl;
+#endif
+					return pixels;
+				}
+				unsigned int pitch = ( image.getWidth() * image.getPixelSize() + 31 ) / 32 * 4;
+				const unsigned char* data = image.getData();
+				pixels.resize(image.getWidth() * image.getHeight() * 4);
+				for ( unsigned int y = 0; y < image.getHeight(); ++y )
+				{
+					unsigned char* row = &pixels[y * image.getWidth() * 4];
+					if ( bytesPerPixel == 4 )
+						std::memcpy(row, data + y * pitch, image.getWidth() * 4);
+					else
+						expandToAlpha(data + y * pitch, row, image.getWidth());
+#if FREEIMAGE_COLORORDER == FREEIMAGE_COLORORDER_BGR
+					swapRedBlue(row, image.getWidth(), 4);
+#endif
+				}
+				return pixels;
+			}
+
+			/*returns the next smaller mipmap level of the rgba pixels with half the size | each pixel is the average of 4 pixels(box filter) and the borders are clamped for odd sizes*/
+			std::vector<unsigned char> downscale(const std::vector<unsigned char>& pixels, unsigned int width, unsigned int height) noexcept
+			{
+				unsigned int levelWidth = width > 1 ? width / 2 : 1;
+				unsigned int levelHeight = height > 1 ? height / 2 : 1;
+				std::vector<unsigned char> level(levelWidth * levelHeight * 4);
+				for ( unsigned int y = 0; y < levelHeight; ++y )
+				{
+					unsigned int y0 = y * 2 < height ? y * 2 : height - 1;
+					unsigned int y1 = y * 2 + 1 < height ? y * 2 + 1 : height - 1;
+					for ( unsigned int x = 0; x < levelWidth; ++x )
+					{
+						unsigned int x0 = x * 2 < width ? x * 2 : width - 1;
+						unsigned int x1 = x * 2 + 1 < width ? x * 2 + 1 : width - 1;
+						for ( unsigned int c = 0; c < 4; ++c )
+						{
+							unsigned int sum = pixels[( y0 * width + x0 ) * 4 + c] + pixels[( y0 * width + x1 ) * 4 + c] + pixels[( y1 * width + x0 ) * 4 + c] + pixels[( y1 * width + x1 ) * 4 + c];
+							level[( y * levelWidth + x ) * 4 + c] = static_cast<unsigned char>( ( sum + 2 ) / 4 );
+						}
+					}
+				}
+				return level;
+			}
+
+			/*compresses the rgba pixels of one mipmap level block by block | the pixels outside of the level are clamped to the border for sizes that are not a multiple of 4*/
+			std::vector<unsigned char> compressLevel(const std::vector<unsigned char>& pixels, unsigned int width, unsigned int height, BlockFormat format) noexcept
+			{
+				unsigned int blocksX = ( width + 3 ) / 4;
+				unsigned int blocksY = ( height + 3 ) / 4;
+				unsigned int blockSize = CookedTexture::getBlockSize(format);
+				std::vector<unsigned char> level(blocksX * blocksY * blockSize);
+				unsigned char block[64];
+				for ( unsigned int by = 0; by < blocksY; ++by )
+				{
+					for ( unsigned int bx = 0; bx < blocksX; ++bx )
+					{
+						for ( unsigned int y = 0; y < 4; ++y )
+						{
+							unsigned int py = by * 4 + y < height ? by * 4 + y : height - 1;
+							for ( unsigned int x = 0; x < 4; ++x )
+							{
+								unsigned int px = bx * 4 + x < width ? bx * 4 + x : width - 1;
+								std::memcpy(block + ( y * 4 + x ) * 4, &pixels[( py * width + px ) * 4], 4);
+							}
+						}
+						unsigned char* output = &level[( by * blocksX + bx ) * blockSize];
+						if ( format == BlockFormat::BC1 )
+							compressBlockBC1(block, output);
+						else if ( format == BlockFormat::BC3 )
+							compressBlockBC3(block, output);
+						else
+							compressBlockBC7(block, output);
+					}
+				}
+				return level;
+			}
+
+			/*cooks the image and writes the cooked texture to the outputpath | returns false if the image has no data, or the file could not be written*/
+			bool cookImage(const Image& image, BlockFormat format, const std::string& outputPath) noexcept
+			{
+				if ( !image.hasData() )
+					return false;
+				CookedTexture texture(image, format);
+				if ( !texture.hasData() )
+					return false;
+				texture.setFilepath(outputPath).save();
+				return static_cast<bool>( std::ifstream(outputPath, std::ios::binary) );
+			}
+
+		}
+
+		CookedTexture::CookedTexture() noexcept
+			: m_format(BlockFormat::BC1), m_width(0), m_height(0), m_hasAlpha(false)
+		{}
+
+		CookedTexture::CookedTexture(const std::string& filepath) noexcept
+			: m_filepath(filepath), m_format(BlockFormat::BC1), m_width(0), m_height(0), m_hasAlpha(false)
+		{}
+
+		CookedTexture::CookedTexture(const Image& image, BlockFormat format) noexcept
+			: m_filepath(getCookedPath(image.getFilepath())), m_format(format), m_width(image.getWidth()), m_height(image.getHeight()), m_hasAlpha(image.hasAlpha() && format != BlockFormat::BC1)
+		{
+			std::vector<unsigned char> pixels = convertToRGBA(image);
+			if ( pixels.empty() )
+				return;
+
+			std::vector<std::vector<unsigned char>> levels;
+			unsigned int width = m_width;
+			unsigned int height = m_height;
+			while ( true )
+			{
+				levels.push_back(compressLevel(pixels, width, height, format));
+				if ( width == 1 && height == 1 )
+					break;
+				pixels = downscale(pixels, width, height);
+				width = width > 1 ? width / 2 : 1;
+				height = height > 1 ? height / 2 : 1;
+			}
+
+			unsigned long long offset = headerSize + levels.size() * levelIndexSize;
+			m_levels.resize(levels.size());
+			for ( unsigned int i = levels.size(); i-- > 0; )//smallest level first
+			{
+				m_levels.at(i).offset = offset;
+				m_levels.at(i).size = levels.at(i).size();
+				offset += levels.at(i).size();
+			}
+
+			m_data.resize(static_cast<size_t>( offset ));
+			std::memcpy(m_data.data(), cookedMagic, 4);
+			writeValue<unsigned int>(m_data, 4, version);
+			writeValue<unsigned int>(m_data, 8, getInternalFormat(format));
+			writeValue<unsigned int>(m_data, 12, static_cast<unsigned int>( format ));
+			writeValue<unsigned int>(m_data, 16, m_width);
+			writeValue<unsigned int>(m_data, 20, m_height);
+			writeValue<unsigned int>(m_data, 24, m_levels.size());
+			writeValue<unsigned int>(m_data, 28, m_hasAlpha ? alphaFlag : 0);
+			for ( unsigned int i = 0; i < m_levels.size(); ++i )
+			{
+				writeValue<unsigned long long>(m_data, headerSize + i * levelIndexSize, m_levels.at(i).offset);
+				writeValue<unsigned long long>(m_data, headerSize + i * levelIndexSize + 8, m_levels.at(i).size);
+				std::memcpy(m_data.data() + m_levels.at(i).offset, levels.at(i).data(), levels.at(i).size());
+			}
+		}
+
+		bool CookedTexture::isCookedFile(const std::string& filepath) noexcept
+		{
+			return filepath.size() > 5 && filepath.compare(filepath.size() - 5, 5, ".cwtx") == 0;
+		}
+
+		std::string CookedTexture::getCookedPath(const std::string& imagePath) noexcept
+		{
+			size_t dot = imagePath.find_last_of('.');
+			size_t slash = imagePath.find_last_of("/\\");
+			if ( dot == std::string::npos || ( slash != std::string::npos && dot < slash ) )
+				return imagePath + ".cwtx";
+			return imagePath.substr(0, dot) + ".cwtx";
+		}
+
+		unsigned int CookedTexture::getBlockSize(BlockFormat format) noexcept
+		{
+			return format == BlockFormat::BC1 ? 8 : 16;
+		}
+
+		int CookedTexture::getInternalFormat(BlockFormat format) noexcept
+		{
+			switch ( format )
+			{
+			case BlockFormat::BC1:
+				return 33776;
+			case BlockFormat::BC3:
+				return 33779;
+			default:
+				return 36492;
+			}
+		}
+
+		CookedTexture& CookedTexture::load() noexcept
+		{
+			m_data.clear();
+			m_levels.clear();
+			const PackEntry* entry = resourcePack ? resourcePack->find(m_filepath) : nullptr;
+			if ( entry )//the data is copied out of the mapped packfile without opening a file
+			{
+				std::vector<unsigned char> buffer;
+				const unsigned char* data = resourcePack->read(*entry, buffer);
+				if ( data == buffer.data() )
+					m_data.swap(buffer);
+				else if ( data )
+					m_data.assign(data, data + entry->size);
+			}
+			else
+			{
+				std::ifstream file(m_filepath, std::ios::binary);
+				if ( !file )
+				{
+#if CLOCKWORK_DEBUG
+					std::cout << "Failed to load CookedTexture(file not found): " << m_filepath << std::endl;
+#endif
+					return *this;
+				}
+				m_data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+			}
+
+			if ( m_data.size() < headerSize || std::memcmp(m_data.data(), cookedMagic, 4) != 0 || readValue<unsigned int>(m_data, 4) != version )
+			{
+#if CLOCKWORK_DEBUG
+				std::cout << "Failed to load CookedTexture(no .cwtx file, or wrong version): " << m_filepath << std::endl;
+#endif
+				m_data.clear();
+				return *this;
+			}
+			m_format = static_cast<BlockFormat>( readValue<unsigned int>(m_data, 12) );
+			m_width = readValue<unsigned int>(m_data, 16);
+			m_height = readValue<unsigned int>(m_data, 20);
+			unsigned int levelCount = readValue<unsigned int>(m_data, 24);
+			m_hasAlpha = ( readValue<unsigned int>(m_data, 28) & alphaFlag ) != 0;
+
+			bool valid = levelCount > 0 && m_data.size() >= headerSize + static_cast<unsigned long long>( levelCount ) * levelIndexSize;
+			for ( unsigned int i = 0; valid && i < levelCount; ++i )
+			{
+				Level level;
+				level.offset = readValue<unsigned long long>(m_data, headerSize + i * levelIndexSize);
+				level.size = readValue<unsigned long long>(m_data, headerSize + i * levelIndexSize + 8);
+				m_levels.push_back(level);
+				unsigned long long blocks = static_cast<unsigned long long>( ( getLevelWidth(i) + 3 ) / 4 ) * ( ( getLevelHeight(i) + 3 ) / 4 );
+				valid = level.offset + level.size <= m_data.size() && level.size == blocks * getBlockSize(m_format);
+			}
+			if ( !valid )
+			{
+#if CLOCKWORK_DEBUG
+				std::cout << "Failed to load CookedTexture(broken levelindex): " << m_filepath << std::endl;
+#endif
+				m_data.clear();
+				m_levels.clear();
+			}
+			return *this;
+		}
+
+		CookedTexture& CookedTexture::save() noexcept
+		{
+#if CLOCKWORK_DEBUG
+			if ( m_data.empty() )
+				std::cout << "Error CookedTexture::save(): the cooked texture has no data " << m_filepath << std::endl;
+#endif
+			std::ofstream file(m_filepath, std::ios::binary | std::ios::trunc);
+			file.write(reinterpret_cast<const char*>( m_data.data() ), m_data.size());
+#if CLOCKWORK_DEBUG
+			if ( !file )
+				std::cout << "Failed to save CookedTexture: " << m_filepath << std::endl;
+#endif
+			return *this;
+		}
+
+		const unsigned char* const CookedTexture::getLevelData(unsigned int level) const noexcept
+		{
+#if CLOCKWORK_DEBUG
+			if ( m_data.empty() )
+				std::cout << "Error CookedTexture::getLevelData(): the cooked texture has no data " << m_filepath << std::endl;
+#endif
+			return m_data.data() + m_levels.at(level).offset;
+		}
+
+		const unsigned int CookedTexture::getLevelSize(unsigned int level) const noexcept
+		{
+			return static_cast<unsigned int>( m_levels.at(level).size );
+		}
+
+		const unsigned int CookedTexture::getLevelWidth(unsigned int level) const noexcept
+		{
+			unsigned int width = m_width >> level;
+			return width > 0 ? width : 1;
+		}
+
+		const unsigned int CookedTexture::getLevelHeight(unsigned int level) const noexcept
+		{
+			unsigned int height = m_height >> level;
+			return height > 0 ? height : 1;
+		}
+
+		Image CookedTexture::getImage() const noexcept
+		{
+			return Image(m_filepath, m_width, m_height, m_hasAlpha ? 32 : 24);
+		}
+
+		void CookedTexture::clearData() noexcept
+		{
+			m_data.clear();
+			m_data.shrink_to_fit();
+		}
+
+		bool cookTexture(const std::string& imagePath, const std::string& outputPath, BlockFormat format) noexcept
+		{
+			Image image(imagePath);
+			image.load();
+			return cookImage(image, format, outputPath);
+		}
+
+		bool cookTexture(const std::string& imagePath, const std::string& outputPath) noexcept
+		{
+			Image image(imagePath);
+			image.load();
+			return cookImage(image, image.hasAlpha() ? BlockFormat::BC3 : BlockFormat::BC1, outputPath);
+		}
+
+	}
+}
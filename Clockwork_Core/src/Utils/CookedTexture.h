@@ -0,0 +1,146 @@
+#pragma once
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "Helper.h"
+#include "Image.h"
+#include <string>
+#include <vector>
+
+namespace clockwork {
+	namespace utils {
+
+		/*the block compression formats a texture can be cooked to
+		BC1 for rgb textures without alpha(4 bits per pixel) | BC3 for rgba textures(8 bits per pixel) | BC7 for a better quality of rgb and rgba textures(8 bits per pixel, needs opengl 4.2)*/
+		enum class BlockFormat : unsigned int
+		{
+			BC1 = 1,
+			BC3 = 3,
+			BC7 = 7,
+		};
+
+		/*a texture that was cooked offline from an image into block compressed gpu data with all mipmap levels | the data can be uploaded directly with glCompressedTexImage, so there is no image decoding and no mipmap generation at runtime
+		and the texture only needs 1/8(BC1) or 1/4(BC3/BC7) of the vram of an uncompressed rgba texture
+		the cooked file(.cwtx) is a small ktx2 like container:
+		header: "CWTX", version, opengl internal format, blockformat, width, height, levelcount, flags(1 = alpha) as 32 bit unsigned integers
+		levelindex: offset of the level in the file and size of the level in bytes as 64 bit unsigned integers for each mipmap level from the biggest(0) to the smallest level(1x1)
+		leveldata: the compressed 4x4 blocks of each mipmap level row by row | the levels are stored from the smallest to the biggest level like in ktx2, so the small levels could be streamed first*/
+		class CookedTexture
+		{
+
+		private:
+			/*the position of a mipmap level in the file data*/
+			struct Level
+			{
+				unsigned long long offset;
+				unsigned long long size;
+			};
+
+		private:
+			std::vector<unsigned char> m_data;//the whole file
+			std::vector<Level> m_levels;
+			std::string m_filepath;
+			BlockFormat m_format;
+			unsigned int m_width;
+			unsigned int m_height;
+			bool m_hasAlpha;
+
+		public:
+			static constexpr unsigned int version = 1;
+
+		public:
+			/*creates an empty cooked texture with no filepath and no data*/
+			CookedTexture() noexcept;
+
+			/*creates an empty cooked texture with a filepath relative to the engine.exe that should point to a .cwtx file | for loading the data of the file, YOU HAVE TO CALL the method load()*/
+			explicit CookedTexture(const std::string& filepath) noexcept;
+
+			/*cooks the image into a texture with all mipmap levels compressed to the blockformat | the mipmaps are downscaled with a box filter and the blocks of the levels are compressed in memory
+			the filepath of the cooked texture will be the filepath of the image with the .cwtx extension | call save() to write it into the file
+			the image needs image data with 24 or 32 bits per pixel | BC1 drops the alpha channel of the image*/
+			CookedTexture(const Image& image, BlockFormat format) noexcept;
+
+		public:
+			/*returns true if the filepath has the .cwtx extension of cooked textures*/
+			static bool isCookedFile(const std::string& filepath) noexcept;
+
+			/*returns the imagepath with the extension replaced by .cwtx*/
+			static std::string getCookedPath(const std::string& imagePath) noexcept;
+
+			/*returns the size of one compressed 4x4 block in bytes | 8 for BC1 and 16 for BC3/BC7*/
+			static unsigned int getBlockSize(BlockFormat format) noexcept;
+
+			/*returns the opengl internal format of the blockformat
+			GL_COMPRESSED_RGB_S3TC_DXT1_EXT = 33776 | GL_COMPRESSED_RGBA_S3TC_DXT5_EXT = 33779 | GL_COMPRESSED_RGBA_BPTC_UNORM = 36492*/
+			static int getInternalFormat(BlockFormat format) noexcept;
+
+		public:
+			/*loads the data of the .cwtx file with the filepath into the cooked texture | the header and the levelindex are checked, so the cooked texture will be empty if the file is broken or has another version
+			the file is read from the resource packfile, if it contains the filepath*/
+			CookedTexture& load() noexcept;
+
+			/*saves the data of the cooked texture into the file with the filepath*/
+			CookedTexture& save() noexcept;
+
+			/*returns a pointer to the compressed blocks of the mipmap level | level 0 is the biggest level with the size of the texture*/
+			const unsigned char* const getLevelData(unsigned int level) const noexcept;
+
+			/*returns the size of the compressed blocks of the mipmap level in bytes*/
+			const unsigned int getLevelSize(unsigned int level) const noexcept;
+
+			/*returns the width of the mipmap level in pixel*/
+			const unsigned int getLevelWidth(unsigned int level) const noexcept;
+
+			/*returns the height of the mipmap level in pixel*/
+			const unsigned int getLevelHeight(unsigned int level) const noexcept;
+
+			/*returns an image without image data that describes the cooked texture with its filepath, size and pixelsize(32 with alpha, otherwise 24) | used by the textures to compare and sort the cooked textures like images*/
+			Image getImage() const noexcept;
+
+			/*clears the data of the cooked texture after it has been uploaded to the gpu, so you have more free space | the size and the levels can still be used*/
+			void clearData() noexcept;
+
+		public:
+			/*returns the filepath of the cooked texture relative to the engine.exe*/
+			const std::string& getFilepath() const noexcept {return m_filepath;}
+
+			/*changes the filepath of the cooked texture relative to the engine.exe*/
+			CookedTexture& setFilepath(const std::string& filepath) noexcept {m_filepath = filepath; return *this;}
+
+			/*returns the opengl internal format of the compressed data*/
+			const int getInternalFormat() const noexcept {return getInternalFormat(m_format);}
+
+			const BlockFormat getFormat() const noexcept {return m_format;}
+
+			const unsigned int getWidth() const noexcept {return m_width;}
+
+			const unsigned int getHeight() const noexcept {return m_height;}
+
+			/*returns the number of mipmap levels down to the 1x1 level*/
+			const unsigned int getLevelCount() const noexcept {return m_levels.size();}
+
+			const bool hasAlpha() const noexcept {return m_hasAlpha;}
+
+			/*returns true if the cooked texture has data that can be uploaded*/
+			const bool hasData() const noexcept {return !m_data.empty();}
+
+		};
+
+		/*loads the image at the imagepath, cooks it into the blockformat and saves the cooked texture at the outputpath | returns false if the image could not be loaded, or the file could not be written*/
+		bool cookTexture(const std::string& imagePath, const std::string& outputPath, BlockFormat format) noexcept;
+
+		/*loads the image at the imagepath, cooks it with BC1 if the image has no alpha channel and otherwise with BC3 and saves the cooked texture at the outputpath
+		returns false if the image could not be loaded, or the file could not be written*/
+		bool cookTexture(const std::string& imagePath, const std::string& outputPath) noexcept;
+
+	}
+}
@@ -11,11 +11,82 @@
 * You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
 *************************************************************************/
 #include "File.h"
+#include "PackFile.h"
+#include <fstream>
 
 namespace clockwork {
 	namespace utils {
 
+		File::File() noexcept
+			: m_data(nullptr), m_size(0)
+		{}
 
+		File::File(const std::string& filepath) noexcept
+			: m_data(nullptr), m_size(0), m_filepath(filepath)
+		{}
+
+		File::File(const File& other) noexcept
+			: m_buffer(other.m_buffer), m_data(other.isMapped() ? other.m_data : ( other.m_data ? m_buffer.data() : nullptr )), m_size(other.m_size), m_filepath(other.m_filepath)
+		{}
+
+		File::File(File&& other) noexcept
+			: m_buffer(std::move(other.m_buffer)), m_data(other.m_data), m_size(other.m_size), m_filepath(std::move(other.m_filepath))
+		{
+			other.m_data = nullptr;
+			other.m_size = 0;
+		}
+
+		File& File::operator=(const File& other) noexcept
+		{
+			m_buffer = other.m_buffer;
+			m_data = other.isMapped() ? other.m_data : ( other.m_data ? m_buffer.data() : nullptr );
+			m_size = other.m_size;
+			m_filepath = other.m_filepath;
+			return *this;
+		}
+
+		File& File::operator=(File&& other) noexcept
+		{
+			m_buffer = std::move(other.m_buffer);
+			m_data = other.m_data;
+			m_size = other.m_size;
+			m_filepath = std::move(other.m_filepath);
+			other.m_data = nullptr;
+			other.m_size = 0;
+			return *this;
+		}
+
+		File& File::read() noexcept
+		{
+			m_data = nullptr;
+			m_size = 0;
+			const PackEntry* entry = resourcePack ? resourcePack->find(m_filepath) : nullptr;
+			if ( entry )
+			{
+				m_data = resourcePack->read(*entry, m_buffer);
+				m_size = m_data ? entry->size : 0;
+				return *this;
+			}
+			std::ifstream file(m_filepath, std::ios::binary | std::ios::ate);//the size is read first, so the data is copied only once into the buffer
+			if ( !file )
+			{
+#if CLOCKWORK_DEBUG
+				std::cout << "Error File::read(): the file could not be opened: " << m_filepath << std::endl;
+#endif
+				return *this;
+			}
+			m_buffer.resize(static_cast<size_t>( file.tellg() ));
+			file.seekg(0);
+			file.read(reinterpret_cast<char*>( m_buffer.data() ), m_buffer.size());
+			m_data = m_buffer.data();
+			m_size = m_buffer.size();
+			return *this;
+		}
+
+		File& File::write() noexcept
+		{
+			return *this;
+		}
 
 	}
-}
\ No newline at end of file
+}
@@ -13,54 +13,63 @@
 *************************************************************************/
 #include "Helper.h"
 #include <string>
-
-
-#include <fstream>//spter nur in cpp und hier noch sachen anpassen
-#include <sstream>
-
-
+#include <vector>
 
 namespace clockwork {
 	namespace utils {
 
+		/*a file with a filepath relative to the engine.exe | the data is read from the resource packfile(see PackFile), if it contains the filepath, otherwise from the loose file
+		files that are stored uncompressed in the packfile are not copied, the data points directly into the mapped packfile | other files are read once into the buffer of the file object*/
 		class File
 		{
 
 		private:
-			std::string m_data;
+			std::vector<unsigned char> m_buffer;//the data of loose files and compressed packed files
+			const unsigned char* m_data;
+			unsigned int m_size;
 			std::string m_filepath;
 
 		public:
-			/**/
-			File() noexcept
-			{
+			/*creates an empty file without filepath and data*/
+			File() noexcept;
 
-			}
+			/*creates a file object with the filepath, but without data | for reading the data, YOU HAVE TO CALL the method read()*/
+			File(const std::string& filepath) noexcept;
 
-			/**/
-			File(const std::string& filepath) noexcept
-			{
-				m_filepath = filepath;
-			}
+			/*the copy shares the data, if it points into the packfile and otherwise copies the buffer*/
+			File(const File& other) noexcept;
+
+			File(File&& other) noexcept;
+
+			File& operator=(const File& other) noexcept;
 
+			File& operator=(File&& other) noexcept;
 
 		public:
-			/**/
-			File& read() noexcept
-			{
-				m_data = static_cast< std::stringstream const& >( std::stringstream() << std::ifstream(m_filepath).rdbuf() ).str();
-				return *this;
-			}
+			/*reads the data of the file | the data is empty if the file does not exist*/
+			File& read() noexcept;
 
 			/**/
-			File& write() noexcept
-			{
-				return *this;
-			}
+			File& write() noexcept;
 
 		public:
-			/**/
-			const std::string& getData() const noexcept{return m_data;}
+			/*returns the data of the file | it is not null terminated, so use getSize() for the end of the data
+			CAREFUL: the data is only valid as long as the file object and the resource packfile live*/
+			const unsigned char* getData() const noexcept {return m_data;}
+
+			/*returns the data of the file as characters for text files like shaders | it is not null terminated, so use getSize() for the end of the data*/
+			const char* getChars() const noexcept {return reinterpret_cast<const char*>( m_data );}
+
+			/*returns the size of the data in bytes*/
+			const unsigned int getSize() const noexcept {return m_size;}
+
+			/*returns a copy of the data as a string*/
+			std::string getString() const noexcept {return std::string(getChars(), m_size);}
+
+			/*returns true if the data points directly into the mapped packfile without a copy*/
+			const bool isMapped() const noexcept {return m_data != nullptr && m_data != m_buffer.data();}
+
+			const std::string& getFilepath() const noexcept {return m_filepath;}
 
 		};
 
@@ -11,11 +11,21 @@
 * You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
 *************************************************************************/
 #include "Image.h"
+#include "PackFile.h"
+#include <vector>
 
 
 namespace clockwork {
 	namespace utils {
 
+		/*returns a shared pointer that unloads the bitmap, when the last image releases it | returns an empty pointer for no bitmap*/
+		static std::shared_ptr<FIBITMAP> shareBitmap(FIBITMAP* bitmap) noexcept
+		{
+			if ( !bitmap )
+				return nullptr;
+			return std::shared_ptr<FIBITMAP>(bitmap, [](FIBITMAP* data) {FreeImage_Unload(data);});//free FreeImages copy of the image data
+		}
+
 		Image::Image() noexcept
 			: m_img(nullptr), m_format(FIF_UNKNOWN), m_subImageCount(0), m_width(0), m_height(0), m_pixelSize(0), m_hasAlpha(false)
 		{}
@@ -26,12 +36,16 @@ namespace clockwork {
 
 		}
 
+		Image::Image(const std::string& filepath, unsigned int width, unsigned int height, unsigned int pixelSize) noexcept
+			: m_img(nullptr), m_format(FIF_UNKNOWN), m_filepath(filepath), m_subImageCount(0), m_width(width), m_height(height), m_pixelSize(pixelSize), m_hasAlpha(pixelSize > 24)
+		{}
+
 		Image::Image(const Image& other) noexcept
-			: m_img(FreeImage_Copy(other.m_img, 0, 0, other.getWidth(), other.getHeight())), m_format(other.m_format), m_filepath(other.m_filepath), m_subImageCount(other.m_subImageCount), m_width(other.m_width), m_height(other.m_height), m_pixelSize(other.m_pixelSize), m_hasAlpha(other.m_hasAlpha)
+			: m_img(other.m_img), m_format(other.m_format), m_filepath(other.m_filepath), m_subImageCount(other.m_subImageCount), m_width(other.m_width), m_height(other.m_height), m_pixelSize(other.m_pixelSize), m_hasAlpha(other.m_hasAlpha)
 		{}
 
 		Image::Image(Image&& other) noexcept
-			: m_img(other.m_img), m_format(other.m_format), m_filepath(other.m_filepath), m_subImageCount(other.m_subImageCount), m_width(other.m_width), m_height(other.m_height), m_pixelSize(other.m_pixelSize), m_hasAlpha(other.m_hasAlpha)
+			: m_img(std::move(other.m_img)), m_format(other.m_format), m_filepath(std::move(other.m_filepath)), m_subImageCount(other.m_subImageCount), m_width(other.m_width), m_height(other.m_height), m_pixelSize(other.m_pixelSize), m_hasAlpha(other.m_hasAlpha)
 		{
 			other.m_img = nullptr;
 			other.m_format = FIF_UNKNOWN;
@@ -39,13 +53,12 @@ namespace clockwork {
 
 		Image::~Image() noexcept
 		{
-			if ( m_img )
-				FreeImage_Unload(m_img);//free FreeImages copy of the image data
+
 		}
 
 		Image& Image::operator=(const Image& other) noexcept
 		{
-			m_img = FreeImage_Copy(other.m_img, 0, 0, other.m_width, other.m_height);
+			m_img = other.m_img;
 			m_format = other.m_format;
 			m_filepath = other.m_filepath;
 			m_subImageCount = other.m_subImageCount;
@@ -58,9 +71,9 @@ namespace clockwork {
 
 		Image& Image::operator=(Image&& other) noexcept
 		{
-			m_img = other.m_img;
+			m_img = std::move(other.m_img);
 			m_format = other.m_format;
-			m_filepath = other.m_filepath;
+			m_filepath = std::move(other.m_filepath);
 			m_subImageCount = other.m_subImageCount;
 			m_width = other.m_width;
 			m_height = other.m_height;
@@ -91,26 +104,52 @@ namespace clockwork {
 
 		Image& Image::load() noexcept
 		{
+			const PackEntry* entry = resourcePack ? resourcePack->find(m_filepath) : nullptr;
+			if ( entry )
+				return loadPacked(*entry);
 			m_format = FreeImage_GetFileType(m_filepath.c_str(), 0);//check file signature and deduce its format
 			if ( m_format == FIF_UNKNOWN )
 				m_format = FreeImage_GetFIFFromFilename(m_filepath.c_str());//if still unknown try to guess file format from file extension
-			m_img = FreeImage_Load(m_format, m_filepath.c_str());//load image 
 #if CLOCKWORK_DEBUG
 			if ( m_format == FIF_UNKNOWN )
 				std::cout << "Failed to load Image(unknown format): " << m_filepath << std::endl;
-			if ( !FreeImage_FIFSupportsReading(m_format) )
+			else if ( !FreeImage_FIFSupportsReading(m_format) )
 				std::cout << "Failed to load Image(plugin has no reading capabilities): " << m_filepath << std::endl;
 #endif
-			if ( m_img )
-				FreeImage_Unload(m_img);//free FreeImages copy of the image data
-			m_img = FreeImage_Load(m_format, m_filepath.c_str());//load image 
+			m_img = shareBitmap(FreeImage_Load(m_format, m_filepath.c_str()));//load image once | the old data is released
 #if CLOCKWORK_DEBUG
 			if ( !m_img )
 				std::cout << "Failed to load Image(unknown error): " << m_filepath << std::endl;
 #endif
-			m_width = FreeImage_GetWidth(m_img);
-			m_height = FreeImage_GetHeight(m_img);
-			m_pixelSize = FreeImage_GetBPP(m_img);
+			m_width = FreeImage_GetWidth(m_img.get());
+			m_height = FreeImage_GetHeight(m_img.get());
+			m_pixelSize = FreeImage_GetBPP(m_img.get());
+			m_hasAlpha = m_pixelSize > 24;
+			return *this;
+		}
+
+		Image& Image::loadPacked(const PackEntry& entry) noexcept
+		{
+			std::vector<unsigned char> buffer;
+			const unsigned char* data = resourcePack->read(entry, buffer);
+			m_img = nullptr;
+			if ( data )
+			{
+				FIMEMORY* memory = FreeImage_OpenMemory(const_cast<BYTE*>( data ), entry.size);//freeimage only reads the memory, so the mapped packfile is decoded without a copy
+				m_format = FreeImage_GetFileTypeFromMemory(memory, entry.size);
+				if ( m_format == FIF_UNKNOWN )
+					m_format = FreeImage_GetFIFFromFilename(m_filepath.c_str());
+				if ( m_format != FIF_UNKNOWN && FreeImage_FIFSupportsReading(m_format) )
+					m_img = shareBitmap(FreeImage_LoadFromMemory(m_format, memory));
+				FreeImage_CloseMemory(memory);
+			}
+#if CLOCKWORK_DEBUG
+			if ( !m_img )
+				std::cout << "Failed to load Image(packed file): " << m_filepath << std::endl;
+#endif
+			m_width = FreeImage_GetWidth(m_img.get());
+			m_height = FreeImage_GetHeight(m_img.get());
+			m_pixelSize = FreeImage_GetBPP(m_img.get());
 			m_hasAlpha = m_pixelSize > 24;
 			return *this;
 		}
@@ -125,27 +164,78 @@ namespace clockwork {
 			if ( !m_img )
 				std::cout << "Failed to load Image(no image data): " << m_filepath << std::endl;
 #endif
-			FreeImage_Save(m_format, m_img, m_filepath.c_str());
+			FreeImage_Save(m_format, m_img.get(), m_filepath.c_str());
 			return *this;
 		}
 
 		Image Image::subImage(unsigned int x, unsigned int y, unsigned int width, unsigned int height) const noexcept
 		{
-			return Image { m_filepath + std::to_string(m_subImageCount++) }.setFormat(m_format).setData(FreeImage_Copy(m_img, x, y, x + width, y + height));
+			return Image { m_filepath + std::to_string(m_subImageCount++) }.setFormat(m_format).setData(FreeImage_Copy(m_img.get(), x, y, x + width, y + height));
 		}
 
-		unsigned char* const Image::getData() const noexcept
+		ImageView Image::getView() const noexcept
+		{
+			if ( !m_img )
+				return ImageView();
+			return ImageView(FreeImage_GetBits(m_img.get()), m_width, m_height, FreeImage_GetPitch(m_img.get()), m_pixelSize / 8);
+		}
+
+		ImageView Image::getView(unsigned int x, unsigned int y, unsigned int width, unsigned int height) const noexcept
+		{
+			return getView().subView(x, y, width, height);
+		}
+
+		Image& Image::resize(unsigned int width, unsigned int height) noexcept
+		{
+#if CLOCKWORK_DEBUG
+			if ( !m_img )
+				std::cout << "Error Image::resize(): the image has no data " << m_filepath << std::endl;
+#endif
+			return setData(FreeImage_Rescale(m_img.get(), width, height, FILTER_BOX));
+		}
+
+		Image& Image::convertTo(unsigned int pixelSize) noexcept
+		{
+			if ( !m_img )
+			{
+#if CLOCKWORK_DEBUG
+				std::cout << "Error Image::convertTo(): the image has no data " << m_filepath << std::endl;
+#endif
+				return *this;
+			}
+			return setData(pixelSize == 32 ? FreeImage_ConvertTo32Bits(m_img.get()) : FreeImage_ConvertTo24Bits(m_img.get()));
+		}
+
+		const unsigned char* Image::getData() const noexcept
 		{
 #if CLOCKWORK_DEBUG
 			if(m_img==nullptr )
 				std::cout << "Error Image::getData: the image has no data " << m_filepath << std::endl;
 #endif
-			return FreeImage_GetBits(m_img);
+			return FreeImage_GetBits(m_img.get());
+		}
+
+		unsigned char* const Image::getMutableData() noexcept
+		{
+			if ( m_img.use_count() > 1 )//copy on write
+				m_img = shareBitmap(FreeImage_Clone(m_img.get()));
+#if CLOCKWORK_DEBUG
+			if ( m_img == nullptr )
+				std::cout << "Error Image::getMutableData: the image has no data " << m_filepath << std::endl;
+#endif
+			return FreeImage_GetBits(m_img.get());
 		}
 
 		Image& Image::setData(FIBITMAP* const data) noexcept
 		{
-			m_img = data;
+			m_img = shareBitmap(data);
+			if ( m_img )
+			{
+				m_width = FreeImage_GetWidth(data);
+				m_height = FreeImage_GetHeight(data);
+				m_pixelSize = FreeImage_GetBPP(data);
+				m_hasAlpha = m_pixelSize > 24;
+			}
 			return *this;
 		}
 
@@ -188,11 +278,7 @@ namespace clockwork {
 
 		void Image::clearData() noexcept
 		{
-			if ( m_img )
-			{
-				FreeImage_Unload(m_img);//free FreeImages copy of the image data
-				m_img = nullptr;
-			}
+			m_img = nullptr;//the data is unloaded by the shared pointer, if no other image uses it
 		}
 
 		bool operator==(const Image& img1, const Image& img2) noexcept
@@ -13,16 +13,20 @@
 *************************************************************************/
 #include "Helper.h"
 #include "FreeImage\FreeImage.h"
+#include "src\Utils\ImageView.h"
 #include <string>
+#include <memory>
 
 namespace clockwork {
 	namespace utils {
 
+		struct PackEntry;
+
 		class Image
 		{
 
 		private:
-			FIBITMAP* m_img;//pointer to image bitmap
+			std::shared_ptr<FIBITMAP> m_img;//pointer to the image bitmap, which is shared by all copies of the image until one of them changes the data(copy on write)
 			FREE_IMAGE_FORMAT m_format;//image format(png,jpg,etc)
 			std::string m_filepath;//filepath to compare
 			mutable unsigned int m_subImageCount;//for subimage filepath
@@ -39,16 +43,21 @@ namespace clockwork {
 			for loading the imagedata of the image into the imageobject, YOU HAVE TO CALL the method load()*/
 			explicit Image(const std::string& filepath) noexcept;
 
-			/*copies the image data*/
+			/*creates an image object with a filepath and a size, but without image data and without fileformat | used to describe textures that are not loaded from an image file(for example cooked textures)
+			so they can still be compared by their filepath and sorted by their size and pixelsize
+			@param[pixelSize] the size of one pixel in bits | 24 = RGB and 32 = RGBA*/
+			Image(const std::string& filepath, unsigned int width, unsigned int height, unsigned int pixelSize) noexcept;
+
+			/*shares the image data of the other image without copying it | the data is only copied when one of the images changes it with getMutableData()*/
 			Image(const Image& other) noexcept;
 
 			/*moves the data of the other image object to this image object and removes the access to the data in the other image*/
 			Image(Image&& other) noexcept;
 
-			/*deletes the image data*/
+			/*deletes the image data, if no other image shares it*/
 			~Image() noexcept;
 
-			/*copies the image data*/
+			/*shares the image data of the other image without copying it and releases the old image data | the data is only copied when one of the images changes it with getMutableData()*/
 			Image& operator=(const Image& other) noexcept;
 
 			/*moves the data of the other image object to this image object and removes the access to the data in the other image*/
@@ -66,9 +75,16 @@ namespace clockwork {
 
 		public:
 			/*loads the image data of the image file with the given filepath into the image object
-			sets the fileformat to the format of the image file at the given path and will use it to load the data*/
+			sets the fileformat to the format of the image file at the given path and will use it to load the data
+			the image file is decoded directly from the resource packfile, if it contains the filepath(see PackFile)*/
 			Image& load() noexcept;
 
+		private:
+			/*decodes the image data from the memory of the entry in the resource packfile*/
+			Image& loadPacked(const PackEntry& entry) noexcept;
+
+		public:
+
 			/*saves the image data of the image object into the image file with the given filepath
 			there has to be image data in the image object, a filepath has to be specified and the image format has to be set(either by calling load, or setting it) */
 			Image& save() noexcept;
@@ -79,11 +95,32 @@ namespace clockwork {
 			you have to load the new image after calling this method with load(), otherwise it will not have any data*/
 			Image subImage(unsigned int x, unsigned int y, unsigned int width, unsigned int height) const noexcept;
 
-			/*returns the data of the image as an unsigned char pointer(==bytes) | array of pixel with size of width*height representing the colour values in either RGB/RGBA, or BGR/BGRA plattform dependant(BGR for little endian processor windows/linux and RGB for big endian processor linux/unix/mac)*/
-			unsigned char* const getData() const noexcept;
+			/*returns a view of all pixels of the image without copying them | the rows of the view have the pitch of freeimage(rows aligned to 4 bytes)
+			CAREFUL: the view is only valid as long as this image(or a copy sharing its data) keeps the data, so dont clear the data, or change it with getMutableData() while the view is used*/
+			ImageView getView() const noexcept;
+
+			/*returns a view of a rectangle of the image without copying the pixels like subImage() | x and y are the positions of the top left pixel of the rectangle from the top left of the image
+			use this instead of subImage() to read tiles of a spritesheet, because no bitmap is allocated per tile | CAREFUL: the view is only valid as long as the image data lives like getView()*/
+			ImageView getView(unsigned int x, unsigned int y, unsigned int width, unsigned int height) const noexcept;
+
+			/*scales the image data to the width and height with the box filter of freeimage | the scaled data is a new bitmap, so copies sharing the old data dont change*/
+			Image& resize(unsigned int width, unsigned int height) noexcept;
+
+			/*converts the image data with freeimage to 24 bits(RGB), or 32 bits(RGBA) per pixel, so images with a palette, greyscale images and images with 16 bits per pixel can be read by the pixel kernels(see PixelConversion.h)
+			the transparency of a palette becomes the alpha channel with 32 bits | the converted data is a new bitmap like resize() and the image has no data, if freeimage can not convert it*/
+			Image& convertTo(unsigned int pixelSize) noexcept;
+
+			/*returns the data of the image as an unsigned char pointer(==bytes) | array of pixel with size of width*height representing the colour values in either RGB/RGBA, or BGR/BGRA plattform dependant(BGR for little endian processor windows/linux and RGB for big endian processor linux/unix/mac)
+			the data can be shared with copies of the image, so it can only be read | use getMutableData() to change the pixels*/
+			const unsigned char* getData() const noexcept;
+
+			/*returns the data of the image like getData(), but copies the data first if it is shared with other images, so the pixels can be changed without changing the copies
+			CAREFUL: dont copy the image on another thread while calling this method*/
+			unsigned char* const getMutableData() noexcept;
 
 			/*changes the image data of the imageobject to another bitmap | array of pixel with size of width*height representing the colour values in either RGB/RGBA, or BGR/BGRA plattform dependant(BGR for little endian processor windows/linux and RGB for big endian processor linux/unix/mac)
-			the image data pointer will point to the same data as the data pointer*/
+			the image data pointer will point to the same data as the data pointer and the image object takes the ownership of the data(it will be unloaded, when no image uses it anymore)
+			the width, height and pixelsize of the image are changed to the size of the bitmap*/
 			Image& setData(FIBITMAP* const data) noexcept;
 
 			/*returns the width of the image in pixel(count of pixels) | positions: pixel 0 to getWidth()-1 */
@@ -106,6 +143,12 @@ namespace clockwork {
 			friend bool operator==(const Image& img1, const Image& img2) noexcept;
 
 		public:
+			/*returns true if the image has image data*/
+			const bool hasData() const noexcept {return m_img != nullptr;}
+
+			/*returns true if the image data is shared with other copies of the image*/
+			const bool isShared() const noexcept {return m_img.use_count() > 1;}
+
 		    /*returns the filepath of the image object relative to the engine.exe*/
 			const std::string& getFilepath() const noexcept{return m_filepath;}
 
@@ -158,7 +201,8 @@ namespace clockwork {
 	FIF_JXR		= 36*/
 			Image& setFormat(int format) noexcept;
 
-			/*clears the image data, so you have more free space | you can not use the image data anymore, but you can still use the size/filepath for textures */
+			/*clears the image data, so you have more free space | you can not use the image data anymore, but you can still use the size/filepath for textures 
+			the data is only deleted, if no other image shares it*/
 			void clearData() noexcept;
 
 		};
@@ -0,0 +1,76 @@
+#pragma once
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include <iostream>
+
+namespace clockwork {
+	namespace utils {
+
+		/*a non-owning view of a rectangle of pixels inside an image(or any other pixel memory) | views are cheap to copy, because they only store a pointer to the first pixel, the size and the pitch
+		the rows are stored like in freeimage from the bottom row to the top row and each row starts pitch bytes after the previous row | the rectangle coordinates start at the top left like Image::subImage
+		CAREFUL: the view does not keep the pixels alive, so the image has to live longer than the view and its data must not be changed or cleared while the view is used*/
+		class ImageView
+		{
+
+		private:
+			const unsigned char* m_data;//the first byte of the bottom row
+			unsigned int m_width;
+			unsigned int m_height;
+			unsigned int m_pitch;//the bytes from one row to the next row
+			unsigned int m_bytesPerPixel;
+
+		public:
+			/*creates an empty view without pixels*/
+			ImageView() noexcept
+				: m_data(nullptr), m_width(0), m_height(0), m_pitch(0), m_bytesPerPixel(0)
+			{}
+
+			/*creates a view of pixel memory
+			@param[data] the first byte of the bottom row
+			@param[pitch] the bytes from one row to the next row | for freeimage data that is the rowsize aligned to 4 bytes
+			@param[bytesPerPixel] 3 = RGB and 4 = RGBA*/
+			ImageView(const unsigned char* data, unsigned int width, unsigned int height, unsigned int pitch, unsigned int bytesPerPixel) noexcept
+				: m_data(data), m_width(width), m_height(height), m_pitch(pitch), m_bytesPerPixel(bytesPerPixel)
+			{}
+
+		public:
+			/*returns a view of a rectangle inside this view without copying the pixels | x and y are the positions of the top left pixel of the rectangle from the top left of this view like Image::subImage*/
+			ImageView subView(unsigned int x, unsigned int y, unsigned int width, unsigned int height) const noexcept
+			{
+#if CLOCKWORK_DEBUG
+				if ( x + width > m_width || y + height > m_height )
+					std::cout << "Error ImageView::subView(): the rectangle is outside of the view" << std::endl;
+#endif
+				return ImageView(m_data + ( m_height - y - height ) * m_pitch + x * m_bytesPerPixel, width, height, m_pitch, m_bytesPerPixel);
+			}
+
+			/*returns the first pixel of the row | the row 0 is the bottom row like in freeimage and opengl*/
+			const unsigned char* getRow(unsigned int row) const noexcept {return m_data + row * m_pitch;}
+
+		public:
+			const unsigned char* getData() const noexcept {return m_data;}
+			const unsigned int getWidth() const noexcept {return m_width;}
+			const unsigned int getHeight() const noexcept {return m_height;}
+			const unsigned int getPitch() const noexcept {return m_pitch;}
+			const unsigned int getBytesPerPixel() const noexcept {return m_bytesPerPixel;}
+			/*returns the size of one pixel in bits like Image::getPixelSize()*/
+			const unsigned int getPixelSize() const noexcept {return m_bytesPerPixel * 8;}
+			const bool hasAlpha() const noexcept {return m_bytesPerPixel == 4;}
+			const bool hasData() const noexcept {return m_data != nullptr;}
+			/*returns true if the rows follow each other without padding, so the pixels can be copied at once*/
+			const bool isPacked() const noexcept {return m_pitch == m_width * m_bytesPerPixel;}
+
+		};
+
+	}
+}
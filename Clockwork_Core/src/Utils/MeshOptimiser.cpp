@@ -0,0 +1,644 @@
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "MeshOptimiser.h"
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+namespace clockwork {
+	namespace utils {
+
+		namespace {
+
+			const unsigned int noVertex = ~0u;
+			const float maxNormalRotation = 0.25f;//the cosine of the biggest rotation of a triangle normal by an edge collapse(about 75 degrees)
+
+			/*a cluster of triangles for the overdraw order | sorted by the distance of its center from the center of the mesh along its normal*/
+			struct Cluster
+			{
+				unsigned int start;
+				unsigned int end;
+				float sortKey;
+			};
+
+			/*returns the next vertex to fan around like in tipsify: the vertex with live triangles that was put into the cache the longest ago and still stays in the cache while fanning around it
+			or the last vertex of the dead end stack with live triangles, or the next vertex with live triangles after the cursor, or -1 if all triangles are emitted*/
+			int getNextVertex(const std::vector<unsigned int>& candidates, const std::vector<unsigned int>& cacheTime, const std::vector<unsigned int>& liveCount, std::vector<unsigned int>& deadEnd,
+				unsigned int& cursor, unsigned int time, unsigned int cacheSize) noexcept
+			{
+				int next = -1;
+				int best = -1;
+				for ( auto vertex : candidates )
+				{
+					if ( liveCount.at(vertex) > 0 )
+					{
+						int priority = 0;
+						if ( time - cacheTime.at(vertex) + 2 * liveCount.at(vertex) <= cacheSize )
+							priority = time - cacheTime.at(vertex);
+						if ( priority > best )
+						{
+							best = priority;
+							next = vertex;
+						}
+					}
+				}
+				if ( next != -1 )
+					return next;
+				while ( !deadEnd.empty() )
+				{
+					unsigned int vertex = deadEnd.back();
+					deadEnd.pop_back();
+					if ( liveCount.at(vertex) > 0 )
+						return vertex;
+				}
+				for ( ; cursor < liveCount.size(); ++cursor )
+				{
+					if ( liveCount.at(cursor) > 0 )
+						return cursor;
+				}
+				return -1;
+			}
+
+			/*simulates the fifo vertex cache for the indices of the part and adds its triangles, used vertices and cache misses to the statistics*/
+			void addCacheMisses(const MeshPart& part, unsigned int cacheSize, VertexCacheStatistics& statistics) noexcept
+			{
+				std::vector<unsigned int> cacheTime(part.vertices.size(), 0);
+				std::vector<bool> used(part.vertices.size(), false);
+				unsigned int time = cacheSize + 1;
+				for ( auto vertex : part.indices )
+				{
+					if ( !used.at(vertex) )
+					{
+						used.at(vertex) = true;
+						++statistics.vertexCount;
+					}
+					if ( time - cacheTime.at(vertex) > cacheSize )
+					{
+						cacheTime.at(vertex) = time++;
+						++statistics.cacheMisses;
+					}
+				}
+				statistics.triangleCount += part.indices.size() / 3;
+			}
+
+			inline void subtract(const float* left, const float* right, float* result) noexcept
+			{
+				for ( unsigned int i = 0; i < 3; ++i )
+					result[i] = left[i] - right[i];
+			}
+
+			inline void cross(const float* left, const float* right, float* result) noexcept
+			{
+				result[0] = left[1] * right[2] - left[2] * right[1];
+				result[1] = left[2] * right[0] - left[0] * right[2];
+				result[2] = left[0] * right[1] - left[1] * right[0];
+			}
+
+			/*returns the not normalized normal of the triangle | its length is twice the area of the triangle*/
+			inline void getTriangleNormal(const float* p0, const float* p1, const float* p2, float* normal) noexcept
+			{
+				float edge1[3], edge2[3];
+				subtract(p1, p0, edge1);
+				subtract(p2, p0, edge2);
+				cross(edge1, edge2, normal);
+			}
+
+			/*the error quadric of a vertex: the sum of the squared distances to the planes of its triangles weighted by their area
+			the symmetric 4x4 matrix is stored as its upper half(a00, a01, a02, a03, a11, a12, a13, a22, a23, a33) and weight is the sum of the areas*/
+			struct Quadric
+			{
+				double a[10];
+				double weight;
+			};
+
+			/*adds the plane with the normalized normal and the distance from the origin(n * p + d = 0) to the quadric*/
+			void addPlane(Quadric& quadric, const double* normal, double distance, double weight) noexcept
+			{
+				double plane[4] = { normal[0], normal[1], normal[2], distance };
+				unsigned int element = 0;
+				for ( unsigned int i = 0; i < 4; ++i )
+				{
+					for ( unsigned int j = i; j < 4; ++j )
+						quadric.a[element++] += plane[i] * plane[j] * weight;
+				}
+				quadric.weight += weight;
+			}
+
+			inline void addQuadric(Quadric& quadric, const Quadric& other) noexcept
+			{
+				for ( unsigned int i = 0; i < 10; ++i )
+					quadric.a[i] += other.a[i];
+				quadric.weight += other.weight;
+			}
+
+			/*returns the mean squared distance of the position to the planes of both quadrics*/
+			double getQuadricError(const Quadric& left, const Quadric& right, const float* position) noexcept
+			{
+				double a[10];
+				for ( unsigned int i = 0; i < 10; ++i )
+					a[i] = left.a[i] + right.a[i];
+				double weight = left.weight + right.weight;
+				double x = position[0];
+				double y = position[1];
+				double z = position[2];
+				double error = a[0] * x * x + 2 * a[1] * x * y + 2 * a[2] * x * z + 2 * a[3] * x + a[4] * y * y + 2 * a[5] * y * z + 2 * a[6] * y + a[7] * z * z + 2 * a[8] * z + a[9];
+				return weight > 0 && error > 0 ? error / weight : 0;
+			}
+
+			/*an edge collapse that moves the vertex from onto the vertex to*/
+			struct Collapse
+			{
+				unsigned int from;
+				unsigned int to;
+				double error;
+			};
+
+			/*returns the id of the position of each vertex, so vertices with the same position(on seams) have the same id | positionCount is set to the count of different positions*/
+			std::vector<unsigned int> getPositionIds(const std::vector<MeshVertex>& vertices, unsigned int& positionCount) noexcept
+			{
+				std::vector<unsigned int> order(vertices.size());
+				for ( unsigned int i = 0; i < order.size(); ++i )
+					order.at(i) = i;
+				auto less = [&vertices](unsigned int left, unsigned int right) {return std::lexicographical_compare(vertices.at(left).position, vertices.at(left).position + 3, vertices.at(right).position, vertices.at(right).position + 3);};
+				std::sort(order.begin(), order.end(), less);
+				std::vector<unsigned int> positionIds(vertices.size(), 0);
+				positionCount = 0;
+				for ( unsigned int i = 0; i < order.size(); ++i )
+				{
+					if ( i > 0 && less(order.at(i - 1), order.at(i)) )
+						++positionCount;
+					positionIds.at(order.at(i)) = positionCount;
+				}
+				if ( !order.empty() )
+					++positionCount;
+				return positionIds;
+			}
+
+			/*returns the triangles of each position: the triangles of position p are at adjacency[offsets[p]] to adjacency[offsets[p+1]]*/
+			void getPositionAdjacency(const std::vector<unsigned int>& indices, const std::vector<unsigned int>& positionIds, unsigned int positionCount, std::vector<unsigned int>& offsets, std::vector<unsigned int>& adjacency) noexcept
+			{
+				offsets.assign(positionCount + 1, 0);
+				for ( auto vertex : indices )
+					++offsets.at(positionIds.at(vertex) + 1);
+				for ( unsigned int i = 0; i < positionCount; ++i )
+					offsets.at(i + 1) += offsets.at(i);
+				adjacency.resize(indices.size());
+				std::vector<unsigned int> fill(offsets.begin(), offsets.end() - 1);
+				for ( unsigned int i = 0; i < indices.size(); ++i )
+					adjacency.at(fill.at(positionIds.at(indices.at(i)))++) = i / 3;
+			}
+
+			/*returns true if the triangles around the position of the vertex from dont flip when it is moved onto the vertex to and counts the triangles that are removed by the collapse
+			the collapse is also invalid if both positions share more neighbours than the removed triangles, because then the mesh would not be a manifold anymore*/
+			bool isCollapseValid(const MeshPart& part, const std::vector<unsigned int>& indices, const std::vector<unsigned int>& positionIds, const std::vector<unsigned int>& offsets, const std::vector<unsigned int>& adjacency,
+				const Collapse& collapse, std::vector<unsigned int>& neighbours, unsigned int& removedTriangles) noexcept
+			{
+				unsigned int from = positionIds.at(collapse.from);
+				unsigned int to = positionIds.at(collapse.to);
+				const float* target = part.vertices.at(collapse.to).position;
+				removedTriangles = 0;
+				neighbours.clear();
+				for ( unsigned int i = offsets.at(from); i < offsets.at(from + 1); ++i )
+				{
+					const unsigned int* triangle = &indices.at(adjacency.at(i) * 3);
+					const float* positions[3];
+					const float* moved[3];
+					bool removed = false;
+					for ( unsigned int j = 0; j < 3; ++j )
+					{
+						unsigned int position = positionIds.at(triangle[j]);
+						positions[j] = part.vertices.at(triangle[j]).position;
+						moved[j] = position == from ? target : positions[j];
+						removed = removed || position == to;
+						if ( position != from && position != to )
+							neighbours.push_back(position);
+					}
+					if ( removed )
+					{
+						++removedTriangles;
+						continue;
+					}
+					float before[3], after[3];
+					getTriangleNormal(positions[0], positions[1], positions[2], before);
+					getTriangleNormal(moved[0], moved[1], moved[2], after);
+					float dot = before[0] * after[0] + before[1] * after[1] + before[2] * after[2];
+					float lengths = std::sqrt(( before[0] * before[0] + before[1] * before[1] + before[2] * before[2] ) * ( after[0] * after[0] + after[1] * after[1] + after[2] * after[2] ));
+					if ( dot <= maxNormalRotation * lengths )//the triangle flips, or rotates too much
+						return false;
+				}
+				if ( removedTriangles == 0 )
+					return false;
+				std::sort(neighbours.begin(), neighbours.end());
+				neighbours.erase(std::unique(neighbours.begin(), neighbours.end()), neighbours.end());
+				unsigned int sharedStart = neighbours.size();
+				for ( unsigned int i = offsets.at(to); i < offsets.at(to + 1); ++i )
+				{
+					const unsigned int* triangle = &indices.at(adjacency.at(i) * 3);
+					for ( unsigned int j = 0; j < 3; ++j )
+					{
+						unsigned int position = positionIds.at(triangle[j]);
+						if ( position != from && position != to && std::binary_search(neighbours.begin(), neighbours.begin() + sharedStart, position) )
+							neighbours.push_back(position);
+					}
+				}
+				std::sort(neighbours.begin() + sharedStart, neighbours.end());
+				unsigned int shared = std::unique(neighbours.begin() + sharedStart, neighbours.end()) - ( neighbours.begin() + sharedStart );
+				return shared <= removedTriangles;
+			}
+
+		}
+
+		VertexCacheStatistics analyseVertexCache(const std::vector<MeshPart>& parts, unsigned int cacheSize) noexcept
+		{
+			VertexCacheStatistics statistics { 0, 0, 0 };
+			for ( const auto& part : parts )
+				addCacheMisses(part, cacheSize, statistics);
+			return statistics;
+		}
+
+		std::vector<unsigned int> optimiseVertexCache(MeshPart& part, unsigned int cacheSize) noexcept
+		{
+			return optimiseVertexCache(part.indices, part.vertices.size(), cacheSize);
+		}
+
+		std::vector<unsigned int> optimiseVertexCache(std::vector<unsigned int>& indices, unsigned int vertexCount, unsigned int cacheSize) noexcept
+		{
+			std::vector<unsigned int> clusters;
+			unsigned int triangleCount = indices.size() / 3;
+			if ( triangleCount == 0 )
+				return clusters;
+
+			std::vector<unsigned int> liveCount(vertexCount, 0);//the triangles of each vertex that are not emitted yet
+			for ( unsigned int i = 0; i < triangleCount * 3; ++i )
+				++liveCount.at(indices.at(i));
+			std::vector<unsigned int> adjacencyOffsets(vertexCount + 1, 0);//the triangles of vertex v are at adjacency[offset[v]] to adjacency[offset[v+1]]
+			for ( unsigned int i = 0; i < vertexCount; ++i )
+				adjacencyOffsets.at(i + 1) = adjacencyOffsets.at(i) + liveCount.at(i);
+			std::vector<unsigned int> adjacency(triangleCount * 3);
+			std::vector<unsigned int> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+			for ( unsigned int i = 0; i < triangleCount * 3; ++i )
+				adjacency.at(fill.at(indices.at(i))++) = i / 3;
+
+			std::vector<unsigned int> cacheTime(vertexCount, 0);
+			std::vector<bool> emitted(triangleCount, false);
+			std::vector<unsigned int> deadEnd;
+			std::vector<unsigned int> candidates;
+			std::vector<unsigned int> output;
+			deadEnd.reserve(triangleCount * 3);
+			output.reserve(triangleCount * 3);
+			unsigned int time = cacheSize + 1;
+			unsigned int cursor = 0;
+			int fanning = indices.at(0);
+			clusters.push_back(0);
+			while ( fanning >= 0 )
+			{
+				candidates.clear();
+				for ( unsigned int i = adjacencyOffsets.at(fanning); i < adjacencyOffsets.at(fanning + 1); ++i )
+				{
+					unsigned int triangle = adjacency.at(i);
+					if ( emitted.at(triangle) )
+						continue;
+					for ( unsigned int j = 0; j < 3; ++j )
+					{
+						unsigned int vertex = indices.at(triangle * 3 + j);
+						output.push_back(vertex);
+						deadEnd.push_back(vertex);
+						candidates.push_back(vertex);
+						--liveCount.at(vertex);
+						if ( time - cacheTime.at(vertex) > cacheSize )
+							cacheTime.at(vertex) = time++;
+					}
+					emitted.at(triangle) = true;
+				}
+				fanning = getNextVertex(candidates, cacheTime, liveCount, deadEnd, cursor, time, cacheSize);
+				if ( fanning >= 0 && time - cacheTime.at(fanning) > cacheSize && output.size() / 3 != clusters.back() )//the next vertex is no longer in the cache, so a new cluster starts
+					clusters.push_back(output.size() / 3);
+			}
+			indices = std::move(output);
+			return clusters;
+		}
+
+		void optimiseOverdraw(MeshPart& part, const std::vector<unsigned int>& clusters, unsigned int cacheSize, float threshold) noexcept
+		{
+			std::vector<unsigned int>& indices = part.indices;
+			unsigned int triangleCount = indices.size() / 3;
+			if ( triangleCount == 0 || clusters.empty() )
+				return;
+
+			//split the hard clusters at the triangles where their local acmr is low enough
+			VertexCacheStatistics statistics { 0, 0, 0 };
+			addCacheMisses(part, cacheSize, statistics);
+			float partACMR = statistics.getACMR();
+			std::vector<Cluster> softClusters;
+			std::vector<unsigned int> cacheTime(part.vertices.size(), 0);
+			unsigned int time = cacheSize + 1;
+			for ( unsigned int i = 0; i < clusters.size(); ++i )
+			{
+				unsigned int end = i + 1 < clusters.size() ? clusters.at(i + 1) : triangleCount;
+				unsigned int start = clusters.at(i);
+				unsigned int misses = 0;
+				time += cacheSize + 1;//flushes the cache
+				for ( unsigned int triangle = start; triangle < end; ++triangle )
+				{
+					for ( unsigned int j = 0; j < 3; ++j )
+					{
+						unsigned int vertex = indices.at(triangle * 3 + j);
+						if ( time - cacheTime.at(vertex) > cacheSize )
+						{
+							cacheTime.at(vertex) = time++;
+							++misses;
+						}
+					}
+					if ( triangle + 1 < end && misses <= threshold * partACMR * ( triangle + 1 - start ) )
+					{
+						softClusters.push_back(Cluster { start, triangle + 1, 0.0f });
+						start = triangle + 1;
+						misses = 0;
+						time += cacheSize + 1;
+					}
+				}
+				softClusters.push_back(Cluster { start, end, 0.0f });
+			}
+
+			//the area weighted center and normal of each cluster and of the whole mesh
+			std::vector<float> centers(softClusters.size() * 3, 0.0f);
+			std::vector<float> normals(softClusters.size() * 3, 0.0f);
+			float meshCenter[3] = { 0.0f, 0.0f, 0.0f };
+			float meshArea = 0.0f;
+			for ( unsigned int i = 0; i < softClusters.size(); ++i )
+			{
+				float clusterArea = 0.0f;
+				for ( unsigned int triangle = softClusters.at(i).start; triangle < softClusters.at(i).end; ++triangle )
+				{
+					const float* p0 = part.vertices.at(indices.at(triangle * 3)).position;
+					const float* p1 = part.vertices.at(indices.at(triangle * 3 + 1)).position;
+					const float* p2 = part.vertices.at(indices.at(triangle * 3 + 2)).position;
+					float edge1[3], edge2[3], normal[3];
+					subtract(p1, p0, edge1);
+					subtract(p2, p0, edge2);
+					cross(edge1, edge2, normal);
+					float area = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+					for ( unsigned int j = 0; j < 3; ++j )
+					{
+						float center = ( p0[j] + p1[j] + p2[j] ) / 3.0f;
+						centers.at(i * 3 + j) += center * area;
+						normals.at(i * 3 + j) += normal[j];
+						meshCenter[j] += center * area;
+					}
+					clusterArea += area;
+				}
+				for ( unsigned int j = 0; j < 3 && clusterArea > 0.0f; ++j )
+					centers.at(i * 3 + j) /= clusterArea;
+				meshArea += clusterArea;
+			}
+			if ( meshArea <= 0.0f )
+				return;
+			for ( unsigned int j = 0; j < 3; ++j )
+				meshCenter[j] /= meshArea;
+			for ( unsigned int i = 0; i < softClusters.size(); ++i )
+			{
+				const float* normal = &normals.at(i * 3);
+				float length = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+				float direction[3];
+				subtract(&centers.at(i * 3), meshCenter, direction);
+				softClusters.at(i).sortKey = length > 0.0f ? ( direction[0] * normal[0] + direction[1] * normal[1] + direction[2] * normal[2] ) / length : 0.0f;
+			}
+			std::stable_sort(softClusters.begin(), softClusters.end(), [](const Cluster& left, const Cluster& right) {return left.sortKey > right.sortKey;});
+
+			std::vector<unsigned int> output;
+			output.reserve(indices.size());
+			for ( const auto& cluster : softClusters )
+				output.insert(output.end(), indices.begin() + cluster.start * 3, indices.begin() + cluster.end * 3);
+			indices = std::move(output);
+		}
+
+		void optimiseVertexFetch(MeshPart& part) noexcept
+		{
+			std::vector<unsigned int> remap(part.vertices.size(), noVertex);
+			std::vector<MeshVertex> vertices;
+			vertices.reserve(part.vertices.size());
+			for ( auto& index : part.indices )
+			{
+				if ( remap.at(index) == noVertex )
+				{
+					remap.at(index) = vertices.size();
+					vertices.push_back(part.vertices.at(index));
+				}
+				index = remap.at(index);
+			}
+			for ( auto& lod : part.lods )
+			{
+				for ( auto& index : lod.indices )
+				{
+					if ( remap.at(index) == noVertex )//the lods only use vertices of the full detail indices, but they could have been added by hand
+					{
+						remap.at(index) = vertices.size();
+						vertices.push_back(part.vertices.at(index));
+					}
+					index = remap.at(index);
+				}
+			}
+			part.vertices = std::move(vertices);
+		}
+
+		std::vector<MeshPart> splitMeshPart(const MeshPart& part, unsigned int maxVertices) noexcept
+		{
+			std::vector<MeshPart> parts;
+			std::vector<unsigned int> remap(part.vertices.size(), noVertex);
+			std::vector<unsigned int> used;//the vertices of the original part in the current part, so remap can be reset
+			MeshPart current;
+			current.material = part.material;
+			for ( unsigned int triangle = 0; triangle < part.indices.size() / 3; ++triangle )
+			{
+				const unsigned int* vertices = &part.indices.at(triangle * 3);
+				unsigned int newVertices = ( remap.at(vertices[0]) == noVertex ) + ( remap.at(vertices[1]) == noVertex && vertices[1] != vertices[0] )
+					+ ( remap.at(vertices[2]) == noVertex && vertices[2] != vertices[0] && vertices[2] != vertices[1] );
+				if ( current.vertices.size() + newVertices > maxVertices )
+				{
+					parts.push_back(std::move(current));
+					current = MeshPart();
+					current.material = part.material;
+					for ( auto vertex : used )
+						remap.at(vertex) = noVertex;
+					used.clear();
+				}
+				for ( unsigned int j = 0; j < 3; ++j )
+				{
+					if ( remap.at(vertices[j]) == noVertex )
+					{
+						remap.at(vertices[j]) = current.vertices.size();
+						current.vertices.push_back(part.vertices.at(vertices[j]));
+						used.push_back(vertices[j]);
+					}
+					current.indices.push_back(remap.at(vertices[j]));
+				}
+			}
+			if ( !current.indices.empty() )
+				parts.push_back(std::move(current));
+			return parts;
+		}
+
+		std::vector<unsigned int> simplifyMesh(const MeshPart& part, const std::vector<unsigned int>& indices, unsigned int targetIndexCount, float& error) noexcept
+		{
+			error = 0.0f;
+			std::vector<unsigned int> simplified(indices.begin(), indices.end() - indices.size() % 3);
+			unsigned int vertexCount = part.vertices.size();
+			unsigned int positionCount = 0;
+			std::vector<unsigned int> positionIds = getPositionIds(part.vertices, positionCount);
+
+			//seams have more than one vertex per position and open borders have edges without the opposite edge(of the neighbour triangle), so they are locked
+			std::vector<unsigned int> verticesPerPosition(positionCount, 0);
+			std::vector<bool> locked(positionCount, false);
+			for ( unsigned int i = 0; i < vertexCount; ++i )
+			{
+				if ( ++verticesPerPosition.at(positionIds.at(i)) > 1 )
+					locked.at(positionIds.at(i)) = true;
+			}
+			std::unordered_map<unsigned long long, unsigned int> edges;
+			auto getEdge = [&positionIds](unsigned int from, unsigned int to) {return static_cast<unsigned long long>( positionIds.at(from) ) << 32 | positionIds.at(to);};
+			for ( unsigned int i = 0; i < simplified.size(); ++i )
+				++edges[getEdge(simplified.at(i), simplified.at(i - i % 3 + ( i + 1 ) % 3))];
+			for ( unsigned int i = 0; i < simplified.size(); ++i )
+			{
+				unsigned int from = simplified.at(i);
+				unsigned int to = simplified.at(i - i % 3 + ( i + 1 ) % 3);
+				auto opposite = edges.find(getEdge(to, from));
+				if ( opposite == edges.end() || opposite->second != 1 || edges.at(getEdge(from, to)) != 1 )
+				{
+					locked.at(positionIds.at(from)) = true;
+					locked.at(positionIds.at(to)) = true;
+				}
+			}
+
+			std::vector<Quadric> quadrics(vertexCount, Quadric { { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, 0 });
+			for ( unsigned int triangle = 0; triangle < simplified.size() / 3; ++triangle )
+			{
+				const float* p0 = part.vertices.at(simplified.at(triangle * 3)).position;
+				float normal[3];
+				getTriangleNormal(p0, part.vertices.at(simplified.at(triangle * 3 + 1)).position, part.vertices.at(simplified.at(triangle * 3 + 2)).position, normal);
+				double length = std::sqrt(static_cast<double>( normal[0] ) * normal[0] + static_cast<double>( normal[1] ) * normal[1] + static_cast<double>( normal[2] ) * normal[2]);
+				if ( length <= 0 )
+					continue;
+				double plane[3] = { normal[0] / length, normal[1] / length, normal[2] / length };
+				double distance = -( plane[0] * p0[0] + plane[1] * p0[1] + plane[2] * p0[2] );
+				for ( unsigned int j = 0; j < 3; ++j )
+					addPlane(quadrics.at(simplified.at(triangle * 3 + j)), plane, distance, length * 0.5);
+			}
+
+			//each pass collapses the cheapest edges, but only one collapse per neighbourhood, because the triangles around a collapse change
+			double maxError = 0;
+			std::vector<unsigned int> remap(vertexCount);
+			std::vector<unsigned int> offsets, adjacency, neighbours;
+			std::vector<Collapse> collapses;
+			std::vector<bool> touched;
+			while ( simplified.size() > targetIndexCount )
+			{
+				for ( unsigned int i = 0; i < vertexCount; ++i )
+					remap.at(i) = i;
+				getPositionAdjacency(simplified, positionIds, positionCount, offsets, adjacency);
+				collapses.clear();
+				for ( unsigned int i = 0; i < simplified.size(); ++i )
+				{
+					unsigned int from = simplified.at(i);
+					unsigned int to = simplified.at(i - i % 3 + ( i + 1 ) % 3);
+					if ( !locked.at(positionIds.at(from)) )
+						collapses.push_back(Collapse { from, to, getQuadricError(quadrics.at(from), quadrics.at(to), part.vertices.at(to).position) });
+					if ( !locked.at(positionIds.at(to)) )
+						collapses.push_back(Collapse { to, from, getQuadricError(quadrics.at(to), quadrics.at(from), part.vertices.at(from).position) });
+				}
+				std::sort(collapses.begin(), collapses.end(), [](const Collapse& left, const Collapse& right) {return left.error < right.error;});
+				touched.assign(positionCount, false);
+				unsigned int triangleCount = simplified.size() / 3;
+				unsigned int collapsed = 0;
+				for ( const auto& collapse : collapses )
+				{
+					if ( triangleCount * 3 <= targetIndexCount )
+						break;
+					unsigned int from = positionIds.at(collapse.from);
+					unsigned int to = positionIds.at(collapse.to);
+					unsigned int removedTriangles = 0;
+					if ( touched.at(from) || touched.at(to) || !isCollapseValid(part, simplified, positionIds, offsets, adjacency, collapse, neighbours, removedTriangles) )
+						continue;
+					remap.at(collapse.from) = collapse.to;
+					addQuadric(quadrics.at(collapse.to), quadrics.at(collapse.from));
+					maxError = collapse.error > maxError ? collapse.error : maxError;
+					triangleCount -= removedTriangles;
+					++collapsed;
+					for ( unsigned int i = offsets.at(from); i < offsets.at(from + 1); ++i )
+					{
+						for ( unsigned int j = 0; j < 3; ++j )
+							touched.at(positionIds.at(simplified.at(adjacency.at(i) * 3 + j))) = true;
+					}
+				}
+				if ( collapsed == 0 )
+					break;
+				unsigned int size = 0;
+				for ( unsigned int triangle = 0; triangle < simplified.size() / 3; ++triangle )
+				{
+					unsigned int v0 = remap.at(simplified.at(triangle * 3));
+					unsigned int v1 = remap.at(simplified.at(triangle * 3 + 1));
+					unsigned int v2 = remap.at(simplified.at(triangle * 3 + 2));
+					if ( positionIds.at(v0) == positionIds.at(v1) || positionIds.at(v1) == positionIds.at(v2) || positionIds.at(v0) == positionIds.at(v2) )
+						continue;
+					simplified.at(size++) = v0;
+					simplified.at(size++) = v1;
+					simplified.at(size++) = v2;
+				}
+				simplified.resize(size);
+			}
+			error = static_cast<float>( std::sqrt(maxError) );
+			return simplified;
+		}
+
+		void generateLods(MeshPart& part, unsigned int maxLevels, float reduction) noexcept
+		{
+			const unsigned int minTriangles = 8;
+			const float minReduction = 0.85f;//a level needs at least 15% less triangles than the previous level
+			part.lods.clear();
+			unsigned int previousCount = part.indices.size();
+			float target = static_cast<float>( part.indices.size() / 3 );
+			for ( unsigned int level = 1; level < maxLevels; ++level )
+			{
+				target *= reduction;
+				if ( target < minTriangles )
+					break;
+				float error = 0.0f;
+				std::vector<unsigned int> indices = simplifyMesh(part, part.indices, static_cast<unsigned int>( target ) * 3, error);
+				if ( indices.size() > previousCount * minReduction )
+					break;
+				previousCount = indices.size();
+				part.lods.push_back(MeshLod { std::move(indices), error });
+			}
+		}
+
+		void optimiseMesh(std::vector<MeshPart>& parts, unsigned int cacheSize, unsigned int lodLevels) noexcept
+		{
+			std::vector<MeshPart> optimised;
+			for ( auto& part : parts )
+			{
+				std::vector<unsigned int> clusters = optimiseVertexCache(part, cacheSize);
+				optimiseOverdraw(part, clusters, cacheSize);
+				std::vector<MeshPart> split = splitMeshPart(part);
+				for ( auto& splitPart : split )
+				{
+					generateLods(splitPart, lodLevels);
+					for ( auto& lod : splitPart.lods )
+						optimiseVertexCache(lod.indices, splitPart.vertices.size(), cacheSize);
+					optimised.push_back(std::move(splitPart));
+				}
+			}
+			parts = std::move(optimised);
+		}
+
+	}
+}
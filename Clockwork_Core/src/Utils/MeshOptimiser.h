@@ -0,0 +1,76 @@
+#pragma once
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "CookedMesh.h"
+#include <vector>
+
+namespace clockwork {
+	namespace utils {
+
+		/*the simulated post transform vertex cache misses of the indices of meshparts | each part is drawn with its own drawcall, so the cache is flushed for each part
+		acmr(average cache miss ratio) is the count of transformed vertices per triangle: 3 is the worst and about 0.5 - 0.7 is the best for normal meshes
+		atvr(average transformed vertex ratio) is the count of transformed vertices per used vertex: 1 is the best, because each vertex is only transformed once*/
+		struct VertexCacheStatistics
+		{
+			unsigned int triangleCount;
+			unsigned int vertexCount;//the vertices that are used by the indices
+			unsigned int cacheMisses;
+
+			float getACMR() const noexcept {return triangleCount == 0 ? 0.0f : static_cast<float>( cacheMisses ) / triangleCount;}
+
+			float getATVR() const noexcept {return vertexCount == 0 ? 0.0f : static_cast<float>( cacheMisses ) / vertexCount;}
+		};
+
+		/*the size of the fifo vertex cache that is simulated by the optimisations | 16 entries is a safe guess for most gpus, because a bigger cache still works well with the order for a smaller cache*/
+		constexpr unsigned int vertexCacheSize = 16;
+
+		/*simulates a fifo vertex cache with cacheSize entries for the indices of all parts and counts the cache misses*/
+		VertexCacheStatistics analyseVertexCache(const std::vector<MeshPart>& parts, unsigned int cacheSize = vertexCacheSize) noexcept;
+
+		/*reorders the triangles of the part for the vertex cache with tipsify(Sander, Nehab and Barczak 2007), which fans around the vertex that stays the longest in the cache and runs in linear time
+		returns the starts of the clusters(triangle positions in the new order) where tipsify had to jump to a vertex that was no longer in the cache | these hard boundaries are used by optimiseOverdraw()*/
+		std::vector<unsigned int> optimiseVertexCache(MeshPart& part, unsigned int cacheSize = vertexCacheSize) noexcept;
+
+		/*reorders the triangles of the indices with tipsify like optimiseVertexCache(MeshPart&) | used for the indices of the levels of detail, which share the vertices of their part
+		@param[vertexCount] the count of vertices that the indices use(all indices have to be smaller)*/
+		std::vector<unsigned int> optimiseVertexCache(std::vector<unsigned int>& indices, unsigned int vertexCount, unsigned int cacheSize = vertexCacheSize) noexcept;
+
+		/*reorders the clusters of the vertex cache optimised part, so the triangles on the outside of the mesh that face away from its center are drawn first and hide the triangles behind them with the depth test
+		the hard clusters of optimiseVertexCache() are split further where the local acmr of a cluster drops below threshold times the acmr of the whole part, so the vertex cache stays almost as good as after optimiseVertexCache()*/
+		void optimiseOverdraw(MeshPart& part, const std::vector<unsigned int>& clusters, unsigned int cacheSize = vertexCacheSize, float threshold = 1.05f) noexcept;
+
+		/*reorders the vertices in the order of their first use by the indices, so the vertices are fetched linearly from the vertexbuffer | vertices that are not used by the indices are removed
+		the indices of the lods are remapped to the new vertices*/
+		void optimiseVertexFetch(MeshPart& part) noexcept;
+
+		/*splits the part into parts with the same material and at most maxVertices vertices each, so every part can use 16 bit indices(relative to its basevertex in the cooked mesh)
+		the order of the triangles is kept and the vertices of each new part are ordered like in optimiseVertexFetch() | the lods of the part are not kept, so generate them after the split*/
+		std::vector<MeshPart> splitMeshPart(const MeshPart& part, unsigned int maxVertices = 65536) noexcept;
+
+		/*simplifies the triangles of the indices with quadric edge collapses(Garland and Heckbert 1997) until there are at most targetIndexCount indices left, or no edge can be collapsed anymore
+		each vertex has the error quadric of the planes of its triangles(weighted by their area) and the edges with the smallest error are collapsed first by moving one vertex onto the other, so the simplified indices still use the vertices of the part
+		vertices on open borders and seams(vertices with the same position, but other texture coords, or normals) are never moved, so there are no holes and the texture mapping stays the same | collapses that would flip a triangle are skipped
+		@param[error] is set to the biggest error of all collapses: the root of the mean squared distance of a moved vertex from the planes of its triangles in model space
+		returns the simplified indices*/
+		std::vector<unsigned int> simplifyMesh(const MeshPart& part, const std::vector<unsigned int>& indices, unsigned int targetIndexCount, float& error) noexcept;
+
+		/*generates the levels of detail(lods) of the part with simplifyMesh() | each level has reduction times the triangles of the previous level and is simplified from the full detail indices, so its error is relative to the full detail mesh
+		there will be less than maxLevels - 1 lods if the triangles cant be reduced enough anymore(for example if most vertices are on seams)*/
+		void generateLods(MeshPart& part, unsigned int maxLevels = 4, float reduction = 0.5f) noexcept;
+
+		/*runs all optimisations on each part: the vertex cache and overdraw order, the split into parts for 16 bit indices and the vertex fetch order
+		the levels of detail are generated for each split part(up to lodLevels levels including the full detail) and reordered for the vertex cache | lodLevels = 1 generates no lods*/
+		void optimiseMesh(std::vector<MeshPart>& parts, unsigned int cacheSize = vertexCacheSize, unsigned int lodLevels = 4) noexcept;
+
+	}
+}
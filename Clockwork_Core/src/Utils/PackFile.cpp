@@ -0,0 +1,377 @@
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "PackFile.h"
+#include "Compression.h"
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace clockwork {
+	namespace utils {
+
+		PackFile* resourcePack = nullptr;
+
+		constexpr unsigned int PackFile::version;
+		constexpr unsigned int PackFile::alignment;
+
+		namespace {
+
+			const char packMagic[4] = { 'C', 'W', 'P', 'K' };
+			const unsigned int headerSize = 32;
+			const unsigned short compressedFlag = 1;
+
+			static_assert( sizeof(PackEntry) == 32, "the entries of the table of contents have to be 32 bytes like in the packfile" );
+
+			template<typename type> type readValue(const unsigned char* data) noexcept
+			{
+				type value;
+				std::memcpy(&value, data, sizeof(type));
+				return value;
+			}
+
+			template<typename type> void writeValue(std::vector<unsigned char>& data, unsigned long long position, const type& value) noexcept
+			{
+				std::memcpy(data.data() + position, &value, sizeof(type));
+			}
+
+			inline unsigned long long alignSize(unsigned long long size) noexcept
+			{
+				return ( size + PackFile::alignment - 1 ) / PackFile::alignment * PackFile::alignment;
+			}
+
+			inline char normaliseCharacter(char character) noexcept
+			{
+				if ( character == '\\' )
+					return '/';
+				if ( character >= 'A' && character <= 'Z' )
+					return static_cast<char>( character - 'A' + 'a' );
+				return character;
+			}
+
+			/*returns the position of the first character of the path without a leading ./*/
+			inline unsigned int skipCurrentFolder(const std::string& path) noexcept
+			{
+				unsigned int start = 0;
+				while ( path.size() >= start + 2 && path[start] == '.' && ( path[start + 1] == '/' || path[start + 1] == '\\' ) )
+					start += 2;
+				return start;
+			}
+
+		}
+
+		PackFile::PackFile() noexcept
+			: m_data(nullptr), m_size(0), m_file(nullptr), m_mapping(nullptr), m_slots(nullptr), m_names(nullptr), m_slotCount(0), m_entryCount(0)
+		{}
+
+		PackFile::PackFile(const std::string& filepath) noexcept
+			: m_filepath(filepath), m_data(nullptr), m_size(0), m_file(nullptr), m_mapping(nullptr), m_slots(nullptr), m_names(nullptr), m_slotCount(0), m_entryCount(0)
+		{
+#ifdef _WIN32
+			HANDLE file = CreateFileA(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+			if ( file == INVALID_HANDLE_VALUE )
+				return;
+			m_file = file;
+			LARGE_INTEGER size;
+			if ( !GetFileSizeEx(file, &size) || size.QuadPart < headerSize )
+				return;
+			m_mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if ( !m_mapping )
+				return;
+			m_data = static_cast<const unsigned char*>( MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0) );
+			if ( !m_data )
+				return;
+			m_size = static_cast<unsigned long long>( size.QuadPart );
+#else
+			int file = open(filepath.c_str(), O_RDONLY);
+			if ( file < 0 )
+				return;
+			struct stat status;
+			if ( fstat(file, &status) != 0 || status.st_size < headerSize )
+			{
+				::close(file);
+				return;
+			}
+			void* data = mmap(nullptr, static_cast<size_t>( status.st_size ), PROT_READ, MAP_PRIVATE, file, 0);
+			::close(file);//the mapping stays valid without the file
+			if ( data == MAP_FAILED )
+				return;
+			m_data = static_cast<const unsigned char*>( data );
+			m_size = static_cast<unsigned long long>( status.st_size );
+#endif
+			unsigned int slotCount = readValue<unsigned int>(m_data + 12);
+			unsigned long long tableOffset = readValue<unsigned long long>(m_data + 16);
+			unsigned long long namesOffset = readValue<unsigned long long>(m_data + 24);
+			if ( std::memcmp(m_data, packMagic, 4) != 0 || readValue<unsigned int>(m_data + 4) != version || slotCount == 0 || ( slotCount & ( slotCount - 1 ) ) != 0
+				|| tableOffset % 8 != 0 || tableOffset + static_cast<unsigned long long>( slotCount ) * sizeof(PackEntry) > m_size || namesOffset > m_size )
+			{
+#if CLOCKWORK_DEBUG
+				std::cout << "Error PackFile::PackFile(): the file is not a packfile of version " << version << ": " << filepath << std::endl;
+#endif
+				close();
+				return;
+			}
+			const PackEntry* slots = reinterpret_cast<const PackEntry*>( m_data + tableOffset );
+			for ( unsigned int i = 0; i < slotCount; ++i )//the names are read without a size check in find() and getName(), so a truncated, or corrupt packfile is rejected here
+			{
+				if ( slots[i].hash != 0 && namesOffset + slots[i].nameOffset + slots[i].nameLength > m_size )
+				{
+#if CLOCKWORK_DEBUG
+					std::cout << "Error PackFile::PackFile(): the name of an entry is outside of the packfile: " << filepath << std::endl;
+#endif
+					close();
+					return;
+				}
+			}
+			m_entryCount = readValue<unsigned int>(m_data + 8);
+			m_slotCount = slotCount;
+			m_slots = slots;
+			m_names = reinterpret_cast<const char*>( m_data + namesOffset );
+		}
+
+		PackFile::~PackFile() noexcept
+		{
+			close();
+		}
+
+		PackFile::PackFile(PackFile&& other) noexcept
+			: m_filepath(std::move(other.m_filepath)), m_data(other.m_data), m_size(other.m_size), m_file(other.m_file), m_mapping(other.m_mapping), m_slots(other.m_slots), m_names(other.m_names), m_slotCount(other.m_slotCount), m_entryCount(other.m_entryCount)
+		{
+			other.m_data = nullptr;
+			other.m_file = nullptr;
+			other.m_mapping = nullptr;
+			other.m_slots = nullptr;
+			other.m_slotCount = 0;
+			other.m_entryCount = 0;
+		}
+
+		PackFile& PackFile::operator=(PackFile&& other) noexcept
+		{
+			close();
+			m_filepath = std::move(other.m_filepath);
+			m_data = other.m_data;
+			m_size = other.m_size;
+			m_file = other.m_file;
+			m_mapping = other.m_mapping;
+			m_slots = other.m_slots;
+			m_names = other.m_names;
+			m_slotCount = other.m_slotCount;
+			m_entryCount = other.m_entryCount;
+			other.m_data = nullptr;
+			other.m_file = nullptr;
+			other.m_mapping = nullptr;
+			other.m_slots = nullptr;
+			other.m_slotCount = 0;
+			other.m_entryCount = 0;
+			return *this;
+		}
+
+		void PackFile::close() noexcept
+		{
+#ifdef _WIN32
+			if ( m_data )
+				UnmapViewOfFile(m_data);
+			if ( m_mapping )
+				CloseHandle(m_mapping);
+			if ( m_file )
+				CloseHandle(m_file);
+#else
+			if ( m_data )
+				munmap(const_cast<unsigned char*>( m_data ), static_cast<size_t>( m_size ));
+#endif
+			m_data = nullptr;
+			m_file = nullptr;
+			m_mapping = nullptr;
+			m_slots = nullptr;
+			m_names = nullptr;
+			m_size = 0;
+			m_slotCount = 0;
+			m_entryCount = 0;
+		}
+
+		unsigned long long PackFile::hashPath(const std::string& path) noexcept
+		{
+			unsigned long long hash = 14695981039346656037ull;
+			for ( unsigned int i = skipCurrentFolder(path); i < path.size(); ++i )
+			{
+				hash ^= static_cast<unsigned char>( normaliseCharacter(path[i]) );
+				hash *= 1099511628211ull;
+			}
+			return hash != 0 ? hash : 1;//0 marks an empty slot
+		}
+
+		std::string PackFile::normalisePath(const std::string& path) noexcept
+		{
+			std::string normalised = path.substr(skipCurrentFolder(path));
+			for ( auto& character : normalised )
+				character = normaliseCharacter(character);
+			return normalised;
+		}
+
+		const PackEntry* PackFile::find(const std::string& path) const noexcept
+		{
+			if ( !m_slots )
+				return nullptr;
+			unsigned long long hash = hashPath(path);
+			unsigned int start = skipCurrentFolder(path);
+			unsigned int length = path.size() - start;
+			for ( unsigned int i = 0, slot = static_cast<unsigned int>( hash ) & ( m_slotCount - 1 ); i < m_slotCount; ++i, slot = ( slot + 1 ) & ( m_slotCount - 1 ) )
+			{
+				const PackEntry& entry = m_slots[slot];
+				if ( entry.hash == 0 )
+					return nullptr;
+				if ( entry.hash != hash || entry.nameLength != length )
+					continue;
+				const char* name = m_names + entry.nameOffset;//the names are compared to be sure that 2 paths with the same hash are not mixed up
+				unsigned int c = 0;
+				while ( c < length && name[c] == normaliseCharacter(path[start + c]) )
+					++c;
+				if ( c == length )
+					return &entry;
+			}
+			return nullptr;
+		}
+
+		const unsigned char* PackFile::read(const PackEntry& entry, std::vector<unsigned char>& buffer) const noexcept
+		{
+			if ( entry.offset + entry.storedSize > m_size )
+			{
+#if CLOCKWORK_DEBUG
+				std::cout << "Error PackFile::read(): the entry is outside of the packfile: " << getName(entry) << std::endl;
+#endif
+				return nullptr;
+			}
+			if ( !entry.isCompressed() )
+				return m_data + entry.offset;
+			buffer.resize(entry.size);
+			if ( decompressLZ4(m_data + entry.offset, entry.storedSize, buffer.data(), entry.size) != entry.size )
+			{
+#if CLOCKWORK_DEBUG
+				std::cout << "Error PackFile::read(): the compressed data is corrupt: " << getName(entry) << std::endl;
+#endif
+				return nullptr;
+			}
+			return buffer.data();
+		}
+
+		std::string PackFile::getName(const PackEntry& entry) const noexcept
+		{
+			return std::string(m_names + entry.nameOffset, entry.nameLength);
+		}
+
+		bool buildPackFile(const std::vector<std::string>& filepaths, const std::string& packPath, bool compress) noexcept
+		{
+			unsigned int slotCount = 2;
+			while ( slotCount < filepaths.size() * 2 )//the table is atmost half full, so the probing stays short
+				slotCount *= 2;
+			std::vector<PackEntry> slots(slotCount);
+			std::memset(slots.data(), 0, slots.size() * sizeof(PackEntry));
+			std::vector<std::vector<unsigned char>> contents;
+			std::vector<unsigned int> slotIds;
+			std::string names;
+			contents.reserve(filepaths.size());
+			for ( const auto& filepath : filepaths )
+			{
+				std::ifstream file(filepath, std::ios::binary);
+				if ( !file )
+				{
+#if CLOCKWORK_DEBUG
+					std::cout << "Error utils::buildPackFile(): the file could not be read: " << filepath << std::endl;
+#endif
+					return false;
+				}
+				std::vector<unsigned char> data { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+				std::string name = PackFile::normalisePath(filepath);
+				unsigned long long hash = PackFile::hashPath(filepath);
+				unsigned int slot = static_cast<unsigned int>( hash ) & ( slotCount - 1 );
+				while ( slots[slot].hash != 0 )
+				{
+					if ( slots[slot].hash == hash && names.compare(slots[slot].nameOffset, slots[slot].nameLength, name) == 0 )
+					{
+#if CLOCKWORK_DEBUG
+						std::cout << "Error utils::buildPackFile(): the file was added twice: " << filepath << std::endl;
+#endif
+						return false;
+					}
+					slot = ( slot + 1 ) & ( slotCount - 1 );
+				}
+				PackEntry& entry = slots[slot];
+				entry.hash = hash;
+				entry.size = static_cast<unsigned int>( data.size() );
+				entry.storedSize = entry.size;
+				entry.nameOffset = static_cast<unsigned int>( names.size() );
+				entry.nameLength = static_cast<unsigned short>( name.size() );
+				names += name;
+				if ( compress && !data.empty() )
+				{
+					std::vector<unsigned char> compressed(getLZ4Bound(entry.size));
+					unsigned int compressedSize = compressLZ4(data.data(), entry.size, compressed.data(), compressed.size());
+					if ( compressedSize != 0 && compressedSize <= entry.size - entry.size / 8 )
+					{
+						compressed.resize(compressedSize);
+						data.swap(compressed);
+						entry.storedSize = compressedSize;
+						entry.flags = compressedFlag;
+					}
+				}
+				contents.push_back(std::move(data));
+				slotIds.push_back(slot);
+			}
+
+			unsigned long long namesOffset = headerSize + slots.size() * sizeof(PackEntry);
+			unsigned long long offset = alignSize(namesOffset + names.size());
+			for ( unsigned int i = 0; i < contents.size(); ++i )
+			{
+				slots[slotIds[i]].offset = offset;
+				offset = alignSize(offset + contents[i].size());
+			}
+			std::vector<unsigned char> pack(static_cast<size_t>( offset ), 0);
+			std::memcpy(pack.data(), packMagic, 4);
+			writeValue<unsigned int>(pack, 4, PackFile::version);
+			writeValue<unsigned int>(pack, 8, static_cast<unsigned int>( contents.size() ));
+			writeValue<unsigned int>(pack, 12, slotCount);
+			writeValue<unsigned long long>(pack, 16, headerSize);
+			writeValue<unsigned long long>(pack, 24, namesOffset);
+			std::memcpy(pack.data() + headerSize, slots.data(), slots.size() * sizeof(PackEntry));
+			std::memcpy(pack.data() + namesOffset, names.data(), names.size());
+			for ( unsigned int i = 0; i < contents.size(); ++i )
+			{
+				if ( !contents[i].empty() )
+					std::memcpy(pack.data() + slots[slotIds[i]].offset, contents[i].data(), contents[i].size());
+			}
+
+			std::ofstream file(packPath, std::ios::binary);
+			file.write(reinterpret_cast<const char*>( pack.data() ), pack.size());
+			if ( !file )
+			{
+#if CLOCKWORK_DEBUG
+				std::cout << "Error utils::buildPackFile(): the packfile could not be written: " << packPath << std::endl;
+#endif
+				return false;
+			}
+			return true;
+		}
+
+	}
+}
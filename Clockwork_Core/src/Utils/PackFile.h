@@ -0,0 +1,133 @@
+#pragma once
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include <string>
+#include <vector>
+
+namespace clockwork {
+	namespace utils {
+
+		/*one entry of the table of contents of a packfile like it is stored in the file(32 bytes) | the entries are stored in a hash table with linear probing where an empty slot has the hash 0*/
+		struct PackEntry
+		{
+			unsigned long long hash;//the hash of the normalised path(see PackFile::hashPath)
+			unsigned long long offset;//the position of the data from the start of the packfile | aligned to PackFile::alignment
+			unsigned int size;//the size of the data after decompressing it
+			unsigned int storedSize;//the size of the data in the packfile
+			unsigned int nameOffset;//the position of the normalised path from the start of the names
+			unsigned short nameLength;
+			unsigned short flags;
+
+			const bool isCompressed() const noexcept {return ( flags & 1 ) != 0;}
+		};
+
+		/*a packfile(.cwpk) stores many resource files in one file, which is mapped into the memory instead of opening and reading each file | the engine opens res.cwpk next to the engine.exe if it exists
+		the files are found by their path(relative to the engine.exe like the loose files, for example res/Images/dirt.png) with one lookup in a hashed table of contents without opening a file
+		the data of each file is aligned to 64 bytes and is either stored like the file, so it can be read without a copy directly from the mapped memory, or compressed with lz4 if that makes it noticeable smaller
+		packfiles are built by the Clockwork_Packer tool with buildPackFile | the packfile is only read, so it can be used by all threads at once(for example by the workers of the assetloader)
+		file layout: 32 byte header(CWPK, version, entrycount, slotcount, table offset, names offset), the table of slots, the names and then the aligned data of the files*/
+		class PackFile
+		{
+
+		public:
+			static constexpr unsigned int version = 1;
+			static constexpr unsigned int alignment = 64;
+
+		private:
+			std::string m_filepath;
+			const unsigned char* m_data;
+			unsigned long long m_size;
+			void* m_file;//the file handle on windows
+			void* m_mapping;//the file mapping handle on windows
+			const PackEntry* m_slots;
+			const char* m_names;
+			unsigned int m_slotCount;
+			unsigned int m_entryCount;
+
+		public:
+			/*creates an invalid packfile without data*/
+			PackFile() noexcept;
+
+			/*maps the packfile at the filepath into the memory and checks its header | the packfile is invalid if the file does not exist, or is not a packfile of this version*/
+			explicit PackFile(const std::string& filepath) noexcept;
+
+			/*unmaps the packfile | all data pointers of the packfile are invalid afterwards*/
+			~PackFile() noexcept;
+
+			PackFile(const PackFile& other) = delete;
+
+			PackFile(PackFile&& other) noexcept;
+
+			PackFile& operator=(const PackFile& other) = delete;
+
+			PackFile& operator=(PackFile&& other) noexcept;
+
+		private:
+			void close() noexcept;
+
+		public:
+			/*returns the hash of the path for the table of contents(64 bit fnv-1a) | the path is normalised first(lower case, / instead of \ and without a leading ./), so res\Images\Dirt.png and res/images/dirt.png are the same file*/
+			static unsigned long long hashPath(const std::string& path) noexcept;
+
+			/*returns the normalised path that is stored in the packfile | see hashPath*/
+			static std::string normalisePath(const std::string& path) noexcept;
+
+		public:
+			/*returns the entry of the file with the path, or nullptr if it is not in the packfile*/
+			const PackEntry* find(const std::string& path) const noexcept;
+
+			/*returns a pointer to the data of the entry | stored entries point directly into the mapped packfile(zero copy) and the buffer is not used
+			compressed entries are decompressed into the buffer, which is resized to the size of the entry | the data has the size of the entry and is valid as long as the packfile and the buffer live
+			returns nullptr if the compressed data is corrupt*/
+			const unsigned char* read(const PackEntry& entry, std::vector<unsigned char>& buffer) const noexcept;
+
+			/*returns the normalised path of the entry*/
+			std::string getName(const PackEntry& entry) const noexcept;
+
+		public:
+			/*returns true if the file with the path is in the packfile*/
+			const bool contains(const std::string& path) const noexcept {return find(path) != nullptr;}
+
+			/*returns true if the packfile is mapped and has a valid header*/
+			const bool isValid() const noexcept {return m_slots != nullptr;}
+
+			const unsigned int getEntryCount() const noexcept {return m_entryCount;}
+
+			const unsigned long long getSize() const noexcept {return m_size;}
+
+			const std::string& getFilepath() const noexcept {return m_filepath;}
+
+			/*calls the function with each entry of the packfile*/
+			template<typename Function>
+			void forEach(Function function) const noexcept
+			{
+				for ( unsigned int i = 0; i < m_slotCount; ++i )
+				{
+					if ( m_slots[i].hash != 0 )
+						function(m_slots[i]);
+				}
+			}
+
+		};
+
+		/*packs the files into a packfile at the packpath | the paths of the files are stored like they are given(relative to the engine.exe, for example res/Shaders/Default/Normal.vs), so the engine can find them with the same paths as the loose files
+		@param[compress] the files are compressed with lz4, if that saves atleast 1/8 of their size | already compressed formats like png/jpg are then stored without compression
+		returns false if a file could not be read, or the packfile could not be written*/
+		bool buildPackFile(const std::vector<std::string>& filepaths, const std::string& packPath, bool compress = true) noexcept;
+
+		/*the resource packfile(res.cwpk next to the engine.exe) that is opened by the engine | it is nullptr if the engine is not running, or invalid if there is no packfile, then all resources are read from the loose files
+		File and Image read their data from it, if it contains their filepath*/
+		extern PackFile* resourcePack;
+
+	}
+}
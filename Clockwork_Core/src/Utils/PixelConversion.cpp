@@ -0,0 +1,268 @@
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "PixelConversion.h"
+#include <cstring>
+
+#if defined(_M_X64) || defined(__SSE2__) || ( defined(_M_IX86_FP) && _M_IX86_FP >= 2 )
+#define CLOCKWORK_SSE2 1
+#include <emmintrin.h>
+#else
+#define CLOCKWORK_SSE2 0
+#endif
+
+#if defined(__SSSE3__) || defined(__AVX__)//msvc has no macro for ssse3, but every processor with avx also has ssse3
+#define CLOCKWORK_SSSE3 1
+#include <tmmintrin.h>
+#else
+#define CLOCKWORK_SSSE3 0
+#endif
+
+namespace clockwork {
+	namespace utils {
+
+		namespace {
+
+			/*returns the rounded value*alpha/255 without a division*/
+			inline unsigned char multiplyAlpha(unsigned int value, unsigned int alpha) noexcept
+			{
+				unsigned int product = value * alpha + 128;
+				return static_cast<unsigned char>( ( product + ( product >> 8 ) ) >> 8 );
+			}
+
+			/*allocates an image with a bitmap of freeimage for the size | the pixels are not initialised*/
+			Image allocateImage(const std::string& filepath, unsigned int width, unsigned int height, unsigned int pixelSize) noexcept
+			{
+				Image image(filepath);
+				image.setData(FreeImage_Allocate(width, height, pixelSize));
+				return image;
+			}
+
+		}
+
+		void expandToAlpha(const unsigned char* source, unsigned char* target, unsigned int count, unsigned char alpha) noexcept
+		{
+			unsigned int i = 0;
+#if CLOCKWORK_SSE2
+			const __m128i colourMask = _mm_set1_epi32(0x00FFFFFF);
+			const __m128i alphaBits = _mm_set1_epi32(static_cast<int>( static_cast<unsigned int>( alpha ) << 24 ));
+			for ( ; i + 4 < count; i += 4 )//reads 4 bytes per pixel, so the last pixel is left for the scalar loop to not read behind the row
+			{
+				int pixels[4];
+				std::memcpy(&pixels[0], source + i * 3, 4);
+				std::memcpy(&pixels[1], source + i * 3 + 3, 4);
+				std::memcpy(&pixels[2], source + i * 3 + 6, 4);
+				std::memcpy(&pixels[3], source + i * 3 + 9, 4);
+				__m128i value = _mm_set_epi32(pixels[3], pixels[2], pixels[1], pixels[0]);
+				value = _mm_or_si128(_mm_and_si128(value, colourMask), alphaBits);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>( target + i * 4 ), value);
+			}
+#endif
+			for ( ; i < count; ++i )
+			{
+				target[i * 4] = source[i * 3];
+				target[i * 4 + 1] = source[i * 3 + 1];
+				target[i * 4 + 2] = source[i * 3 + 2];
+				target[i * 4 + 3] = alpha;
+			}
+		}
+
+		void removeAlpha(const unsigned char* source, unsigned char* target, unsigned int count) noexcept
+		{
+			for ( unsigned int i = 0; i < count; ++i )
+			{
+				target[i * 3] = source[i * 4];
+				target[i * 3 + 1] = source[i * 4 + 1];
+				target[i * 3 + 2] = source[i * 4 + 2];
+			}
+		}
+
+		void swapRedBlue(unsigned char* pixels, unsigned int count, unsigned int bytesPerPixel) noexcept
+		{
+			unsigned int i = 0;
+#if CLOCKWORK_SSE2
+			if ( bytesPerPixel == 4 )
+			{
+				const __m128i redBlueMask = _mm_set1_epi32(0x00FF00FF);
+				const __m128i greenAlphaMask = _mm_set1_epi32(static_cast<int>( 0xFF00FF00 ));
+				for ( ; i + 4 <= count; i += 4 )
+				{
+					__m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>( pixels + i * 4 ));
+					__m128i redBlue = _mm_and_si128(value, redBlueMask);
+					redBlue = _mm_and_si128(_mm_or_si128(_mm_slli_epi32(redBlue, 16), _mm_srli_epi32(redBlue, 16)), redBlueMask);//byte 0 and byte 2 change places
+					value = _mm_or_si128(_mm_and_si128(value, greenAlphaMask), redBlue);
+					_mm_storeu_si128(reinterpret_cast<__m128i*>( pixels + i * 4 ), value);
+				}
+			}
+#endif
+#if CLOCKWORK_SSSE3
+			if ( bytesPerPixel == 3 )
+			{
+				const __m128i swapMask = _mm_setr_epi8(2, 1, 0, 5, 4, 3, 8, 7, 6, 11, 10, 9, 12, 13, 14, 15);//swaps the first 4 pixels(12 bytes) of the register
+				for ( ; i + 6 <= count; i += 4 )//reads 16 bytes, so the last pixels are left for the scalar loop to not read behind the row
+				{
+					__m128i value = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>( pixels + i * 3 )), swapMask);
+					_mm_storel_epi64(reinterpret_cast<__m128i*>( pixels + i * 3 ), value);//only the 12 swapped bytes are written, because a 16 byte store would overlap the load of the next step and stall the store forwarding
+					int last = _mm_cvtsi128_si32(_mm_srli_si128(value, 8));
+					std::memcpy(pixels + i * 3 + 8, &last, 4);
+				}
+			}
+#endif
+			for ( ; i < count; ++i )
+			{
+				unsigned char* pixel = pixels + i * bytesPerPixel;
+				unsigned char red = pixel[0];
+				pixel[0] = pixel[2];
+				pixel[2] = red;
+			}
+		}
+
+		void premultiplyAlpha(unsigned char* pixels, unsigned int count) noexcept
+		{
+			unsigned int i = 0;
+#if CLOCKWORK_SSE2
+			const __m128i zero = _mm_setzero_si128();
+			const __m128i colourLanes = _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1);
+			const __m128i alphaLanes = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);//the alpha is multiplied with 255, so it stays the same
+			const __m128i rounding = _mm_set1_epi16(128);
+			for ( ; i + 4 <= count; i += 4 )
+			{
+				__m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>( pixels + i * 4 ));
+				__m128i halves[2] = { _mm_unpacklo_epi8(value, zero), _mm_unpackhi_epi8(value, zero) };//2 pixels with 16 bits per channel
+				for ( unsigned int h = 0; h < 2; ++h )
+				{
+					__m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(halves[h], _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+					alpha = _mm_or_si128(_mm_and_si128(alpha, colourLanes), alphaLanes);
+					__m128i product = _mm_add_epi16(_mm_mullo_epi16(halves[h], alpha), rounding);
+					halves[h] = _mm_srli_epi16(_mm_add_epi16(product, _mm_srli_epi16(product, 8)), 8);
+				}
+				_mm_storeu_si128(reinterpret_cast<__m128i*>( pixels + i * 4 ), _mm_packus_epi16(halves[0], halves[1]));
+			}
+#endif
+			for ( ; i < count; ++i )
+			{
+				unsigned char* pixel = pixels + i * 4;
+				pixel[0] = multiplyAlpha(pixel[0], pixel[3]);
+				pixel[1] = multiplyAlpha(pixel[1], pixel[3]);
+				pixel[2] = multiplyAlpha(pixel[2], pixel[3]);
+			}
+		}
+
+		void downscaleRow(const unsigned char* row0, const unsigned char* row1, unsigned char* target, unsigned int sourceCount, unsigned int bytesPerPixel) noexcept
+		{
+			unsigned int targetCount = sourceCount > 1 ? sourceCount / 2 : 1;
+			unsigned int x = 0;
+#if CLOCKWORK_SSE2
+			if ( bytesPerPixel == 4 )
+			{
+				const __m128i zero = _mm_setzero_si128();
+				const __m128i rounding = _mm_set1_epi16(2);
+				for ( ; x + 2 <= targetCount; x += 2 )//4 source pixels per row for 2 target pixels
+				{
+					__m128i top = _mm_loadu_si128(reinterpret_cast<const __m128i*>( row0 + x * 8 ));
+					__m128i bottom = _mm_loadu_si128(reinterpret_cast<const __m128i*>( row1 + x * 8 ));
+					__m128i left = _mm_add_epi16(_mm_unpacklo_epi8(top, zero), _mm_unpacklo_epi8(bottom, zero));//the columns of the first target pixel
+					__m128i right = _mm_add_epi16(_mm_unpackhi_epi8(top, zero), _mm_unpackhi_epi8(bottom, zero));//the columns of the second target pixel
+					left = _mm_add_epi16(left, _mm_srli_si128(left, 8));
+					right = _mm_add_epi16(right, _mm_srli_si128(right, 8));
+					__m128i sum = _mm_srli_epi16(_mm_add_epi16(_mm_unpacklo_epi64(left, right), rounding), 2);
+					_mm_storel_epi64(reinterpret_cast<__m128i*>( target + x * 4 ), _mm_packus_epi16(sum, zero));
+				}
+			}
+#endif
+			for ( ; x < targetCount; ++x )
+			{
+				unsigned int x0 = x * 2 * bytesPerPixel;
+				unsigned int x1 = x * 2 + 1 < sourceCount ? x0 + bytesPerPixel : x0;
+				for ( unsigned int c = 0; c < bytesPerPixel; ++c )
+				{
+					unsigned int sum = row0[x0 + c] + row0[x1 + c] + row1[x0 + c] + row1[x1 + c];
+					target[x * bytesPerPixel + c] = static_cast<unsigned char>( ( sum + 2 ) / 4 );
+				}
+			}
+		}
+
+		Image convertImage(const ImageView& view, unsigned int pixelSize, const std::string& filepath) noexcept
+		{
+			if ( !view.hasData() || ( view.getBytesPerPixel() != 3 && view.getBytesPerPixel() != 4 ) || ( pixelSize != 24 && pixelSize != 32 ) )
+			{
+#if CLOCKWORK_DEBUG
+				std::cout << "Error utils::convertImage(): the view has no data, or the pixelsize is not 24/32 bits: " << filepath << std::endl;
+#endif
+				return Image(filepath);
+			}
+			Image image = allocateImage(filepath, view.getWidth(), view.getHeight(), pixelSize);
+			unsigned int pitch = image.getView().getPitch();
+			unsigned char* data = image.getMutableData();
+			for ( unsigned int y = 0; y < view.getHeight(); ++y )
+			{
+				unsigned char* row = data + y * pitch;
+				if ( view.getPixelSize() == pixelSize )
+					std::memcpy(row, view.getRow(y), view.getWidth() * view.getBytesPerPixel());
+				else if ( pixelSize == 32 )
+					expandToAlpha(view.getRow(y), row, view.getWidth());
+				else
+					removeAlpha(view.getRow(y), row, view.getWidth());
+			}
+			return image;
+		}
+
+		Image downscaleImage(const ImageView& view, const std::string& filepath) noexcept
+		{
+			unsigned int width = view.getWidth() > 1 ? view.getWidth() / 2 : 1;
+			unsigned int height = view.getHeight() > 1 ? view.getHeight() / 2 : 1;
+			Image image = allocateImage(filepath, width, height, view.getPixelSize());
+			unsigned int pitch = image.getView().getPitch();
+			unsigned char* data = image.getMutableData();
+			for ( unsigned int y = 0; y < height; ++y )
+			{
+				unsigned int y1 = y * 2 + 1 < view.getHeight() ? y * 2 + 1 : y * 2;
+				downscaleRow(view.getRow(y * 2), view.getRow(y1), data + y * pitch, view.getWidth(), view.getBytesPerPixel());
+			}
+			return image;
+		}
+
+		Image normaliseImage(const Image& image, unsigned int width, unsigned int height, unsigned int pixelSize) noexcept
+		{
+			if ( image.getWidth() == width && image.getHeight() == height && image.getPixelSize() == pixelSize )
+				return image;
+			if ( !image.hasData() || ( pixelSize != 24 && pixelSize != 32 ) )
+			{
+#if CLOCKWORK_DEBUG
+				std::cout << "Error utils::normaliseImage(): the image has no data, or the pixelsize is not 24/32 bits: " << image.getFilepath() << std::endl;
+#endif
+				return image;
+			}
+			Image result = image;
+			if ( result.getPixelSize() != 24 && result.getPixelSize() != 32 )//the kernels only read pixels with 3, or 4 bytes, so images with a palette, greyscale images, etc are converted by freeimage first
+			{
+				result.convertTo(pixelSize);
+				if ( !result.hasData() )
+				{
+#if CLOCKWORK_DEBUG
+					std::cout << "Error utils::normaliseImage(): the image could not be converted to 24/32 bits: " << image.getFilepath() << std::endl;
+#endif
+					return Image(image.getFilepath(), width, height, pixelSize);
+				}
+			}
+			while ( result.getWidth() >= width * 2 && result.getHeight() >= height * 2 )
+				result = downscaleImage(result.getView(), image.getFilepath());
+			if ( result.getPixelSize() != pixelSize )
+				result = convertImage(result.getView(), pixelSize, image.getFilepath());
+			if ( result.getWidth() != width || result.getHeight() != height )
+				result.resize(width, height);
+			result.setFormat(image.getFormat());
+			return result;
+		}
+
+	}
+}
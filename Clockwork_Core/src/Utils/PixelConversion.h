@@ -0,0 +1,55 @@
+#pragma once
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "src\Utils\Image.h"
+#include "src\Utils\ImageView.h"
+
+namespace clockwork {
+	namespace utils {
+
+		/*the pixel kernels work on rows of pixels in the colour order of freeimage(BGR/BGRA for little endian and RGB/RGBA for big endian) and use sse2 for 4 pixels at once, which every x86 processor of the engine supports
+		swapRedBlue() also uses ssse3 for pixels with 3 bytes if the compiler targets it(avx for msvc) | they dont allocate memory and can be called from any thread, so worker threads can convert images before they are uploaded*/
+
+		/*expands count pixels with 3 bytes to pixels with 4 bytes and the given alpha value | source and target must not overlap*/
+		void expandToAlpha(const unsigned char* source, unsigned char* target, unsigned int count, unsigned char alpha = 255) noexcept;
+
+		/*removes the alpha byte of count pixels with 4 bytes, so they have 3 bytes | source and target must not overlap*/
+		void removeAlpha(const unsigned char* source, unsigned char* target, unsigned int count) noexcept;
+
+		/*swaps the red and the blue byte of count pixels in place, so BGR/BGRA pixels become RGB/RGBA pixels and the other way around
+		@param[bytesPerPixel] 3 = RGB and 4 = RGBA*/
+		void swapRedBlue(unsigned char* pixels, unsigned int count, unsigned int bytesPerPixel) noexcept;
+
+		/*multiplies the colour bytes of count pixels with 4 bytes in place with their alpha value(rounded colour*alpha/255), so the pixels can be blended with premultiplied alpha | the alpha byte stays the same*/
+		void premultiplyAlpha(unsigned char* pixels, unsigned int count) noexcept;
+
+		/*writes one row of the next smaller mipmap level | each target pixel is the rounded average of 2x2 pixels of the 2 source rows(box filter)
+		@param[sourceCount] the count of pixels in the source rows | the target row has sourceCount/2 pixels and at least 1 pixel, so the last source pixel is clamped for a width of 1
+		@param[bytesPerPixel] 3 = RGB and 4 = RGBA*/
+		void downscaleRow(const unsigned char* row0, const unsigned char* row1, unsigned char* target, unsigned int sourceCount, unsigned int bytesPerPixel) noexcept;
+
+		/*returns a new image with the pixels of the view converted to the pixelsize and the given filepath | the new image owns a copy of the pixels, so the view can be released afterwards
+		@param[pixelSize] 24 = RGB and 32 = RGBA | pixels without alpha get an alpha of 255*/
+		Image convertImage(const ImageView& view, unsigned int pixelSize, const std::string& filepath) noexcept;
+
+		/*returns a new image with half the size(and at least 1 pixel) of the view, where each pixel is the average of 2x2 pixels | the pixelsize stays the same*/
+		Image downscaleImage(const ImageView& view, const std::string& filepath) noexcept;
+
+		/*returns a copy of the image with the width, height and pixelsize, so images of mixed sources can be added to one texturearray2d | the filepath and format of the image stay the same
+		the image is halved with the box filter as long as it is at least twice as big as the size and the rest is rescaled by freeimage | images that already fit are only shared(see Image(const Image&))
+		images with a palette, greyscale images, etc are converted by freeimage first(see Image::convertTo()) | an image that can not be converted is returned with the size, but without data
+		@param[pixelSize] 24 = RGB and 32 = RGBA*/
+		Image normaliseImage(const Image& image, unsigned int width, unsigned int height, unsigned int pixelSize) noexcept;
+
+	}
+}
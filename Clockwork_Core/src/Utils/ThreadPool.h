@@ -14,285 +14,126 @@
 
 #include <thread>
 #include <mutex>
+#include <condition_variable>
+#include <functional>
 #include <vector>
-#include <queue>
+#include <deque>
+#include <iostream>
 
 namespace clockwork {
 	namespace utils {
 
+		/*a pool of worker threads that execute the tasks(jobs) of one shared queue | tasks can be added from any thread and are started in the order they were added
+		the tasks should not be too small, because each task needs a lock of the queue, so many tiny tasks should be combined into one bigger task
+		tasks must not use opengl, because the worker threads have no opengl context | the results have to be given to the render thread(for example with the assetloader)*/
 		class ThreadPool ///aufgaben drfen nicht zu klein/schnell sein, sonst bringt multithread nichts: mssen groe aufgaben sein
 		{
 
 		private:
+			std::vector<std::thread> m_workers;
+			std::deque<std::function<void()>> m_tasks;
+			std::mutex m_lock;
+			std::condition_variable m_taskCondition;
+			std::condition_variable m_idleCondition;
+			unsigned int m_working;
+			bool m_running;
 
-			struct Captree
+		public:
+			/*starts the worker threads of the pool
+			@param[threadCount] the number of worker threads | 0 uses the number of hardware threads minus the render thread, but atleast one thread*/
+			explicit ThreadPool(unsigned int threadCount = 0) noexcept
+				: m_working(0), m_running(true)
 			{
-
-				struct Container
-				{
-					std::vector<std::function<void()>> tasks;
-				};
-
-				struct Capsule
-				{
-					Container* container;
-					std::mutex lock;
-					int size;
-					Capsule()
-						: size(0), container(new Container())
-					{}
-				};
-
-				Capsule* capsules;
-				int count;
-				int bestpos;
-				int counter;
-
-				Captree(int threadCount)
-					: count(threadCount), bestpos(0), counter(0)
-				{
-					capsules = new Capsule[count];
-				}
-
-
-			private:
-				void findBestPos()
-				{
-					std::unique_lock<std::mutex> tempLock(capsules[bestpos].lock, std::defer_lock);
-					tempLock.lock();
-					int bestsize = capsules[bestpos].size;
-					tempLock.unlock();
-					for ( int i = 0; i < count; ++i )
-					{
-						if ( i == bestpos )
-							continue;
-						Capsule& cap = capsules[i];
-						std::unique_lock<std::mutex> lock(cap.lock, std::defer_lock);
-						lock.lock();
-						int size = cap.size;
-						lock.unlock();
-						if ( size < bestsize )
-						{
-							bestsize = size;
-							bestpos = i;
-						}
-					}
-				}
-
-			public:
-
-				//container pointer muss danach gelscht werden | wenn pointer null ist, sind keine tasks vorhanden
-				//threads sollten testen ob nicht null, dann tasks ausfhren, sonst relativ lange timeout warten
-				Container* getTasks(int threadNumber)
+				if ( threadCount == 0 )
 				{
-					Capsule& temp = capsules[threadNumber];
-					std::unique_lock<std::mutex> lock(temp.lock, std::defer_lock);
-					lock.lock();
-					if ( temp.container->tasks.empty() )
-					{
-						lock.unlock();
-						return nullptr;
-					}
-					Container* container = temp.container;
-					temp.container = new Container();
-					temp.size = 0;
-					lock.unlock();
-					return container;
+					unsigned int hardwareThreads = std::thread::hardware_concurrency();
+					threadCount = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
 				}
+				m_workers.reserve(threadCount);
+				for ( unsigned int i = 0; i < threadCount; ++i )
+					m_workers.push_back(std::thread(&ThreadPool::running, this));
+			}
 
-				void addTask(std::function<void()>&& task)
-				{
-					if ( counter == 6 )//bestpos after 5 tasks new calculated
-					{
-						findBestPos();
-						counter = 0;
-					}
-					++counter;
-
-					Capsule& cap = capsules[bestpos];
-					std::unique_lock<std::mutex> lock(cap.lock, std::defer_lock);
-					lock.lock();
-					cap.container->tasks.push_back(std::move(task));
-					++cap.size;
-					lock.unlock();
-				}
-
-				bool isEmpty()
-				{
-					for ( unsigned int i = 0; i < count; ++i )
-					{
-						Capsule& temp = capsules[count];
-						std::unique_lock<std::mutex> lock(temp.lock, std::defer_lock);
-						bool test = lock.owns_lock();
-						lock.lock();//crash/exception ? not working 
-						if ( temp.size != 0 )
-						{
-							lock.unlock();
-							return false;
-						}
-						lock.unlock();
-					}
-					return true;
-				}
-
-			};
-
-		public:
-			class ThreadWorker
+			/*executes the remaining tasks and stops the worker threads*/
+			~ThreadPool() noexcept
 			{
-				friend class ThreadPool;
-
-			private:
-				ThreadPool* m_pool;
-				bool m_running;
-				bool m_working;
-				std::mutex m_lock;
-				int m_id;
-				std::thread m_thread;
-
-			public:
-				ThreadWorker(ThreadPool* pool, int id) noexcept;
-				void running() noexcept;
-
-				~ThreadWorker() noexcept
 				{
-					m_running = false;//not working
-					m_thread.join();
+					std::lock_guard<std::mutex> lock(m_lock);
+					m_running = false;
 				}
-
-			};
-
-		private:
-			bool m_started;
-			int m_threadcount;
-			std::vector<ThreadWorker*> m_workers;
-			Captree m_tree;
-
-		public:
-
-			ThreadPool(unsigned int threadCount=4, unsigned int threadPriority=2)
-				: m_started(false), m_threadcount(threadCount), m_tree(threadCount)
-			{
-				m_workers.reserve(threadCount);
-				start();
+				m_taskCondition.notify_all();
+				for ( auto& worker : m_workers )
+					worker.join();
 			}
 
-			~ThreadPool()
-			{
-				stop();
+			ThreadPool(const ThreadPool& other) = delete;
 
-			}
+			ThreadPool(ThreadPool&& other) = delete;
 
-			template<typename type, typename ...Args>
-			void addTask(type* object,void ( type::*method )( Args...), Args&&... args)//as many method parameters as you want 
-			{
-				m_tree.addTask([=] (){
-					( object->*method )( std::forward<Args>(args)... );//foward=lvalue, or rvalue arguments depending on function call and therfor template parame args(lvalue reference, or rvalue reference) 
-				});			
-			}
+			ThreadPool& operator=(const ThreadPool& other) = delete;
+
+			ThreadPool& operator=(ThreadPool&& other) = delete;
 
-			void start()//not working
+		private:
+			/*the loop of each worker thread | waits for tasks and executes them until the pool is destroyed and the queue is empty*/
+			void running() noexcept
 			{
-				if (!m_started)
+				std::unique_lock<std::mutex> lock(m_lock);
+				while ( true )
 				{
-					for ( unsigned int i = 0; i < m_threadcount; ++i )
-					{
-						m_workers.push_back(new ThreadWorker(this,i));
-					}
-					m_started = true;
+					m_taskCondition.wait(lock, [this]() {return !m_running || !m_tasks.empty();});
+					if ( m_tasks.empty() )
+						return;
+					std::function<void()> task = std::move(m_tasks.front());
+					m_tasks.pop_front();
+					++m_working;
+					lock.unlock();
+					task();
+					lock.lock();
+					--m_working;
+					if ( m_working == 0 && m_tasks.empty() )
+						m_idleCondition.notify_all();
 				}
 			}
 
-			void stop()
+		public:
+			/*adds a task to the queue, which will be executed by the next free worker thread | can be called from any thread and also from inside a task*/
+			void addTask(std::function<void()>&& task) noexcept
 			{
-				if (m_started)
 				{
-					for ( unsigned int i = 0; i < m_threadcount; ++i )
-					{
-						delete m_workers.at(0);
-						m_workers.erase(m_workers.begin());
-					}
-					m_started = false;
+					std::lock_guard<std::mutex> lock(m_lock);
+					m_tasks.push_back(std::move(task));
 				}
+				m_taskCondition.notify_one();
 			}
 
-			bool isWorking()//funktioniert anscheinend vielleicht
+			/*adds a method of an object as a task | the arguments are copied into the task, so use pointers for objects that should not be copied
+			the object has to live until the task is executed*/
+			template<typename type, typename ...Params, typename ...Args>
+			void addTask(type* object, void ( type::*method )( Params... ), Args&&... args) noexcept//as many method parameters as you want 
 			{
-				//if ( !m_tree.isEmpty() )
-					//return true;
-				for ( unsigned int i = 0; i < m_threadcount; ++i )
-				{
-					std::unique_lock<std::mutex> lock(m_workers.at(i)->m_lock, std::defer_lock);
-					lock.lock();
-					if ( m_workers.at(i)->m_working )
-					{
-						lock.unlock();
-						return true;
-					}
-					lock.unlock();
-				}
-				std::this_thread::sleep_for(std::chrono::duration<double>(0.5));
-				for ( unsigned int i = 0; i < m_threadcount; ++i )
-				{
-					std::unique_lock<std::mutex> lock(m_workers.at(i)->m_lock, std::defer_lock);
-					lock.lock();
-					if ( m_workers.at(i)->m_working )
-					{
-						lock.unlock();
-						return true;
-					}
-					lock.unlock();
-				}
-				return false;
+				addTask(std::function<void()>(std::bind(method, object, std::forward<Args>(args)...)));
 			}
 
-			bool isRunning()
+			/*returns true if there are tasks in the queue, or tasks that are executed right now*/
+			bool isWorking() noexcept
 			{
-				return true;
+				std::lock_guard<std::mutex> lock(m_lock);
+				return m_working != 0 || !m_tasks.empty();
 			}
 
-			void waitWorking()
+			/*blocks the calling thread until all tasks are executed | must not be called from inside a task*/
+			void waitWorking() noexcept
 			{
-
+				std::unique_lock<std::mutex> lock(m_lock);
+				m_idleCondition.wait(lock, [this]() {return m_working == 0 && m_tasks.empty();});
 			}
 
-
+			/*returns the number of worker threads*/
+			const unsigned int getThreadCount() const noexcept {return m_workers.size();}
 
 		};
 
-		ThreadPool::ThreadWorker::ThreadWorker(ThreadPool* pool, int id) noexcept
-			: m_pool(pool), m_running(true), m_working(false), m_id(id), m_thread(&ThreadWorker::running, this)
-		{
-
-		}
-
-		void ThreadPool::ThreadWorker::running() noexcept
-		{
-			while ( m_running )
-			{
-				std::unique_lock<std::mutex> lock(m_lock, std::defer_lock);
-				lock.lock();
-				m_working = true;
-				lock.unlock();
-				Captree::Container* container = m_pool->m_tree.getTasks(m_id);
-				if ( container != nullptr )
-				{
-					for ( unsigned int i = 0; i < container->tasks.size(); ++i )
-					{
-						container->tasks.at(i)( );
-					}
-					delete container;
-				}
-				else
-				{
-					lock.lock();
-					m_working = false;
-					lock.unlock();
-					std::this_thread::sleep_for(std::chrono::duration<double>(1));
-				}
-			}
-		}
-
 		struct str2
 		{
 			long long into = 10;
@@ -316,9 +157,9 @@ namespace clockwork {
 			}
 		};
 
-		void test3()
+		inline void test3()
 		{
-			ThreadPool pool {6,6};
+			ThreadPool pool {6};
 			str2 ob1;
 			str2 ob2;
 			str2 ob3;
@@ -342,13 +183,7 @@ namespace clockwork {
 				pool.addTask(&ob8, &str2::testi);
 			}
 
-			//std::this_thread::sleep_for(std::chrono::duration<double>(10));
-
-			while ( pool.isWorking() )
-			{
-				std::this_thread::sleep_for(std::chrono::duration<double>(0.1));
-			}
-			//std::this_thread::sleep_for(std::chrono::duration<double>(1));
+			pool.waitWorking();
 			std::cout << "STOP!"<< ob1.into<<"  "<<ob2.into << ob3.into << ob4.into << ob5.into << ob6.into << ob7.into << ob8.into << std::endl;
 		}
 
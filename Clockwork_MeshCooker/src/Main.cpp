@@ -0,0 +1,171 @@
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "src\Utils\CookedMesh.h"
+#include "src\Utils\MeshOptimiser.h"
+#include "assimp\Importer.hpp"
+#include "assimp\scene.h"
+#include "assimp\postprocess.h"
+#include <experimental\filesystem>
+#include <cctype>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*the meshcooker imports model files with assimp and cooks them into .cwms files, which can be loaded by graphics::Mesh without parsing the model at runtime
+usage: Clockwork_MeshCooker [model or folder = res/Models]
+a folder is searched recursively for models and each model is cooked into a .cwms file with the same name next to the model
+the node transformations are applied to the vertices and all meshes of the same material are merged into one submesh | the diffuse texture of a material is stored as path relative to the engine.exe
+the triangles are reordered for the vertex cache and for less overdraw, the vertices are reordered for the vertex fetch and the parts are split so they fit 16 bit indices(see MeshOptimiser.h)
+the levels of detail are simplified from each part with quadric edge collapses and stored in the same file
+the acmr and atvr of the simulated vertex cache are printed before and after the optimisations for each model and the triangles and errors of its levels of detail*/
+
+namespace filesystem = std::experimental::filesystem;
+using namespace clockwork;
+
+bool isModel(const filesystem::path& path) noexcept
+{
+	std::string extension = path.extension().string();
+	for ( auto& character : extension )
+		character = static_cast<char>( tolower(character) );
+	return extension == ".obj" || extension == ".fbx" || extension == ".dae" || extension == ".3ds" || extension == ".blend" || extension == ".ply" || extension == ".gltf" || extension == ".glb";
+}
+
+/*returns the path of the diffuse texture of the material relative to the engine.exe, or an empty string | the texturepaths in model files are relative to the model*/
+std::string getMaterial(const aiMaterial* material, const filesystem::path& modelPath) noexcept
+{
+	aiString texturePath;
+	if ( material == nullptr || material->GetTexture(aiTextureType_DIFFUSE, 0, &texturePath) != AI_SUCCESS || texturePath.length == 0 || texturePath.data[0] == '*' )//* are textures embedded in the model file
+		return std::string();
+	std::string path = ( modelPath.parent_path() / texturePath.C_Str() ).string();
+	for ( auto& character : path )
+	{
+		if ( character == '\\' )
+			character = '/';
+	}
+	return path;
+}
+
+/*imports the model and converts its meshes into one part per material | returns false if assimp could not read the model*/
+bool importModel(const filesystem::path& modelPath, std::vector<utils::MeshPart>& parts) noexcept
+{
+	Assimp::Importer importer;
+	importer.SetPropertyInteger(AI_CONFIG_PP_SBP_REMOVE, aiPrimitiveType_POINT | aiPrimitiveType_LINE);
+	const aiScene* scene = importer.ReadFile(modelPath.string(), aiProcess_Triangulate | aiProcess_GenSmoothNormals | aiProcess_JoinIdenticalVertices | aiProcess_PreTransformVertices | aiProcess_SortByPType | aiProcess_ValidateDataStructure);
+	if ( scene == nullptr || ( scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE ) )
+	{
+		std::cout << importer.GetErrorString() << std::endl;
+		return false;
+	}
+	parts.assign(scene->mNumMaterials, utils::MeshPart());
+	for ( unsigned int i = 0; i < scene->mNumMaterials; ++i )
+		parts.at(i).material = getMaterial(scene->mMaterials[i], modelPath);
+	for ( unsigned int i = 0; i < scene->mNumMeshes; ++i )
+	{
+		const aiMesh* mesh = scene->mMeshes[i];
+		utils::MeshPart& part = parts.at(mesh->mMaterialIndex);
+		unsigned int baseVertex = part.vertices.size();
+		for ( unsigned int v = 0; v < mesh->mNumVertices; ++v )
+		{
+			utils::MeshVertex vertex {};
+			vertex.position[0] = mesh->mVertices[v].x;
+			vertex.position[1] = mesh->mVertices[v].y;
+			vertex.position[2] = mesh->mVertices[v].z;
+			if ( mesh->HasTextureCoords(0) )
+			{
+				vertex.uv[0] = mesh->mTextureCoords[0][v].x;
+				vertex.uv[1] = mesh->mTextureCoords[0][v].y;
+			}
+			if ( mesh->HasNormals() )
+			{
+				vertex.normal[0] = mesh->mNormals[v].x;
+				vertex.normal[1] = mesh->mNormals[v].y;
+				vertex.normal[2] = mesh->mNormals[v].z;
+			}
+			part.vertices.push_back(vertex);
+		}
+		for ( unsigned int f = 0; f < mesh->mNumFaces; ++f )
+		{
+			if ( mesh->mFaces[f].mNumIndices != 3 )
+				continue;
+			for ( unsigned int j = 0; j < 3; ++j )
+				part.indices.push_back(baseVertex + mesh->mFaces[f].mIndices[j]);
+		}
+	}
+	for ( unsigned int i = parts.size(); i-- > 0; )//materials without triangles
+	{
+		if ( parts.at(i).indices.empty() )
+			parts.erase(parts.begin() + i);
+	}
+	return !parts.empty();
+}
+
+int main(int argc, char** argv)
+{
+	std::string input = argc > 1 ? argv[1] : "res/Models";
+
+	std::vector<filesystem::path> modelPaths;
+	if ( filesystem::is_directory(input) )
+	{
+		for ( const auto& entry : filesystem::recursive_directory_iterator(input) )
+		{
+			if ( filesystem::is_regular_file(entry.path()) && isModel(entry.path()) )
+				modelPaths.push_back(entry.path());
+		}
+	}
+	else if ( filesystem::is_regular_file(input) )
+		modelPaths.push_back(input);
+	if ( modelPaths.empty() )
+	{
+		std::cout << "usage: Clockwork_MeshCooker [model or folder = res/Models]" << std::endl;
+		std::cout << "no models found at " << input << std::endl;
+		return 1;
+	}
+
+	unsigned int failed = 0;
+	for ( const auto& modelPath : modelPaths )
+	{
+		std::vector<utils::MeshPart> parts;
+		std::string cookedPath = utils::CookedMesh::getCookedPath(modelPath.string());
+		if ( !importModel(modelPath, parts) )
+		{
+			std::cout << "failed to import " << modelPath.string() << std::endl;
+			++failed;
+			continue;
+		}
+		utils::VertexCacheStatistics before = utils::analyseVertexCache(parts);
+		utils::optimiseMesh(parts);
+		utils::VertexCacheStatistics after = utils::analyseVertexCache(parts);
+		std::cout << std::fixed << std::setprecision(3) << modelPath.string() << ": acmr " << before.getACMR() << " -> " << after.getACMR() << ", atvr " << before.getATVR() << " -> " << after.getATVR() << std::endl;
+		utils::CookedMesh mesh(cookedPath, parts);
+		mesh.save();
+		if ( filesystem::is_regular_file(cookedPath) )
+		{
+			std::cout << "cooked " << modelPath.string() << " -> " << cookedPath << " (" << mesh.getVertexCount() << " vertices, " << mesh.getSubmeshCount() << " submeshes, " << mesh.getSize() << " bytes)" << std::endl;
+			for ( unsigned int lod = 0; lod < mesh.getLodCount(); ++lod )
+			{
+				unsigned int triangles = 0;
+				for ( unsigned int i = 0; i < mesh.getSubmeshCount(); ++i )
+					triangles += mesh.getSubmeshLod(i, lod).indexCount / 3;
+				std::cout << "  lod " << lod << ": " << triangles << " triangles, error " << mesh.getLodError(lod) << std::endl;
+			}
+		}
+		else
+		{
+			std::cout << "failed to write " << cookedPath << std::endl;
+			++failed;
+		}
+	}
+	std::cout << modelPaths.size() - failed << " of " << modelPaths.size() << " models cooked" << std::endl;
+	return failed == 0 ? 0 : 1;
+}
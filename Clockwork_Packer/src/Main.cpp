@@ -0,0 +1,77 @@
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "src\Utils\PackFile.h"
+#include <experimental\filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*the packer packs the resource folder into one packfile(.cwpk), which the engine maps into the memory instead of opening each resource file
+usage: Clockwork_Packer [folder = binaries\res] [packfile = binaries\res.cwpk] [lz4|store = lz4]
+the folder is searched recursively and all files are packed with their path relative to the parent of the folder(the folder of the engine.exe), so the paths in the packfile are the same as the paths the engine uses(res\Images\Dirt.png)
+the default paths are the absolute paths of the binaries folder of the solution(CLOCKWORK_BINARIES_DIR from the project), so the packer does not depend on the working directory and the post build step of the project packs the resources after every build of the packer
+lz4 compresses the files that get atleast 1/8 smaller and store packs all files without compression*/
+
+#ifndef CLOCKWORK_BINARIES_DIR
+#define CLOCKWORK_BINARIES_DIR ""
+#endif
+
+namespace filesystem = std::experimental::filesystem;
+using namespace clockwork;
+
+int main(int argc, char** argv)
+{
+	std::string input = argc > 1 ? argv[1] : CLOCKWORK_BINARIES_DIR "res";
+	std::string output = argc > 2 ? argv[2] : CLOCKWORK_BINARIES_DIR "res.cwpk";
+	std::string mode = argc > 3 ? argv[3] : "lz4";
+	if ( !filesystem::is_directory(input) || ( mode != "lz4" && mode != "store" ) )
+	{
+		std::cout << "usage: Clockwork_Packer [folder = " << CLOCKWORK_BINARIES_DIR << "res] [packfile = " << CLOCKWORK_BINARIES_DIR << "res.cwpk] [lz4|store = lz4]" << std::endl;
+		return 1;
+	}
+
+	//the paths of the files are relative to the parent of the resource folder, so the packfile works for every working directory of the packer
+	filesystem::path folder = filesystem::canonical(input);
+	output = filesystem::absolute(output).string();
+	filesystem::current_path(folder.parent_path());
+
+	std::vector<std::string> filepaths;
+	unsigned long long size = 0;
+	for ( const auto& entry : filesystem::recursive_directory_iterator(folder.filename()) )
+	{
+		if ( filesystem::is_regular_file(entry.path()) && entry.path().extension() != ".cwpk" )
+		{
+			filepaths.push_back(entry.path().string());
+			size += filesystem::file_size(entry.path());
+		}
+	}
+	if ( filepaths.empty() )
+	{
+		std::cout << "no files found in " << input << std::endl;
+		return 1;
+	}
+
+	if ( !utils::buildPackFile(filepaths, output, mode == "lz4") )
+	{
+		std::cout << "failed to pack " << input << " -> " << output << std::endl;
+		return 1;
+	}
+	utils::PackFile pack(output);
+	unsigned int compressed = 0;
+	pack.forEach([&compressed](const utils::PackEntry& entry) {
+		if ( entry.isCompressed() )
+			++compressed;
+	});
+	std::cout << "packed " << pack.getEntryCount() << " files(" << compressed << " compressed) from " << input << " -> " << output << " (" << size << " -> " << pack.getSize() << " bytes)" << std::endl;
+	return 0;
+}
@@ -0,0 +1,88 @@
+/*************************************************************************
+* Clockwork-Engine
+* A C++/Opengl/GLFW3 game engine
+* Website: clock-work.tk
+*------------------------------------------------------------------------
+* Copyright (C) 20017-2018 Niko Miklis <clock-work@gmx.de> - All Rights Reserved
+*
+* This software is provided 'as-is', without any express or implied
+* warranty. In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* You can use this software under the following License: https://github.com/Clock-work/Clockwork-Engine/blob/master/LICENSE
+*************************************************************************/
+#include "src\Utils\CookedTexture.h"
+#include "FreeImage\FreeImage.h"
+#include <experimental\filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*the texturecooker cooks images into .cwtx files with block compressed mipmaps, which can be loaded by texture2d, texturearray2d and the textureregistry without decoding the image and without generating mipmaps
+usage: Clockwork_TextureCooker [image or folder = res/Images] [auto|bc1|bc3|bc7 = auto]
+a folder is searched recursively for images and each image is cooked into a .cwtx file with the same name next to the image
+auto cooks images without alpha channel to BC1 and images with alpha channel to BC3*/
+
+namespace filesystem = std::experimental::filesystem;
+using namespace clockwork;
+
+bool isImage(const filesystem::path& path) noexcept
+{
+	std::string extension = path.extension().string();
+	for ( auto& character : extension )
+		character = static_cast<char>( tolower(character) );
+	return extension == ".jpg" || extension == ".jpeg" || extension == ".png" || extension == ".bmp" || extension == ".tga" || extension == ".tif" || extension == ".tiff";
+}
+
+int main(int argc, char** argv)
+{
+	std::string input = argc > 1 ? argv[1] : "res/Images";
+	std::string formatName = argc > 2 ? argv[2] : "auto";
+	if ( formatName != "auto" && formatName != "bc1" && formatName != "bc3" && formatName != "bc7" )
+	{
+		std::cout << "usage: Clockwork_TextureCooker [image or folder = res/Images] [auto|bc1|bc3|bc7 = auto]" << std::endl;
+		return 1;
+	}
+
+	std::vector<std::string> imagePaths;
+	if ( filesystem::is_directory(input) )
+	{
+		for ( const auto& entry : filesystem::recursive_directory_iterator(input) )
+		{
+			if ( filesystem::is_regular_file(entry.path()) && isImage(entry.path()) )
+				imagePaths.push_back(entry.path().string());
+		}
+	}
+	else if ( filesystem::is_regular_file(input) )
+		imagePaths.push_back(input);
+	if ( imagePaths.empty() )
+	{
+		std::cout << "no images found at " << input << std::endl;
+		return 1;
+	}
+
+	FreeImage_Initialise(false);
+	unsigned int failed = 0;
+	for ( const auto& imagePath : imagePaths )
+	{
+		std::string cookedPath = utils::CookedTexture::getCookedPath(imagePath);
+		bool cooked;
+		if ( formatName == "bc1" )
+			cooked = utils::cookTexture(imagePath, cookedPath, utils::BlockFormat::BC1);
+		else if ( formatName == "bc3" )
+			cooked = utils::cookTexture(imagePath, cookedPath, utils::BlockFormat::BC3);
+		else if ( formatName == "bc7" )
+			cooked = utils::cookTexture(imagePath, cookedPath, utils::BlockFormat::BC7);
+		else
+			cooked = utils::cookTexture(imagePath, cookedPath);
+		if ( cooked )
+			std::cout << "cooked " << imagePath << " -> " << cookedPath << " (" << filesystem::file_size(imagePath) << " -> " << filesystem::file_size(cookedPath) << " bytes)" << std::endl;
+		else
+		{
+			std::cout << "failed to cook " << imagePath << std::endl;
+			++failed;
+		}
+	}
+	FreeImage_DeInitialise();
+	std::cout << imagePaths.size() - failed << " of " << imagePaths.size() << " images cooked" << std::endl;
+	return failed == 0 ? 0 : 1;
+}